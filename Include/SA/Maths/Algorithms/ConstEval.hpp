@@ -0,0 +1,131 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_CONST_EVAL_GUARD
+#define SAPPHIRE_MATHS_CONST_EVAL_GUARD
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+*	\file ConstEval.hpp
+*
+*	\brief <b>Compile-time evaluation</b> helpers.
+*
+*	std:: maths functions are not constexpr: Sqrt, Sin, Cos, Tan and SinCos switch to
+*	constexpr implementations when evaluated in a constant expression (Intl::IsConstantEvaluated())
+*	and keep std:: at runtime.
+*
+*	\ingroup Maths_Algorithms
+*	\{
+*/
+
+
+/**
+*	\def SA_MATHS_CONSTEXPR_MATHS
+*
+*	\brief Whether Sqrt, Sin, Cos, Tan and SinCos can be evaluated at compile time.
+*
+*	Requires std::is_constant_evaluated (C++20) or the compiler builtin (GCC 9, Clang 9, MSVC 19.25).
+*/
+
+#if defined(__cpp_lib_is_constant_evaluated)
+
+	#define SA_MATHS_CONSTEXPR_MATHS 1
+	#define SA_MATHS_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+
+	#define SA_MATHS_CONSTEXPR_MATHS 1
+	#define SA_MATHS_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+
+#else
+
+	#define SA_MATHS_CONSTEXPR_MATHS 0
+	#define SA_MATHS_IS_CONSTANT_EVALUATED() false
+
+#endif
+
+
+namespace SA
+{
+	/// \cond Internal
+
+	namespace Intl
+	{
+		/// Whether the call is evaluated in a constant expression. Always false without SA_MATHS_CONSTEXPR_MATHS.
+		constexpr bool IsConstantEvaluated() noexcept
+		{
+			return SA_MATHS_IS_CONSTANT_EVALUATED();
+		}
+
+		/// Constexpr std::floor for |_in| < 2^63.
+		template <typename T>
+		constexpr T ConstexprFloor(T _in) noexcept
+		{
+			const T trunc = static_cast<T>(static_cast<int64_t>(_in));
+
+			return trunc > _in ? trunc - T(1) : trunc;
+		}
+
+		/**
+		*	\brief Constexpr std::sqrt (Newton-Raphson), max error: 1 ulp.
+		*
+		*	Input is scaled by powers of 4 to [0.25, 4): exact scaling of the result by powers of 2.
+		*/
+		template <typename T>
+		constexpr T ConstexprSqrt(T _in) noexcept
+		{
+			if (_in != _in || _in == T(0) || _in == std::numeric_limits<T>::infinity())
+				return _in;
+
+			if (_in < T(0))
+				return std::numeric_limits<T>::quiet_NaN();
+
+			T m = _in;
+			T scale = T(1);
+
+			while (m >= T(4))
+			{
+				m *= T(0.25);
+				scale *= T(2);
+			}
+
+			while (m < T(0.25))
+			{
+				m *= T(4);
+				scale *= T(0.5);
+			}
+
+			// Decreasing from above after the first step: stop on first non-decreasing step.
+			T res = (m + T(1)) * T(0.5);
+
+			while (true)
+			{
+				const T next = (res + m / res) * T(0.5);
+
+				if (next >= res)
+					break;
+
+				res = next;
+			}
+
+			return res * scale;
+		}
+	}
+
+	/// \endcond
+}
+
+
+/**
+*	\example ConstEvalTests.cpp
+*	Examples and Unitary Tests for compile-time evaluation.
+*/
+
+
+/** \} */
+
+#endif // GUARD
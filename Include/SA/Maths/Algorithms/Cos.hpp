@@ -6,6 +6,7 @@
 #define SAPPHIRE_MATHS_COS_GUARD
 
 #include <SA/Maths/Angle/Radian.hpp>
+#include <SA/Maths/Algorithms/TrigPrecision.hpp>
 
 /**
 *	\file Cos.hpp
@@ -24,6 +25,8 @@ namespace SA
 		/**
 		*	\brief \e Compute the \b cosine of the input.
 		*
+		*	TrigPrecision::High polynomial in constant expressions (see SA_MATHS_CONSTEXPR_MATHS).
+		*
 		*	\param[in] _in	Input in radian to compute cosine.
 		*
 		*	\return Cosine of the input.
@@ -31,10 +34,45 @@ namespace SA
 		template <typename T>
 		constexpr T Cos(Rad<T> _in) noexcept
 		{
+			if (Intl::IsConstantEvaluated())
+				return static_cast<T>(Intl::TrigCos<TrigPrecision::High>(static_cast<double>(_in.Handle())));
+
 			return std::cos(_in.Handle());
 		}
 
 
+		/**
+		*	\brief \e Compute the \b cosine of the input with a polynomial approximation.
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Input in radian to compute cosine.
+		*
+		*	\return Approximated cosine of the input.
+		*/
+		template <TrigPrecision precision, typename T>
+		constexpr T Cos(Rad<T> _in) noexcept
+		{
+			return Intl::TrigCos<precision>(_in.Handle());
+		}
+
+		/**
+		*	\brief \e Compute the \b cosine of an array of inputs with a polynomial approximation.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX).
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Inputs in radian.
+		*	\param[out] _out	Output cosines. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <TrigPrecision precision, typename T>
+		void CosBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = Cos<precision>(Rad<T>(_in[i]));
+		}
+
+
 		/**
 		*	\brief \e Compute the \b arc-cosine of the input.
 		*
@@ -47,6 +85,62 @@ namespace SA
 		{
 			return std::acos(_in);
 		}
+
+		/**
+		*	\brief \e Compute the \b arc-cosine of an array of inputs.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX), max error: 4 ulp.
+		*
+		*	\param[in] _in		Inputs.
+		*	\param[out] _out	Output arc-cosines in radian. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <typename T>
+		void ACosBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = std::acos(_in[i]);
+		}
+
+
+		/// \cond Internal
+
+#if SA_MATHS_TRIGONOMETRY_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void CosBatch<TrigPrecision::Low, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void CosBatch<TrigPrecision::Medium, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void CosBatch<TrigPrecision::High, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+
+		template <>
+		void CosBatch<TrigPrecision::Low, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+		template <>
+		void CosBatch<TrigPrecision::Medium, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+		template <>
+		void CosBatch<TrigPrecision::High, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+#endif
+
+
+#if SA_MATHS_TRANSCENDENTAL_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void ACosBatch<float>(const float* _in, float* _out, size_t _num) noexcept;
+
+
+		template <>
+		void ACosBatch<double>(const double* _in, double* _out, size_t _num) noexcept;
+
+#endif
+
+		/// \endcond
 	}
 }
 
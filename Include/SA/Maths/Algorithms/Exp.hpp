@@ -0,0 +1,87 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_EXP_GUARD
+#define SAPPHIRE_MATHS_EXP_GUARD
+
+#include <cmath>
+#include <cstddef>
+
+#include <SA/Maths/Config.hpp>
+
+#if SA_MATHS_INTRINSICS_OPT
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+*	\file Exp.hpp
+*
+*	\brief \b Exponential method implementation.
+*
+*	\ingroup Maths_Algorithms
+*	\{
+*/
+
+
+namespace SA
+{
+	namespace Maths
+	{
+		/**
+		*	\brief \e Compute the \b exponential of the input.
+		*
+		*	\param[in] _in	Input to compute exponential.
+		*
+		*	\return e raised to the power of the input.
+		*/
+		template <typename T>
+		T Exp(T _in) noexcept
+		{
+			return std::exp(_in);
+		}
+
+		/**
+		*	\brief \e Compute the \b exponential of an array of inputs.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX), max error: 1 ulp (float), 2 ulp (double).
+		*
+		*	\param[in] _in		Inputs.
+		*	\param[out] _out	Outputs. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <typename T>
+		void ExpBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = std::exp(_in[i]);
+		}
+
+
+		/// \cond Internal
+
+#if SA_MATHS_TRANSCENDENTAL_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void ExpBatch<float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void ExpBatch<double>(const double* _in, double* _out, size_t _num) noexcept;
+
+#endif
+
+		/// \endcond
+	}
+}
+
+/**
+*	\example TranscendentalTests.cpp
+*	Examples and Unitary Tests for Exp.
+*/
+
+
+/** \} */
+
+#endif // GUARD
@@ -0,0 +1,199 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_INV_SQRT_GUARD
+#define SAPPHIRE_MATHS_INV_SQRT_GUARD
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#if SA_MATHS_INTRINSICS_OPT
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+*	\file InvSqrt.hpp
+*
+*	\brief <b>Inverse Square Root</b> algorithm implementation.
+*
+*	\ingroup Maths_Algorithms
+*	\{
+*/
+
+
+namespace SA
+{
+	namespace Maths
+	{
+		/**
+		*	Precision of InvSqrt.
+		*
+		*	Max relative errors:
+		*
+		*	| Precision | InvSqrt float / double | InvSqrtBatch float (SSE / AVX) |
+		*	| --------- | ---------------------- | ------------------------------ |
+		*	| Exact     | 1 / sqrt               | 1 / sqrt                       |
+		*	| Newton    | 4.7e-6                 | 2.5e-7                         |
+		*	| Raw       | 1.8e-3                 | 3.3e-4                         |
+		*
+		*	Raw is the cheapest estimate of each path, not an unrefined one:
+		*	- InvSqrt (float / double) and double InvSqrtBatch: bit-level estimate (0x5f3759df) + 1 Newton-Raphson iteration.
+		*	- float InvSqrtBatch: rsqrt instruction only (12 bits).
+		*	Newton adds one more Newton-Raphson iteration to Raw.
+		*/
+		enum class InvSqrtPrecision : uint8_t
+		{
+			/// 1 / std::sqrt.
+			Exact,
+
+			/// Raw result refined by one more Newton-Raphson iteration.
+			Newton,
+
+			/// Cheapest estimate: bit-level estimate + 1 Newton-Raphson iteration (float batches: rsqrt instruction only).
+			Raw,
+		};
+	}
+
+
+	/// \cond Internal
+
+	namespace Intl
+	{
+		/// Bit-level estimate constants (see Lomont, "Fast inverse square root").
+		template <typename T>
+		struct InvSqrtMagic;
+
+		template <>
+		struct InvSqrtMagic<float>
+		{
+			using Bits = uint32_t;
+			static constexpr Bits value = 0x5f3759dfu;
+		};
+
+		template <>
+		struct InvSqrtMagic<double>
+		{
+			using Bits = uint64_t;
+			static constexpr Bits value = 0x5fe6eb50c7b537a9ull;
+		};
+
+
+		/// One Newton-Raphson step of y = 1 / sqrt(_in).
+		template <typename T>
+		T InvSqrtNewtonStep(T _in, T _y) noexcept
+		{
+			return _y * (T(1.5) - T(0.5) * _in * _y * _y);
+		}
+
+		/// Bit-level estimate refined once: ~1.8e-3 max relative error.
+		template <typename T>
+		T InvSqrtEstimate(T _in) noexcept
+		{
+			using Bits = typename InvSqrtMagic<T>::Bits;
+
+			Bits bits;
+			std::memcpy(&bits, &_in, sizeof(T));
+
+			bits = InvSqrtMagic<T>::value - (bits >> 1);
+
+			T y;
+			std::memcpy(&y, &bits, sizeof(T));
+
+			return InvSqrtNewtonStep(_in, y);
+		}
+	}
+
+	/// \endcond
+
+
+	namespace Maths
+	{
+		/**
+		*	\brief \e Compute the <b> inverse square root </b> of the input.
+		*
+		*	\tparam T			Input Type.
+		*	\tparam precision	Precision (see InvSqrtPrecision).
+		*
+		*	\param[in] _in	Input to compute inverse square root. Must be > 0.
+		*
+		*	\return 1 / sqrt(_in).
+		*/
+		template <typename T, InvSqrtPrecision precision = InvSqrtPrecision::Exact>
+		T InvSqrt(T _in)
+		{
+			SA_ASSERT((Default, _in > T(0)), SA.Maths, (L"Compute inverse square root of non-positive number: [%1]", _in));
+
+			if constexpr (precision == InvSqrtPrecision::Exact)
+				return T(1) / std::sqrt(_in);
+			else if constexpr (precision == InvSqrtPrecision::Newton)
+				return Intl::InvSqrtNewtonStep(_in, Intl::InvSqrtEstimate(_in));
+			else
+				return Intl::InvSqrtEstimate(_in);
+		}
+
+		/**
+		*	\brief \e Compute the <b> inverse square root </b> of an array of inputs.
+		*
+		*	SIMD implementation computes one input per lane (SSE / AVX).
+		*
+		*	\tparam T			Input Type.
+		*	\tparam precision	Precision (see InvSqrtPrecision).
+		*
+		*	\param[in] _in		Inputs. Must be > 0.
+		*	\param[out] _out	Outputs. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <typename T, InvSqrtPrecision precision = InvSqrtPrecision::Exact>
+		void InvSqrtBatch(const T* _in, T* _out, size_t _num)
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = InvSqrt<T, precision>(_in[i]);
+		}
+
+
+		/// \cond Internal
+
+#if SA_MATHS_INV_SQRT_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void InvSqrtBatch<float, InvSqrtPrecision::Exact>(const float* _in, float* _out, size_t _num);
+
+		template <>
+		void InvSqrtBatch<float, InvSqrtPrecision::Newton>(const float* _in, float* _out, size_t _num);
+
+		template <>
+		void InvSqrtBatch<float, InvSqrtPrecision::Raw>(const float* _in, float* _out, size_t _num);
+
+
+		template <>
+		void InvSqrtBatch<double, InvSqrtPrecision::Exact>(const double* _in, double* _out, size_t _num);
+
+		template <>
+		void InvSqrtBatch<double, InvSqrtPrecision::Newton>(const double* _in, double* _out, size_t _num);
+
+		template <>
+		void InvSqrtBatch<double, InvSqrtPrecision::Raw>(const double* _in, double* _out, size_t _num);
+
+#endif
+
+		/// \endcond
+	}
+}
+
+/**
+*	\example InvSqrtTests.cpp
+*	Examples and Unitary Tests for InvSqrt.
+*/
+
+
+/** \} */
+
+#endif // GUARD
@@ -5,12 +5,14 @@
 #ifndef SAPPHIRE_MATHS_LERP_GUARD
 #define SAPPHIRE_MATHS_LERP_GUARD
 
+#include <cstdint>
 #include <algorithm>
 
 #include <SA/Maths/Debug.hpp>
 
 #include <SA/Maths/Algorithms/Cos.hpp>
 #include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/SinCos.hpp>
 
 /**
 *	\file Lerp.hpp
@@ -26,6 +28,26 @@ namespace SA
 {
 	namespace Maths
 	{
+		/**
+		*	\brief Precision of batched SLerp (Quat::SLerpBatch).
+		*
+		*	Max absolute error of result components against exact slerp (_alpha in [0, 1], shortest path):
+		*
+		*	| Precision | float  | double |
+		*	| --------- | ------ | ------ |
+		*	| Exact     | 2e-7   | 5e-16  |
+		*	| Approx    | 3e-5   | 3e-5   |
+		*/
+		enum class SLerpPrecision : uint8_t
+		{
+			/// Type precision: angle from the atan of the half chord, accurate for close quaternions.
+			Exact,
+
+			/// Eberly polynomial in cos(angle): no trigonometry nor square root.
+			Approx,
+		};
+
+
 		/**
 		*	\brief <b> Unclamped Lerp </b> from _start to _end at _alpha.
 		*
@@ -115,10 +137,12 @@ namespace SA
 			// Current sin.
 			TScalar sin = Sin(angle);
 
+			const SinCosResult<TScalar> step = SinCos(angleStep);
+
 			// Sin Step ratio.
-			TScalar sinRatio = Sin(angleStep) / sin;
+			TScalar sinRatio = step.sin / sin;
 
-			TScalar s0 = Cos(angleStep) - dot * sinRatio;
+			TScalar s0 = step.cos - dot * sinRatio;
 
 			return s0 * _start + sinRatio * _end * endSign;
 		}
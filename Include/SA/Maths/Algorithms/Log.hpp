@@ -0,0 +1,87 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_LOG_GUARD
+#define SAPPHIRE_MATHS_LOG_GUARD
+
+#include <cmath>
+#include <cstddef>
+
+#include <SA/Maths/Config.hpp>
+
+#if SA_MATHS_INTRINSICS_OPT
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+*	\file Log.hpp
+*
+*	\brief \b Natural logarithm method implementation.
+*
+*	\ingroup Maths_Algorithms
+*	\{
+*/
+
+
+namespace SA
+{
+	namespace Maths
+	{
+		/**
+		*	\brief \e Compute the \b natural logarithm of the input.
+		*
+		*	\param[in] _in	Input to compute natural logarithm.
+		*
+		*	\return Natural logarithm of the input.
+		*/
+		template <typename T>
+		T Log(T _in) noexcept
+		{
+			return std::log(_in);
+		}
+
+		/**
+		*	\brief \e Compute the \b natural logarithm of an array of inputs.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX), max error: 1 ulp.
+		*
+		*	\param[in] _in		Inputs.
+		*	\param[out] _out	Outputs. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <typename T>
+		void LogBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = std::log(_in[i]);
+		}
+
+
+		/// \cond Internal
+
+#if SA_MATHS_TRANSCENDENTAL_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void LogBatch<float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void LogBatch<double>(const double* _in, double* _out, size_t _num) noexcept;
+
+#endif
+
+		/// \endcond
+	}
+}
+
+/**
+*	\example TranscendentalTests.cpp
+*	Examples and Unitary Tests for Log.
+*/
+
+
+/** \} */
+
+#endif // GUARD
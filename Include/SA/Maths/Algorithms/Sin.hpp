@@ -6,6 +6,7 @@
 #define SAPPHIRE_MATHS_SIN_GUARD
 
 #include <SA/Maths/Angle/Radian.hpp>
+#include <SA/Maths/Algorithms/TrigPrecision.hpp>
 
 /**
 *	\file Sin.hpp
@@ -24,6 +25,8 @@ namespace SA
 		/**
 		*	\brief \e Compute the \b sine of the input.
 		*
+		*	TrigPrecision::High polynomial in constant expressions (see SA_MATHS_CONSTEXPR_MATHS).
+		*
 		*	\param[in] _in	Input in radian to compute sine.
 		*
 		*	\return Sine of the input.
@@ -31,9 +34,44 @@ namespace SA
 		template <typename T>
 		constexpr T Sin(Rad<T> _in) noexcept
 		{
+			if (Intl::IsConstantEvaluated())
+				return static_cast<T>(Intl::TrigSin<TrigPrecision::High>(static_cast<double>(_in.Handle())));
+
 			return std::sin(_in.Handle());
 		}
 
+
+		/**
+		*	\brief \e Compute the \b sine of the input with a polynomial approximation.
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Input in radian to compute sine.
+		*
+		*	\return Approximated sine of the input.
+		*/
+		template <TrigPrecision precision, typename T>
+		constexpr T Sin(Rad<T> _in) noexcept
+		{
+			return Intl::TrigSin<precision>(_in.Handle());
+		}
+
+		/**
+		*	\brief \e Compute the \b sine of an array of inputs with a polynomial approximation.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX).
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Inputs in radian.
+		*	\param[out] _out	Output sines. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <TrigPrecision precision, typename T>
+		void SinBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = Sin<precision>(Rad<T>(_in[i]));
+		}
+
 		/**
 		*	\brief \e Compute the \b arc-sine of the input.
 		*
@@ -46,6 +84,62 @@ namespace SA
 		{
 			return std::asin(_in);
 		}
+
+		/**
+		*	\brief \e Compute the \b arc-sine of an array of inputs.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX), max error: 4 ulp.
+		*
+		*	\param[in] _in		Inputs.
+		*	\param[out] _out	Output arc-sines in radian. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <typename T>
+		void ASinBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = std::asin(_in[i]);
+		}
+
+
+		/// \cond Internal
+
+#if SA_MATHS_TRIGONOMETRY_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void SinBatch<TrigPrecision::Low, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void SinBatch<TrigPrecision::Medium, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void SinBatch<TrigPrecision::High, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+
+		template <>
+		void SinBatch<TrigPrecision::Low, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+		template <>
+		void SinBatch<TrigPrecision::Medium, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+		template <>
+		void SinBatch<TrigPrecision::High, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+#endif
+
+
+#if SA_MATHS_TRANSCENDENTAL_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void ASinBatch<float>(const float* _in, float* _out, size_t _num) noexcept;
+
+
+		template <>
+		void ASinBatch<double>(const double* _in, double* _out, size_t _num) noexcept;
+
+#endif
+
+		/// \endcond
 	}
 }
 
@@ -0,0 +1,155 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_SIN_COS_GUARD
+#define SAPPHIRE_MATHS_SIN_COS_GUARD
+
+#include <SA/Maths/Angle/Radian.hpp>
+#include <SA/Maths/Algorithms/TrigPrecision.hpp>
+
+/**
+*	\file SinCos.hpp
+*
+*	\brief <b>Sine and cosine</b> method implementation.
+*
+*	\ingroup Maths_Algorithms
+*	\{
+*/
+
+
+namespace SA
+{
+	namespace Maths
+	{
+		/// Sine and cosine of the same angle.
+		template <typename T>
+		struct SinCosResult
+		{
+			/// Sine of the angle.
+			T sin = T(0);
+
+			/// Cosine of the angle.
+			T cos = T(1);
+		};
+
+
+		/**
+		*	\brief \e Compute the \b sine and \b cosine of the input.
+		*
+		*	std::sin and std::cos of the same argument are merged by the compiler in a single
+		*	sincos call (shared range reduction): same results as Sin() and Cos().
+		*
+		*	TrigPrecision::High polynomial in constant expressions (see SA_MATHS_CONSTEXPR_MATHS).
+		*
+		*	\param[in] _in	Input in radian.
+		*
+		*	\return Sine and cosine of the input.
+		*/
+		template <typename T>
+		constexpr SinCosResult<T> SinCos(Rad<T> _in) noexcept
+		{
+			if (Intl::IsConstantEvaluated())
+			{
+				const double in = static_cast<double>(_in.Handle());
+
+				return SinCosResult<T>{ static_cast<T>(Intl::TrigSin<TrigPrecision::High>(in)), static_cast<T>(Intl::TrigCos<TrigPrecision::High>(in)) };
+			}
+
+			const T in = _in.Handle();
+
+			return SinCosResult<T>{ std::sin(in), std::cos(in) };
+		}
+
+		/**
+		*	\brief \e Compute the \b sine and \b cosine of the input with a polynomial approximation.
+		*
+		*	Single range reduction and polynomial evaluation for both results.
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Input in radian.
+		*
+		*	\return Approximated sine and cosine of the input.
+		*/
+		template <TrigPrecision precision, typename T>
+		constexpr SinCosResult<T> SinCos(Rad<T> _in) noexcept
+		{
+			T s = T(0);
+			T c = T(1);
+			const int64_t k = Intl::TrigSinCosReduced<precision>(_in.Handle(), s, c);
+
+			// sin(k * Pi / 2 + r): sin(r), cos(r), -sin(r), -cos(r).
+			// cos(k * Pi / 2 + r): cos(r), -sin(r), -cos(r), sin(r).
+			SinCosResult<T> res{ (k & 1) ? c : s, (k & 1) ? s : c };
+
+			if (k & 2)
+				res.sin = -res.sin;
+
+			if ((k + 1) & 2)
+				res.cos = -res.cos;
+
+			return res;
+		}
+
+		/**
+		*	\brief \e Compute the \b sine and \b cosine of an array of inputs with a polynomial approximation.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX).
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Inputs in radian.
+		*	\param[out] _sin	Output sines. Can be _in.
+		*	\param[out] _cos	Output cosines.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <TrigPrecision precision, typename T>
+		void SinCosBatch(const T* _in, T* _sin, T* _cos, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+			{
+				const SinCosResult<T> res = SinCos<precision>(Rad<T>(_in[i]));
+
+				_sin[i] = res.sin;
+				_cos[i] = res.cos;
+			}
+		}
+
+
+		/// \cond Internal
+
+#if SA_MATHS_TRIGONOMETRY_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void SinCosBatch<TrigPrecision::Low, float>(const float* _in, float* _sin, float* _cos, size_t _num) noexcept;
+
+		template <>
+		void SinCosBatch<TrigPrecision::Medium, float>(const float* _in, float* _sin, float* _cos, size_t _num) noexcept;
+
+		template <>
+		void SinCosBatch<TrigPrecision::High, float>(const float* _in, float* _sin, float* _cos, size_t _num) noexcept;
+
+
+		template <>
+		void SinCosBatch<TrigPrecision::Low, double>(const double* _in, double* _sin, double* _cos, size_t _num) noexcept;
+
+		template <>
+		void SinCosBatch<TrigPrecision::Medium, double>(const double* _in, double* _sin, double* _cos, size_t _num) noexcept;
+
+		template <>
+		void SinCosBatch<TrigPrecision::High, double>(const double* _in, double* _sin, double* _cos, size_t _num) noexcept;
+
+#endif
+
+		/// \endcond
+	}
+}
+
+/**
+*	\example SinCosTests.cpp
+*	Examples and Unitary Tests for SinCos.
+*/
+
+
+/** \} */
+
+#endif // GUARD
@@ -8,6 +8,7 @@
 #include <cmath>
 
 #include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Algorithms/ConstEval.hpp>
 
 /**
 *	\file Sqrt.hpp
@@ -26,6 +27,8 @@ namespace SA
 		/**
 		*	\brief \e Compute the <b> square root </b> of the input as float.
 		*
+		*	Constexpr implementation in constant expressions (see SA_MATHS_CONSTEXPR_MATHS).
+		*
 		*	\tparam T		Input Type.
 		* 
 		*	\param[in] _in	Input to compute square root.
@@ -33,8 +36,11 @@ namespace SA
 		*	\return Square Root of the input.
 		*/
 		template <typename T>
-		T Sqrt(T _in)
+		constexpr T Sqrt(T _in)
 		{
+			if (Intl::IsConstantEvaluated())
+				return Intl::ConstexprSqrt(_in);
+
 			SA_ASSERT((Default, _in >= T(0)), SA.Maths, (L"Compute square root of negative number: [%1]", _in));
 
 			return std::sqrt(_in);
@@ -6,6 +6,7 @@
 #define SAPPHIRE_MATHS_TAN_GUARD
 
 #include <SA/Maths/Angle/Radian.hpp>
+#include <SA/Maths/Algorithms/TrigPrecision.hpp>
 
 /**
 *	\file Tan.hpp
@@ -24,6 +25,8 @@ namespace SA
 		/**
 		*	\brief \e Compute the \b tangent of the input.
 		*
+		*	TrigPrecision::High polynomial in constant expressions (see SA_MATHS_CONSTEXPR_MATHS).
+		*
 		*	\param[in] _in	Input in radian to compute tangent.
 		*
 		*	\return Tangent of the input.
@@ -31,9 +34,44 @@ namespace SA
 		template <typename T>
 		constexpr T Tan(Rad<T> _in) noexcept
 		{
+			if (Intl::IsConstantEvaluated())
+				return static_cast<T>(Intl::TrigTan<TrigPrecision::High>(static_cast<double>(_in.Handle())));
+
 			return std::tan(_in.Handle());
 		}
 
+
+		/**
+		*	\brief \e Compute the \b tangent of the input with a polynomial approximation.
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Input in radian to compute tangent.
+		*
+		*	\return Approximated tangent of the input.
+		*/
+		template <TrigPrecision precision, typename T>
+		constexpr T Tan(Rad<T> _in) noexcept
+		{
+			return Intl::TrigTan<precision>(_in.Handle());
+		}
+
+		/**
+		*	\brief \e Compute the \b tangent of an array of inputs with a polynomial approximation.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX).
+		*
+		*	\tparam precision	Precision tier (see TrigPrecision).
+		*	\param[in] _in		Inputs in radian.
+		*	\param[out] _out	Output tangents. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <TrigPrecision precision, typename T>
+		void TanBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = Tan<precision>(Rad<T>(_in[i]));
+		}
+
 		/**
 		*	\brief \e Compute the \b arc-tangent of the input.
 		*
@@ -47,6 +85,22 @@ namespace SA
 			return std::atan(_in);
 		}
 
+		/**
+		*	\brief \e Compute the \b arc-tangent of an array of inputs.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX), max error: 3 ulp.
+		*
+		*	\param[in] _in		Inputs.
+		*	\param[out] _out	Output arc-tangents in radian. Can be _in.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <typename T>
+		void ATanBatch(const T* _in, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = std::atan(_in[i]);
+		}
+
 
 		/**
 		*	\brief \e Compute the \b arc-tangent 2 of _y / _x.
@@ -61,6 +115,70 @@ namespace SA
 		{
 			return std::atan2(_y, _x);
 		}
+
+		/**
+		*	\brief \e Compute the \b arc-tangent 2 of arrays of _y / _x.
+		*
+		*	SIMD implementation computes one input per lane (SSE4.1 / AVX), max error: 3 ulp.
+		*	Finite inputs only. atan2(y, -0) returns atan2(y, +0).
+		*
+		*	\param[in] _y		Y terms.
+		*	\param[in] _x		X terms.
+		*	\param[out] _out	Output arc-tangents 2 in radian. Can be _y or _x.
+		*	\param[in] _num		Number of inputs.
+		*/
+		template <typename T>
+		void ATan2Batch(const T* _y, const T* _x, T* _out, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+				_out[i] = std::atan2(_y[i], _x[i]);
+		}
+
+
+		/// \cond Internal
+
+#if SA_MATHS_TRIGONOMETRY_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void TanBatch<TrigPrecision::Low, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void TanBatch<TrigPrecision::Medium, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void TanBatch<TrigPrecision::High, float>(const float* _in, float* _out, size_t _num) noexcept;
+
+
+		template <>
+		void TanBatch<TrigPrecision::Low, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+		template <>
+		void TanBatch<TrigPrecision::Medium, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+		template <>
+		void TanBatch<TrigPrecision::High, double>(const double* _in, double* _out, size_t _num) noexcept;
+
+#endif
+
+
+#if SA_MATHS_TRANSCENDENTAL_SIMD && SA_INTRISC_SSE
+
+		template <>
+		void ATanBatch<float>(const float* _in, float* _out, size_t _num) noexcept;
+
+		template <>
+		void ATan2Batch<float>(const float* _y, const float* _x, float* _out, size_t _num) noexcept;
+
+
+		template <>
+		void ATanBatch<double>(const double* _in, double* _out, size_t _num) noexcept;
+
+		template <>
+		void ATan2Batch<double>(const double* _y, const double* _x, double* _out, size_t _num) noexcept;
+
+#endif
+
+		/// \endcond
 	}
 }
 
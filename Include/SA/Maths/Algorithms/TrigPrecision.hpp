@@ -0,0 +1,228 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_TRIG_PRECISION_GUARD
+#define SAPPHIRE_MATHS_TRIG_PRECISION_GUARD
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <SA/Maths/Config.hpp>
+#include <SA/Maths/Algorithms/ConstEval.hpp>
+
+#if SA_MATHS_INTRINSICS_OPT
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+*	\file TrigPrecision.hpp
+*
+*	\brief <b>Polynomial trigonometry</b> precision tiers.
+*
+*	Sin, Cos and Tan with a TrigPrecision policy (Maths::Sin<TrigPrecision::Low>(angle))
+*	use minimax polynomials instead of std:: functions:
+*	- range reduction to r in [-Pi/4, Pi/4] with k = round(x * 2 / Pi) (Cody-Waite: Pi / 2 split in 2 or 3 constants).
+*	- sin(r) = r + r^3 * P(r^2), cos(r) = 1 + r^2 * Q(r^2).
+*	- quadrant (k mod 4) selects and signs sin(r) or cos(r), tan = sin / cos.
+*
+*	Max absolute error of sin and cos for |x| <= 1e4 (TrigBenchmark.cpp):
+*
+*	| Precision | Orders (sin / cos)        | float   | double  |
+*	| --------- | ------------------------- | ------- | ------- |
+*	| Low       | 3 / 2                     | 2.7e-3  | 2.7e-3  |
+*	| Medium    | 5 / 4                     | 1.3e-5  | 1.3e-5  |
+*	| High      | 7 / 8 (float), 13 / 14    | 6.9e-8  | 1.1e-16 |
+*
+*	Results are not correctly rounded and precision degrades for large inputs (range reduction).
+*
+*	All functions are constexpr: Sin, Cos, Tan and SinCos without precision use High (computed in double)
+*	in constant expressions (see SA_MATHS_CONSTEXPR_MATHS).
+*
+*	\ingroup Maths_Algorithms
+*	\{
+*/
+
+
+namespace SA
+{
+	namespace Maths
+	{
+		/// Precision tier of polynomial trigonometry functions.
+		enum class TrigPrecision : uint8_t
+		{
+			/// ~3e-3 max absolute error: 3rd order sine, 2nd order cosine.
+			Low,
+
+			/// ~1e-5 max absolute error: 5th order sine, 4th order cosine.
+			Medium,
+
+			/// Type precision: 7th / 8th order (float), 13th / 14th order (double).
+			High,
+		};
+	}
+
+
+	/// \cond Internal
+
+	namespace Intl
+	{
+		/**
+		*	\brief Minimax coefficients on [-Pi/4, Pi/4], lowest order first.
+		*
+		*	sinCoeffs: sin(r) = r + r^3 * P(r^2).
+		*	cosCoeffs: cos(r) = 1 + r^2 * Q(r^2).
+		*/
+		template <typename T, Maths::TrigPrecision precision>
+		struct TrigCoefficients;
+
+		template <typename T>
+		struct TrigCoefficients<T, Maths::TrigPrecision::Low>
+		{
+			static constexpr T sinCoeffs[] = { T(-1.622591282121025e-1) };
+			static constexpr T cosCoeffs[] = { T(-4.7910383797173967e-1) };
+		};
+
+		template <typename T>
+		struct TrigCoefficients<T, Maths::TrigPrecision::Medium>
+		{
+			static constexpr T sinCoeffs[] = { T(-1.6662940017463027e-1), T(8.151570955246242e-3) };
+			static constexpr T cosCoeffs[] = { T(-4.9977630707473647e-1), T(4.0488935841449594e-2) };
+		};
+
+		template <>
+		struct TrigCoefficients<float, Maths::TrigPrecision::High>
+		{
+			static constexpr float sinCoeffs[] = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+			static constexpr float cosCoeffs[] = { -0.5f, 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+		};
+
+		template <>
+		struct TrigCoefficients<double, Maths::TrigPrecision::High>
+		{
+			static constexpr double sinCoeffs[] = {
+				-1.66666666666666307295e-1, 8.33333333332211858878e-3, -1.98412698295895385996e-4,
+				2.75573136213857245213e-6, -2.50507477628578072866e-8, 1.58962301576546568060e-10
+			};
+
+			static constexpr double cosCoeffs[] = {
+				-0.5, 4.16666666666665929218e-2, -1.38888888888730564116e-3, 2.48015872888517045348e-5,
+				-2.75573141792967388112e-7, 2.08757008419747316778e-9, -1.13585365213876817300e-11
+			};
+		};
+
+
+		/**
+		*	\brief Pi / 2 split in 3 constants (Cody-Waite reduction).
+		*	First constants have trailing zero bits: k * pio2[0] is exact for large k.
+		*/
+		template <typename T>
+		struct TrigReduction
+		{
+			static constexpr T pio2[] = { T(1.57079625129699707031), T(7.54978941586159635336e-8), T(5.39030285815811905290e-15) };
+		};
+
+		template <>
+		struct TrigReduction<float>
+		{
+			static constexpr float pio2[] = { 1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f };
+		};
+
+		/// 2 / Pi constant.
+		template <typename T>
+		constexpr T trigTwoOvPi = T(0.63661977236758134308);
+
+
+		/// Evaluate polynomial of _coeffs (lowest order first) at _t.
+		template <typename T, size_t N>
+		constexpr T TrigHorner(const T (&_coeffs)[N], T _t) noexcept
+		{
+			T res = _coeffs[N - 1];
+
+			for (size_t i = N - 1; i > 0; --i)
+				res = res * _t + _coeffs[i - 1];
+
+			return res;
+		}
+
+		/**
+		*	\brief Reduce _x and compute sine and cosine of the reduced angle.
+		*
+		*	\param[in] _x		Input angle in radian.
+		*	\param[out] _sin	sin(r), r in [-Pi/4, Pi/4].
+		*	\param[out] _cos	cos(r).
+		*
+		*	\return quadrant k (x = k * Pi / 2 + r).
+		*/
+		template <Maths::TrigPrecision precision, typename T>
+		constexpr int64_t TrigSinCosReduced(T _x, T& _sin, T& _cos) noexcept
+		{
+			using Coeffs = TrigCoefficients<T, precision>;
+			using Reduction = TrigReduction<T>;
+
+			const T k = IsConstantEvaluated() ? ConstexprFloor(_x * trigTwoOvPi<T> + T(0.5)) : std::floor(_x * trigTwoOvPi<T> + T(0.5));
+
+			T r = _x - k * Reduction::pio2[0];
+
+			if constexpr (precision == Maths::TrigPrecision::High)
+				r = (r - k * Reduction::pio2[1]) - k * Reduction::pio2[2];
+			else
+				r = r - k * (Reduction::pio2[1] + Reduction::pio2[2]);
+
+			const T t = r * r;
+
+			_sin = r + r * t * TrigHorner(Coeffs::sinCoeffs, t);
+			_cos = T(1) + t * TrigHorner(Coeffs::cosCoeffs, t);
+
+			return static_cast<int64_t>(k);
+		}
+
+
+		/// Sine from the quadrant k: sin(k * Pi / 2 + r) = sin(r), cos(r), -sin(r), -cos(r).
+		template <Maths::TrigPrecision precision, typename T>
+		constexpr T TrigSin(T _x) noexcept
+		{
+			T s = T(0);
+			T c = T(1);
+			const int64_t k = TrigSinCosReduced<precision>(_x, s, c);
+
+			const T res = (k & 1) ? c : s;
+
+			return (k & 2) ? -res : res;
+		}
+
+		/// Cosine from the quadrant k: cos(k * Pi / 2 + r) = cos(r), -sin(r), -cos(r), sin(r).
+		template <Maths::TrigPrecision precision, typename T>
+		constexpr T TrigCos(T _x) noexcept
+		{
+			T s = T(0);
+			T c = T(1);
+			const int64_t k = TrigSinCosReduced<precision>(_x, s, c);
+
+			const T res = (k & 1) ? s : c;
+
+			return ((k + 1) & 2) ? -res : res;
+		}
+
+		/// Tangent from the quadrant k: tan(k * Pi / 2 + r) = tan(r) or -1 / tan(r).
+		template <Maths::TrigPrecision precision, typename T>
+		constexpr T TrigTan(T _x) noexcept
+		{
+			T s = T(0);
+			T c = T(1);
+			const int64_t k = TrigSinCosReduced<precision>(_x, s, c);
+
+			return (k & 1) ? -c / s : s / c;
+		}
+	}
+
+	/// \endcond
+}
+
+
+/** \} */
+
+#endif // GUARD
@@ -56,6 +56,12 @@
 *	\ingroup Maths
 */
 
+/**
+*	\defgroup Maths_Dispatch Dispatch
+*	Sapphire Suite's Maths runtime CPU dispatch.
+*	\ingroup Maths
+*/
+
 
 /**
 *	Whether to use SIMD implementation for Quaternion.
@@ -77,6 +83,162 @@
 */
 #define SA_MATHS_MATRIX4_SIMD (0 || SA_CI) && SA_MATHS_INTRINSICS_OPT
 
+
+/**
+*	Whether to use SIMD implementation for Matrix4 batch operations (arrays of vectors or matrices).
+*	Default is enabled: matrix registers are loaded once and reused over the whole array.
+*/
+#define SA_MATHS_MATRIX4_BATCH_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use AVX-512F implementation for Matrix4 when available.
+*	Single matrix operations (with SA_MATHS_MATRIX4_SIMD): a float matrix fits in one zmm register, a double matrix in two.
+*	Batch kernels: used on AVX-512 targets (or hosts, with SA_MATHS_RUNTIME_DISPATCH).
+*/
+#define SA_MATHS_MATRIX4_AVX512 SA_MATHS_INTRINSICS_OPT
+
+
+/// Whether the compilation target supports AVX-512 Foundation instructions.
+#if defined(__AVX512F__)
+
+	#define SA_MATHS_INTRISC_AVX512 1
+
+#else
+
+	#define SA_MATHS_INTRISC_AVX512 0
+
+#endif
+
+
+/**
+*	Whether the compilation target supports FMA3 (fused multiply-add) instructions.
+*	Float SIMD matrix kernels use a single rounding for each a * b + c.
+*/
+#if !defined(SA_INTRISC_FMA)
+
+	#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+
+		#define SA_INTRISC_FMA 1
+
+	#else
+
+		#define SA_INTRISC_FMA 0
+
+	#endif
+
+#endif
+
+
+/**
+*	Whether to use SIMD implementation for Vec3Stream bulk operations.
+*	Default is enabled: Structure-Of-Arrays layout computes one vector per lane.
+*/
+#define SA_MATHS_VECTOR3_STREAM_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for Quaternion batch operations (Quat::NLerpBatch / SLerpBatch).
+*	Default is enabled: Structure-Of-Arrays inputs computes one quaternion per lane.
+*/
+#define SA_MATHS_QUATERNION_BATCH_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for QuatStream bulk operations.
+*	Default is enabled: Structure-Of-Arrays layout computes one quaternion per lane.
+*/
+#define SA_MATHS_QUATERNION_STREAM_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for polynomial trigonometry batches (SinBatch / CosBatch / TanBatch).
+*	Default is enabled: one input per lane, quadrant is selected with masks instead of branches.
+*	Selected at compile time only (SSE4.1 for 4 float and 2 double lanes, AVX for 8 float and 4 double lanes).
+*/
+#define SA_MATHS_TRIGONOMETRY_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for InvSqrtBatch.
+*	Default is enabled: float estimate uses the rsqrt instruction (SSE 4 lanes, AVX 8 lanes).
+*	double estimate uses integer operations on 2 lanes, refined on 4 lanes with AVX.
+*/
+#define SA_MATHS_INV_SQRT_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for transcendental batches (ACosBatch, ASinBatch, ATanBatch, ATan2Batch, ExpBatch, LogBatch).
+*	Default is enabled: one input per lane with polynomial / rational approximations instead of scalar libm calls.
+*	Selected at compile time only (SSE4.1 for 4 float and 2 double lanes, AVX for 8 float and 4 double lanes).
+*/
+#define SA_MATHS_TRANSCENDENTAL_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for Transform batch operations (TrTRSMatrixBatchFunctor).
+*	Default is enabled: Structure-Of-Arrays inputs computes one transform per lane.
+*/
+#define SA_MATHS_TRANSFORM_BATCH_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for AABB3DPack overlap tests.
+*	Default is enabled: one compare per axis bound tests a query against every lane.
+*	Selected at compile time only (SSE4.1 for 4 float lanes, AVX for 8 float and double lanes):
+*	calls are too small for runtime dispatch.
+*/
+#define SA_MATHS_AABB3D_PACK_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for AABB3D::TransformBatch (Arvo method).
+*	Default is enabled: center and extents of one box per iteration in a single register,
+*	matrix columns are kept in registers when a single matrix is used.
+*/
+#define SA_MATHS_AABB3D_TRANSFORM_BATCH_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for Ray3Pack packet intersections (slab and Moller-Trumbore).
+*	Default is enabled: one ray per lane against a single box or triangle.
+*	Selected at compile time only (SSE4.1 for 4 float lanes, AVX for 8 float and 4 double lanes).
+*/
+#define SA_MATHS_RAY3_PACK_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for Frustum batch culling (CullAABBs / CullSpheres).
+*	Default is enabled: the 6 planes are tested at once (AVX: one register, SSE4.1: two registers).
+*	Float only, selected at compile time.
+*/
+#define SA_MATHS_FRUSTUM_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for SpherePack overlap tests (sphere / sphere, sphere / AABB).
+*	Default is enabled: one sphere per lane against a single query volume.
+*	Selected at compile time only (SSE4.1 for 4 float lanes, AVX for 8 float and 4 double lanes).
+*/
+#define SA_MATHS_SPHERE_PACK_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether to use SIMD implementation for OBB3DPack SAT tests (OBB / OBB, OBB / AABB).
+*	Default is enabled: one box per lane, the 15 separating axes are tested for every lane at once.
+*	Selected at compile time only (SSE4.1 for 4 float lanes, AVX for 8 float and 4 double lanes).
+*/
+#define SA_MATHS_OBB3D_PACK_SIMD SA_MATHS_INTRINSICS_OPT
+
+
+/**
+*	Whether SIMD batch kernels are selected at runtime from the host CPU features.
+*	Set by CMake option SA_MATHS_RUNTIME_DISPATCH_OPT (requires SA_MATHS_INTRINSICS_OPT).
+*	Library is built for the baseline instruction set and each batch call uses the best
+*	kernel available on the running machine (SSE4.1, AVX2 + FMA or AVX-512).
+*/
+#define SA_MATHS_RUNTIME_DISPATCH SA_MATHS_RUNTIME_DISPATCH_OPT && SA_MATHS_INTRINSICS_OPT
+
 /** \} */
 
 #endif // GUARD
@@ -0,0 +1,78 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_CPU_FEATURES_GUARD
+#define SAPPHIRE_MATHS_CPU_FEATURES_GUARD
+
+#include <cstdint>
+
+#include <SA/Maths/Config.hpp>
+
+/**
+*	\file CPUFeatures.hpp
+*
+*	\brief <b>CPU features</b> detection for runtime kernel dispatch.
+*
+*	\ingroup Maths_Dispatch
+*	\{
+*/
+
+
+namespace SA
+{
+	namespace Maths
+	{
+		/// SIMD instruction set levels used for kernel dispatch (ordered).
+		enum class SIMDLevel : uint8_t
+		{
+			/// No SIMD kernel: plain C++ loops.
+			Scalar = 0,
+
+			/// SSE up to SSE4.1 (128 bits).
+			SSE41,
+
+			/// AVX, AVX2 and FMA3 (256 bits).
+			AVX2,
+
+			/// AVX-512 Foundation (512 bits).
+			AVX512,
+		};
+
+		/**
+		*	\brief Get the best SIMD level supported by the host CPU and OS.
+		*
+		*	CPUID (and XGETBV for OS register state support) is queried once, on first call.
+		*
+		*	\return host SIMD level.
+		*/
+		SIMDLevel GetHostSIMDLevel() noexcept;
+
+		/**
+		*	\brief Get the SIMD level currently used by batch kernels dispatch.
+		*
+		*	Default is GetHostSIMDLevel().
+		*	Only used when built with SA_MATHS_RUNTIME_DISPATCH: otherwise kernels are selected at compile time.
+		*
+		*	\return active SIMD level.
+		*/
+		SIMDLevel GetSIMDLevel() noexcept;
+
+		/**
+		*	\brief Force the SIMD level used by batch kernels dispatch (tests, benchmarks).
+		*
+		*	Level is clamped to GetHostSIMDLevel().
+		*	Must not be called while batch operations run on other threads.
+		*
+		*	\param[in] _level	Requested SIMD level.
+		*
+		*	\return SIMD level effectively set.
+		*/
+		SIMDLevel SetSIMDLevel(SIMDLevel _level) noexcept;
+	}
+}
+
+
+/** \} */
+
+#endif // GUARD
@@ -0,0 +1,161 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_THREAD_POOL_GUARD
+#define SAPPHIRE_MATHS_THREAD_POOL_GUARD
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <type_traits>
+#include <condition_variable>
+
+/**
+*	\file ThreadPool.hpp
+*
+*	\brief <b>Thread pool</b> executor for parallel batch operations.
+*
+*	\ingroup Maths_Dispatch
+*	\{
+*/
+
+
+namespace SA
+{
+	namespace Maths
+	{
+		/**
+		*	\brief Persistent thread pool, used as \e parallel_for executor.
+		*
+		*	Parallel operations (TrHierarchy::UpdateParallel, SweepAndPrune::UpdateParallel) accept any
+		*	executor callable as executor(begin, end, fn): fn(i) is called once for each i in [begin, end),
+		*	possibly concurrently, and the call returns when every fn(i) has returned.
+		*	ThreadPool implements it with threads created once, at construction.
+		*/
+		class ThreadPool
+		{
+			/// Worker threads (calling thread is not included).
+			std::vector<std::thread> mThreads;
+
+			/// Serialize calls from different threads.
+			std::mutex mCallMutex;
+
+			std::mutex mMutex;
+			std::condition_variable mStartCondition;
+			std::condition_variable mEndCondition;
+
+			/// Current job: type-erased functor and its data.
+			void (*mJob)(const void*, uint32_t) = nullptr;
+			const void* mJobData = nullptr;
+
+			/// Next index to process.
+			std::atomic<uint32_t> mNext{ 0u };
+
+			/// End of current job index range.
+			uint32_t mEnd = 0u;
+
+			/// Incremented at each job start.
+			uint32_t mGeneration = 0u;
+
+			/// Number of workers still running current job.
+			uint32_t mRunningNum = 0u;
+
+			bool mStop = false;
+
+			/// Process indices of current job until range is exhausted.
+			void Run();
+
+			/// Worker thread main loop.
+			void WorkerLoop();
+
+		public:
+			/**
+			*	\brief \e Value constructor.
+			*
+			*	\param[in] _threadNum	Number of threads, including calling thread (_threadNum - 1 workers are created).
+			*/
+			explicit ThreadPool(uint32_t _threadNum = std::thread::hardware_concurrency());
+
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool& operator=(const ThreadPool&) = delete;
+
+			/// \b Destructor (join workers).
+			~ThreadPool();
+
+			/**
+			*	\brief Getter of thread count.
+			*
+			*	\return Number of threads, including calling thread.
+			*/
+			uint32_t GetThreadNum() const noexcept;
+
+			/**
+			*	\brief \e parallel_for: call _fn(i) for each i in [_begin, _end) over the pool threads.
+			*
+			*	Calling thread also processes indices. Indices are taken dynamically (one atomic increment each):
+			*	use a few coarse tasks rather than one per element.
+			*	Must not be called from _fn (no nested call) and _fn must not throw.
+			*
+			*	\tparam Fn		Functor type: void(uint32_t).
+			*	\param[in] _begin	First index.
+			*	\param[in] _end		End index (excluded).
+			*	\param[in] _fn		Functor called once per index.
+			*/
+			template <typename Fn>
+			void operator()(uint32_t _begin, uint32_t _end, Fn&& _fn)
+			{
+				if (_begin >= _end)
+					return;
+
+				if (mThreads.empty() || _end - _begin == 1u)
+				{
+					for (uint32_t i = _begin; i < _end; ++i)
+						_fn(i);
+
+					return;
+				}
+
+				using FnT = std::remove_reference_t<Fn>;
+
+				std::lock_guard<std::mutex> callLock(mCallMutex);
+
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+
+					mJob = [](const void* _data, uint32_t _index)
+					{
+						(*static_cast<FnT*>(const_cast<void*>(_data)))(_index);
+					};
+
+					mJobData = std::addressof(_fn);
+					mNext.store(_begin, std::memory_order_relaxed);
+					mEnd = _end;
+					mRunningNum = static_cast<uint32_t>(mThreads.size());
+					++mGeneration;
+				}
+
+				mStartCondition.notify_all();
+
+				Run();
+
+				// Every worker must leave the job before it is replaced.
+				std::unique_lock<std::mutex> lock(mMutex);
+				mEndCondition.wait(lock, [this]() { return mRunningNum == 0u; });
+			}
+		};
+	}
+}
+
+/**
+*	\example ThreadPoolTests.cpp
+*	Examples and Unitary Tests for ThreadPool.
+*/
+
+
+/** \} */
+
+#endif // GUARD
@@ -135,7 +135,7 @@ namespace SA
 		 * 
 		 * @param _other 	Other AABB box.
 		 * 
-		 * @return true if this and other collide on any axis.
+		 * @return true if this and other collide on every axis (boxes intersect).
 		 */
 		bool IsColliding(const AABB2D& _other) const;
 
@@ -85,7 +85,7 @@ namespace SA
 	template <typename T>
 	bool AABB2D<T>::IsColliding(const AABB2D& _other) const
 	{
-		return IsCollidingX(_other) || IsCollidingY(_other);
+		return IsCollidingX(_other) && IsCollidingY(_other);
 	}
 
 //}
@@ -5,7 +5,11 @@
 #ifndef SAPPHIRE_MATHS_AABB3D_GUARD
 #define SAPPHIRE_MATHS_AABB3D_GUARD
 
+#include <cmath>
+#include <cstddef>
+
 #include <SA/Maths/Space/Vector3.hpp>
+#include <SA/Maths/Matrix/Matrix4.hpp>
 
 /**
  * @file AABB3D.hpp
@@ -143,7 +147,7 @@ namespace SA
 		 * 
 		 * @param _other 	Other AABB box.
 		 * 
-		 * @return true if this and other collide on any axis.
+		 * @return true if this and other collide on every axis (boxes intersect).
 		 */
 		bool IsColliding(const AABB3D& _other) const;
 
@@ -190,6 +194,49 @@ namespace SA
 //}
 
 
+//{ Transformation
+
+		/**
+		 * @brief Transform box by an affine matrix (Arvo method).
+		 * Center is transformed as a point, extents by the absolute 3x3 part: result is the
+		 * tightest AABB containing the 8 transformed corners, without computing them.
+		 * Projective row (e30, e31, e32, e33) is ignored.
+		 *
+		 * @tparam major 	Matrix major.
+		 * @param _mat 		Affine transformation matrix.
+		 * @return transformed box.
+		 */
+		template <MatrixMajor major>
+		AABB3D Transform(const Mat4<T, major>& _mat) const noexcept;
+
+		/**
+		 * @brief \e Transform an array of boxes by a single matrix: _out[i] = _in[i].Transform(_mat).
+		 *
+		 * @tparam major 	Matrix major.
+		 * @param _mat 		Affine transformation matrix.
+		 * @param _in 		Input boxes.
+		 * @param _out 		Output transformed boxes. Can be _in.
+		 * @param _num 		Number of boxes.
+		 */
+		template <MatrixMajor major>
+		static void TransformBatch(const Mat4<T, major>& _mat, const AABB3D* _in, AABB3D* _out, size_t _num) noexcept;
+
+		/**
+		 * @brief \e Transform an array of boxes by an array of matrices: _out[i] = _in[i].Transform(_mats[i]).
+		 * Typical use: local bounds of objects to world bounds.
+		 *
+		 * @tparam major 	Matrix major.
+		 * @param _mats 	Affine transformation matrices.
+		 * @param _in 		Input boxes.
+		 * @param _out 		Output transformed boxes. Can be _in.
+		 * @param _num 		Number of boxes and matrices.
+		 */
+		template <MatrixMajor major>
+		static void TransformBatch(const Mat4<T, major>* _mats, const AABB3D* _in, AABB3D* _out, size_t _num) noexcept;
+
+//}
+
+
 		/**
 		 * @brief Merge 2 AABB3D box to create a big AABB3D which wrap both boxes.
 		 * 
@@ -232,6 +279,54 @@ namespace SA
 
 //}
 
+
+	/// \cond Internal
+
+#if SA_MATHS_AABB3D_TRANSFORM_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+//{ Float
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const RMat4f& _mat, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept;
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const RMat4f* _mats, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept;
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const CMat4f& _mat, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept;
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const CMat4f* _mats, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept;
+
+//}
+
+//{ Double
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const RMat4d& _mat, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept;
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const RMat4d* _mats, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept;
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const CMat4d& _mat, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept;
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const CMat4d* _mats, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept;
+
+//}
+
+#endif
+
+	/// \endcond
 }
 
 
@@ -94,7 +94,7 @@ namespace SA
 	template <typename T>
 	bool AABB3D<T>::IsColliding(const AABB3D& _other) const
 	{
-		return IsCollidingX(_other) || IsCollidingY(_other) || IsCollidingZ(_other);
+		return IsCollidingX(_other) && IsCollidingY(_other) && IsCollidingZ(_other);
 	}
 
 //}
@@ -143,6 +143,57 @@ namespace SA
 //}
 
 
+//{ Transformation
+
+	template <typename T>
+	template <MatrixMajor major>
+	AABB3D<T> AABB3D<T>::Transform(const Mat4<T, major>& _mat) const noexcept
+	{
+		SA_ASSERT(IsThisValid, SA.Maths.AABB.3D, L"Invalid AABB: min must be < to max!");
+
+		const Vec3<T> center = (min + max) * T(0.5);
+		const Vec3<T> extents = (max - min) * T(0.5);
+
+		const Vec3<T> outCenter(
+			_mat.e00 * center.x + _mat.e01 * center.y + _mat.e02 * center.z + _mat.e03,
+			_mat.e10 * center.x + _mat.e11 * center.y + _mat.e12 * center.z + _mat.e13,
+			_mat.e20 * center.x + _mat.e21 * center.y + _mat.e22 * center.z + _mat.e23
+		);
+
+		// Each output half size is the sum of the input half sizes projected on the output axis.
+		const Vec3<T> outExtents(
+			std::abs(_mat.e00) * extents.x + std::abs(_mat.e01) * extents.y + std::abs(_mat.e02) * extents.z,
+			std::abs(_mat.e10) * extents.x + std::abs(_mat.e11) * extents.y + std::abs(_mat.e12) * extents.z,
+			std::abs(_mat.e20) * extents.x + std::abs(_mat.e21) * extents.y + std::abs(_mat.e22) * extents.z
+		);
+
+		AABB3D out;
+
+		out.min = outCenter - outExtents;
+		out.max = outCenter + outExtents;
+
+		return out;
+	}
+
+	template <typename T>
+	template <MatrixMajor major>
+	void AABB3D<T>::TransformBatch(const Mat4<T, major>& _mat, const AABB3D* _in, AABB3D* _out, size_t _num) noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+			_out[i] = _in[i].Transform(_mat);
+	}
+
+	template <typename T>
+	template <MatrixMajor major>
+	void AABB3D<T>::TransformBatch(const Mat4<T, major>* _mats, const AABB3D* _in, AABB3D* _out, size_t _num) noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+			_out[i] = _in[i].Transform(_mats[i]);
+	}
+
+//}
+
+
 	template <typename T>
 	AABB3D<T> AABB3D<T>::Merge(const AABB3D& _first, const AABB3D& _second)
 	{
@@ -0,0 +1,185 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_AABB3D_PACK_GUARD
+#define SAPPHIRE_MATHS_AABB3D_PACK_GUARD
+
+#include <cstdint>
+#include <limits>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Geometry/AABB3D.hpp>
+
+#if SA_MATHS_AABB3D_PACK_SIMD
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+ * @file AABB3DPack.hpp
+ *
+ * @brief <b>AABB 3D Pack</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e AABB \e 3D \e Pack Sapphire's class.
+	*
+	*	N boxes in Structure-Of-Arrays layout (one box per SIMD lane)
+	*	to test one query box against N boxes at once.
+	*	Unused lanes hold an empty (inverted infinite) box that never overlaps a finite box.
+	*
+	*	@tparam T	Type of the AABB.
+	*	@tparam N	Number of boxes (lanes).
+	*/
+	template <typename T, uint32_t N>
+	struct alignas(sizeof(T) * N) AABB3DPack
+	{
+		static_assert(N > 0u && N <= 32u, "AABB3DPack lane count must fit in a 32 bits mask.");
+		static_assert((N & (N - 1u)) == 0u, "AABB3DPack lane count must be a power of 2 (lanes are aligned on sizeof(T) * N).");
+
+		/// Number of lanes.
+		static constexpr uint32_t Width = N;
+
+		/// Min X lanes.
+		alignas(sizeof(T) * N) T minX[N];
+
+		/// Min Y lanes.
+		alignas(sizeof(T) * N) T minY[N];
+
+		/// Min Z lanes.
+		alignas(sizeof(T) * N) T minZ[N];
+
+		/// Max X lanes.
+		alignas(sizeof(T) * N) T maxX[N];
+
+		/// Max Y lanes.
+		alignas(sizeof(T) * N) T maxY[N];
+
+		/// Max Z lanes.
+		alignas(sizeof(T) * N) T maxZ[N];
+
+
+//{ Constructors
+
+		/// Default constructor: every lane is empty.
+		AABB3DPack() noexcept;
+
+		/**
+		 * @brief \e Value constructor from boxes.
+		 *
+		 * @param _boxes 	Boxes to pack.
+		 * @param _num 		Number of boxes (<= N): remaining lanes are empty.
+		 */
+		AABB3DPack(const AABB3D<T>* _boxes, uint32_t _num) noexcept;
+
+//}
+
+
+//{ Lanes
+
+		/**
+		 * @brief Set lane box.
+		 *
+		 * @param _lane 	Lane index.
+		 * @param _box 		Box to store.
+		 */
+		void Set(uint32_t _lane, const AABB3D<T>& _box) noexcept;
+
+		/**
+		 * @brief Get lane box.
+		 *
+		 * @param _lane 	Lane index.
+		 * @return lane box.
+		 */
+		AABB3D<T> Get(uint32_t _lane) const noexcept;
+
+		/**
+		 * @brief Set lane to empty box (never overlaps a finite box).
+		 *
+		 * @param _lane 	Lane index.
+		 */
+		void SetEmpty(uint32_t _lane) noexcept;
+
+//}
+
+
+//{ Collision
+
+		/**
+		 * @brief Test _query against every lane.
+		 * Same semantic as AABB3D::IsColliding: boxes overlap if they intersect on every axis (bounds included).
+		 *
+		 * @param _query 	Query box.
+		 * @return bitmask of overlapping lanes (bit i set for lane i).
+		 */
+		uint32_t OverlapMask(const AABB3D<T>& _query) const noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Template alias of 4 lanes AABB3DPack.
+	template <typename T>
+	using AABB3DPack4 = AABB3DPack<T, 4u>;
+
+	/// Template alias of 8 lanes AABB3DPack.
+	template <typename T>
+	using AABB3DPack8 = AABB3DPack<T, 8u>;
+
+	/// Alias for float AABB3DPack4.
+	using AABB3DPack4f = AABB3DPack4<float>;
+
+	/// Alias for double AABB3DPack4.
+	using AABB3DPack4d = AABB3DPack4<double>;
+
+	/// Alias for float AABB3DPack8.
+	using AABB3DPack8f = AABB3DPack8<float>;
+
+	/// Alias for double AABB3DPack8.
+	using AABB3DPack8d = AABB3DPack8<double>;
+
+//}
+
+
+	/// \cond Internal
+
+#if SA_MATHS_AABB3D_PACK_SIMD && SA_INTRISC_SSE
+
+	template <>
+	uint32_t AABB3DPack4f::OverlapMask(const AABB3D<float>& _query) const noexcept;
+
+#endif
+
+#if SA_MATHS_AABB3D_PACK_SIMD && SA_INTRISC_AVX
+
+	template <>
+	uint32_t AABB3DPack8f::OverlapMask(const AABB3D<float>& _query) const noexcept;
+
+	template <>
+	uint32_t AABB3DPack4d::OverlapMask(const AABB3D<double>& _query) const noexcept;
+
+	template <>
+	uint32_t AABB3DPack8d::OverlapMask(const AABB3D<double>& _query) const noexcept;
+
+#endif
+
+	/// \endcond
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/AABB3DPack.inl>
+
+#endif // GUARD
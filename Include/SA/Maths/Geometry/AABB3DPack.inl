@@ -0,0 +1,94 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T, uint32_t N>
+	AABB3DPack<T, N>::AABB3DPack() noexcept
+	{
+		for (uint32_t i = 0u; i < N; ++i)
+			SetEmpty(i);
+	}
+
+	template <typename T, uint32_t N>
+	AABB3DPack<T, N>::AABB3DPack(const AABB3D<T>* _boxes, uint32_t _num) noexcept
+	{
+		SA_ASSERT((Default, _num <= N), SA.Maths.AABB.3D, (L"Box count [%1] exceeds pack width [%2]!", _num, N));
+
+		uint32_t i = 0u;
+
+		for (; i < _num; ++i)
+			Set(i, _boxes[i]);
+
+		for (; i < N; ++i)
+			SetEmpty(i);
+	}
+
+//}
+
+
+//{ Lanes
+
+	template <typename T, uint32_t N>
+	void AABB3DPack<T, N>::Set(uint32_t _lane, const AABB3D<T>& _box) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.AABB.3D);
+
+		minX[_lane] = _box.min.x;
+		minY[_lane] = _box.min.y;
+		minZ[_lane] = _box.min.z;
+
+		maxX[_lane] = _box.max.x;
+		maxY[_lane] = _box.max.y;
+		maxZ[_lane] = _box.max.z;
+	}
+
+	template <typename T, uint32_t N>
+	AABB3D<T> AABB3DPack<T, N>::Get(uint32_t _lane) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.AABB.3D);
+
+		AABB3D<T> box;
+
+		box.min = Vec3<T>(minX[_lane], minY[_lane], minZ[_lane]);
+		box.max = Vec3<T>(maxX[_lane], maxY[_lane], maxZ[_lane]);
+
+		return box;
+	}
+
+	template <typename T, uint32_t N>
+	void AABB3DPack<T, N>::SetEmpty(uint32_t _lane) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.AABB.3D);
+
+		// Inverted infinite box: min > any finite max, max < any finite min.
+		minX[_lane] = minY[_lane] = minZ[_lane] = std::numeric_limits<T>::infinity();
+		maxX[_lane] = maxY[_lane] = maxZ[_lane] = -std::numeric_limits<T>::infinity();
+	}
+
+//}
+
+
+//{ Collision
+
+	template <typename T, uint32_t N>
+	uint32_t AABB3DPack<T, N>::OverlapMask(const AABB3D<T>& _query) const noexcept
+	{
+		uint32_t mask = 0u;
+
+		// Branchless: lets the compiler vectorize when no specialization exists.
+		for (uint32_t i = 0u; i < N; ++i)
+		{
+			const bool bOverlap = (minX[i] <= _query.max.x) & (maxX[i] >= _query.min.x) &
+				(minY[i] <= _query.max.y) & (maxY[i] >= _query.min.y) &
+				(minZ[i] <= _query.max.z) & (maxZ[i] >= _query.min.z);
+
+			mask |= uint32_t(bOverlap) << i;
+		}
+
+		return mask;
+	}
+
+//}
+}
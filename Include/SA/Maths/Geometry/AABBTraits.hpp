@@ -0,0 +1,54 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_AABB_TRAITS_GUARD
+#define SAPPHIRE_MATHS_AABB_TRAITS_GUARD
+
+#include <cstdint>
+
+#include <SA/Maths/Geometry/AABB2D.hpp>
+#include <SA/Maths/Geometry/AABB3D.hpp>
+
+/**
+ * @file AABBTraits.hpp
+ *
+ * @brief AABB2D / AABB3D traits for dimension generic algorithms.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/// \cond Internal
+
+	namespace Intl
+	{
+		template <typename AABBT>
+		struct AABBTraits;
+
+		template <typename T>
+		struct AABBTraits<AABB2D<T>>
+		{
+			using Type = T;
+			using VecT = Vec2<T>;
+			static constexpr uint32_t Dim = 2u;
+		};
+
+		template <typename T>
+		struct AABBTraits<AABB3D<T>>
+		{
+			using Type = T;
+			using VecT = Vec3<T>;
+			static constexpr uint32_t Dim = 3u;
+		};
+	}
+
+	/// \endcond
+}
+
+
+/** @} */
+
+#endif // GUARD
@@ -0,0 +1,267 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_BVH3D_GUARD
+#define SAPPHIRE_MATHS_BVH3D_GUARD
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Geometry/Ray3.hpp>
+
+/**
+ * @file BVH3D.hpp
+ *
+ * @brief <b>Bounding Volume Hierarchy 3D</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e BVH \e 3D Sapphire's class.
+	*
+	*	Static bounding volume hierarchy over an array of AABB3D.
+	*	Built top-down using binned Surface Area Heuristic (SAH).
+	*	Nodes are flattened in depth-first order: left child is always stored right after its parent,
+	*	only right child index is stored.
+	*	Queries return indices of the input boxes.
+	*
+	*	@tparam T	Type of the BVH.
+	*/
+	template <typename T>
+	class BVH3D
+	{
+	public:
+		/// Flattened BVH node.
+		struct Node
+		{
+			/// Node bounds (union of children or primitives bounds).
+			AABB3D<T> bounds;
+
+			/// Leaf: first primitive in index array. Inner node: right child index (left child is this + 1).
+			uint32_t offset = 0u;
+
+			/// Number of primitives (0 for inner nodes).
+			uint32_t count = 0u;
+
+			/**
+			 * @brief Whether node is a leaf.
+			 *
+			 * @return true if node has primitives.
+			 */
+			bool IsLeaf() const noexcept { return count != 0u; }
+		};
+
+		/// Number of SAH bins per axis.
+		static constexpr uint32_t BinNum = 16u;
+
+		/// Maximum traversal depth (stack size).
+		static constexpr uint32_t MaxDepth = 64u;
+
+	private:
+		/// Flattened nodes (root is node 0).
+		std::vector<Node> mNodes;
+
+		/// Build input index of primitives, in leaf order.
+		std::vector<uint32_t> mIndices;
+
+		/// Primitive bounds, in leaf order (same order as mIndices).
+		std::vector<AABB3D<T>> mBoxes;
+
+
+		/// Build-time primitive: partitioned in place to keep binning passes contiguous in memory.
+		struct BuildPrim
+		{
+			AABB3D<T> box;
+			Vec3<T> centroid;
+			uint32_t index = 0u;
+		};
+
+		/// Build node over [_start, _end) primitives (recursive).
+		void BuildNode(std::vector<BuildPrim>& _prims, uint32_t _start, uint32_t _end, uint32_t _maxLeafSize, uint32_t _depth);
+
+		/// Surface area (SAH cost metric).
+		static T SurfaceArea(const AABB3D<T>& _box) noexcept;
+
+		/// Box / box overlap on every axis.
+		static bool Overlap(const AABB3D<T>& _lhs, const AABB3D<T>& _rhs) noexcept;
+
+		/// Point inside box (bounds included).
+		static bool Contains(const AABB3D<T>& _box, const Vec3<T>& _point) noexcept;
+
+
+	public:
+
+//{ Build
+
+		/**
+		 * @brief Build hierarchy from boxes.
+		 *
+		 * @param _boxes 		Input boxes (copied).
+		 * @param _num 			Number of boxes.
+		 * @param _maxLeafSize 	Maximum number of boxes per leaf.
+		 */
+		void Build(const AABB3D<T>* _boxes, uint32_t _num, uint32_t _maxLeafSize = 4u);
+
+		/// Remove all nodes and boxes.
+		void Clear() noexcept;
+
+//}
+
+
+//{ Getters
+
+		/**
+		 * @brief Getter of box count.
+		 *
+		 * @return number of boxes in hierarchy.
+		 */
+		uint32_t Size() const noexcept;
+
+		/**
+		 * @brief Whether hierarchy is empty.
+		 *
+		 * @return true if Size() == 0.
+		 */
+		bool IsEmpty() const noexcept;
+
+		/**
+		 * @brief Getter of flattened nodes.
+		 *
+		 * @return node array (root is node 0).
+		 */
+		const std::vector<Node>& GetNodes() const noexcept;
+
+		/**
+		 * @brief Getter of boxes in leaf order.
+		 * Leaf primitives are [node.offset, node.offset + node.count) in this array.
+		 *
+		 * @return boxes array.
+		 */
+		const std::vector<AABB3D<T>>& GetBoxes() const noexcept;
+
+		/**
+		 * @brief Getter of build input indices in leaf order.
+		 *
+		 * @return indices array (same order as GetBoxes()).
+		 */
+		const std::vector<uint32_t>& GetIndices() const noexcept;
+
+//}
+
+
+//{ Queries
+
+		/**
+		 * @brief Find boxes overlapping _box.
+		 *
+		 * @tparam CallbackT 	Callback type: void(uint32_t _index).
+		 * @param _box 			Query box.
+		 * @param _callback 	Called once for each overlapping box.
+		 */
+		template <typename CallbackT>
+		void QueryOverlap(const AABB3D<T>& _box, CallbackT _callback) const;
+
+		/**
+		 * @brief Find boxes overlapping _box.
+		 *
+		 * @param _box 	Query box.
+		 * @param _out 	Output indices (appended).
+		 */
+		void QueryOverlap(const AABB3D<T>& _box, std::vector<uint32_t>& _out) const;
+
+
+		/**
+		 * @brief Find boxes containing _point.
+		 *
+		 * @tparam CallbackT 	Callback type: void(uint32_t _index).
+		 * @param _point 		Query point.
+		 * @param _callback 	Called once for each box containing the point.
+		 */
+		template <typename CallbackT>
+		void QueryPoint(const Vec3<T>& _point, CallbackT _callback) const;
+
+		/**
+		 * @brief Find boxes containing _point.
+		 *
+		 * @param _point 	Query point.
+		 * @param _out 		Output indices (appended).
+		 */
+		void QueryPoint(const Vec3<T>& _point, std::vector<uint32_t>& _out) const;
+
+
+		/**
+		 * @brief Find boxes hit by ray.
+		 * Nearest child is visited first.
+		 *
+		 * @tparam CallbackT 	Callback type: void(uint32_t _index, T _tEntry).
+		 * @param _origin 		Ray origin.
+		 * @param _dir 			Ray direction (not required to be normalized: distances are in _dir unit).
+		 * @param _maxDist 		Ray max distance.
+		 * @param _callback 	Called once for each box hit, with entry distance.
+		 */
+		template <typename CallbackT>
+		void QueryRay(const Vec3<T>& _origin, const Vec3<T>& _dir, T _maxDist, CallbackT _callback) const;
+
+		/**
+		 * @brief Find closest box hit by ray.
+		 *
+		 * @param _origin 		Ray origin.
+		 * @param _dir 			Ray direction.
+		 * @param _maxDist 		Ray max distance.
+		 * @param _tEntry 		Output entry distance of closest box.
+		 * @return closest box index or UINT32_MAX if none.
+		 */
+		uint32_t RaycastClosest(const Vec3<T>& _origin, const Vec3<T>& _dir, T _maxDist, T& _tEntry) const;
+
+		/**
+		 * @brief Find boxes hit by ray (precomputed inverse direction).
+		 * Nearest child is visited first.
+		 *
+		 * @tparam CallbackT 	Callback type: void(uint32_t _index, T _tEntry).
+		 * @param _ray 			Query ray.
+		 * @param _maxDist 		Ray max distance.
+		 * @param _callback 	Called once for each box hit, with entry distance.
+		 */
+		template <typename CallbackT>
+		void QueryRay(const Ray3<T>& _ray, T _maxDist, CallbackT _callback) const;
+
+		/**
+		 * @brief Find closest box hit by ray (precomputed inverse direction).
+		 *
+		 * @param _ray 			Query ray.
+		 * @param _maxDist 		Ray max distance.
+		 * @param _tEntry 		Output entry distance of closest box.
+		 * @return closest box index or UINT32_MAX if none.
+		 */
+		uint32_t RaycastClosest(const Ray3<T>& _ray, T _maxDist, T& _tEntry) const;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float BVH3D.
+	using BVH3Df = BVH3D<float>;
+
+	/// Alias for double BVH3D.
+	using BVH3Dd = BVH3D<double>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/BVH3D.inl>
+
+#endif // GUARD
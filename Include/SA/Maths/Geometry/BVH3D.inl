@@ -0,0 +1,508 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Helpers
+
+	template <typename T>
+	T BVH3D<T>::SurfaceArea(const AABB3D<T>& _box) noexcept
+	{
+		const Vec3<T> d = _box.max - _box.min;
+
+		return T(2) * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	template <typename T>
+	bool BVH3D<T>::Overlap(const AABB3D<T>& _lhs, const AABB3D<T>& _rhs) noexcept
+	{
+		return _lhs.min.x <= _rhs.max.x && _lhs.max.x >= _rhs.min.x &&
+			_lhs.min.y <= _rhs.max.y && _lhs.max.y >= _rhs.min.y &&
+			_lhs.min.z <= _rhs.max.z && _lhs.max.z >= _rhs.min.z;
+	}
+
+	template <typename T>
+	bool BVH3D<T>::Contains(const AABB3D<T>& _box, const Vec3<T>& _point) noexcept
+	{
+		return _point.x >= _box.min.x && _point.x <= _box.max.x &&
+			_point.y >= _box.min.y && _point.y <= _box.max.y &&
+			_point.z >= _box.min.z && _point.z <= _box.max.z;
+	}
+
+//}
+
+
+//{ Build
+
+	template <typename T>
+	void BVH3D<T>::Build(const AABB3D<T>* _boxes, uint32_t _num, uint32_t _maxLeafSize)
+	{
+		SA_ASSERT((Default, _maxLeafSize > 0u), SA.Maths.BVH.3D, L"Max leaf size must be > 0!");
+
+		Clear();
+
+		if (_num == 0u)
+			return;
+
+		std::vector<BuildPrim> prims(_num);
+
+		for (uint32_t i = 0; i < _num; ++i)
+		{
+			prims[i].box = _boxes[i];
+			prims[i].centroid = (_boxes[i].min + _boxes[i].max) * T(0.5);
+			prims[i].index = i;
+		}
+
+		// Binary tree: at most 2N - 1 nodes.
+		mNodes.reserve(2u * ((_num + _maxLeafSize - 1u) / _maxLeafSize));
+
+		BuildNode(prims, 0u, _num, _maxLeafSize, 0u);
+
+		mIndices.resize(_num);
+		mBoxes.resize(_num);
+
+		for (uint32_t i = 0; i < _num; ++i)
+		{
+			mIndices[i] = prims[i].index;
+			mBoxes[i] = prims[i].box;
+		}
+	}
+
+	template <typename T>
+	void BVH3D<T>::BuildNode(std::vector<BuildPrim>& _prims, uint32_t _start, uint32_t _end, uint32_t _maxLeafSize, uint32_t _depth)
+	{
+		const uint32_t nodeIndex = static_cast<uint32_t>(mNodes.size());
+		mNodes.emplace_back();
+
+		// Node and centroid bounds.
+		AABB3D<T> bounds = _prims[_start].box;
+		AABB3D<T> cBounds{ _prims[_start].centroid, _prims[_start].centroid };
+
+		for (uint32_t i = _start + 1u; i < _end; ++i)
+		{
+			const AABB3D<T>& box = _prims[i].box;
+			const Vec3<T>& c = _prims[i].centroid;
+
+			for (uint32_t a = 0u; a < 3u; ++a)
+			{
+				bounds.min[a] = std::min(bounds.min[a], box.min[a]);
+				bounds.max[a] = std::max(bounds.max[a], box.max[a]);
+
+				cBounds.min[a] = std::min(cBounds.min[a], c[a]);
+				cBounds.max[a] = std::max(cBounds.max[a], c[a]);
+			}
+		}
+
+		mNodes[nodeIndex].bounds = bounds;
+
+		const uint32_t count = _end - _start;
+
+		// Leaf (depth bounded by traversal stack size).
+		if (count <= _maxLeafSize || _depth + 2u >= MaxDepth)
+		{
+			mNodes[nodeIndex].offset = _start;
+			mNodes[nodeIndex].count = count;
+
+			return;
+		}
+
+
+		// Binned SAH: find best axis and split bin.
+		struct Bin
+		{
+			AABB3D<T> bounds;
+			uint32_t count = 0u;
+		};
+
+		T bestCost = std::numeric_limits<T>::max();
+		uint32_t bestAxis = 0u;
+		uint32_t bestSplit = 0u;
+
+		T scales[3];
+
+		for (uint32_t a = 0u; a < 3u; ++a)
+		{
+			const T extent = cBounds.max[a] - cBounds.min[a];
+			scales[a] = extent > T(0) ? T(BinNum) / extent : T(0);
+		}
+
+		// Fill bins of every axis in a single pass over primitives.
+		Bin bins[3][BinNum];
+
+		for (uint32_t i = _start; i < _end; ++i)
+		{
+			const Vec3<T>& c = _prims[i].centroid;
+			const AABB3D<T>& box = _prims[i].box;
+
+			for (uint32_t a = 0u; a < 3u; ++a)
+			{
+				const uint32_t b = std::min(BinNum - 1u, static_cast<uint32_t>((c[a] - cBounds.min[a]) * scales[a]));
+				Bin& bin = bins[a][b];
+
+				bin.bounds = bin.count ? AABB3D<T>::Merge(bin.bounds, box) : box;
+				++bin.count;
+			}
+		}
+
+		for (uint32_t a = 0u; a < 3u; ++a)
+		{
+			if (scales[a] == T(0))
+				continue;
+
+			// Left sweep: area and count of bins [0, i].
+			T leftAreas[BinNum - 1u];
+			uint32_t leftCounts[BinNum - 1u];
+
+			AABB3D<T> acc;
+			uint32_t accCount = 0u;
+
+			for (uint32_t i = 0u; i < BinNum - 1u; ++i)
+			{
+				if (bins[a][i].count)
+				{
+					acc = accCount ? AABB3D<T>::Merge(acc, bins[a][i].bounds) : bins[a][i].bounds;
+					accCount += bins[a][i].count;
+				}
+
+				leftAreas[i] = accCount ? SurfaceArea(acc) : T(0);
+				leftCounts[i] = accCount;
+			}
+
+			// Right sweep: cost of split after bin i.
+			accCount = 0u;
+
+			for (uint32_t i = BinNum - 1u; i > 0u; --i)
+			{
+				if (bins[a][i].count)
+				{
+					acc = accCount ? AABB3D<T>::Merge(acc, bins[a][i].bounds) : bins[a][i].bounds;
+					accCount += bins[a][i].count;
+				}
+
+				if (leftCounts[i - 1u] == 0u || accCount == 0u)
+					continue;
+
+				const T cost = T(leftCounts[i - 1u]) * leftAreas[i - 1u] + T(accCount) * SurfaceArea(acc);
+
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = a;
+					bestSplit = i - 1u;
+				}
+			}
+		}
+
+
+		// Partition.
+		uint32_t mid = _start;
+
+		if (bestCost < std::numeric_limits<T>::max())
+		{
+			const T scale = scales[bestAxis];
+			const T minC = cBounds.min[bestAxis];
+
+			auto it = std::partition(_prims.begin() + _start, _prims.begin() + _end,
+				[bestAxis, bestSplit, scale, minC](const BuildPrim& _prim)
+				{
+					const uint32_t b = std::min(BinNum - 1u, static_cast<uint32_t>((_prim.centroid[bestAxis] - minC) * scale));
+					return b <= bestSplit;
+				}
+			);
+
+			mid = static_cast<uint32_t>(it - _prims.begin());
+		}
+
+		if (mid == _start || mid == _end)
+		{
+			// All centroids in the same place: split in half.
+			mid = _start + count / 2u;
+		}
+
+		BuildNode(_prims, _start, mid, _maxLeafSize, _depth + 1u);
+
+		mNodes[nodeIndex].offset = static_cast<uint32_t>(mNodes.size());
+
+		BuildNode(_prims, mid, _end, _maxLeafSize, _depth + 1u);
+	}
+
+	template <typename T>
+	void BVH3D<T>::Clear() noexcept
+	{
+		mNodes.clear();
+		mIndices.clear();
+		mBoxes.clear();
+	}
+
+//}
+
+
+//{ Getters
+
+	template <typename T>
+	uint32_t BVH3D<T>::Size() const noexcept
+	{
+		return static_cast<uint32_t>(mBoxes.size());
+	}
+
+	template <typename T>
+	bool BVH3D<T>::IsEmpty() const noexcept
+	{
+		return mBoxes.empty();
+	}
+
+	template <typename T>
+	const std::vector<typename BVH3D<T>::Node>& BVH3D<T>::GetNodes() const noexcept
+	{
+		return mNodes;
+	}
+
+	template <typename T>
+	const std::vector<AABB3D<T>>& BVH3D<T>::GetBoxes() const noexcept
+	{
+		return mBoxes;
+	}
+
+	template <typename T>
+	const std::vector<uint32_t>& BVH3D<T>::GetIndices() const noexcept
+	{
+		return mIndices;
+	}
+
+//}
+
+
+//{ Queries
+
+	template <typename T>
+	template <typename CallbackT>
+	void BVH3D<T>::QueryOverlap(const AABB3D<T>& _box, CallbackT _callback) const
+	{
+		if (mNodes.empty())
+			return;
+
+		uint32_t stack[MaxDepth];
+		uint32_t stackSize = 0u;
+
+		stack[stackSize++] = 0u;
+
+		while (stackSize)
+		{
+			const uint32_t nodeIndex = stack[--stackSize];
+			const Node& node = mNodes[nodeIndex];
+
+			if (!Overlap(node.bounds, _box))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+				{
+					if (Overlap(mBoxes[i], _box))
+						_callback(mIndices[i]);
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.offset;
+				stack[stackSize++] = nodeIndex + 1u;
+			}
+		}
+	}
+
+	template <typename T>
+	void BVH3D<T>::QueryOverlap(const AABB3D<T>& _box, std::vector<uint32_t>& _out) const
+	{
+		QueryOverlap(_box, [&_out](uint32_t _index) { _out.push_back(_index); });
+	}
+
+
+	template <typename T>
+	template <typename CallbackT>
+	void BVH3D<T>::QueryPoint(const Vec3<T>& _point, CallbackT _callback) const
+	{
+		if (mNodes.empty())
+			return;
+
+		uint32_t stack[MaxDepth];
+		uint32_t stackSize = 0u;
+
+		stack[stackSize++] = 0u;
+
+		while (stackSize)
+		{
+			const uint32_t nodeIndex = stack[--stackSize];
+			const Node& node = mNodes[nodeIndex];
+
+			if (!Contains(node.bounds, _point))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+				{
+					if (Contains(mBoxes[i], _point))
+						_callback(mIndices[i]);
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.offset;
+				stack[stackSize++] = nodeIndex + 1u;
+			}
+		}
+	}
+
+	template <typename T>
+	void BVH3D<T>::QueryPoint(const Vec3<T>& _point, std::vector<uint32_t>& _out) const
+	{
+		QueryPoint(_point, [&_out](uint32_t _index) { _out.push_back(_index); });
+	}
+
+
+	template <typename T>
+	template <typename CallbackT>
+	void BVH3D<T>::QueryRay(const Vec3<T>& _origin, const Vec3<T>& _dir, T _maxDist, CallbackT _callback) const
+	{
+		QueryRay(Ray3<T>(_origin, _dir), _maxDist, _callback);
+	}
+
+	template <typename T>
+	template <typename CallbackT>
+	void BVH3D<T>::QueryRay(const Ray3<T>& _ray, T _maxDist, CallbackT _callback) const
+	{
+		if (mNodes.empty())
+			return;
+
+		T tEntry;
+
+		if (!_ray.IntersectAABB(mNodes[0].bounds, _maxDist, tEntry))
+			return;
+
+		uint32_t stack[MaxDepth];
+		uint32_t stackSize = 0u;
+
+		stack[stackSize++] = 0u;
+
+		while (stackSize)
+		{
+			const Node& node = mNodes[stack[--stackSize]];
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+				{
+					if (_ray.IntersectAABB(mBoxes[i], _maxDist, tEntry))
+						_callback(mIndices[i], tEntry);
+				}
+
+				continue;
+			}
+
+			const uint32_t left = static_cast<uint32_t>(&node - mNodes.data()) + 1u;
+			const uint32_t right = node.offset;
+
+			T tLeft, tRight;
+			const bool bLeft = _ray.IntersectAABB(mNodes[left].bounds, _maxDist, tLeft);
+			const bool bRight = _ray.IntersectAABB(mNodes[right].bounds, _maxDist, tRight);
+
+			// Push far child first: near child is visited next.
+			if (bLeft && bRight)
+			{
+				stack[stackSize++] = tLeft <= tRight ? right : left;
+				stack[stackSize++] = tLeft <= tRight ? left : right;
+			}
+			else if (bLeft)
+				stack[stackSize++] = left;
+			else if (bRight)
+				stack[stackSize++] = right;
+		}
+	}
+
+	template <typename T>
+	uint32_t BVH3D<T>::RaycastClosest(const Vec3<T>& _origin, const Vec3<T>& _dir, T _maxDist, T& _tEntry) const
+	{
+		return RaycastClosest(Ray3<T>(_origin, _dir), _maxDist, _tEntry);
+	}
+
+	template <typename T>
+	uint32_t BVH3D<T>::RaycastClosest(const Ray3<T>& _ray, T _maxDist, T& _tEntry) const
+	{
+		uint32_t closest = ~uint32_t(0);
+
+		if (mNodes.empty())
+			return closest;
+
+		T tEntry;
+
+		if (!_ray.IntersectAABB(mNodes[0].bounds, _maxDist, tEntry))
+			return closest;
+
+		// Stack of (node, entry distance): skip nodes further than closest hit.
+		uint32_t stack[MaxDepth];
+		T stackDist[MaxDepth];
+		uint32_t stackSize = 0u;
+
+		stack[stackSize] = 0u;
+		stackDist[stackSize++] = tEntry;
+
+		while (stackSize)
+		{
+			--stackSize;
+
+			if (stackDist[stackSize] > _maxDist)
+				continue;
+
+			const uint32_t nodeIndex = stack[stackSize];
+			const Node& node = mNodes[nodeIndex];
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+				{
+					if (_ray.IntersectAABB(mBoxes[i], _maxDist, tEntry) &&
+						(tEntry < _maxDist || closest == ~uint32_t(0)))
+					{
+						_maxDist = tEntry;
+						closest = mIndices[i];
+					}
+				}
+
+				continue;
+			}
+
+			const uint32_t left = nodeIndex + 1u;
+			const uint32_t right = node.offset;
+
+			T tLeft, tRight;
+			const bool bLeft = _ray.IntersectAABB(mNodes[left].bounds, _maxDist, tLeft);
+			const bool bRight = _ray.IntersectAABB(mNodes[right].bounds, _maxDist, tRight);
+
+			if (bLeft && bRight)
+			{
+				const bool bLeftFirst = tLeft <= tRight;
+
+				stack[stackSize] = bLeftFirst ? right : left;
+				stackDist[stackSize++] = bLeftFirst ? tRight : tLeft;
+
+				stack[stackSize] = bLeftFirst ? left : right;
+				stackDist[stackSize++] = bLeftFirst ? tLeft : tRight;
+			}
+			else if (bLeft)
+			{
+				stack[stackSize] = left;
+				stackDist[stackSize++] = tLeft;
+			}
+			else if (bRight)
+			{
+				stack[stackSize] = right;
+				stackDist[stackSize++] = tRight;
+			}
+		}
+
+		_tEntry = _maxDist;
+
+		return closest;
+	}
+
+//}
+}
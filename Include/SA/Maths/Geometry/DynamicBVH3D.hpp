@@ -0,0 +1,286 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_DYNAMIC_BVH3D_GUARD
+#define SAPPHIRE_MATHS_DYNAMIC_BVH3D_GUARD
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Geometry/AABB3D.hpp>
+
+/**
+ * @file DynamicBVH3D.hpp
+ *
+ * @brief <b>Dynamic Bounding Volume Hierarchy 3D</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Dynamic \e BVH \e 3D Sapphire's class.
+	*
+	*	Incremental AABB tree for moving objects.
+	*	Leaves store "fat" boxes: input box enlarged by a margin (and optional predicted displacement),
+	*	so small moves do not change the tree at all.
+	*	Insertion descends using Surface Area Heuristic (SAH) cost.
+	*	Tree quality is kept by local rotations (children / grandchildren swaps reducing SAH)
+	*	applied on every modified ancestor and on demand with Optimize().
+	*
+	*	Proxy ids returned by Insert() are stable until Remove().
+	*
+	*	@tparam T	Type of the BVH.
+	*/
+	template <typename T>
+	class DynamicBVH3D
+	{
+	public:
+		/// Null node index (no parent / no child / no proxy).
+		static constexpr uint32_t NullNode = ~uint32_t(0);
+
+		/// Tree node.
+		struct Node
+		{
+			/// Fat box (leaf) or union of children boxes (inner node).
+			AABB3D<T> box;
+
+			/// Parent index (NullNode for root). Next free node when in free list.
+			uint32_t parent = NullNode;
+
+			/// First child index (NullNode for leaves).
+			uint32_t child1 = NullNode;
+
+			/// Second child index (NullNode for leaves).
+			uint32_t child2 = NullNode;
+
+			/**
+			 * @brief Whether node is a leaf.
+			 *
+			 * @return true if node has no children.
+			 */
+			bool IsLeaf() const noexcept { return child1 == NullNode; }
+		};
+
+	private:
+		/// Nodes storage (leaves and inner nodes).
+		std::vector<Node> mNodes;
+
+		/// Root node index.
+		uint32_t mRoot = NullNode;
+
+		/// Free list head.
+		uint32_t mFreeList = NullNode;
+
+		/// Number of proxies (leaves).
+		uint32_t mProxyNum = 0u;
+
+		/// Optimize() round-robin cursor.
+		uint32_t mOptimizeCursor = 0u;
+
+		/// Fat box margin.
+		T mMargin = T(0.1);
+
+
+		uint32_t AllocateNode();
+		void FreeNode(uint32_t _index) noexcept;
+
+		void InsertLeaf(uint32_t _leaf);
+		void RemoveLeaf(uint32_t _leaf) noexcept;
+
+		/// Recompute ancestors bounds from _index to root, rotating each of them.
+		void RefitAncestors(uint32_t _index) noexcept;
+
+		/// Swap a child of _index with a grandchild if it reduces SAH cost.
+		void RotateNode(uint32_t _index) noexcept;
+
+		/// Replace child _oldChild of _parent by _newChild.
+		void ReplaceChild(uint32_t _parent, uint32_t _oldChild, uint32_t _newChild) noexcept;
+
+		AABB3D<T> MakeFatBox(const AABB3D<T>& _box, const Vec3<T>& _displacement) const noexcept;
+
+		static T SurfaceArea(const AABB3D<T>& _box) noexcept;
+		static bool Contains(const AABB3D<T>& _outer, const AABB3D<T>& _inner) noexcept;
+		static bool Overlap(const AABB3D<T>& _lhs, const AABB3D<T>& _rhs) noexcept;
+
+		/**
+		 * @brief Stackless depth-first traversal using parent links (no depth limit, no allocation).
+		 *
+		 * @param _descend 	bool(const Node&): whether node box passes the test.
+		 * @param _visit 	void(uint32_t _node, uint32_t _depth): called on every passing node.
+		 */
+		template <typename DescendT, typename VisitT>
+		void Traverse(DescendT _descend, VisitT _visit) const;
+
+	public:
+		/**
+		 * @brief Value constructor.
+		 *
+		 * @param _margin 	Fat box margin added on every side of inserted boxes.
+		 */
+		DynamicBVH3D(T _margin = T(0.1)) noexcept;
+
+//{ Proxies
+
+		/**
+		 * @brief Insert a new box.
+		 *
+		 * @param _box 		Box to insert.
+		 * @return proxy id.
+		 */
+		uint32_t Insert(const AABB3D<T>& _box);
+
+		/**
+		 * @brief Remove a box.
+		 *
+		 * @param _proxy 	Proxy id returned by Insert().
+		 */
+		void Remove(uint32_t _proxy) noexcept;
+
+		/**
+		 * @brief Move a box: reinsert leaf if _box left its fat box.
+		 *
+		 * @param _proxy 			Proxy id.
+		 * @param _box 				New box.
+		 * @param _displacement 	Predicted displacement: fat box is extended in this direction.
+		 * @return true if leaf was reinserted.
+		 */
+		bool Move(uint32_t _proxy, const AABB3D<T>& _box, const Vec3<T>& _displacement = Vec3<T>::Zero);
+
+		/**
+		 * @brief Refit a box: update leaf fat box in place if _box left it, then ancestors bounds (with rotations).
+		 * Cheaper than Move() but keeps leaf at the same place in the tree:
+		 * use Optimize() to recover quality after many refits.
+		 *
+		 * @param _proxy 			Proxy id.
+		 * @param _box 				New box.
+		 * @param _displacement 	Predicted displacement: fat box is extended in this direction.
+		 * @return true if tree was modified.
+		 */
+		bool Refit(uint32_t _proxy, const AABB3D<T>& _box, const Vec3<T>& _displacement = Vec3<T>::Zero) noexcept;
+
+		/**
+		 * @brief Apply rotations to _nodeNum nodes (round-robin over the whole tree across calls).
+		 * Call each frame with a small budget to keep quality.
+		 *
+		 * @param _nodeNum 	Number of nodes to try.
+		 */
+		void Optimize(uint32_t _nodeNum) noexcept;
+
+		/// Remove all proxies.
+		void Clear() noexcept;
+
+//}
+
+
+//{ Getters
+
+		/**
+		 * @brief Getter of proxy count.
+		 *
+		 * @return number of proxies in tree.
+		 */
+		uint32_t Size() const noexcept;
+
+		/**
+		 * @brief Whether tree is empty.
+		 *
+		 * @return true if Size() == 0.
+		 */
+		bool IsEmpty() const noexcept;
+
+		/**
+		 * @brief Getter of margin.
+		 *
+		 * @return fat box margin.
+		 */
+		T GetMargin() const noexcept;
+
+		/**
+		 * @brief Getter of proxy fat box.
+		 *
+		 * @param _proxy 	Proxy id.
+		 * @return fat box of the proxy.
+		 */
+		const AABB3D<T>& GetFatBox(uint32_t _proxy) const noexcept;
+
+		/**
+		 * @brief Getter of root index.
+		 *
+		 * @return root node index (NullNode if empty).
+		 */
+		uint32_t GetRoot() const noexcept;
+
+		/**
+		 * @brief Getter of nodes storage.
+		 * Includes free nodes: walk from GetRoot().
+		 *
+		 * @return nodes array.
+		 */
+		const std::vector<Node>& GetNodes() const noexcept;
+
+		/**
+		 * @brief Compute tree height (O(n)).
+		 *
+		 * @return height (0 if empty, 1 for root leaf).
+		 */
+		uint32_t ComputeHeight() const;
+
+		/**
+		 * @brief Compute tree quality metric (O(n)): sum of node areas / root area.
+		 * Lower is better.
+		 *
+		 * @return area ratio (0 if empty).
+		 */
+		T ComputeAreaRatio() const;
+
+//}
+
+
+//{ Queries
+
+		/**
+		 * @brief Find proxies whose fat box overlaps _box.
+		 *
+		 * @tparam CallbackT 	Callback type: void(uint32_t _proxy).
+		 * @param _box 			Query box.
+		 * @param _callback 	Called once for each overlapping proxy.
+		 */
+		template <typename CallbackT>
+		void QueryOverlap(const AABB3D<T>& _box, CallbackT _callback) const;
+
+		/**
+		 * @brief Find proxies whose fat box overlaps _box.
+		 *
+		 * @param _box 	Query box.
+		 * @param _out 	Output proxies (appended).
+		 */
+		void QueryOverlap(const AABB3D<T>& _box, std::vector<uint32_t>& _out) const;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float DynamicBVH3D.
+	using DynamicBVH3Df = DynamicBVH3D<float>;
+
+	/// Alias for double DynamicBVH3D.
+	using DynamicBVH3Dd = DynamicBVH3D<double>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/DynamicBVH3D.inl>
+
+#endif // GUARD
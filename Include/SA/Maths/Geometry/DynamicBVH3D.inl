@@ -0,0 +1,552 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+	template <typename T>
+	DynamicBVH3D<T>::DynamicBVH3D(T _margin) noexcept :
+		mMargin{ _margin }
+	{
+		SA_ASSERT((Default, _margin >= T(0)), SA.Maths.BVH.3D, L"Margin must be >= 0!");
+	}
+
+//{ Helpers
+
+	template <typename T>
+	T DynamicBVH3D<T>::SurfaceArea(const AABB3D<T>& _box) noexcept
+	{
+		const Vec3<T> d = _box.max - _box.min;
+
+		return T(2) * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	template <typename T>
+	bool DynamicBVH3D<T>::Contains(const AABB3D<T>& _outer, const AABB3D<T>& _inner) noexcept
+	{
+		return _outer.min.x <= _inner.min.x && _outer.min.y <= _inner.min.y && _outer.min.z <= _inner.min.z &&
+			_outer.max.x >= _inner.max.x && _outer.max.y >= _inner.max.y && _outer.max.z >= _inner.max.z;
+	}
+
+	template <typename T>
+	bool DynamicBVH3D<T>::Overlap(const AABB3D<T>& _lhs, const AABB3D<T>& _rhs) noexcept
+	{
+		return _lhs.min.x <= _rhs.max.x && _lhs.max.x >= _rhs.min.x &&
+			_lhs.min.y <= _rhs.max.y && _lhs.max.y >= _rhs.min.y &&
+			_lhs.min.z <= _rhs.max.z && _lhs.max.z >= _rhs.min.z;
+	}
+
+	template <typename T>
+	AABB3D<T> DynamicBVH3D<T>::MakeFatBox(const AABB3D<T>& _box, const Vec3<T>& _displacement) const noexcept
+	{
+		AABB3D<T> fat;
+
+		fat.min = _box.min - Vec3<T>(mMargin);
+		fat.max = _box.max + Vec3<T>(mMargin);
+
+		// Extend in predicted direction only.
+		for (uint32_t a = 0u; a < 3u; ++a)
+		{
+			if (_displacement[a] < T(0))
+				fat.min[a] += _displacement[a];
+			else
+				fat.max[a] += _displacement[a];
+		}
+
+		return fat;
+	}
+
+	template <typename T>
+	template <typename DescendT, typename VisitT>
+	void DynamicBVH3D<T>::Traverse(DescendT _descend, VisitT _visit) const
+	{
+		uint32_t index = mRoot;
+		uint32_t prev = NullNode;
+		uint32_t depth = 1u;
+
+		while (index != NullNode)
+		{
+			const Node& node = mNodes[index];
+			uint32_t next;
+
+			if (prev == node.parent)
+			{
+				// Coming from parent: test node.
+				if (_descend(node))
+				{
+					_visit(index, depth);
+
+					next = node.IsLeaf() ? node.parent : node.child1;
+				}
+				else
+					next = node.parent;
+			}
+			else if (prev == node.child1)
+				next = node.child2;
+			else
+				next = node.parent;
+
+			depth = next == node.parent ? depth - 1u : depth + 1u;
+
+			prev = index;
+			index = next;
+		}
+	}
+
+//}
+
+
+//{ Nodes
+
+	template <typename T>
+	uint32_t DynamicBVH3D<T>::AllocateNode()
+	{
+		if (mFreeList == NullNode)
+		{
+			mNodes.emplace_back();
+			return static_cast<uint32_t>(mNodes.size() - 1u);
+		}
+
+		const uint32_t index = mFreeList;
+		mFreeList = mNodes[index].parent;
+
+		mNodes[index] = Node{};
+
+		return index;
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::FreeNode(uint32_t _index) noexcept
+	{
+		Node& node = mNodes[_index];
+
+		node.parent = mFreeList;
+		node.child1 = NullNode;
+		node.child2 = NullNode;
+
+		mFreeList = _index;
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::ReplaceChild(uint32_t _parent, uint32_t _oldChild, uint32_t _newChild) noexcept
+	{
+		if (_parent == NullNode)
+		{
+			mRoot = _newChild;
+			return;
+		}
+
+		Node& parent = mNodes[_parent];
+
+		if (parent.child1 == _oldChild)
+			parent.child1 = _newChild;
+		else
+			parent.child2 = _newChild;
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::InsertLeaf(uint32_t _leaf)
+	{
+		if (mRoot == NullNode)
+		{
+			mRoot = _leaf;
+			mNodes[_leaf].parent = NullNode;
+
+			return;
+		}
+
+		const AABB3D<T> leafBox = mNodes[_leaf].box;
+
+
+		// Find best sibling: descend while creating a new parent here costs more than going down.
+		uint32_t index = mRoot;
+
+		while (!mNodes[index].IsLeaf())
+		{
+			const Node& node = mNodes[index];
+
+			const T area = SurfaceArea(node.box);
+			const T combinedArea = SurfaceArea(AABB3D<T>::Merge(node.box, leafBox));
+
+			// Cost of new parent for this node and leaf.
+			const T cost = T(2) * combinedArea;
+
+			// Minimum cost of pushing leaf further down.
+			const T inheritanceCost = T(2) * (combinedArea - area);
+
+			auto childCost = [this, &leafBox, inheritanceCost](uint32_t _child)
+			{
+				const Node& child = mNodes[_child];
+				const T mergedArea = SurfaceArea(AABB3D<T>::Merge(child.box, leafBox));
+
+				return (child.IsLeaf() ? mergedArea : mergedArea - SurfaceArea(child.box)) + inheritanceCost;
+			};
+
+			const T cost1 = childCost(node.child1);
+			const T cost2 = childCost(node.child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? node.child1 : node.child2;
+		}
+
+		const uint32_t sibling = index;
+
+
+		// Create new parent (may reallocate mNodes: no reference kept).
+		const uint32_t oldParent = mNodes[sibling].parent;
+		const uint32_t newParent = AllocateNode();
+
+		mNodes[newParent].parent = oldParent;
+		mNodes[newParent].box = AABB3D<T>::Merge(leafBox, mNodes[sibling].box);
+		mNodes[newParent].child1 = sibling;
+		mNodes[newParent].child2 = _leaf;
+
+		mNodes[sibling].parent = newParent;
+		mNodes[_leaf].parent = newParent;
+
+		ReplaceChild(oldParent, sibling, newParent);
+
+		RefitAncestors(oldParent);
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::RemoveLeaf(uint32_t _leaf) noexcept
+	{
+		if (_leaf == mRoot)
+		{
+			mRoot = NullNode;
+			return;
+		}
+
+		const uint32_t parent = mNodes[_leaf].parent;
+		const uint32_t grandParent = mNodes[parent].parent;
+		const uint32_t sibling = mNodes[parent].child1 == _leaf ? mNodes[parent].child2 : mNodes[parent].child1;
+
+		// Sibling replaces parent.
+		ReplaceChild(grandParent, parent, sibling);
+		mNodes[sibling].parent = grandParent;
+
+		FreeNode(parent);
+
+		RefitAncestors(grandParent);
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::RefitAncestors(uint32_t _index) noexcept
+	{
+		while (_index != NullNode)
+		{
+			Node& node = mNodes[_index];
+
+			node.box = AABB3D<T>::Merge(mNodes[node.child1].box, mNodes[node.child2].box);
+
+			RotateNode(_index);
+
+			_index = node.parent;
+		}
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::RotateNode(uint32_t _index) noexcept
+	{
+		/**
+		*	    A
+		*	  /   \
+		*	 B     C
+		*	/ \   / \
+		*	D E   F G
+		*
+		*	Swapping B with a child of C (or C with a child of B) keeps A bounds:
+		*	only the area of the node receiving the swapped child changes.
+		*/
+
+		const Node& a = mNodes[_index];
+
+		if (a.IsLeaf())
+			return;
+
+		const uint32_t b = a.child1;
+		const uint32_t c = a.child2;
+
+		const Node& nodeB = mNodes[b];
+		const Node& nodeC = mNodes[c];
+
+		T bestDelta = T(0);
+		uint32_t uncle = NullNode;		// Child of A moved down.
+		uint32_t target = NullNode;		// Node receiving uncle.
+		uint32_t nephew = NullNode;		// Child of target moved up.
+
+		auto tryRotation = [this, &bestDelta, &uncle, &target, &nephew](uint32_t _uncle, uint32_t _target)
+		{
+			const Node& tNode = mNodes[_target];
+
+			if (tNode.IsLeaf())
+				return;
+
+			const T targetArea = SurfaceArea(tNode.box);
+			const AABB3D<T>& uncleBox = mNodes[_uncle].box;
+
+			// Swap with child1: target becomes (uncle, child2).
+			const T delta1 = SurfaceArea(AABB3D<T>::Merge(uncleBox, mNodes[tNode.child2].box)) - targetArea;
+
+			if (delta1 < bestDelta)
+			{
+				bestDelta = delta1;
+				uncle = _uncle;
+				target = _target;
+				nephew = tNode.child1;
+			}
+
+			// Swap with child2: target becomes (child1, uncle).
+			const T delta2 = SurfaceArea(AABB3D<T>::Merge(uncleBox, mNodes[tNode.child1].box)) - targetArea;
+
+			if (delta2 < bestDelta)
+			{
+				bestDelta = delta2;
+				uncle = _uncle;
+				target = _target;
+				nephew = tNode.child2;
+			}
+		};
+
+		if (nodeB.IsLeaf() && nodeC.IsLeaf())
+			return;
+
+		tryRotation(b, c);
+		tryRotation(c, b);
+
+		if (target == NullNode)
+			return;
+
+
+		// Apply swap.
+		Node& nodeA = mNodes[_index];
+		Node& tNode = mNodes[target];
+
+		if (nodeA.child1 == uncle)
+			nodeA.child1 = nephew;
+		else
+			nodeA.child2 = nephew;
+
+		mNodes[nephew].parent = _index;
+
+		if (tNode.child1 == nephew)
+			tNode.child1 = uncle;
+		else
+			tNode.child2 = uncle;
+
+		mNodes[uncle].parent = target;
+
+		tNode.box = AABB3D<T>::Merge(mNodes[tNode.child1].box, mNodes[tNode.child2].box);
+	}
+
+//}
+
+
+//{ Proxies
+
+	template <typename T>
+	uint32_t DynamicBVH3D<T>::Insert(const AABB3D<T>& _box)
+	{
+		const uint32_t proxy = AllocateNode();
+
+		mNodes[proxy].box = MakeFatBox(_box, Vec3<T>::Zero);
+
+		InsertLeaf(proxy);
+
+		++mProxyNum;
+
+		return proxy;
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::Remove(uint32_t _proxy) noexcept
+	{
+		SA_ASSERT((OutOfRange, _proxy, 0u, static_cast<uint32_t>(mNodes.size()) - 1u), SA.Maths.BVH.3D);
+		SA_ASSERT((Default, mNodes[_proxy].IsLeaf()), SA.Maths.BVH.3D, L"Proxy must be a leaf!");
+
+		RemoveLeaf(_proxy);
+		FreeNode(_proxy);
+
+		--mProxyNum;
+	}
+
+	template <typename T>
+	bool DynamicBVH3D<T>::Move(uint32_t _proxy, const AABB3D<T>& _box, const Vec3<T>& _displacement)
+	{
+		SA_ASSERT((OutOfRange, _proxy, 0u, static_cast<uint32_t>(mNodes.size()) - 1u), SA.Maths.BVH.3D);
+		SA_ASSERT((Default, mNodes[_proxy].IsLeaf()), SA.Maths.BVH.3D, L"Proxy must be a leaf!");
+
+		const AABB3D<T> fat = MakeFatBox(_box, _displacement);
+		const AABB3D<T>& treeBox = mNodes[_proxy].box;
+
+		if (Contains(treeBox, _box))
+		{
+			// Still inside, but tree box may be too large (previous large displacement).
+			const AABB3D<T> huge{ fat.min - Vec3<T>(T(4) * mMargin), fat.max + Vec3<T>(T(4) * mMargin) };
+
+			if (Contains(huge, treeBox))
+				return false;
+		}
+
+		RemoveLeaf(_proxy);
+
+		mNodes[_proxy].box = fat;
+
+		InsertLeaf(_proxy);
+
+		return true;
+	}
+
+	template <typename T>
+	bool DynamicBVH3D<T>::Refit(uint32_t _proxy, const AABB3D<T>& _box, const Vec3<T>& _displacement) noexcept
+	{
+		SA_ASSERT((OutOfRange, _proxy, 0u, static_cast<uint32_t>(mNodes.size()) - 1u), SA.Maths.BVH.3D);
+		SA_ASSERT((Default, mNodes[_proxy].IsLeaf()), SA.Maths.BVH.3D, L"Proxy must be a leaf!");
+
+		const AABB3D<T> fat = MakeFatBox(_box, _displacement);
+		AABB3D<T>& treeBox = mNodes[_proxy].box;
+
+		if (Contains(treeBox, _box))
+		{
+			const AABB3D<T> huge{ fat.min - Vec3<T>(T(4) * mMargin), fat.max + Vec3<T>(T(4) * mMargin) };
+
+			if (Contains(huge, treeBox))
+				return false;
+		}
+
+		treeBox = fat;
+
+		RefitAncestors(mNodes[_proxy].parent);
+
+		return true;
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::Optimize(uint32_t _nodeNum) noexcept
+	{
+		const uint32_t size = static_cast<uint32_t>(mNodes.size());
+
+		if (size == 0u)
+			return;
+
+		// Free nodes and leaves have no children: RotateNode is a no-op.
+		for (uint32_t i = 0u; i < _nodeNum; ++i)
+		{
+			if (mOptimizeCursor >= size)
+				mOptimizeCursor = 0u;
+
+			RotateNode(mOptimizeCursor++);
+		}
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::Clear() noexcept
+	{
+		mNodes.clear();
+
+		mRoot = NullNode;
+		mFreeList = NullNode;
+		mProxyNum = 0u;
+		mOptimizeCursor = 0u;
+	}
+
+//}
+
+
+//{ Getters
+
+	template <typename T>
+	uint32_t DynamicBVH3D<T>::Size() const noexcept
+	{
+		return mProxyNum;
+	}
+
+	template <typename T>
+	bool DynamicBVH3D<T>::IsEmpty() const noexcept
+	{
+		return mProxyNum == 0u;
+	}
+
+	template <typename T>
+	T DynamicBVH3D<T>::GetMargin() const noexcept
+	{
+		return mMargin;
+	}
+
+	template <typename T>
+	const AABB3D<T>& DynamicBVH3D<T>::GetFatBox(uint32_t _proxy) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _proxy, 0u, static_cast<uint32_t>(mNodes.size()) - 1u), SA.Maths.BVH.3D);
+
+		return mNodes[_proxy].box;
+	}
+
+	template <typename T>
+	uint32_t DynamicBVH3D<T>::GetRoot() const noexcept
+	{
+		return mRoot;
+	}
+
+	template <typename T>
+	const std::vector<typename DynamicBVH3D<T>::Node>& DynamicBVH3D<T>::GetNodes() const noexcept
+	{
+		return mNodes;
+	}
+
+	template <typename T>
+	uint32_t DynamicBVH3D<T>::ComputeHeight() const
+	{
+		uint32_t height = 0u;
+
+		Traverse([](const Node&) { return true; },
+			[&height](uint32_t, uint32_t _depth) { height = std::max(height, _depth); });
+
+		return height;
+	}
+
+	template <typename T>
+	T DynamicBVH3D<T>::ComputeAreaRatio() const
+	{
+		if (mRoot == NullNode)
+			return T(0);
+
+		const T rootArea = SurfaceArea(mNodes[mRoot].box);
+
+		if (rootArea <= T(0))
+			return T(0);
+
+		T totalArea = T(0);
+
+		Traverse([](const Node&) { return true; },
+			[this, &totalArea](uint32_t _index, uint32_t) { totalArea += SurfaceArea(mNodes[_index].box); });
+
+		return (totalArea - rootArea) / rootArea;
+	}
+
+//}
+
+
+//{ Queries
+
+	template <typename T>
+	template <typename CallbackT>
+	void DynamicBVH3D<T>::QueryOverlap(const AABB3D<T>& _box, CallbackT _callback) const
+	{
+		Traverse([&_box](const Node& _node) { return Overlap(_node.box, _box); },
+			[this, &_callback](uint32_t _index, uint32_t)
+			{
+				if (mNodes[_index].IsLeaf())
+					_callback(_index);
+			}
+		);
+	}
+
+	template <typename T>
+	void DynamicBVH3D<T>::QueryOverlap(const AABB3D<T>& _box, std::vector<uint32_t>& _out) const
+	{
+		QueryOverlap(_box, [&_out](uint32_t _proxy) { _out.push_back(_proxy); });
+	}
+
+//}
+}
@@ -0,0 +1,257 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_FRUSTUM_GUARD
+#define SAPPHIRE_MATHS_FRUSTUM_GUARD
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Space/Vector4.hpp>
+#include <SA/Maths/Matrix/Matrix4.hpp>
+#include <SA/Maths/Geometry/AABB3D.hpp>
+
+#if SA_MATHS_FRUSTUM_SIMD
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+ * @file Frustum.hpp
+ *
+ * @brief <b>Frustum</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/// Frustum culling precision.
+	enum class FrustumCull : uint8_t
+	{
+		/**
+		*	Plane tests only (fast).
+		*	Never culls a visible object, but objects near frustum edges and corners may be reported visible.
+		*/
+		Conservative = 1u,
+
+		/**
+		*	Plane tests, then exact refinement of objects crossing a plane:
+		*	separating axis test for boxes, closest point distance for spheres.
+		*/
+		Exact = 2u,
+	};
+
+
+	/**
+	*	@brief \e Frustum Sapphire's class.
+	*
+	*	Convex volume of 6 planes extracted from a (projection * view) matrix (Gribb-Hartmann),
+	*	using the library projection convention: column vectors and clip depth in [0, w] (see Mat4::MakePerspective).
+	*	Planes are normalized and point inward: n.p + d >= 0 inside.
+	*
+	*	Batch culling writes a visibility bitmask: bit (i % 32) of word (i / 32) is set if object i is visible.
+	*
+	*	@tparam T	Type of the frustum.
+	*/
+	template <typename T>
+	class Frustum
+	{
+	public:
+		/// Plane indices.
+		enum PlaneIndex : uint32_t
+		{
+			Left = 0u,
+			Right,
+			Bottom,
+			Top,
+			Near,
+			Far,
+
+			PlaneNum
+		};
+
+		/// Number of corners.
+		static constexpr uint32_t CornerNum = 8u;
+
+		/// Number of objects classified per batch chunk (stack scratch, no allocation).
+		static constexpr uint32_t ChunkSize = 1024u;
+
+	private:
+		/// Planes (xyz: inward normal, w: distance).
+		Vec4<T> mPlanes[PlaneNum];
+
+		/// Planes in Structure-Of-Arrays layout, padded to 8 lanes with always-inside planes.
+		alignas(sizeof(T) * 8) T mPlaneNx[8];
+		alignas(sizeof(T) * 8) T mPlaneNy[8];
+		alignas(sizeof(T) * 8) T mPlaneNz[8];
+		alignas(sizeof(T) * 8) T mPlaneD[8];
+
+		/// Corners (bit 0: right, bit 1: top, bit 2: far).
+		Vec3<T> mCorners[CornerNum];
+
+		/// Corners bounding box (box axes of the separating axis test).
+		AABB3D<T> mBounds;
+
+		/// Maximum number of edge cross axes: 12 frustum edges x 3 box axes.
+		static constexpr uint32_t MaxAxisNum = 36u;
+
+		/// Edge cross axes of the separating axis test.
+		Vec3<T> mAxes[MaxAxisNum];
+
+		/// Frustum projection interval min on mAxes.
+		T mAxisMin[MaxAxisNum];
+
+		/// Frustum projection interval max on mAxes.
+		T mAxisMax[MaxAxisNum];
+
+		/// Number of non-degenerated edge cross axes.
+		uint32_t mAxisNum = 0u;
+
+
+		void ComputeCorners() noexcept;
+		void ComputeAxes() noexcept;
+
+		bool IsVisibleExactAABB(const AABB3D<T>& _box) const noexcept;
+		bool IsVisibleExactSphere(const Vec3<T>& _center, T _radius) const noexcept;
+
+		/**
+		*	Plane classification of _num (<= ChunkSize) boxes.
+		*	Bit set in _visible if no plane culls the box, in _intersect if the box is also not fully inside.
+		*/
+		void ClassifyAABBs(const AABB3D<T>* _boxes, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept;
+
+		/// Plane classification of _num (<= ChunkSize) spheres (same outputs as ClassifyAABBs).
+		void ClassifySpheres(const Vec4<T>* _spheres, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept;
+
+		/// Shared CullAABBs / CullSpheres implementation.
+		template <typename ObjT, typename ClassifyT, typename ExactT>
+		void Cull(const ObjT* _objs, uint32_t _num, uint32_t* _visibility, FrustumCull _mode,
+			ClassifyT _classify, ExactT _exact) const;
+
+	public:
+
+//{ Constructors
+
+		/// Default constructor: clip volume of the identity matrix (x, y in [-1, 1], z in [0, 1]).
+		Frustum() noexcept;
+
+		/**
+		 * @brief \e Value constructor from a (projection * view) matrix.
+		 *
+		 * @tparam major 		Matrix storage layout (same planes for both layouts).
+		 * @param _viewProj 	Matrix from world to clip space.
+		 */
+		template <MatrixMajor major>
+		Frustum(const Mat4<T, major>& _viewProj) noexcept;
+
+//}
+
+
+//{ Getters
+
+		/**
+		 * @brief Getter of plane.
+		 *
+		 * @param _index 	Plane index (PlaneIndex).
+		 * @return normalized inward plane (xyz: normal, w: distance).
+		 */
+		const Vec4<T>& GetPlane(uint32_t _index) const noexcept;
+
+		/**
+		 * @brief Getter of corner.
+		 *
+		 * @param _index 	Corner index (bit 0: right, bit 1: top, bit 2: far).
+		 * @return corner position.
+		 */
+		const Vec3<T>& GetCorner(uint32_t _index) const noexcept;
+
+//}
+
+
+//{ Culling
+
+		/**
+		 * @brief Test box visibility.
+		 *
+		 * @param _box 		Box to test.
+		 * @param _mode 	Culling precision.
+		 * @return true if box may be visible (Conservative) or is visible (Exact).
+		 */
+		bool IsVisible(const AABB3D<T>& _box, FrustumCull _mode = FrustumCull::Conservative) const noexcept;
+
+		/**
+		 * @brief Test sphere visibility.
+		 *
+		 * @param _center 	Sphere center.
+		 * @param _radius 	Sphere radius.
+		 * @param _mode 	Culling precision.
+		 * @return true if sphere may be visible (Conservative) or is visible (Exact).
+		 */
+		bool IsVisible(const Vec3<T>& _center, T _radius, FrustumCull _mode = FrustumCull::Conservative) const noexcept;
+
+		/**
+		 * @brief Batch box culling.
+		 *
+		 * @param _boxes 		Boxes to test.
+		 * @param _num 			Number of boxes.
+		 * @param _visibility 	Output bitmask ((_num + 31) / 32 words). Unused bits of last word are cleared.
+		 * @param _mode 		Culling precision.
+		 */
+		void CullAABBs(const AABB3D<T>* _boxes, uint32_t _num, uint32_t* _visibility,
+			FrustumCull _mode = FrustumCull::Conservative) const;
+
+		/**
+		 * @brief Batch sphere culling.
+		 *
+		 * @param _spheres 		Spheres to test (xyz: center, w: radius).
+		 * @param _num 			Number of spheres.
+		 * @param _visibility 	Output bitmask ((_num + 31) / 32 words). Unused bits of last word are cleared.
+		 * @param _mode 		Culling precision.
+		 */
+		void CullSpheres(const Vec4<T>* _spheres, uint32_t _num, uint32_t* _visibility,
+			FrustumCull _mode = FrustumCull::Conservative) const;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float Frustum.
+	using Frustumf = Frustum<float>;
+
+	/// Alias for double Frustum.
+	using Frustumd = Frustum<double>;
+
+//}
+
+
+	/// \cond Internal
+
+#if SA_MATHS_FRUSTUM_SIMD && SA_INTRISC_SSE
+
+	template <>
+	void Frustumf::ClassifyAABBs(const AABB3D<float>* _boxes, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept;
+
+	template <>
+	void Frustumf::ClassifySpheres(const Vec4<float>* _spheres, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept;
+
+#endif
+
+	/// \endcond
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/Frustum.inl>
+
+#endif // GUARD
@@ -0,0 +1,450 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+	/// \cond Internal
+
+	namespace Intl
+	{
+		/// Intersection point of 3 planes (n.p + d = 0).
+		template <typename T>
+		Vec3<T> FrustumPlanesIntersection(const Vec4<T>& _p1, const Vec4<T>& _p2, const Vec4<T>& _p3) noexcept
+		{
+			const Vec3<T> n1(_p1.x, _p1.y, _p1.z);
+			const Vec3<T> n2(_p2.x, _p2.y, _p2.z);
+			const Vec3<T> n3(_p3.x, _p3.y, _p3.z);
+
+			const Vec3<T> c23 = Vec3<T>::Cross(n2, n3);
+			const Vec3<T> c31 = Vec3<T>::Cross(n3, n1);
+			const Vec3<T> c12 = Vec3<T>::Cross(n1, n2);
+
+			return (c23 * _p1.w + c31 * _p2.w + c12 * _p3.w) / -Vec3<T>::Dot(n1, c23);
+		}
+
+		/// Face corner indices, in order around the face.
+		constexpr uint32_t frustumFaceCorners[6][4] =
+		{
+			{ 0u, 2u, 6u, 4u },		// Left
+			{ 1u, 3u, 7u, 5u },		// Right
+			{ 0u, 1u, 5u, 4u },		// Bottom
+			{ 2u, 3u, 7u, 6u },		// Top
+			{ 0u, 1u, 3u, 2u },		// Near
+			{ 4u, 5u, 7u, 6u },		// Far
+		};
+
+		/// Edge corner indices: 4 lateral, 4 near and 4 far edges.
+		constexpr uint32_t frustumEdges[12][2] =
+		{
+			{ 0u, 4u }, { 1u, 5u }, { 2u, 6u }, { 3u, 7u },
+			{ 0u, 1u }, { 2u, 3u }, { 0u, 2u }, { 1u, 3u },
+			{ 4u, 5u }, { 6u, 7u }, { 4u, 6u }, { 5u, 7u },
+		};
+	}
+
+	/// \endcond
+
+
+//{ Constructors
+
+	template <typename T>
+	Frustum<T>::Frustum() noexcept :
+		Frustum(Mat4<T>::Identity)
+	{
+	}
+
+	template <typename T>
+	template <MatrixMajor major>
+	Frustum<T>::Frustum(const Mat4<T, major>& _viewProj) noexcept
+	{
+		// Gribb-Hartmann: planes are combinations of the matrix rows (logical rows: same for both majors).
+		const T rows[4][4] =
+		{
+			{ _viewProj.e00, _viewProj.e01, _viewProj.e02, _viewProj.e03 },
+			{ _viewProj.e10, _viewProj.e11, _viewProj.e12, _viewProj.e13 },
+			{ _viewProj.e20, _viewProj.e21, _viewProj.e22, _viewProj.e23 },
+			{ _viewProj.e30, _viewProj.e31, _viewProj.e32, _viewProj.e33 },
+		};
+
+		// plane = row3 + sign * row[index] (Near: row2 only, clip depth in [0, w]).
+		constexpr uint32_t rowIndices[PlaneNum] = { 0u, 0u, 1u, 1u, 2u, 2u };
+		constexpr T rowSigns[PlaneNum] = { T(1), T(-1), T(1), T(-1), T(1), T(-1) };
+		constexpr T row3Scales[PlaneNum] = { T(1), T(1), T(1), T(1), T(0), T(1) };
+
+		for (uint32_t i = 0u; i < PlaneNum; ++i)
+		{
+			const T* const row = rows[rowIndices[i]];
+
+			T plane[4];
+
+			for (uint32_t k = 0u; k < 4u; ++k)
+				plane[k] = row3Scales[i] * rows[3][k] + rowSigns[i] * row[k];
+
+			const T length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+
+			SA_ASSERT((Default, length > T(0)), SA.Maths.Frustum, (L"Degenerated frustum plane [%1]", i));
+
+			mPlanes[i] = Vec4<T>(plane[0] / length, plane[1] / length, plane[2] / length, plane[3] / length);
+
+			mPlaneNx[i] = mPlanes[i].x;
+			mPlaneNy[i] = mPlanes[i].y;
+			mPlaneNz[i] = mPlanes[i].z;
+			mPlaneD[i] = mPlanes[i].w;
+		}
+
+		// Padding lanes: always inside.
+		for (uint32_t i = PlaneNum; i < 8u; ++i)
+		{
+			mPlaneNx[i] = mPlaneNy[i] = mPlaneNz[i] = T(0);
+			mPlaneD[i] = T(1);
+		}
+
+		ComputeCorners();
+		ComputeAxes();
+	}
+
+	template <typename T>
+	void Frustum<T>::ComputeCorners() noexcept
+	{
+		for (uint32_t i = 0u; i < CornerNum; ++i)
+		{
+			mCorners[i] = Intl::FrustumPlanesIntersection(
+				mPlanes[(i & 1u) ? Right : Left],
+				mPlanes[(i & 2u) ? Top : Bottom],
+				mPlanes[(i & 4u) ? Far : Near]
+			);
+		}
+
+		mBounds.min = mCorners[0];
+		mBounds.max = mCorners[0];
+
+		for (uint32_t i = 1u; i < CornerNum; ++i)
+		{
+			mBounds.min = Vec3<T>(std::min(mBounds.min.x, mCorners[i].x), std::min(mBounds.min.y, mCorners[i].y), std::min(mBounds.min.z, mCorners[i].z));
+			mBounds.max = Vec3<T>(std::max(mBounds.max.x, mCorners[i].x), std::max(mBounds.max.y, mCorners[i].y), std::max(mBounds.max.z, mCorners[i].z));
+		}
+	}
+
+	template <typename T>
+	void Frustum<T>::ComputeAxes() noexcept
+	{
+		mAxisNum = 0u;
+
+		for (const auto& edgeCorners : Intl::frustumEdges)
+		{
+			const Vec3<T> edge = mCorners[edgeCorners[1]] - mCorners[edgeCorners[0]];
+
+			// edge x box axes (X, Y, Z).
+			const Vec3<T> axes[3] =
+			{
+				Vec3<T>(T(0), edge.z, -edge.y),
+				Vec3<T>(-edge.z, T(0), edge.x),
+				Vec3<T>(edge.y, -edge.x, T(0)),
+			};
+
+			for (const auto& axis : axes)
+			{
+				// Edge parallel to box axis: no new separating direction.
+				if (axis.SqrLength() <= std::numeric_limits<T>::epsilon() * edge.SqrLength())
+					continue;
+
+				T pMin = Vec3<T>::Dot(mCorners[0], axis);
+				T pMax = pMin;
+
+				for (uint32_t i = 1u; i < CornerNum; ++i)
+				{
+					const T p = Vec3<T>::Dot(mCorners[i], axis);
+
+					pMin = std::min(pMin, p);
+					pMax = std::max(pMax, p);
+				}
+
+				mAxes[mAxisNum] = axis;
+				mAxisMin[mAxisNum] = pMin;
+				mAxisMax[mAxisNum] = pMax;
+				++mAxisNum;
+			}
+		}
+	}
+
+//}
+
+
+//{ Getters
+
+	template <typename T>
+	const Vec4<T>& Frustum<T>::GetPlane(uint32_t _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, PlaneNum - 1u), SA.Maths.Frustum);
+
+		return mPlanes[_index];
+	}
+
+	template <typename T>
+	const Vec3<T>& Frustum<T>::GetCorner(uint32_t _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, CornerNum - 1u), SA.Maths.Frustum);
+
+		return mCorners[_index];
+	}
+
+//}
+
+
+//{ Exact
+
+	template <typename T>
+	bool Frustum<T>::IsVisibleExactAABB(const AABB3D<T>& _box) const noexcept
+	{
+		// Separating axis test: frustum planes are already tested, remains box axes and edge cross axes.
+		if (!_box.IsColliding(mBounds))
+			return false;
+
+		const Vec3<T> center = (_box.min + _box.max) * T(0.5);
+		const Vec3<T> extents = (_box.max - _box.min) * T(0.5);
+
+		for (uint32_t i = 0u; i < mAxisNum; ++i)
+		{
+			const Vec3<T>& axis = mAxes[i];
+
+			const T proj = Vec3<T>::Dot(center, axis);
+			const T radius = extents.x * std::abs(axis.x) + extents.y * std::abs(axis.y) + extents.z * std::abs(axis.z);
+
+			if (proj + radius < mAxisMin[i] || proj - radius > mAxisMax[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	bool Frustum<T>::IsVisibleExactSphere(const Vec3<T>& _center, T _radius) const noexcept
+	{
+		// Closest point of the frustum lies on a face the center is outside of.
+		const T sqrRadius = _radius * _radius;
+
+		bool bOutside = false;
+
+		for (uint32_t f = 0u; f < PlaneNum; ++f)
+		{
+			const Vec4<T>& plane = mPlanes[f];
+			const Vec3<T> normal(plane.x, plane.y, plane.z);
+
+			const T dist = Vec3<T>::Dot(normal, _center) + plane.w;
+
+			if (dist >= T(0))
+				continue;
+
+			bOutside = true;
+
+			// Projection inside face polygon: plane distance.
+			const Vec3<T> proj = _center - normal * dist;
+			const uint32_t* const face = Intl::frustumFaceCorners[f];
+
+			bool bPositive = true;
+			bool bNegative = true;
+
+			for (uint32_t e = 0u; e < 4u; ++e)
+			{
+				const Vec3<T>& a = mCorners[face[e]];
+				const Vec3<T>& b = mCorners[face[(e + 1u) & 3u]];
+
+				const T side = Vec3<T>::Dot(Vec3<T>::Cross(b - a, proj - a), normal);
+
+				bPositive &= side >= T(0);
+				bNegative &= side <= T(0);
+			}
+
+			if (bPositive || bNegative)
+			{
+				if (dist * dist <= sqrRadius)
+					return true;
+
+				continue;
+			}
+
+			// Otherwise: closest point is on a face edge.
+			for (uint32_t e = 0u; e < 4u; ++e)
+			{
+				const Vec3<T>& a = mCorners[face[e]];
+				const Vec3<T> ab = mCorners[face[(e + 1u) & 3u]] - a;
+
+				const T t = std::clamp(Vec3<T>::Dot(_center - a, ab) / ab.SqrLength(), T(0), T(1));
+
+				if ((a + ab * t - _center).SqrLength() <= sqrRadius)
+					return true;
+			}
+		}
+
+		// Center inside every plane.
+		return !bOutside;
+	}
+
+//}
+
+
+//{ Culling
+
+	template <typename T>
+	bool Frustum<T>::IsVisible(const AABB3D<T>& _box, FrustumCull _mode) const noexcept
+	{
+		uint32_t visible = 0u;
+		uint32_t intersect = 0u;
+
+		ClassifyAABBs(&_box, 1u, &visible, &intersect);
+
+		if (_mode == FrustumCull::Exact && (visible & intersect))
+			return IsVisibleExactAABB(_box);
+
+		return visible;
+	}
+
+	template <typename T>
+	bool Frustum<T>::IsVisible(const Vec3<T>& _center, T _radius, FrustumCull _mode) const noexcept
+	{
+		const Vec4<T> sphere(_center, _radius);
+
+		uint32_t visible = 0u;
+		uint32_t intersect = 0u;
+
+		ClassifySpheres(&sphere, 1u, &visible, &intersect);
+
+		if (_mode == FrustumCull::Exact && (visible & intersect))
+			return IsVisibleExactSphere(_center, _radius);
+
+		return visible;
+	}
+
+	template <typename T>
+	void Frustum<T>::ClassifyAABBs(const AABB3D<T>* _boxes, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept
+	{
+		for (uint32_t w = 0u; w < (_num + 31u) / 32u; ++w)
+		{
+			_visible[w] = 0u;
+			_intersect[w] = 0u;
+		}
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			const AABB3D<T>& box = _boxes[i];
+
+			const T cx = (box.min.x + box.max.x) * T(0.5);
+			const T cy = (box.min.y + box.max.y) * T(0.5);
+			const T cz = (box.min.z + box.max.z) * T(0.5);
+
+			const T ex = (box.max.x - box.min.x) * T(0.5);
+			const T ey = (box.max.y - box.min.y) * T(0.5);
+			const T ez = (box.max.z - box.min.z) * T(0.5);
+
+			bool bVisible = true;
+			bool bInside = true;
+
+			for (uint32_t p = 0u; p < PlaneNum; ++p)
+			{
+				const T dist = mPlaneNx[p] * cx + mPlaneNy[p] * cy + mPlaneNz[p] * cz + mPlaneD[p];
+				const T radius = std::abs(mPlaneNx[p]) * ex + std::abs(mPlaneNy[p]) * ey + std::abs(mPlaneNz[p]) * ez;
+
+				bVisible &= dist + radius >= T(0);
+				bInside &= dist - radius >= T(0);
+			}
+
+			_visible[i / 32u] |= uint32_t(bVisible) << (i % 32u);
+			_intersect[i / 32u] |= uint32_t(!bInside) << (i % 32u);
+		}
+	}
+
+	template <typename T>
+	void Frustum<T>::ClassifySpheres(const Vec4<T>* _spheres, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept
+	{
+		for (uint32_t w = 0u; w < (_num + 31u) / 32u; ++w)
+		{
+			_visible[w] = 0u;
+			_intersect[w] = 0u;
+		}
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			const Vec4<T>& sphere = _spheres[i];
+
+			bool bVisible = true;
+			bool bInside = true;
+
+			for (uint32_t p = 0u; p < PlaneNum; ++p)
+			{
+				const T dist = mPlaneNx[p] * sphere.x + mPlaneNy[p] * sphere.y + mPlaneNz[p] * sphere.z + mPlaneD[p];
+
+				bVisible &= dist + sphere.w >= T(0);
+				bInside &= dist - sphere.w >= T(0);
+			}
+
+			_visible[i / 32u] |= uint32_t(bVisible) << (i % 32u);
+			_intersect[i / 32u] |= uint32_t(!bInside) << (i % 32u);
+		}
+	}
+
+	template <typename T>
+	template <typename ObjT, typename ClassifyT, typename ExactT>
+	void Frustum<T>::Cull(const ObjT* _objs, uint32_t _num, uint32_t* _visibility, FrustumCull _mode,
+		ClassifyT _classify, ExactT _exact) const
+	{
+		uint32_t intersect[ChunkSize / 32u];
+
+		for (uint32_t start = 0u; start < _num; start += ChunkSize)
+		{
+			const uint32_t num = std::min(ChunkSize, _num - start);
+
+			uint32_t* const visible = _visibility + start / 32u;
+
+			_classify(_objs + start, num, visible, intersect);
+
+			if (_mode != FrustumCull::Exact)
+				continue;
+
+			// Refine objects crossing a plane only.
+			for (uint32_t w = 0u; w < (num + 31u) / 32u; ++w)
+			{
+				const uint32_t bits = visible[w] & intersect[w];
+
+				if (bits == 0u)
+					continue;
+
+				for (uint32_t b = 0u; b < 32u; ++b)
+				{
+					if (((bits >> b) & 1u) && !_exact(_objs[start + w * 32u + b]))
+						visible[w] &= ~(1u << b);
+				}
+			}
+		}
+	}
+
+	template <typename T>
+	void Frustum<T>::CullAABBs(const AABB3D<T>* _boxes, uint32_t _num, uint32_t* _visibility, FrustumCull _mode) const
+	{
+		Cull(_boxes, _num, _visibility, _mode,
+			[this](const AABB3D<T>* _objs, uint32_t _n, uint32_t* _visible, uint32_t* _intersect)
+			{
+				ClassifyAABBs(_objs, _n, _visible, _intersect);
+			},
+			[this](const AABB3D<T>& _box)
+			{
+				return IsVisibleExactAABB(_box);
+			}
+		);
+	}
+
+	template <typename T>
+	void Frustum<T>::CullSpheres(const Vec4<T>* _spheres, uint32_t _num, uint32_t* _visibility, FrustumCull _mode) const
+	{
+		Cull(_spheres, _num, _visibility, _mode,
+			[this](const Vec4<T>* _objs, uint32_t _n, uint32_t* _visible, uint32_t* _intersect)
+			{
+				ClassifySpheres(_objs, _n, _visible, _intersect);
+			},
+			[this](const Vec4<T>& _sphere)
+			{
+				return IsVisibleExactSphere(Vec3<T>(_sphere.x, _sphere.y, _sphere.z), _sphere.w);
+			}
+		);
+	}
+
+//}
+}
@@ -0,0 +1,204 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_OBB3D_GUARD
+#define SAPPHIRE_MATHS_OBB3D_GUARD
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Matrix/Matrix3.hpp>
+#include <SA/Maths/Geometry/Sphere.hpp>
+
+/**
+ * @file OBB3D.hpp
+ *
+ * @brief <b>OBB 3D</b> (Oriented Bounding Box) type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e OBB \e 3D Sapphire's class.
+	*
+	*	Box of half-size extents along 3 orthonormal axes around center.
+	*	Box collisions use the separating axis theorem (15 axes for OBB / OBB).
+	*	Collision tests include the boundary (touching volumes collide), like AABB3D::IsColliding.
+	*
+	*	@tparam T	Type of the OBB.
+	*/
+	template <typename T>
+	struct OBB3D
+	{
+		/// Number of box corners.
+		static constexpr uint32_t CornerNum = 8u;
+
+		/// Box center.
+		Vec3<T> center;
+
+		/// Box local axes (orthonormal).
+		Vec3<T> axes[3] = {
+			Vec3<T>(T(1), T(0), T(0)),
+			Vec3<T>(T(0), T(1), T(0)),
+			Vec3<T>(T(0), T(0), T(1))
+		};
+
+		/// Half-size along each local axis.
+		Vec3<T> extents;
+
+
+//{ Constructors
+
+		/// Default constructor.
+		OBB3D() = default;
+
+		/**
+		 * @brief \e Value constructor from rotation matrix.
+		 *
+		 * @tparam major 		Matrix major.
+		 * @param _center 		Box center.
+		 * @param _rotation 	Rotation matrix: columns are the box axes.
+		 * @param _extents 		Half-size along each local axis.
+		 */
+		template <MatrixMajor major>
+		OBB3D(const Vec3<T>& _center, const Mat3<T, major>& _rotation, const Vec3<T>& _extents) noexcept;
+
+		/**
+		 * @brief \e Value constructor from rotation quaternion.
+		 *
+		 * @param _center 		Box center.
+		 * @param _rotation 	Normalized rotation quaternion.
+		 * @param _extents 		Half-size along each local axis.
+		 */
+		OBB3D(const Vec3<T>& _center, const Quat<T>& _rotation, const Vec3<T>& _extents) noexcept;
+
+		/**
+		 * @brief Constructor from AABB3D (world axes).
+		 *
+		 * @param _box 	Axis aligned box.
+		 */
+		OBB3D(const AABB3D<T>& _box) noexcept;
+
+//}
+
+
+//{ Collisions
+
+		/**
+		 * @brief Point containment test.
+		 *
+		 * @param _point 	Point to test.
+		 * @return true if _point is inside or on the box.
+		 */
+		bool Contains(const Vec3<T>& _point) const noexcept;
+
+		/**
+		 * @brief SAT OBB / OBB intersection test (15 axes, branchless).
+		 *
+		 * @param _other 	Other box.
+		 * @return true if boxes intersect.
+		 */
+		bool IsColliding(const OBB3D& _other) const noexcept;
+
+		/**
+		 * @brief SAT OBB / AABB intersection test.
+		 * Same result as IsColliding(OBB3D(_box)) without the axes products.
+		 *
+		 * @param _box 	Axis aligned box.
+		 * @return true if boxes intersect.
+		 */
+		bool IsColliding(const AABB3D<T>& _box) const noexcept;
+
+		/**
+		 * @brief OBB / sphere intersection test (squared distance to closest box point).
+		 *
+		 * @param _sphere 	Sphere to test.
+		 * @return true if box and sphere intersect.
+		 */
+		bool IsColliding(const Sphere<T>& _sphere) const noexcept;
+
+//}
+
+
+//{ Geometry
+
+		/**
+		 * @brief Closest box point.
+		 *
+		 * @param _point 	Point to project.
+		 * @return _point if inside, closest point on the box surface otherwise.
+		 */
+		Vec3<T> ClosestPoint(const Vec3<T>& _point) const noexcept;
+
+		/**
+		 * @brief Getter of box corner.
+		 *
+		 * @param _index 	Corner index: bit i set for +extents[i] along axes[i].
+		 * @return box corner.
+		 */
+		Vec3<T> GetCorner(uint32_t _index) const noexcept;
+
+		/**
+		 * @brief Compute bounding box.
+		 *
+		 * @return tightest AABB3D containing the box.
+		 */
+		AABB3D<T> ComputeAABB() const noexcept;
+
+//}
+
+
+//{ Transformation
+
+		/**
+		 * @brief Transform box by an affine matrix.
+		 * Exact when the matrix keeps the box axes orthogonal (rotation, translation, scale along box axes).
+		 * Otherwise (shear), the result is a box containing the transformed volume.
+		 *
+		 * @tparam major 	Matrix major.
+		 * @param _mat 		Affine transformation matrix (invertible 3x3 part).
+		 * @return transformed box.
+		 */
+		template <MatrixMajor major>
+		OBB3D Transform(const Mat4<T, major>& _mat) const;
+
+		/**
+		 * @brief Transform box by a transform (scale, then rotation, then translation).
+		 * Exact without TrScale component (uniform scale), uses Transform(_tr.Matrix()) otherwise.
+		 *
+		 * @tparam TrArgs 	Transform components.
+		 * @param _tr 		Transform with non-null scale.
+		 * @return transformed box.
+		 */
+		template <template <typename> typename... TrArgs>
+		OBB3D Transform(const Tr<T, TrArgs...>& _tr) const;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float OBB3D.
+	using OBB3Df = OBB3D<float>;
+
+	/// Alias for double OBB3D.
+	using OBB3Dd = OBB3D<double>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/OBB3D.inl>
+
+#endif // GUARD
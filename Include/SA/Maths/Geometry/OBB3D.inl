@@ -0,0 +1,306 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+	/// \cond Internal
+
+	namespace Intl
+	{
+		/// Added to |R| terms: avoids false separation on near parallel edges (null cross product axes).
+		template <typename T>
+		constexpr T obbParallelEpsilon = std::numeric_limits<T>::epsilon() * T(16);
+
+		/**
+		*	SAT separation test of box B from box A (Ericson, Real-Time Collision Detection 4.4.1).
+		*	_R[i][j] = Dot(A.axes[i], B.axes[j]), _t = B.center - A.center in A frame.
+		*	Branchless: every axis is tested (same operations as the OBB3DPack SIMD implementation).
+		*/
+		template <typename T>
+		bool OBBSeparated(const T (&_R)[3][3], const T (&_t)[3], const T (&_ea)[3], const T (&_eb)[3]) noexcept
+		{
+			T absR[3][3];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				for (uint32_t j = 0u; j < 3u; ++j)
+					absR[i][j] = std::abs(_R[i][j]) + obbParallelEpsilon<T>;
+			}
+
+			bool bSeparated = false;
+
+			// A axes.
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				const T rb = _eb[0] * absR[i][0] + _eb[1] * absR[i][1] + _eb[2] * absR[i][2];
+
+				bSeparated |= std::abs(_t[i]) > _ea[i] + rb;
+			}
+
+			// B axes.
+			for (uint32_t j = 0u; j < 3u; ++j)
+			{
+				const T ra = _ea[0] * absR[0][j] + _ea[1] * absR[1][j] + _ea[2] * absR[2][j];
+				const T dist = _t[0] * _R[0][j] + _t[1] * _R[1][j] + _t[2] * _R[2][j];
+
+				bSeparated |= std::abs(dist) > ra + _eb[j];
+			}
+
+			// A.axes[i] x B.axes[j].
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				const uint32_t i1 = (i + 1u) % 3u;
+				const uint32_t i2 = (i + 2u) % 3u;
+
+				for (uint32_t j = 0u; j < 3u; ++j)
+				{
+					const uint32_t j1 = (j + 1u) % 3u;
+					const uint32_t j2 = (j + 2u) % 3u;
+
+					const T ra = _ea[i1] * absR[i2][j] + _ea[i2] * absR[i1][j];
+					const T rb = _eb[j1] * absR[i][j2] + _eb[j2] * absR[i][j1];
+					const T dist = _t[i2] * _R[i1][j] - _t[i1] * _R[i2][j];
+
+					bSeparated |= std::abs(dist) > ra + rb;
+				}
+			}
+
+			return bSeparated;
+		}
+	}
+
+	/// \endcond
+
+
+//{ Constructors
+
+	template <typename T>
+	template <MatrixMajor major>
+	OBB3D<T>::OBB3D(const Vec3<T>& _center, const Mat3<T, major>& _rotation, const Vec3<T>& _extents) noexcept :
+		center{ _center },
+		axes{
+			Vec3<T>(_rotation.e00, _rotation.e10, _rotation.e20),
+			Vec3<T>(_rotation.e01, _rotation.e11, _rotation.e21),
+			Vec3<T>(_rotation.e02, _rotation.e12, _rotation.e22)
+		},
+		extents{ _extents }
+	{
+	}
+
+	template <typename T>
+	OBB3D<T>::OBB3D(const Vec3<T>& _center, const Quat<T>& _rotation, const Vec3<T>& _extents) noexcept :
+		center{ _center },
+		axes{
+			_rotation.Rotate(Vec3<T>(T(1), T(0), T(0))),
+			_rotation.Rotate(Vec3<T>(T(0), T(1), T(0))),
+			_rotation.Rotate(Vec3<T>(T(0), T(0), T(1)))
+		},
+		extents{ _extents }
+	{
+		SA_WARN(_rotation.IsNormalized(), SA.Maths.OBB.3D, L"Quaternion should be normalized!");
+	}
+
+	template <typename T>
+	OBB3D<T>::OBB3D(const AABB3D<T>& _box) noexcept :
+		center{ (_box.min + _box.max) * T(0.5) },
+		extents{ (_box.max - _box.min) * T(0.5) }
+	{
+	}
+
+//}
+
+
+//{ Collisions
+
+	template <typename T>
+	bool OBB3D<T>::Contains(const Vec3<T>& _point) const noexcept
+	{
+		const Vec3<T> dir = _point - center;
+
+		bool bInside = true;
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+			bInside &= std::abs(Vec3<T>::Dot(dir, axes[i])) <= extents[i];
+
+		return bInside;
+	}
+
+	template <typename T>
+	bool OBB3D<T>::IsColliding(const OBB3D& _other) const noexcept
+	{
+		const Vec3<T> dir = _other.center - center;
+
+		T R[3][3];
+		T t[3];
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+		{
+			const Vec3<T>& axis = axes[i];
+
+			for (uint32_t j = 0u; j < 3u; ++j)
+				R[i][j] = axis.x * _other.axes[j].x + axis.y * _other.axes[j].y + axis.z * _other.axes[j].z;
+
+			t[i] = dir.x * axis.x + dir.y * axis.y + dir.z * axis.z;
+		}
+
+		const T ea[3] = { extents.x, extents.y, extents.z };
+		const T eb[3] = { _other.extents.x, _other.extents.y, _other.extents.z };
+
+		return !Intl::OBBSeparated(R, t, ea, eb);
+	}
+
+	template <typename T>
+	bool OBB3D<T>::IsColliding(const AABB3D<T>& _box) const noexcept
+	{
+		const Vec3<T> boxCenter = (_box.min + _box.max) * T(0.5);
+		const Vec3<T> boxExtents = (_box.max - _box.min) * T(0.5);
+
+		const Vec3<T> dir = boxCenter - center;
+
+		T R[3][3];
+		T t[3];
+
+		// Box axes are world axes: R[i][j] = axes[i][j].
+		for (uint32_t i = 0u; i < 3u; ++i)
+		{
+			const Vec3<T>& axis = axes[i];
+
+			R[i][0] = axis.x;
+			R[i][1] = axis.y;
+			R[i][2] = axis.z;
+
+			t[i] = dir.x * axis.x + dir.y * axis.y + dir.z * axis.z;
+		}
+
+		const T ea[3] = { extents.x, extents.y, extents.z };
+		const T eb[3] = { boxExtents.x, boxExtents.y, boxExtents.z };
+
+		return !Intl::OBBSeparated(R, t, ea, eb);
+	}
+
+	template <typename T>
+	bool OBB3D<T>::IsColliding(const Sphere<T>& _sphere) const noexcept
+	{
+		return (ClosestPoint(_sphere.center) - _sphere.center).SqrLength() <= _sphere.radius * _sphere.radius;
+	}
+
+//}
+
+
+//{ Geometry
+
+	template <typename T>
+	Vec3<T> OBB3D<T>::ClosestPoint(const Vec3<T>& _point) const noexcept
+	{
+		const Vec3<T> dir = _point - center;
+
+		Vec3<T> out = center;
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+			out += axes[i] * std::clamp(Vec3<T>::Dot(dir, axes[i]), -extents[i], extents[i]);
+
+		return out;
+	}
+
+	template <typename T>
+	Vec3<T> OBB3D<T>::GetCorner(uint32_t _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, CornerNum - 1u), SA.Maths.OBB.3D);
+
+		Vec3<T> out = center;
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+			out += axes[i] * ((_index >> i) & 1u ? extents[i] : -extents[i]);
+
+		return out;
+	}
+
+	template <typename T>
+	AABB3D<T> OBB3D<T>::ComputeAABB() const noexcept
+	{
+		Vec3<T> half;
+
+		for (uint32_t k = 0u; k < 3u; ++k)
+			half[k] = std::abs(axes[0][k]) * extents.x + std::abs(axes[1][k]) * extents.y + std::abs(axes[2][k]) * extents.z;
+
+		return AABB3D<T>(center - half, center + half);
+	}
+
+//}
+
+
+//{ Transformation
+
+	template <typename T>
+	template <MatrixMajor major>
+	OBB3D<T> OBB3D<T>::Transform(const Mat4<T, major>& _mat) const
+	{
+		OBB3D out;
+
+		out.center = Vec3<T>(
+			_mat.e00 * center.x + _mat.e01 * center.y + _mat.e02 * center.z + _mat.e03,
+			_mat.e10 * center.x + _mat.e11 * center.y + _mat.e12 * center.z + _mat.e13,
+			_mat.e20 * center.x + _mat.e21 * center.y + _mat.e22 * center.z + _mat.e23
+		);
+
+		// Transformed (non-normalized) axes.
+		Vec3<T> dirs[3];
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+		{
+			const Vec3<T>& axis = axes[i];
+
+			dirs[i] = Vec3<T>(
+				_mat.e00 * axis.x + _mat.e01 * axis.y + _mat.e02 * axis.z,
+				_mat.e10 * axis.x + _mat.e11 * axis.y + _mat.e12 * axis.z,
+				_mat.e20 * axis.x + _mat.e21 * axis.y + _mat.e22 * axis.z
+			);
+		}
+
+		// Gram-Schmidt: same axes as dirs when _mat keeps them orthogonal.
+		out.axes[0] = dirs[0].GetNormalized();
+		out.axes[1] = (dirs[1] - out.axes[0] * Vec3<T>::Dot(dirs[1], out.axes[0])).GetNormalized();
+		out.axes[2] = Vec3<T>::Cross(out.axes[0], out.axes[1]);
+
+		// Projection of the transformed volume on each new axis.
+		for (uint32_t k = 0u; k < 3u; ++k)
+		{
+			out.extents[k] = extents.x * std::abs(Vec3<T>::Dot(dirs[0], out.axes[k])) +
+				extents.y * std::abs(Vec3<T>::Dot(dirs[1], out.axes[k])) +
+				extents.z * std::abs(Vec3<T>::Dot(dirs[2], out.axes[k]));
+		}
+
+		return out;
+	}
+
+	template <typename T>
+	template <template <typename> typename... TrArgs>
+	OBB3D<T> OBB3D<T>::Transform(const Tr<T, TrArgs...>& _tr) const
+	{
+		if constexpr (TrHasComponent<TrScale>())
+		{
+			// Non-uniform scale is applied before rotation: box axes may be sheared.
+			return Transform(_tr.Matrix());
+		}
+		else
+		{
+			const Vec3<T> scale = Intl::TrComputeScale(_tr);
+
+			OBB3D out;
+
+			out.center = Intl::TrTransformPoint(_tr, scale, center);
+			out.extents = extents * std::abs(scale.x);
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				if constexpr (TrHasComponent<TrRotation>())
+					out.axes[i] = _tr.rotation.Rotate(axes[i]);
+				else
+					out.axes[i] = axes[i];
+			}
+
+			return out;
+		}
+	}
+
+//}
+}
@@ -0,0 +1,191 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_OBB3D_PACK_GUARD
+#define SAPPHIRE_MATHS_OBB3D_PACK_GUARD
+
+#include <cstdint>
+#include <limits>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Geometry/OBB3D.hpp>
+
+#if SA_MATHS_OBB3D_PACK_SIMD
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+ * @file OBB3DPack.hpp
+ *
+ * @brief <b>OBB 3D Pack</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e OBB \e 3D \e Pack Sapphire's class.
+	*
+	*	N oriented boxes in Structure-Of-Arrays layout (one box per SIMD lane)
+	*	to run the SAT test of one query box against N boxes at once.
+	*	Unused lanes hold an empty box (negative infinite extents) separated from any finite box.
+	*
+	*	@tparam T	Type of the OBB.
+	*	@tparam N	Number of boxes (lanes).
+	*/
+	template <typename T, uint32_t N>
+	struct alignas(sizeof(T) * N) OBB3DPack
+	{
+		static_assert(N > 0u && N <= 32u, "OBB3DPack lane count must fit in a 32 bits mask.");
+		static_assert((N & (N - 1u)) == 0u, "OBB3DPack lane count must be a power of 2 (lanes are aligned on sizeof(T) * N).");
+
+		/// Number of lanes.
+		static constexpr uint32_t Width = N;
+
+		/// Center lanes: center[k][lane] is component k of the lane center.
+		alignas(sizeof(T) * N) T center[3][N];
+
+		/// Axes lanes: axes[i][k][lane] is component k of the lane axis i.
+		alignas(sizeof(T) * N) T axes[3][3][N];
+
+		/// Extents lanes: extents[i][lane] is the lane half-size along axis i.
+		alignas(sizeof(T) * N) T extents[3][N];
+
+
+//{ Constructors
+
+		/// Default constructor: every lane is empty.
+		OBB3DPack() noexcept;
+
+		/**
+		 * @brief \e Value constructor from boxes.
+		 *
+		 * @param _boxes 	Boxes to pack.
+		 * @param _num 		Number of boxes (<= N): remaining lanes are empty.
+		 */
+		OBB3DPack(const OBB3D<T>* _boxes, uint32_t _num) noexcept;
+
+//}
+
+
+//{ Lanes
+
+		/**
+		 * @brief Set lane box.
+		 *
+		 * @param _lane 	Lane index.
+		 * @param _box 		Box to store.
+		 */
+		void Set(uint32_t _lane, const OBB3D<T>& _box) noexcept;
+
+		/**
+		 * @brief Get lane box.
+		 *
+		 * @param _lane 	Lane index.
+		 * @return lane box.
+		 */
+		OBB3D<T> Get(uint32_t _lane) const noexcept;
+
+		/**
+		 * @brief Set lane to empty box (never overlaps a finite box).
+		 *
+		 * @param _lane 	Lane index.
+		 */
+		void SetEmpty(uint32_t _lane) noexcept;
+
+//}
+
+
+//{ Collision
+
+		/**
+		 * @brief SAT test of _query against every lane.
+		 * Same semantic as OBB3D::IsColliding(const OBB3D&) (lane box as this).
+		 *
+		 * @param _query 	Query box.
+		 * @return bitmask of overlapping lanes (bit i set for lane i).
+		 */
+		uint32_t OverlapMask(const OBB3D<T>& _query) const noexcept;
+
+		/**
+		 * @brief SAT test of _query against every lane.
+		 * Same semantic as OBB3D::IsColliding(const AABB3D&) (lane box as this).
+		 *
+		 * @param _query 	Query box.
+		 * @return bitmask of overlapping lanes (bit i set for lane i).
+		 */
+		uint32_t OverlapMask(const AABB3D<T>& _query) const noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Template alias of 4 lanes OBB3DPack.
+	template <typename T>
+	using OBB3DPack4 = OBB3DPack<T, 4u>;
+
+	/// Template alias of 8 lanes OBB3DPack.
+	template <typename T>
+	using OBB3DPack8 = OBB3DPack<T, 8u>;
+
+	/// Alias for float OBB3DPack4.
+	using OBB3DPack4f = OBB3DPack4<float>;
+
+	/// Alias for double OBB3DPack4.
+	using OBB3DPack4d = OBB3DPack4<double>;
+
+	/// Alias for float OBB3DPack8.
+	using OBB3DPack8f = OBB3DPack8<float>;
+
+	/// Alias for double OBB3DPack8.
+	using OBB3DPack8d = OBB3DPack8<double>;
+
+//}
+
+
+	/// \cond Internal
+
+#if SA_MATHS_OBB3D_PACK_SIMD && SA_INTRISC_SSE
+
+	template <>
+	uint32_t OBB3DPack4f::OverlapMask(const OBB3D<float>& _query) const noexcept;
+
+	template <>
+	uint32_t OBB3DPack4f::OverlapMask(const AABB3D<float>& _query) const noexcept;
+
+#endif
+
+#if SA_MATHS_OBB3D_PACK_SIMD && SA_INTRISC_AVX
+
+	template <>
+	uint32_t OBB3DPack8f::OverlapMask(const OBB3D<float>& _query) const noexcept;
+
+	template <>
+	uint32_t OBB3DPack8f::OverlapMask(const AABB3D<float>& _query) const noexcept;
+
+	template <>
+	uint32_t OBB3DPack4d::OverlapMask(const OBB3D<double>& _query) const noexcept;
+
+	template <>
+	uint32_t OBB3DPack4d::OverlapMask(const AABB3D<double>& _query) const noexcept;
+
+#endif
+
+	/// \endcond
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/OBB3DPack.inl>
+
+#endif // GUARD
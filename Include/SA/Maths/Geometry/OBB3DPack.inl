@@ -0,0 +1,159 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T, uint32_t N>
+	OBB3DPack<T, N>::OBB3DPack() noexcept
+	{
+		for (uint32_t i = 0u; i < N; ++i)
+			SetEmpty(i);
+	}
+
+	template <typename T, uint32_t N>
+	OBB3DPack<T, N>::OBB3DPack(const OBB3D<T>* _boxes, uint32_t _num) noexcept
+	{
+		SA_ASSERT((Default, _num <= N), SA.Maths.OBB.3D, (L"Box count [%1] exceeds pack width [%2]!", _num, N));
+
+		uint32_t i = 0u;
+
+		for (; i < _num; ++i)
+			Set(i, _boxes[i]);
+
+		for (; i < N; ++i)
+			SetEmpty(i);
+	}
+
+//}
+
+
+//{ Lanes
+
+	template <typename T, uint32_t N>
+	void OBB3DPack<T, N>::Set(uint32_t _lane, const OBB3D<T>& _box) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.OBB.3D);
+
+		for (uint32_t k = 0u; k < 3u; ++k)
+		{
+			center[k][_lane] = _box.center[k];
+			extents[k][_lane] = _box.extents[k];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+				axes[i][k][_lane] = _box.axes[i][k];
+		}
+	}
+
+	template <typename T, uint32_t N>
+	OBB3D<T> OBB3DPack<T, N>::Get(uint32_t _lane) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.OBB.3D);
+
+		OBB3D<T> box;
+
+		for (uint32_t k = 0u; k < 3u; ++k)
+		{
+			box.center[k] = center[k][_lane];
+			box.extents[k] = extents[k][_lane];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+				box.axes[i][k] = axes[i][k][_lane];
+		}
+
+		return box;
+	}
+
+	template <typename T, uint32_t N>
+	void OBB3DPack<T, N>::SetEmpty(uint32_t _lane) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.OBB.3D);
+
+		// Negative infinite extents: every projection radius is -inf (no NaN thanks to the parallel epsilon).
+		for (uint32_t k = 0u; k < 3u; ++k)
+		{
+			center[k][_lane] = T(0);
+			extents[k][_lane] = -std::numeric_limits<T>::infinity();
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+				axes[i][k][_lane] = i == k ? T(1) : T(0);
+		}
+	}
+
+//}
+
+
+//{ Collision
+
+	template <typename T, uint32_t N>
+	uint32_t OBB3DPack<T, N>::OverlapMask(const OBB3D<T>& _query) const noexcept
+	{
+		const T eb[3] = { _query.extents.x, _query.extents.y, _query.extents.z };
+
+		uint32_t mask = 0u;
+
+		for (uint32_t l = 0u; l < N; ++l)
+		{
+			const T dx = _query.center.x - center[0][l];
+			const T dy = _query.center.y - center[1][l];
+			const T dz = _query.center.z - center[2][l];
+
+			T R[3][3];
+			T t[3];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				for (uint32_t j = 0u; j < 3u; ++j)
+				{
+					R[i][j] = axes[i][0][l] * _query.axes[j].x + axes[i][1][l] * _query.axes[j].y +
+						axes[i][2][l] * _query.axes[j].z;
+				}
+
+				t[i] = dx * axes[i][0][l] + dy * axes[i][1][l] + dz * axes[i][2][l];
+			}
+
+			const T ea[3] = { extents[0][l], extents[1][l], extents[2][l] };
+
+			mask |= uint32_t(!Intl::OBBSeparated(R, t, ea, eb)) << l;
+		}
+
+		return mask;
+	}
+
+	template <typename T, uint32_t N>
+	uint32_t OBB3DPack<T, N>::OverlapMask(const AABB3D<T>& _query) const noexcept
+	{
+		const Vec3<T> boxCenter = (_query.min + _query.max) * T(0.5);
+		const Vec3<T> boxExtents = (_query.max - _query.min) * T(0.5);
+
+		const T eb[3] = { boxExtents.x, boxExtents.y, boxExtents.z };
+
+		uint32_t mask = 0u;
+
+		for (uint32_t l = 0u; l < N; ++l)
+		{
+			const T dx = boxCenter.x - center[0][l];
+			const T dy = boxCenter.y - center[1][l];
+			const T dz = boxCenter.z - center[2][l];
+
+			T R[3][3];
+			T t[3];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				for (uint32_t k = 0u; k < 3u; ++k)
+					R[i][k] = axes[i][k][l];
+
+				t[i] = dx * axes[i][0][l] + dy * axes[i][1][l] + dz * axes[i][2][l];
+			}
+
+			const T ea[3] = { extents[0][l], extents[1][l], extents[2][l] };
+
+			mask |= uint32_t(!Intl::OBBSeparated(R, t, ea, eb)) << l;
+		}
+
+		return mask;
+	}
+
+//}
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_PLANE_GUARD
+#define SAPPHIRE_MATHS_PLANE_GUARD
+
+#include <cmath>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Space/Vector4.hpp>
+#include <SA/Maths/Geometry/AABB3D.hpp>
+#include <SA/Maths/Transform/Transform.hpp>
+
+/**
+ * @file Plane.hpp
+ *
+ * @brief <b>Plane</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Plane Sapphire's class.
+	*
+	*	Points p such as Dot(normal, p) + d == 0 (same equation as Frustum planes).
+	*	Normal is expected to be normalized: SignedDistance() is then an euclidean distance,
+	*	positive on the normal side.
+	*
+	*	@tparam T	Type of the plane.
+	*/
+	template <typename T>
+	struct Plane
+	{
+		/// Plane normal (default is up).
+		Vec3<T> normal = Vec3<T>(T(0), T(1), T(0));
+
+		/// Plane equation constant: Dot(normal, p) + d == 0.
+		T d = T(0);
+
+
+//{ Constructors
+
+		/// Default constructor.
+		Plane() = default;
+
+		/**
+		 * @brief \e Value constructor from normal and equation constant.
+		 *
+		 * @param _normal 	Normalized plane normal.
+		 * @param _d 		Plane equation constant.
+		 */
+		Plane(const Vec3<T>& _normal, T _d) noexcept;
+
+		/**
+		 * @brief \e Value constructor from plane equation (xyz: normal, w: d).
+		 * Frustum::GetPlane() compatible.
+		 *
+		 * @param _equation 	Plane equation.
+		 */
+		Plane(const Vec4<T>& _equation) noexcept;
+
+		/**
+		 * @brief Make plane from normal and point on plane.
+		 *
+		 * @param _normal 	Normalized plane normal.
+		 * @param _point 	Point on plane.
+		 * @return created plane.
+		 */
+		static Plane FromPoint(const Vec3<T>& _normal, const Vec3<T>& _point) noexcept;
+
+		/**
+		 * @brief Make plane from triangle (counter-clockwise normal).
+		 *
+		 * @param _v0 	First point.
+		 * @param _v1 	Second point.
+		 * @param _v2 	Third point.
+		 * @return created plane: normal is Cross(_v1 - _v0, _v2 - _v0) normalized.
+		 */
+		static Plane FromPoints(const Vec3<T>& _v0, const Vec3<T>& _v1, const Vec3<T>& _v2);
+
+//}
+
+
+//{ Distance
+
+		/**
+		 * @brief Signed distance from plane (positive on the normal side).
+		 *
+		 * @param _point 	Point to measure.
+		 * @return Dot(normal, _point) + d.
+		 */
+		T SignedDistance(const Vec3<T>& _point) const noexcept;
+
+		/**
+		 * @brief Orthogonal projection of a point on the plane.
+		 *
+		 * @param _point 	Point to project.
+		 * @return closest point on plane.
+		 */
+		Vec3<T> ClosestPoint(const Vec3<T>& _point) const noexcept;
+
+//}
+
+
+//{ Collisions
+
+		/**
+		 * @brief Plane / box intersection test (bounds included).
+		 *
+		 * @param _box 		Box to test.
+		 * @return true if the box has points on both sides of the plane (or touches it).
+		 */
+		bool IsColliding(const AABB3D<T>& _box) const noexcept;
+
+//}
+
+
+//{ Transformation
+
+		/**
+		 * @brief Transform plane by an affine or projective matrix (inverse transpose of _mat).
+		 *
+		 * @tparam major 	Matrix major.
+		 * @param _mat 		Invertible transformation matrix.
+		 * @return transformed plane with normalized normal.
+		 */
+		template <MatrixMajor major>
+		Plane Transform(const Mat4<T, major>& _mat) const;
+
+		/**
+		 * @brief Transform plane by a transform (TRS matrix).
+		 *
+		 * @tparam TrArgs 	Transform components.
+		 * @param _tr 		Transform with non-null scale.
+		 * @return transformed plane with normalized normal.
+		 */
+		template <template <typename> typename... TrArgs>
+		Plane Transform(const Tr<T, TrArgs...>& _tr) const;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float Plane.
+	using Planef = Plane<float>;
+
+	/// Alias for double Plane.
+	using Planed = Plane<double>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/Plane.inl>
+
+#endif // GUARD
@@ -0,0 +1,102 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T>
+	Plane<T>::Plane(const Vec3<T>& _normal, T _d) noexcept :
+		normal{ _normal },
+		d{ _d }
+	{
+		SA_WARN(_normal.IsNormalized(), SA.Maths.Plane, L"Plane normal should be normalized!");
+	}
+
+	template <typename T>
+	Plane<T>::Plane(const Vec4<T>& _equation) noexcept :
+		Plane(Vec3<T>(_equation.x, _equation.y, _equation.z), _equation.w)
+	{
+	}
+
+	template <typename T>
+	Plane<T> Plane<T>::FromPoint(const Vec3<T>& _normal, const Vec3<T>& _point) noexcept
+	{
+		return Plane(_normal, -Vec3<T>::Dot(_normal, _point));
+	}
+
+	template <typename T>
+	Plane<T> Plane<T>::FromPoints(const Vec3<T>& _v0, const Vec3<T>& _v1, const Vec3<T>& _v2)
+	{
+		const Vec3<T> normal = Vec3<T>::Cross(_v1 - _v0, _v2 - _v0).GetNormalized();
+
+		return FromPoint(normal, _v0);
+	}
+
+//}
+
+
+//{ Distance
+
+	template <typename T>
+	T Plane<T>::SignedDistance(const Vec3<T>& _point) const noexcept
+	{
+		return normal.x * _point.x + normal.y * _point.y + normal.z * _point.z + d;
+	}
+
+	template <typename T>
+	Vec3<T> Plane<T>::ClosestPoint(const Vec3<T>& _point) const noexcept
+	{
+		return _point - normal * SignedDistance(_point);
+	}
+
+//}
+
+
+//{ Collisions
+
+	template <typename T>
+	bool Plane<T>::IsColliding(const AABB3D<T>& _box) const noexcept
+	{
+		const Vec3<T> center = (_box.min + _box.max) * T(0.5);
+		const Vec3<T> extents = (_box.max - _box.min) * T(0.5);
+
+		// Box projection radius on the normal.
+		const T radius = extents.x * std::abs(normal.x) + extents.y * std::abs(normal.y) + extents.z * std::abs(normal.z);
+
+		return std::abs(SignedDistance(center)) <= radius;
+	}
+
+//}
+
+
+//{ Transformation
+
+	template <typename T>
+	template <MatrixMajor major>
+	Plane<T> Plane<T>::Transform(const Mat4<T, major>& _mat) const
+	{
+		// Plane as row vector: (n, d) * inverse(_mat).
+		const Mat4<T, major> inv = _mat.GetInversed();
+
+		const Vec3<T> outNormal(
+			normal.x * inv.e00 + normal.y * inv.e10 + normal.z * inv.e20 + d * inv.e30,
+			normal.x * inv.e01 + normal.y * inv.e11 + normal.z * inv.e21 + d * inv.e31,
+			normal.x * inv.e02 + normal.y * inv.e12 + normal.z * inv.e22 + d * inv.e32
+		);
+
+		const T outD = normal.x * inv.e03 + normal.y * inv.e13 + normal.z * inv.e23 + d * inv.e33;
+
+		const T invLength = T(1) / outNormal.Length();
+
+		return Plane(outNormal * invLength, outD * invLength);
+	}
+
+	template <typename T>
+	template <template <typename> typename... TrArgs>
+	Plane<T> Plane<T>::Transform(const Tr<T, TrArgs...>& _tr) const
+	{
+		return Transform(_tr.Matrix());
+	}
+
+//}
+}
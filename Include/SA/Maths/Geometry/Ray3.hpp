@@ -0,0 +1,131 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_RAY3_GUARD
+#define SAPPHIRE_MATHS_RAY3_GUARD
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include <SA/Maths/Geometry/AABB3D.hpp>
+
+/**
+ * @file Ray3.hpp
+ *
+ * @brief <b>Ray 3D</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Ray \e 3D Sapphire's class.
+	*
+	*	Half-line origin + t * direction (t >= 0).
+	*	Inverse direction is precomputed for slab tests:
+	*	null direction components give infinite inverse (IEEE-754), which the slab test handles.
+	*	Direction does not need to be normalized: distances t are expressed in direction length unit.
+	*
+	*	@tparam T	Type of the ray.
+	*/
+	template <typename T>
+	struct Ray3
+	{
+		/// Ray origin.
+		Vec3<T> origin;
+
+		/// Ray direction (default is forward).
+		Vec3<T> direction = Vec3<T>(T(0), T(0), T(1));
+
+		/// Precomputed 1 / direction (per component).
+		Vec3<T> invDirection = Vec3<T>(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(), T(1));
+
+
+//{ Constructors
+
+		/// Default constructor.
+		Ray3() = default;
+
+		/**
+		 * @brief \e Value constructor from origin and direction.
+		 *
+		 * @param _origin 		Ray origin.
+		 * @param _direction 	Ray direction.
+		 */
+		Ray3(const Vec3<T>& _origin, const Vec3<T>& _direction) noexcept;
+
+//}
+
+
+//{ Accessors
+
+		/**
+		 * @brief Set direction and update inverse direction.
+		 *
+		 * @param _direction 	New ray direction.
+		 */
+		void SetDirection(const Vec3<T>& _direction) noexcept;
+
+		/**
+		 * @brief Compute point at distance _t along the ray.
+		 *
+		 * @param _t 	Distance along ray (direction length unit).
+		 * @return origin + _t * direction.
+		 */
+		Vec3<T> ComputePoint(T _t) const noexcept;
+
+//}
+
+
+//{ Intersection
+
+		/**
+		 * @brief Slab test against a box.
+		 *
+		 * @param _box 		Box to intersect.
+		 * @param _maxDist 	Max hit distance.
+		 * @param _tEntry 	Output entry distance (0 if origin is inside the box).
+		 * @return true if the ray hits the box in [0, _maxDist].
+		 */
+		bool IntersectAABB(const AABB3D<T>& _box, T _maxDist, T& _tEntry) const noexcept;
+
+		/**
+		 * @brief Moller-Trumbore ray / triangle intersection (double sided).
+		 *
+		 * @param _v0 		First triangle vertex.
+		 * @param _v1 		Second triangle vertex.
+		 * @param _v2 		Third triangle vertex.
+		 * @param _maxDist 	Max hit distance.
+		 * @param _t 		Output hit distance.
+		 * @param _u 		Output barycentric coordinate of _v1.
+		 * @param _v 		Output barycentric coordinate of _v2.
+		 * @return true if the ray hits the triangle in [0, _maxDist].
+		 */
+		bool IntersectTriangle(const Vec3<T>& _v0, const Vec3<T>& _v1, const Vec3<T>& _v2,
+			T _maxDist, T& _t, T& _u, T& _v) const noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float Ray3.
+	using Ray3f = Ray3<float>;
+
+	/// Alias for double Ray3.
+	using Ray3d = Ray3<double>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/Ray3.inl>
+
+#endif // GUARD
@@ -0,0 +1,101 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T>
+	Ray3<T>::Ray3(const Vec3<T>& _origin, const Vec3<T>& _direction) noexcept :
+		origin{ _origin }
+	{
+		SetDirection(_direction);
+	}
+
+//}
+
+
+//{ Accessors
+
+	template <typename T>
+	void Ray3<T>::SetDirection(const Vec3<T>& _direction) noexcept
+	{
+		direction = _direction;
+		invDirection = Vec3<T>(T(1) / _direction.x, T(1) / _direction.y, T(1) / _direction.z);
+	}
+
+	template <typename T>
+	Vec3<T> Ray3<T>::ComputePoint(T _t) const noexcept
+	{
+		return origin + direction * _t;
+	}
+
+//}
+
+
+//{ Intersection
+
+	template <typename T>
+	bool Ray3<T>::IntersectAABB(const AABB3D<T>& _box, T _maxDist, T& _tEntry) const noexcept
+	{
+		// Slab test: https://tavianator.com/2011/ray_box.html
+
+		const T tx1 = (_box.min.x - origin.x) * invDirection.x;
+		const T tx2 = (_box.max.x - origin.x) * invDirection.x;
+
+		T tMin = std::min(tx1, tx2);
+		T tMax = std::max(tx1, tx2);
+
+		const T ty1 = (_box.min.y - origin.y) * invDirection.y;
+		const T ty2 = (_box.max.y - origin.y) * invDirection.y;
+
+		tMin = std::max(tMin, std::min(ty1, ty2));
+		tMax = std::min(tMax, std::max(ty1, ty2));
+
+		const T tz1 = (_box.min.z - origin.z) * invDirection.z;
+		const T tz2 = (_box.max.z - origin.z) * invDirection.z;
+
+		tMin = std::max(tMin, std::min(tz1, tz2));
+		tMax = std::min(tMax, std::max(tz1, tz2));
+
+		_tEntry = std::max(tMin, T(0));
+
+		return tMax >= _tEntry && _tEntry <= _maxDist;
+	}
+
+	template <typename T>
+	bool Ray3<T>::IntersectTriangle(const Vec3<T>& _v0, const Vec3<T>& _v1, const Vec3<T>& _v2,
+		T _maxDist, T& _t, T& _u, T& _v) const noexcept
+	{
+		// Moller-Trumbore: https://cadxfem.org/inf/Fast%20MinimumStorage%20RayTriangle%20Intersection.pdf
+
+		const Vec3<T> edge1 = _v1 - _v0;
+		const Vec3<T> edge2 = _v2 - _v0;
+
+		const Vec3<T> p = Vec3<T>::Cross(direction, edge2);
+		const T det = Vec3<T>::Dot(edge1, p);
+
+		// Ray parallel to triangle plane.
+		if (std::abs(det) < std::numeric_limits<T>::epsilon())
+			return false;
+
+		const T invDet = T(1) / det;
+
+		const Vec3<T> s = origin - _v0;
+		_u = Vec3<T>::Dot(s, p) * invDet;
+
+		if (_u < T(0) || _u > T(1))
+			return false;
+
+		const Vec3<T> q = Vec3<T>::Cross(s, edge1);
+		_v = Vec3<T>::Dot(direction, q) * invDet;
+
+		if (_v < T(0) || _u + _v > T(1))
+			return false;
+
+		_t = Vec3<T>::Dot(edge2, q) * invDet;
+
+		return _t >= T(0) && _t <= _maxDist;
+	}
+
+//}
+}
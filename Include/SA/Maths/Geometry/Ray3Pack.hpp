@@ -0,0 +1,219 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_RAY3_PACK_GUARD
+#define SAPPHIRE_MATHS_RAY3_PACK_GUARD
+
+#include <cstdint>
+#include <limits>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Geometry/Ray3.hpp>
+
+#if SA_MATHS_RAY3_PACK_SIMD
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+ * @file Ray3Pack.hpp
+ *
+ * @brief <b>Ray 3D Pack</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Ray \e 3D \e Pack Sapphire's class.
+	*
+	*	N rays (packet) in Structure-Of-Arrays layout (one ray per SIMD lane)
+	*	to test N rays against one box or one triangle at once.
+	*	Unused lanes hold an empty ray (infinite origin) that never hits a finite primitive.
+	*
+	*	@tparam T	Type of the rays.
+	*	@tparam N	Number of rays (lanes).
+	*/
+	template <typename T, uint32_t N>
+	struct alignas(sizeof(T) * N) Ray3Pack
+	{
+		static_assert(N > 0u && N <= 32u, "Ray3Pack lane count must fit in a 32 bits mask.");
+		static_assert((N & (N - 1u)) == 0u, "Ray3Pack lane count must be a power of 2 (lanes are aligned on sizeof(T) * N).");
+
+		/// Number of lanes.
+		static constexpr uint32_t Width = N;
+
+		/// Origin X lanes.
+		alignas(sizeof(T) * N) T originX[N];
+
+		/// Origin Y lanes.
+		alignas(sizeof(T) * N) T originY[N];
+
+		/// Origin Z lanes.
+		alignas(sizeof(T) * N) T originZ[N];
+
+		/// Direction X lanes.
+		alignas(sizeof(T) * N) T dirX[N];
+
+		/// Direction Y lanes.
+		alignas(sizeof(T) * N) T dirY[N];
+
+		/// Direction Z lanes.
+		alignas(sizeof(T) * N) T dirZ[N];
+
+		/// Inverse direction X lanes.
+		alignas(sizeof(T) * N) T invDirX[N];
+
+		/// Inverse direction Y lanes.
+		alignas(sizeof(T) * N) T invDirY[N];
+
+		/// Inverse direction Z lanes.
+		alignas(sizeof(T) * N) T invDirZ[N];
+
+
+//{ Constructors
+
+		/// Default constructor: every lane is empty.
+		Ray3Pack() noexcept;
+
+		/**
+		 * @brief \e Value constructor from rays.
+		 *
+		 * @param _rays 	Rays to pack.
+		 * @param _num 		Number of rays (<= N): remaining lanes are empty.
+		 */
+		Ray3Pack(const Ray3<T>* _rays, uint32_t _num) noexcept;
+
+//}
+
+
+//{ Lanes
+
+		/**
+		 * @brief Set lane ray.
+		 *
+		 * @param _lane 	Lane index.
+		 * @param _ray 		Ray to store.
+		 */
+		void Set(uint32_t _lane, const Ray3<T>& _ray) noexcept;
+
+		/**
+		 * @brief Get lane ray.
+		 *
+		 * @param _lane 	Lane index.
+		 * @return lane ray.
+		 */
+		Ray3<T> Get(uint32_t _lane) const noexcept;
+
+		/**
+		 * @brief Set lane to empty ray (never hits a finite primitive).
+		 *
+		 * @param _lane 	Lane index.
+		 */
+		void SetEmpty(uint32_t _lane) noexcept;
+
+//}
+
+
+//{ Intersection
+
+		/**
+		 * @brief Slab test of every lane against _box.
+		 * Same semantic as Ray3::IntersectAABB.
+		 *
+		 * @param _box 		Box to intersect.
+		 * @param _maxDist 	Max hit distance (all lanes).
+		 * @param _tEntries Optional output entry distances (N values, only valid for hit lanes).
+		 * @return bitmask of hit lanes (bit i set for lane i).
+		 */
+		uint32_t IntersectAABBMask(const AABB3D<T>& _box, T _maxDist, T* _tEntries = nullptr) const noexcept;
+
+		/**
+		 * @brief Moller-Trumbore test of every lane against triangle (_v0, _v1, _v2).
+		 * Same semantic as Ray3::IntersectTriangle.
+		 *
+		 * @param _v0 		First triangle vertex.
+		 * @param _v1 		Second triangle vertex.
+		 * @param _v2 		Third triangle vertex.
+		 * @param _maxDist 	Max hit distance (all lanes).
+		 * @param _t 		Optional output hit distances (N values, only valid for hit lanes).
+		 * @return bitmask of hit lanes (bit i set for lane i).
+		 */
+		uint32_t IntersectTriangleMask(const Vec3<T>& _v0, const Vec3<T>& _v1, const Vec3<T>& _v2,
+			T _maxDist, T* _t = nullptr) const noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Template alias of 4 lanes Ray3Pack.
+	template <typename T>
+	using Ray3Pack4 = Ray3Pack<T, 4u>;
+
+	/// Template alias of 8 lanes Ray3Pack.
+	template <typename T>
+	using Ray3Pack8 = Ray3Pack<T, 8u>;
+
+	/// Alias for float Ray3Pack4.
+	using Ray3Pack4f = Ray3Pack4<float>;
+
+	/// Alias for double Ray3Pack4.
+	using Ray3Pack4d = Ray3Pack4<double>;
+
+	/// Alias for float Ray3Pack8.
+	using Ray3Pack8f = Ray3Pack8<float>;
+
+	/// Alias for double Ray3Pack8.
+	using Ray3Pack8d = Ray3Pack8<double>;
+
+//}
+
+
+	/// \cond Internal
+
+#if SA_MATHS_RAY3_PACK_SIMD && SA_INTRISC_SSE
+
+	template <>
+	uint32_t Ray3Pack4f::IntersectAABBMask(const AABB3D<float>& _box, float _maxDist, float* _tEntries) const noexcept;
+
+	template <>
+	uint32_t Ray3Pack4f::IntersectTriangleMask(const Vec3<float>& _v0, const Vec3<float>& _v1, const Vec3<float>& _v2,
+		float _maxDist, float* _t) const noexcept;
+
+#endif
+
+#if SA_MATHS_RAY3_PACK_SIMD && SA_INTRISC_AVX
+
+	template <>
+	uint32_t Ray3Pack8f::IntersectAABBMask(const AABB3D<float>& _box, float _maxDist, float* _tEntries) const noexcept;
+
+	template <>
+	uint32_t Ray3Pack8f::IntersectTriangleMask(const Vec3<float>& _v0, const Vec3<float>& _v1, const Vec3<float>& _v2,
+		float _maxDist, float* _t) const noexcept;
+
+	template <>
+	uint32_t Ray3Pack4d::IntersectAABBMask(const AABB3D<double>& _box, double _maxDist, double* _tEntries) const noexcept;
+
+	template <>
+	uint32_t Ray3Pack4d::IntersectTriangleMask(const Vec3<double>& _v0, const Vec3<double>& _v1, const Vec3<double>& _v2,
+		double _maxDist, double* _t) const noexcept;
+
+#endif
+
+	/// \endcond
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/Ray3Pack.inl>
+
+#endif // GUARD
@@ -0,0 +1,166 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T, uint32_t N>
+	Ray3Pack<T, N>::Ray3Pack() noexcept
+	{
+		for (uint32_t i = 0u; i < N; ++i)
+			SetEmpty(i);
+	}
+
+	template <typename T, uint32_t N>
+	Ray3Pack<T, N>::Ray3Pack(const Ray3<T>* _rays, uint32_t _num) noexcept
+	{
+		SA_ASSERT((Default, _num <= N), SA.Maths.Ray.3D, (L"Ray count [%1] exceeds pack width [%2]!", _num, N));
+
+		uint32_t i = 0u;
+
+		for (; i < _num; ++i)
+			Set(i, _rays[i]);
+
+		for (; i < N; ++i)
+			SetEmpty(i);
+	}
+
+//}
+
+
+//{ Lanes
+
+	template <typename T, uint32_t N>
+	void Ray3Pack<T, N>::Set(uint32_t _lane, const Ray3<T>& _ray) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.Ray.3D);
+
+		originX[_lane] = _ray.origin.x;
+		originY[_lane] = _ray.origin.y;
+		originZ[_lane] = _ray.origin.z;
+
+		dirX[_lane] = _ray.direction.x;
+		dirY[_lane] = _ray.direction.y;
+		dirZ[_lane] = _ray.direction.z;
+
+		invDirX[_lane] = _ray.invDirection.x;
+		invDirY[_lane] = _ray.invDirection.y;
+		invDirZ[_lane] = _ray.invDirection.z;
+	}
+
+	template <typename T, uint32_t N>
+	Ray3<T> Ray3Pack<T, N>::Get(uint32_t _lane) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.Ray.3D);
+
+		Ray3<T> ray;
+
+		ray.origin = Vec3<T>(originX[_lane], originY[_lane], originZ[_lane]);
+		ray.direction = Vec3<T>(dirX[_lane], dirY[_lane], dirZ[_lane]);
+		ray.invDirection = Vec3<T>(invDirX[_lane], invDirY[_lane], invDirZ[_lane]);
+
+		return ray;
+	}
+
+	template <typename T, uint32_t N>
+	void Ray3Pack<T, N>::SetEmpty(uint32_t _lane) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.Ray.3D);
+
+		// Infinite origin: slab distances are -inf (box behind) and barycentrics are inf or NaN.
+		originX[_lane] = originY[_lane] = originZ[_lane] = std::numeric_limits<T>::infinity();
+
+		dirX[_lane] = dirY[_lane] = dirZ[_lane] = T(1);
+		invDirX[_lane] = invDirY[_lane] = invDirZ[_lane] = T(1);
+	}
+
+//}
+
+
+//{ Intersection
+
+	template <typename T, uint32_t N>
+	uint32_t Ray3Pack<T, N>::IntersectAABBMask(const AABB3D<T>& _box, T _maxDist, T* _tEntries) const noexcept
+	{
+		uint32_t mask = 0u;
+
+		// Branchless: lets the compiler vectorize when no specialization exists.
+		for (uint32_t i = 0u; i < N; ++i)
+		{
+			const T tx1 = (_box.min.x - originX[i]) * invDirX[i];
+			const T tx2 = (_box.max.x - originX[i]) * invDirX[i];
+
+			T tMin = std::min(tx1, tx2);
+			T tMax = std::max(tx1, tx2);
+
+			const T ty1 = (_box.min.y - originY[i]) * invDirY[i];
+			const T ty2 = (_box.max.y - originY[i]) * invDirY[i];
+
+			tMin = std::max(tMin, std::min(ty1, ty2));
+			tMax = std::min(tMax, std::max(ty1, ty2));
+
+			const T tz1 = (_box.min.z - originZ[i]) * invDirZ[i];
+			const T tz2 = (_box.max.z - originZ[i]) * invDirZ[i];
+
+			tMin = std::max(tMin, std::min(tz1, tz2));
+			tMax = std::min(tMax, std::max(tz1, tz2));
+
+			const T tEntry = std::max(tMin, T(0));
+
+			if (_tEntries)
+				_tEntries[i] = tEntry;
+
+			mask |= uint32_t((tMax >= tEntry) & (tEntry <= _maxDist)) << i;
+		}
+
+		return mask;
+	}
+
+	template <typename T, uint32_t N>
+	uint32_t Ray3Pack<T, N>::IntersectTriangleMask(const Vec3<T>& _v0, const Vec3<T>& _v1, const Vec3<T>& _v2,
+		T _maxDist, T* _t) const noexcept
+	{
+		const Vec3<T> edge1 = _v1 - _v0;
+		const Vec3<T> edge2 = _v2 - _v0;
+
+		uint32_t mask = 0u;
+
+		for (uint32_t i = 0u; i < N; ++i)
+		{
+			// p = dir x edge2
+			const T px = dirY[i] * edge2.z - dirZ[i] * edge2.y;
+			const T py = dirZ[i] * edge2.x - dirX[i] * edge2.z;
+			const T pz = dirX[i] * edge2.y - dirY[i] * edge2.x;
+
+			const T det = edge1.x * px + edge1.y * py + edge1.z * pz;
+			const T invDet = T(1) / det;
+
+			const T sx = originX[i] - _v0.x;
+			const T sy = originY[i] - _v0.y;
+			const T sz = originZ[i] - _v0.z;
+
+			const T u = (sx * px + sy * py + sz * pz) * invDet;
+
+			// q = s x edge1
+			const T qx = sy * edge1.z - sz * edge1.y;
+			const T qy = sz * edge1.x - sx * edge1.z;
+			const T qz = sx * edge1.y - sy * edge1.x;
+
+			const T v = (dirX[i] * qx + dirY[i] * qy + dirZ[i] * qz) * invDet;
+			const T t = (edge2.x * qx + edge2.y * qy + edge2.z * qz) * invDet;
+
+			if (_t)
+				_t[i] = t;
+
+			const bool bHit = (std::abs(det) >= std::numeric_limits<T>::epsilon()) &
+				(u >= T(0)) & (u <= T(1)) & (v >= T(0)) & (u + v <= T(1)) &
+				(t >= T(0)) & (t <= _maxDist);
+
+			mask |= uint32_t(bHit) << i;
+		}
+
+		return mask;
+	}
+
+//}
+}
@@ -0,0 +1,281 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_SPATIAL_HASH_GRID_GUARD
+#define SAPPHIRE_MATHS_SPATIAL_HASH_GRID_GUARD
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Geometry/AABBTraits.hpp>
+
+/**
+ * @file SpatialHashGrid.hpp
+ *
+ * @brief <b>Spatial Hash Grid</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Spatial \e Hash \e Grid Sapphire's class.
+	*
+	*	Uniform grid of cubic cells hashed on integer cell coordinates floor(p / cellSize).
+	*	Only occupied cells are stored, in an open addressing table (linear probing, power of two capacity).
+	*	Each cell owns a contiguous slice of a single index arena (filled by counting sort at Build()),
+	*	so there is no per-cell allocation and queries (callback versions) never allocate.
+	*
+	*	Boxes spanning several cells are referenced in every cell they cover
+	*	but reported only once per query.
+	*	Best performance is reached when cell size is close to the typical query size (e.g. particle radius * 2).
+	*
+	*	@tparam AABBT	Box type (AABB2D<T> or AABB3D<T>).
+	*/
+	template <typename AABBT>
+	class SpatialHashGrid
+	{
+	public:
+		/// Box component type.
+		using T = typename Intl::AABBTraits<AABBT>::Type;
+
+		/// Point type (Vec2<T> or Vec3<T>).
+		using VecT = typename Intl::AABBTraits<AABBT>::VecT;
+
+		/// Grid dimension.
+		static constexpr uint32_t Dim = Intl::AABBTraits<AABBT>::Dim;
+
+		/// Integer cell coordinates.
+		struct Cell
+		{
+			int32_t coords[Dim] = {};
+
+			bool operator==(const Cell& _rhs) const noexcept;
+			bool operator!=(const Cell& _rhs) const noexcept;
+		};
+
+	private:
+		/// Hash table slot: cell and its slice in the index arena.
+		struct Slot
+		{
+			Cell cell;
+
+			/// First index in arena.
+			uint32_t start = 0u;
+
+			/// Number of indices in arena (0 for empty slot).
+			uint32_t count = 0u;
+		};
+
+		/// Cell size.
+		T mCellSize = T(1);
+
+		/// Inverse of cell size.
+		T mInvCellSize = T(1);
+
+		/// Arena entry: item copy for contiguous cell traversal.
+		struct Entry
+		{
+			/// Item box (points are stored as degenerated boxes).
+			AABBT box;
+
+			/// Cell of box.min (single report test).
+			Cell minCell;
+
+			/// Item index.
+			uint32_t index = 0u;
+		};
+
+		/// Open addressing table of occupied cells.
+		std::vector<Slot> mSlots;
+
+		/// Entry arena: each occupied cell owns the slice [start, start + count).
+		std::vector<Entry> mArena;
+
+		/// Number of items.
+		uint32_t mSize = 0u;
+
+		/// Number of occupied cells.
+		uint32_t mCellNum = 0u;
+
+
+		static uint32_t Hash(const Cell& _cell) noexcept;
+
+		/// Find slot of _cell (nullptr if cell is empty).
+		const Slot* Find(const Cell& _cell) const noexcept;
+
+		/// Find slot of _cell or insert it (table grows at load factor 0.5).
+		Slot& FindOrInsert(const Cell& _cell);
+
+		/// Rehash occupied slots in a table of _capacity (power of two).
+		void Rehash(uint32_t _capacity);
+
+		/// Cell range covered by _box: returns the number of cells.
+		uint64_t ComputeCellRange(const AABBT& _box, Cell& _min, Cell& _max) const noexcept;
+
+		/// Call _functor(cell) on every cell of [_min, _max].
+		template <typename FunctorT>
+		static void ForEachCell(const Cell& _min, const Cell& _max, FunctorT _functor);
+
+		/// Shared Build() implementation: _getBox(i) returns item i box.
+		template <typename GetBoxT>
+		void BuildCells(uint32_t _num, GetBoxT _getBox);
+
+		/**
+		*	Visit every item overlapping _bounds (at most once):
+		*	_test(item box) is the exact test, _callback(index) is called on success.
+		*/
+		template <typename TestT, typename CallbackT>
+		void Query(const AABBT& _bounds, TestT _test, CallbackT _callback) const;
+
+	public:
+
+//{ Constructors
+
+		/**
+		 * @brief \e Value constructor.
+		 *
+		 * @param _cellSize 	Size of a cell (> 0).
+		 */
+		SpatialHashGrid(T _cellSize = T(1)) noexcept;
+
+//}
+
+
+//{ Build
+
+		/**
+		 * @brief Bulk insert boxes (previous content is cleared).
+		 *
+		 * @param _boxes 	Boxes to insert. Index in this array is reported by queries.
+		 * @param _num 		Number of boxes.
+		 */
+		void Build(const AABBT* _boxes, uint32_t _num);
+
+		/**
+		 * @brief Bulk insert points (previous content is cleared).
+		 *
+		 * @param _points 	Points to insert. Index in this array is reported by queries.
+		 * @param _num 		Number of points.
+		 */
+		void Build(const VecT* _points, uint32_t _num);
+
+		/// Remove all items (keep cell size and allocated memory).
+		void Clear() noexcept;
+
+//}
+
+
+//{ Getters
+
+		/**
+		 * @brief Getter of cell size.
+		 *
+		 * @return size of a cell.
+		 */
+		T GetCellSize() const noexcept;
+
+		/**
+		 * @brief Setter of cell size. Content is cleared.
+		 *
+		 * @param _cellSize 	Size of a cell (> 0).
+		 */
+		void SetCellSize(T _cellSize) noexcept;
+
+		/**
+		 * @brief Getter of item count.
+		 *
+		 * @return number of inserted items.
+		 */
+		uint32_t Size() const noexcept;
+
+		/**
+		 * @brief Getter of occupied cell count.
+		 *
+		 * @return number of non-empty cells.
+		 */
+		uint32_t GetCellNum() const noexcept;
+
+		/**
+		 * @brief Compute the cell containing _point.
+		 *
+		 * @param _point 	Point to locate.
+		 * @return integer cell coordinates.
+		 */
+		Cell ComputeCell(const VecT& _point) const noexcept;
+
+//}
+
+
+//{ Queries
+
+		/**
+		 * @brief Visit items overlapping _box (IsColliding semantic). Each item is reported once.
+		 *
+		 * @param _box 			Query box.
+		 * @param _callback 	Functor called with (uint32_t index) for every overlapping item.
+		 */
+		template <typename CallbackT>
+		void QueryBox(const AABBT& _box, CallbackT _callback) const;
+
+		/**
+		 * @brief Append items overlapping _box to _out.
+		 *
+		 * @param _box 		Query box.
+		 * @param _out 		Output item indices.
+		 */
+		void QueryBox(const AABBT& _box, std::vector<uint32_t>& _out) const;
+
+		/**
+		 * @brief Visit items at distance <= _radius of _center (closest point of item box). Each item is reported once.
+		 *
+		 * @param _center 		Query sphere (disk in 2D) center.
+		 * @param _radius 		Query radius.
+		 * @param _callback 	Functor called with (uint32_t index) for every item in range.
+		 */
+		template <typename CallbackT>
+		void QueryRadius(const VecT& _center, T _radius, CallbackT _callback) const;
+
+		/**
+		 * @brief Append items at distance <= _radius of _center to _out.
+		 *
+		 * @param _center 	Query sphere (disk in 2D) center.
+		 * @param _radius 	Query radius.
+		 * @param _out 		Output item indices.
+		 */
+		void QueryRadius(const VecT& _center, T _radius, std::vector<uint32_t>& _out) const;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float AABB2D SpatialHashGrid.
+	using SpatialHashGrid2Df = SpatialHashGrid<AABB2D<float>>;
+
+	/// Alias for double AABB2D SpatialHashGrid.
+	using SpatialHashGrid2Dd = SpatialHashGrid<AABB2D<double>>;
+
+	/// Alias for float AABB3D SpatialHashGrid.
+	using SpatialHashGrid3Df = SpatialHashGrid<AABB3D<float>>;
+
+	/// Alias for double AABB3D SpatialHashGrid.
+	using SpatialHashGrid3Dd = SpatialHashGrid<AABB3D<double>>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/SpatialHashGrid.inl>
+
+#endif // GUARD
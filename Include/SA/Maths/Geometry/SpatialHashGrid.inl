@@ -0,0 +1,419 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Cell
+
+	template <typename AABBT>
+	bool SpatialHashGrid<AABBT>::Cell::operator==(const Cell& _rhs) const noexcept
+	{
+		for (uint32_t a = 0u; a < Dim; ++a)
+		{
+			if (coords[a] != _rhs.coords[a])
+				return false;
+		}
+
+		return true;
+	}
+
+	template <typename AABBT>
+	bool SpatialHashGrid<AABBT>::Cell::operator!=(const Cell& _rhs) const noexcept
+	{
+		return !(*this == _rhs);
+	}
+
+//}
+
+
+//{ Table
+
+	template <typename AABBT>
+	uint32_t SpatialHashGrid<AABBT>::Hash(const Cell& _cell) noexcept
+	{
+		constexpr uint32_t primes[3] = { 0x9E3779B1u, 0x85EBCA77u, 0xC2B2AE3Du };
+
+		uint32_t hash = 0u;
+
+		for (uint32_t a = 0u; a < Dim; ++a)
+			hash ^= static_cast<uint32_t>(_cell.coords[a]) * primes[a];
+
+		// Final mix: neighbor cells must not end in neighbor slots (linear probing clustering).
+		hash ^= hash >> 15;
+		hash *= 0x2C1B3C6Du;
+		hash ^= hash >> 12;
+
+		return hash;
+	}
+
+	template <typename AABBT>
+	const typename SpatialHashGrid<AABBT>::Slot* SpatialHashGrid<AABBT>::Find(const Cell& _cell) const noexcept
+	{
+		if (mSlots.empty())
+			return nullptr;
+
+		const uint32_t mask = static_cast<uint32_t>(mSlots.size()) - 1u;
+
+		for (uint32_t i = Hash(_cell) & mask;; i = (i + 1u) & mask)
+		{
+			const Slot& slot = mSlots[i];
+
+			if (slot.count == 0u)
+				return nullptr;
+
+			if (slot.cell == _cell)
+				return &slot;
+		}
+	}
+
+	template <typename AABBT>
+	typename SpatialHashGrid<AABBT>::Slot& SpatialHashGrid<AABBT>::FindOrInsert(const Cell& _cell)
+	{
+		if (2u * (mCellNum + 1u) > mSlots.size())
+			Rehash(std::max(16u, static_cast<uint32_t>(mSlots.size()) * 2u));
+
+		const uint32_t mask = static_cast<uint32_t>(mSlots.size()) - 1u;
+
+		for (uint32_t i = Hash(_cell) & mask;; i = (i + 1u) & mask)
+		{
+			Slot& slot = mSlots[i];
+
+			if (slot.count == 0u)
+			{
+				slot.cell = _cell;
+				++mCellNum;
+
+				return slot;
+			}
+
+			if (slot.cell == _cell)
+				return slot;
+		}
+	}
+
+	template <typename AABBT>
+	void SpatialHashGrid<AABBT>::Rehash(uint32_t _capacity)
+	{
+		std::vector<Slot> slots(_capacity);
+		slots.swap(mSlots);
+
+		const uint32_t mask = _capacity - 1u;
+
+		for (const auto& slot : slots)
+		{
+			if (slot.count == 0u)
+				continue;
+
+			uint32_t i = Hash(slot.cell) & mask;
+
+			while (mSlots[i].count != 0u)
+				i = (i + 1u) & mask;
+
+			mSlots[i] = slot;
+		}
+	}
+
+	template <typename AABBT>
+	uint64_t SpatialHashGrid<AABBT>::ComputeCellRange(const AABBT& _box, Cell& _min, Cell& _max) const noexcept
+	{
+		_min = ComputeCell(_box.min);
+		_max = ComputeCell(_box.max);
+
+		uint64_t num = 1u;
+
+		for (uint32_t a = 0u; a < Dim; ++a)
+			num *= static_cast<uint64_t>(int64_t(_max.coords[a]) - int64_t(_min.coords[a]) + 1);
+
+		return num;
+	}
+
+	template <typename AABBT>
+	template <typename FunctorT>
+	void SpatialHashGrid<AABBT>::ForEachCell(const Cell& _min, const Cell& _max, FunctorT _functor)
+	{
+		Cell cell = _min;
+
+		while (true)
+		{
+			_functor(cell);
+
+			// Odometer increment: first axis varies fastest.
+			uint32_t a = 0u;
+
+			for (; a < Dim; ++a)
+			{
+				if (cell.coords[a] < _max.coords[a])
+				{
+					++cell.coords[a];
+					break;
+				}
+
+				cell.coords[a] = _min.coords[a];
+			}
+
+			if (a == Dim)
+				return;
+		}
+	}
+
+//}
+
+
+//{ Constructors
+
+	template <typename AABBT>
+	SpatialHashGrid<AABBT>::SpatialHashGrid(T _cellSize) noexcept
+	{
+		SetCellSize(_cellSize);
+	}
+
+//}
+
+
+//{ Build
+
+	template <typename AABBT>
+	template <typename GetBoxT>
+	void SpatialHashGrid<AABBT>::BuildCells(uint32_t _num, GetBoxT _getBox)
+	{
+		// Keep previous capacity: rebuilding a similar set never rehashes.
+		const uint32_t capacity = static_cast<uint32_t>(mSlots.size());
+
+		mSlots.assign(capacity, Slot{});
+		mSize = _num;
+		mCellNum = 0u;
+
+		Cell cMin;
+		Cell cMax;
+
+		// Count items per cell.
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			ComputeCellRange(_getBox(i), cMin, cMax);
+
+			ForEachCell(cMin, cMax, [this](const Cell& _cell)
+			{
+				++FindOrInsert(_cell).count;
+			});
+		}
+
+
+		// Prefix sum: start is set to the slice end, then decremented while filling.
+		uint32_t offset = 0u;
+
+		for (auto& slot : mSlots)
+		{
+			offset += slot.count;
+			slot.start = offset;
+		}
+
+		mArena.resize(offset);
+
+
+		// Fill arena in reverse order: entries are sorted by index in each cell.
+		for (uint32_t i = _num; i-- > 0u;)
+		{
+			const AABBT& box = _getBox(i);
+
+			ComputeCellRange(box, cMin, cMax);
+
+			ForEachCell(cMin, cMax, [this, i, &box, &cMin](const Cell& _cell)
+			{
+				Slot& slot = mSlots[Find(_cell) - mSlots.data()];
+
+				Entry& entry = mArena[--slot.start];
+				entry.box = box;
+				entry.minCell = cMin;
+				entry.index = i;
+			});
+		}
+	}
+
+	template <typename AABBT>
+	void SpatialHashGrid<AABBT>::Build(const AABBT* _boxes, uint32_t _num)
+	{
+		BuildCells(_num, [_boxes](uint32_t _index) -> const AABBT& { return _boxes[_index]; });
+	}
+
+	template <typename AABBT>
+	void SpatialHashGrid<AABBT>::Build(const VecT* _points, uint32_t _num)
+	{
+		AABBT box;
+
+		BuildCells(_num, [_points, &box](uint32_t _index) -> const AABBT&
+		{
+			box.min = _points[_index];
+			box.max = _points[_index];
+
+			return box;
+		});
+	}
+
+	template <typename AABBT>
+	void SpatialHashGrid<AABBT>::Clear() noexcept
+	{
+		mSlots.clear();
+		mArena.clear();
+
+		mSize = 0u;
+		mCellNum = 0u;
+	}
+
+//}
+
+
+//{ Getters
+
+	template <typename AABBT>
+	typename SpatialHashGrid<AABBT>::T SpatialHashGrid<AABBT>::GetCellSize() const noexcept
+	{
+		return mCellSize;
+	}
+
+	template <typename AABBT>
+	void SpatialHashGrid<AABBT>::SetCellSize(T _cellSize) noexcept
+	{
+		SA_ASSERT((Default, _cellSize > T(0)), SA.Maths.SpatialHashGrid, (L"Cell size [%1] must be positive!", _cellSize));
+
+		Clear();
+
+		mCellSize = _cellSize;
+		mInvCellSize = T(1) / _cellSize;
+	}
+
+	template <typename AABBT>
+	uint32_t SpatialHashGrid<AABBT>::Size() const noexcept
+	{
+		return mSize;
+	}
+
+	template <typename AABBT>
+	uint32_t SpatialHashGrid<AABBT>::GetCellNum() const noexcept
+	{
+		return mCellNum;
+	}
+
+	template <typename AABBT>
+	typename SpatialHashGrid<AABBT>::Cell SpatialHashGrid<AABBT>::ComputeCell(const VecT& _point) const noexcept
+	{
+		Cell cell;
+
+		for (uint32_t a = 0u; a < Dim; ++a)
+			cell.coords[a] = static_cast<int32_t>(std::floor(_point[a] * mInvCellSize));
+
+		return cell;
+	}
+
+//}
+
+
+//{ Queries
+
+	template <typename AABBT>
+	template <typename TestT, typename CallbackT>
+	void SpatialHashGrid<AABBT>::Query(const AABBT& _bounds, TestT _test, CallbackT _callback) const
+	{
+		if (mCellNum == 0u)
+			return;
+
+		Cell cMin;
+		Cell cMax;
+
+		const uint64_t rangeNum = ComputeCellRange(_bounds, cMin, cMax);
+
+		auto visitCell = [this, &_bounds, &cMin, &_test, &_callback](const Slot& _slot)
+		{
+			const Entry* const entries = mArena.data() + _slot.start;
+
+			for (uint32_t i = 0u; i < _slot.count; ++i)
+			{
+				const Entry& entry = entries[i];
+
+				// Branchless: overlap with bounds, then report once, only in the first cell of (item inter bounds).
+				bool bHit = true;
+
+				for (uint32_t a = 0u; a < Dim; ++a)
+				{
+					bHit &= (entry.box.min[a] <= _bounds.max[a]) & (entry.box.max[a] >= _bounds.min[a]) &
+						(std::max(entry.minCell.coords[a], cMin.coords[a]) == _slot.cell.coords[a]);
+				}
+
+				if (bHit & _test(entry.box))
+					_callback(entry.index);
+			}
+		};
+
+		if (rangeNum <= mCellNum)
+		{
+			ForEachCell(cMin, cMax, [this, &visitCell](const Cell& _cell)
+			{
+				if (const Slot* const slot = Find(_cell))
+					visitCell(*slot);
+			});
+		}
+		else
+		{
+			// Query covers more cells than occupied: scan occupied cells instead.
+			for (const auto& slot : mSlots)
+			{
+				if (slot.count == 0u)
+					continue;
+
+				bool bInRange = true;
+
+				for (uint32_t a = 0u; a < Dim; ++a)
+					bInRange &= (slot.cell.coords[a] >= cMin.coords[a]) & (slot.cell.coords[a] <= cMax.coords[a]);
+
+				if (bInRange)
+					visitCell(slot);
+			}
+		}
+	}
+
+	template <typename AABBT>
+	template <typename CallbackT>
+	void SpatialHashGrid<AABBT>::QueryBox(const AABBT& _box, CallbackT _callback) const
+	{
+		Query(_box, [](const AABBT&) { return true; }, _callback);
+	}
+
+	template <typename AABBT>
+	void SpatialHashGrid<AABBT>::QueryBox(const AABBT& _box, std::vector<uint32_t>& _out) const
+	{
+		QueryBox(_box, [&_out](uint32_t _index) { _out.push_back(_index); });
+	}
+
+	template <typename AABBT>
+	template <typename CallbackT>
+	void SpatialHashGrid<AABBT>::QueryRadius(const VecT& _center, T _radius, CallbackT _callback) const
+	{
+		AABBT bounds;
+		bounds.min = _center - VecT(_radius);
+		bounds.max = _center + VecT(_radius);
+
+		const T sqrRadius = _radius * _radius;
+
+		auto test = [&_center, sqrRadius](const AABBT& _item)
+		{
+			// Squared distance from center to closest point of item box.
+			T sqrDist = T(0);
+
+			for (uint32_t a = 0u; a < Dim; ++a)
+			{
+				const T d = std::max(std::max(_item.min[a] - _center[a], _center[a] - _item.max[a]), T(0));
+				sqrDist += d * d;
+			}
+
+			return sqrDist <= sqrRadius;
+		};
+
+		Query(bounds, test, _callback);
+	}
+
+	template <typename AABBT>
+	void SpatialHashGrid<AABBT>::QueryRadius(const VecT& _center, T _radius, std::vector<uint32_t>& _out) const
+	{
+		QueryRadius(_center, _radius, [&_out](uint32_t _index) { _out.push_back(_index); });
+	}
+
+//}
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_SPHERE_GUARD
+#define SAPPHIRE_MATHS_SPHERE_GUARD
+
+#include <cmath>
+#include <algorithm>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Geometry/Plane.hpp>
+
+/**
+ * @file Sphere.hpp
+ *
+ * @brief <b>Sphere</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Sphere Sapphire's class.
+	*
+	*	Collision tests include the boundary (touching volumes collide), like AABB3D::IsColliding.
+	*
+	*	@tparam T	Type of the sphere.
+	*/
+	template <typename T>
+	struct Sphere
+	{
+		/// Sphere center.
+		Vec3<T> center;
+
+		/// Sphere radius.
+		T radius = T(0);
+
+
+//{ Constructors
+
+		/// Default constructor.
+		Sphere() = default;
+
+		/**
+		 * @brief \e Value constructor from center and radius.
+		 *
+		 * @param _center 	Sphere center.
+		 * @param _radius 	Sphere radius (>= 0).
+		 */
+		Sphere(const Vec3<T>& _center, T _radius) noexcept;
+
+		/**
+		 * @brief \e Value constructor from packed sphere (xyz: center, w: radius).
+		 * Frustum::CullSpheres() compatible.
+		 *
+		 * @param _packed 	Packed sphere.
+		 */
+		Sphere(const Vec4<T>& _packed) noexcept;
+
+//}
+
+
+//{ Collisions
+
+		/**
+		 * @brief Point containment test.
+		 *
+		 * @param _point 	Point to test.
+		 * @return true if _point is inside or on the sphere.
+		 */
+		bool Contains(const Vec3<T>& _point) const noexcept;
+
+		/**
+		 * @brief Sphere / sphere intersection test.
+		 *
+		 * @param _other 	Other sphere.
+		 * @return true if spheres intersect.
+		 */
+		bool IsColliding(const Sphere& _other) const noexcept;
+
+		/**
+		 * @brief Sphere / box intersection test (Arvo: squared distance to closest box point).
+		 *
+		 * @param _box 		Box to test.
+		 * @return true if sphere and box intersect.
+		 */
+		bool IsColliding(const AABB3D<T>& _box) const noexcept;
+
+		/**
+		 * @brief Sphere / plane intersection test.
+		 *
+		 * @param _plane 	Plane to test.
+		 * @return true if the sphere touches the plane.
+		 */
+		bool IsColliding(const Plane<T>& _plane) const noexcept;
+
+//}
+
+
+//{ Geometry
+
+		/**
+		 * @brief Compute bounding box.
+		 *
+		 * @return sphere bounding box.
+		 */
+		AABB3D<T> ComputeAABB() const noexcept;
+
+//}
+
+
+//{ Transformation
+
+		/**
+		 * @brief Transform sphere by an affine matrix.
+		 * Radius is scaled by the spectral norm of the linear part (largest stretch of any direction):
+		 * the result bounds the transformed volume, whatever the scale / rotation order
+		 * (exact without non-uniform scale).
+		 *
+		 * @tparam major 	Matrix major.
+		 * @param _mat 		Affine transformation matrix.
+		 * @return transformed sphere.
+		 */
+		template <MatrixMajor major>
+		Sphere Transform(const Mat4<T, major>& _mat) const noexcept;
+
+		/**
+		 * @brief Transform sphere by a transform (scale, then rotation, then translation).
+		 * Radius is scaled by the largest absolute scale component.
+		 *
+		 * @tparam TrArgs 	Transform components.
+		 * @param _tr 		Transform.
+		 * @return transformed sphere.
+		 */
+		template <template <typename> typename... TrArgs>
+		Sphere Transform(const Tr<T, TrArgs...>& _tr) const noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float Sphere.
+	using Spheref = Sphere<float>;
+
+	/// Alias for double Sphere.
+	using Sphered = Sphere<double>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/Sphere.inl>
+
+#endif // GUARD
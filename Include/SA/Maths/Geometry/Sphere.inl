@@ -0,0 +1,182 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+	/// \cond Internal
+
+	namespace Intl
+	{
+		/// Global scale of a transform (TrScale * TrUScale, One without scale component).
+		template <typename T, template <typename> typename... TrArgs>
+		Vec3<T> TrComputeScale(const Tr<T, TrArgs...>& _tr) noexcept
+		{
+			Vec3<T> scale(T(1), T(1), T(1));
+
+			if constexpr (TrHasComponent<TrScale>())
+				scale = _tr.scale;
+
+			if constexpr (TrHasComponent<TrUScale>())
+				scale *= _tr.uScale;
+
+			return scale;
+		}
+
+		/// Apply transform to a point: position + rotation * (_scale * _point).
+		template <typename T, template <typename> typename... TrArgs>
+		Vec3<T> TrTransformPoint(const Tr<T, TrArgs...>& _tr, const Vec3<T>& _scale, const Vec3<T>& _point) noexcept
+		{
+			Vec3<T> out = _scale * _point;
+
+			if constexpr (TrHasComponent<TrRotation>())
+				out = _tr.rotation.Rotate(out);
+
+			if constexpr (TrHasComponent<TrPosition>())
+				out += _tr.position;
+
+			return out;
+		}
+	}
+
+	/// \endcond
+
+
+//{ Constructors
+
+	template <typename T>
+	Sphere<T>::Sphere(const Vec3<T>& _center, T _radius) noexcept :
+		center{ _center },
+		radius{ _radius }
+	{
+		SA_ASSERT((Default, _radius >= T(0)), SA.Maths.Sphere, (L"Sphere radius [%1] must be positive!", _radius));
+	}
+
+	template <typename T>
+	Sphere<T>::Sphere(const Vec4<T>& _packed) noexcept :
+		Sphere(Vec3<T>(_packed.x, _packed.y, _packed.z), _packed.w)
+	{
+	}
+
+//}
+
+
+//{ Collisions
+
+	template <typename T>
+	bool Sphere<T>::Contains(const Vec3<T>& _point) const noexcept
+	{
+		return (_point - center).SqrLength() <= radius * radius;
+	}
+
+	template <typename T>
+	bool Sphere<T>::IsColliding(const Sphere& _other) const noexcept
+	{
+		const T radiusSum = radius + _other.radius;
+
+		return (_other.center - center).SqrLength() <= radiusSum * radiusSum;
+	}
+
+	template <typename T>
+	bool Sphere<T>::IsColliding(const AABB3D<T>& _box) const noexcept
+	{
+		// Closest box point: per axis clamp of center.
+		const T dx = center.x - std::clamp(center.x, _box.min.x, _box.max.x);
+		const T dy = center.y - std::clamp(center.y, _box.min.y, _box.max.y);
+		const T dz = center.z - std::clamp(center.z, _box.min.z, _box.max.z);
+
+		return dx * dx + dy * dy + dz * dz <= radius * radius;
+	}
+
+	template <typename T>
+	bool Sphere<T>::IsColliding(const Plane<T>& _plane) const noexcept
+	{
+		return std::abs(_plane.SignedDistance(center)) <= radius;
+	}
+
+//}
+
+
+//{ Geometry
+
+	template <typename T>
+	AABB3D<T> Sphere<T>::ComputeAABB() const noexcept
+	{
+		const Vec3<T> extents(radius, radius, radius);
+
+		return AABB3D<T>(center - extents, center + extents);
+	}
+
+//}
+
+
+//{ Transformation
+
+	template <typename T>
+	template <MatrixMajor major>
+	Sphere<T> Sphere<T>::Transform(const Mat4<T, major>& _mat) const noexcept
+	{
+		Sphere out;
+
+		out.center = Vec3<T>(
+			_mat.e00 * center.x + _mat.e01 * center.y + _mat.e02 * center.z + _mat.e03,
+			_mat.e10 * center.x + _mat.e11 * center.y + _mat.e12 * center.z + _mat.e13,
+			_mat.e20 * center.x + _mat.e21 * center.y + _mat.e22 * center.z + _mat.e23
+		);
+
+		// Largest stretch: spectral norm of the linear part M = sqrt(largest eigenvalue of A = Mt.M).
+		// Longest basis column is not a bound with a scale applied after a rotation (S.R).
+		const Vec3<T> c0(_mat.e00, _mat.e10, _mat.e20);
+		const Vec3<T> c1(_mat.e01, _mat.e11, _mat.e21);
+		const Vec3<T> c2(_mat.e02, _mat.e12, _mat.e22);
+
+		const T a00 = Vec3<T>::Dot(c0, c0);
+		const T a11 = Vec3<T>::Dot(c1, c1);
+		const T a22 = Vec3<T>::Dot(c2, c2);
+		const T a01 = Vec3<T>::Dot(c0, c1);
+		const T a02 = Vec3<T>::Dot(c0, c2);
+		const T a12 = Vec3<T>::Dot(c1, c2);
+
+		const T offDiag = a01 * a01 + a02 * a02 + a12 * a12;
+
+		T maxEigen = std::max(a00, std::max(a11, a22));
+
+		if (offDiag > T(0))
+		{
+			// Closed form eigenvalues of symmetric 3x3 matrix (A = q.I + p.B, eigenvalues of B are 2cos(phi + 2k.pi/3)).
+			const T q = (a00 + a11 + a22) / T(3);
+			const T p = std::sqrt(((a00 - q) * (a00 - q) + (a11 - q) * (a11 - q) + (a22 - q) * (a22 - q) + T(2) * offDiag) / T(6));
+
+			const T b00 = (a00 - q) / p;
+			const T b11 = (a11 - q) / p;
+			const T b22 = (a22 - q) / p;
+			const T b01 = a01 / p;
+			const T b02 = a02 / p;
+			const T b12 = a12 / p;
+
+			const T r = (b00 * (b11 * b22 - b12 * b12) - b01 * (b01 * b22 - b12 * b02) + b02 * (b01 * b12 - b11 * b02)) / T(2);
+			const T phi = std::acos(std::min(T(1), std::max(T(-1), r))) / T(3);
+
+			// Rounding: never below the longest column (lower bound of the spectral norm).
+			maxEigen = std::max(maxEigen, q + T(2) * p * std::cos(phi));
+		}
+
+		out.radius = radius * std::sqrt(maxEigen);
+
+		return out;
+	}
+
+	template <typename T>
+	template <template <typename> typename... TrArgs>
+	Sphere<T> Sphere<T>::Transform(const Tr<T, TrArgs...>& _tr) const noexcept
+	{
+		const Vec3<T> scale = Intl::TrComputeScale(_tr);
+
+		Sphere out;
+
+		out.center = Intl::TrTransformPoint(_tr, scale, center);
+		out.radius = radius * std::max(std::abs(scale.x), std::max(std::abs(scale.y), std::abs(scale.z)));
+
+		return out;
+	}
+
+//}
+}
@@ -0,0 +1,194 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_SPHERE_PACK_GUARD
+#define SAPPHIRE_MATHS_SPHERE_PACK_GUARD
+
+#include <cstdint>
+#include <limits>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Geometry/Sphere.hpp>
+
+#if SA_MATHS_SPHERE_PACK_SIMD
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+ * @file SpherePack.hpp
+ *
+ * @brief <b>Sphere Pack</b> type implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Sphere \e Pack Sapphire's class.
+	*
+	*	N spheres in Structure-Of-Arrays layout (one sphere per SIMD lane)
+	*	to test one query volume against N spheres at once.
+	*	Unused lanes hold an empty sphere (infinite center) that never overlaps a finite volume.
+	*
+	*	@tparam T	Type of the spheres.
+	*	@tparam N	Number of spheres (lanes).
+	*/
+	template <typename T, uint32_t N>
+	struct alignas(sizeof(T) * N) SpherePack
+	{
+		static_assert(N > 0u && N <= 32u, "SpherePack lane count must fit in a 32 bits mask.");
+		static_assert((N & (N - 1u)) == 0u, "SpherePack lane count must be a power of 2 (lanes are aligned on sizeof(T) * N).");
+
+		/// Number of lanes.
+		static constexpr uint32_t Width = N;
+
+		/// Center X lanes.
+		alignas(sizeof(T) * N) T centerX[N];
+
+		/// Center Y lanes.
+		alignas(sizeof(T) * N) T centerY[N];
+
+		/// Center Z lanes.
+		alignas(sizeof(T) * N) T centerZ[N];
+
+		/// Radius lanes.
+		alignas(sizeof(T) * N) T radius[N];
+
+
+//{ Constructors
+
+		/// Default constructor: every lane is empty.
+		SpherePack() noexcept;
+
+		/**
+		 * @brief \e Value constructor from spheres.
+		 *
+		 * @param _spheres 	Spheres to pack.
+		 * @param _num 		Number of spheres (<= N): remaining lanes are empty.
+		 */
+		SpherePack(const Sphere<T>* _spheres, uint32_t _num) noexcept;
+
+//}
+
+
+//{ Lanes
+
+		/**
+		 * @brief Set lane sphere.
+		 *
+		 * @param _lane 	Lane index.
+		 * @param _sphere 	Sphere to store.
+		 */
+		void Set(uint32_t _lane, const Sphere<T>& _sphere) noexcept;
+
+		/**
+		 * @brief Get lane sphere.
+		 *
+		 * @param _lane 	Lane index.
+		 * @return lane sphere.
+		 */
+		Sphere<T> Get(uint32_t _lane) const noexcept;
+
+		/**
+		 * @brief Set lane to empty sphere (never overlaps a finite volume).
+		 *
+		 * @param _lane 	Lane index.
+		 */
+		void SetEmpty(uint32_t _lane) noexcept;
+
+//}
+
+
+//{ Collision
+
+		/**
+		 * @brief Test _query against every lane.
+		 * Same semantic as Sphere::IsColliding(const Sphere&).
+		 *
+		 * @param _query 	Query sphere.
+		 * @return bitmask of overlapping lanes (bit i set for lane i).
+		 */
+		uint32_t OverlapMask(const Sphere<T>& _query) const noexcept;
+
+		/**
+		 * @brief Test _query against every lane.
+		 * Same semantic as Sphere::IsColliding(const AABB3D&).
+		 *
+		 * @param _query 	Query box.
+		 * @return bitmask of overlapping lanes (bit i set for lane i).
+		 */
+		uint32_t OverlapMask(const AABB3D<T>& _query) const noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Template alias of 4 lanes SpherePack.
+	template <typename T>
+	using SpherePack4 = SpherePack<T, 4u>;
+
+	/// Template alias of 8 lanes SpherePack.
+	template <typename T>
+	using SpherePack8 = SpherePack<T, 8u>;
+
+	/// Alias for float SpherePack4.
+	using SpherePack4f = SpherePack4<float>;
+
+	/// Alias for double SpherePack4.
+	using SpherePack4d = SpherePack4<double>;
+
+	/// Alias for float SpherePack8.
+	using SpherePack8f = SpherePack8<float>;
+
+	/// Alias for double SpherePack8.
+	using SpherePack8d = SpherePack8<double>;
+
+//}
+
+
+	/// \cond Internal
+
+#if SA_MATHS_SPHERE_PACK_SIMD && SA_INTRISC_SSE
+
+	template <>
+	uint32_t SpherePack4f::OverlapMask(const Sphere<float>& _query) const noexcept;
+
+	template <>
+	uint32_t SpherePack4f::OverlapMask(const AABB3D<float>& _query) const noexcept;
+
+#endif
+
+#if SA_MATHS_SPHERE_PACK_SIMD && SA_INTRISC_AVX
+
+	template <>
+	uint32_t SpherePack8f::OverlapMask(const Sphere<float>& _query) const noexcept;
+
+	template <>
+	uint32_t SpherePack8f::OverlapMask(const AABB3D<float>& _query) const noexcept;
+
+	template <>
+	uint32_t SpherePack4d::OverlapMask(const Sphere<double>& _query) const noexcept;
+
+	template <>
+	uint32_t SpherePack4d::OverlapMask(const AABB3D<double>& _query) const noexcept;
+
+#endif
+
+	/// \endcond
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/SpherePack.inl>
+
+#endif // GUARD
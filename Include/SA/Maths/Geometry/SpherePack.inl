@@ -0,0 +1,106 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T, uint32_t N>
+	SpherePack<T, N>::SpherePack() noexcept
+	{
+		for (uint32_t i = 0u; i < N; ++i)
+			SetEmpty(i);
+	}
+
+	template <typename T, uint32_t N>
+	SpherePack<T, N>::SpherePack(const Sphere<T>* _spheres, uint32_t _num) noexcept
+	{
+		SA_ASSERT((Default, _num <= N), SA.Maths.Sphere, (L"Sphere count [%1] exceeds pack width [%2]!", _num, N));
+
+		uint32_t i = 0u;
+
+		for (; i < _num; ++i)
+			Set(i, _spheres[i]);
+
+		for (; i < N; ++i)
+			SetEmpty(i);
+	}
+
+//}
+
+
+//{ Lanes
+
+	template <typename T, uint32_t N>
+	void SpherePack<T, N>::Set(uint32_t _lane, const Sphere<T>& _sphere) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.Sphere);
+
+		centerX[_lane] = _sphere.center.x;
+		centerY[_lane] = _sphere.center.y;
+		centerZ[_lane] = _sphere.center.z;
+
+		radius[_lane] = _sphere.radius;
+	}
+
+	template <typename T, uint32_t N>
+	Sphere<T> SpherePack<T, N>::Get(uint32_t _lane) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.Sphere);
+
+		return Sphere<T>(Vec3<T>(centerX[_lane], centerY[_lane], centerZ[_lane]), radius[_lane]);
+	}
+
+	template <typename T, uint32_t N>
+	void SpherePack<T, N>::SetEmpty(uint32_t _lane) noexcept
+	{
+		SA_ASSERT((OutOfRange, _lane, 0u, N - 1u), SA.Maths.Sphere);
+
+		// Infinite center: infinite distance to any finite volume.
+		centerX[_lane] = centerY[_lane] = centerZ[_lane] = std::numeric_limits<T>::infinity();
+		radius[_lane] = T(0);
+	}
+
+//}
+
+
+//{ Collision
+
+	template <typename T, uint32_t N>
+	uint32_t SpherePack<T, N>::OverlapMask(const Sphere<T>& _query) const noexcept
+	{
+		uint32_t mask = 0u;
+
+		// Branchless: lets the compiler vectorize when no specialization exists.
+		for (uint32_t i = 0u; i < N; ++i)
+		{
+			const T dx = _query.center.x - centerX[i];
+			const T dy = _query.center.y - centerY[i];
+			const T dz = _query.center.z - centerZ[i];
+
+			const T radiusSum = radius[i] + _query.radius;
+
+			mask |= uint32_t(dx * dx + dy * dy + dz * dz <= radiusSum * radiusSum) << i;
+		}
+
+		return mask;
+	}
+
+	template <typename T, uint32_t N>
+	uint32_t SpherePack<T, N>::OverlapMask(const AABB3D<T>& _query) const noexcept
+	{
+		uint32_t mask = 0u;
+
+		for (uint32_t i = 0u; i < N; ++i)
+		{
+			const T dx = centerX[i] - std::clamp(centerX[i], _query.min.x, _query.max.x);
+			const T dy = centerY[i] - std::clamp(centerY[i], _query.min.y, _query.max.y);
+			const T dz = centerZ[i] - std::clamp(centerZ[i], _query.min.z, _query.max.z);
+
+			mask |= uint32_t(dx * dx + dy * dy + dz * dz <= radius[i] * radius[i]) << i;
+		}
+
+		return mask;
+	}
+
+//}
+}
@@ -0,0 +1,191 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_SWEEP_AND_PRUNE_GUARD
+#define SAPPHIRE_MATHS_SWEEP_AND_PRUNE_GUARD
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Geometry/AABBTraits.hpp>
+
+/**
+ * @file SweepAndPrune.hpp
+ *
+ * @brief <b>Sweep And Prune</b> broadphase implementation.
+ *
+ * @ingroup Maths_Geometry
+ * @{
+ */
+
+namespace SA
+{
+	/**
+	*	@brief \e Sweep \e And \e Prune Sapphire's class.
+	*
+	*	Sort-and-sweep broadphase over an array of AABB2D or AABB3D.
+	*	Boxes are kept sorted by their min bound on a major axis (highest center variance at Build()):
+	*	- Build(): cold start using a radix sort.
+	*	- Update(): insertion sort from previous order (near linear for coherent motion).
+	*	Then a single sweep outputs every overlapping pair (IsColliding semantic).
+	*
+	*	@tparam AABBT	Box type (AABB2D<T> or AABB3D<T>).
+	*/
+	template <typename AABBT>
+	class SweepAndPrune
+	{
+	public:
+		/// Box component type.
+		using T = typename Intl::AABBTraits<AABBT>::Type;
+
+		/// Box dimension.
+		static constexpr uint32_t Dim = Intl::AABBTraits<AABBT>::Dim;
+
+		/// Overlapping pair of box indices (first < second).
+		struct Pair
+		{
+			uint32_t first = 0u;
+			uint32_t second = 0u;
+
+			bool operator==(const Pair& _rhs) const noexcept { return first == _rhs.first && second == _rhs.second; }
+			bool operator!=(const Pair& _rhs) const noexcept { return !(*this == _rhs); }
+			bool operator<(const Pair& _rhs) const noexcept { return first < _rhs.first || (first == _rhs.first && second < _rhs.second); }
+		};
+
+	private:
+		/// Sorted entry: box copy for contiguous sweep.
+		struct Entry
+		{
+			AABBT box;
+			uint32_t index = 0u;
+		};
+
+		/// Radix sort key: float bits mapped to unsigned order.
+		using Key = std::conditional_t<sizeof(T) == 8u, uint64_t, uint32_t>;
+
+		/// Entries sorted by box.min[mAxis].
+		std::vector<Entry> mEntries;
+
+		/// Output pairs.
+		std::vector<Pair> mPairs;
+
+		/// Per-task output pairs (UpdateParallel).
+		std::vector<std::vector<Pair>> mTaskPairs;
+
+		/// Sweep axis.
+		uint32_t mAxis = 0u;
+
+		/// Number of swaps of the last insertion sort.
+		uint32_t mSwapNum = 0u;
+
+
+		static Key MakeKey(T _value) noexcept;
+
+		void RadixSort(const AABBT* _boxes, uint32_t _num);
+		void InsertionSort() noexcept;
+
+		/// Sweep sorted entries [_start, _end): pairs are appended to _out.
+		void Sweep(uint32_t _start, uint32_t _end, std::vector<Pair>& _out) const;
+
+	public:
+
+//{ Update
+
+		/**
+		 * @brief Cold start: select major axis, radix sort boxes and compute pairs.
+		 *
+		 * @param _boxes 	Boxes to sort.
+		 * @param _num 		Number of boxes.
+		 */
+		void Build(const AABBT* _boxes, uint32_t _num);
+
+		/**
+		 * @brief Incremental update: insertion sort from previous order and compute pairs.
+		 *
+		 * @param _boxes 	Updated boxes (same count as Build(), same indices).
+		 */
+		void Update(const AABBT* _boxes);
+
+		/**
+		 * @brief Incremental update with sweep split in _taskNum tasks.
+		 * Sorted boxes are partitioned in contiguous ranges of the sweep axis, one per task, run by _executor.
+		 * Output is identical to Update() (same pairs, same order).
+		 *
+		 * @tparam Executor 	parallel_for callable: executor(begin, end, fn) calls fn(uint32_t) for each index
+		 * 						in [begin, end), possibly concurrently, and returns once all calls returned (see Maths::ThreadPool).
+		 * @param _boxes 		Updated boxes (same count as Build(), same indices).
+		 * @param _executor 	Executor instance (threads are owned by the caller, none is created here).
+		 * @param _taskNum 		Number of tasks (usually executor thread count). <= 1 fallback to Update().
+		 */
+		template <typename Executor>
+		void UpdateParallel(const AABBT* _boxes, Executor&& _executor, uint32_t _taskNum);
+
+		/// Remove all boxes and pairs.
+		void Clear() noexcept;
+
+//}
+
+
+//{ Getters
+
+		/**
+		 * @brief Getter of box count.
+		 *
+		 * @return number of boxes.
+		 */
+		uint32_t Size() const noexcept;
+
+		/**
+		 * @brief Getter of sweep axis.
+		 *
+		 * @return axis index (0: X, 1: Y, 2: Z).
+		 */
+		uint32_t GetAxis() const noexcept;
+
+		/**
+		 * @brief Getter of last insertion sort swap count (coherence metric).
+		 *
+		 * @return number of swaps of the last Update().
+		 */
+		uint32_t GetSwapNum() const noexcept;
+
+		/**
+		 * @brief Getter of overlapping pairs.
+		 *
+		 * @return pairs of the last Build() or Update().
+		 */
+		const std::vector<Pair>& GetPairs() const noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float AABB2D SweepAndPrune.
+	using SweepAndPrune2Df = SweepAndPrune<AABB2D<float>>;
+
+	/// Alias for double AABB2D SweepAndPrune.
+	using SweepAndPrune2Dd = SweepAndPrune<AABB2D<double>>;
+
+	/// Alias for float AABB3D SweepAndPrune.
+	using SweepAndPrune3Df = SweepAndPrune<AABB3D<float>>;
+
+	/// Alias for double AABB3D SweepAndPrune.
+	using SweepAndPrune3Dd = SweepAndPrune<AABB3D<double>>;
+
+//}
+}
+
+
+/** @} */
+
+#include <SA/Maths/Geometry/SweepAndPrune.inl>
+
+#endif // GUARD
@@ -0,0 +1,272 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+namespace SA
+{
+//{ Sort
+
+	template <typename AABBT>
+	typename SweepAndPrune<AABBT>::Key SweepAndPrune<AABBT>::MakeKey(T _value) noexcept
+	{
+		static_assert(sizeof(Key) == sizeof(T), "Key must have the same size as T.");
+
+		Key bits;
+		std::memcpy(&bits, &_value, sizeof(T));
+
+		constexpr Key signBit = Key(1) << (sizeof(Key) * 8u - 1u);
+
+		// Negative: flip all bits (reverse order). Positive: flip sign bit only.
+		return (bits & signBit) ? ~bits : bits | signBit;
+	}
+
+	template <typename AABBT>
+	void SweepAndPrune<AABBT>::RadixSort(const AABBT* _boxes, uint32_t _num)
+	{
+		// LSD radix sort on 8 bits digits of (key, index).
+		std::vector<Key> keys(_num);
+		std::vector<Key> tmpKeys(_num);
+
+		std::vector<uint32_t> indices(_num);
+		std::vector<uint32_t> tmpIndices(_num);
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			keys[i] = MakeKey(_boxes[i].min[mAxis]);
+			indices[i] = i;
+		}
+
+		for (uint32_t shift = 0u; shift < sizeof(Key) * 8u; shift += 8u)
+		{
+			uint32_t counts[256] = {};
+
+			for (uint32_t i = 0u; i < _num; ++i)
+				++counts[(keys[i] >> shift) & 0xFF];
+
+			// Same digit for every key: pass is a no-op.
+			if (counts[(keys[0] >> shift) & 0xFF] == _num)
+				continue;
+
+			uint32_t offset = 0u;
+
+			for (uint32_t d = 0u; d < 256u; ++d)
+			{
+				const uint32_t count = counts[d];
+				counts[d] = offset;
+				offset += count;
+			}
+
+			for (uint32_t i = 0u; i < _num; ++i)
+			{
+				const uint32_t dst = counts[(keys[i] >> shift) & 0xFF]++;
+
+				tmpKeys[dst] = keys[i];
+				tmpIndices[dst] = indices[i];
+			}
+
+			keys.swap(tmpKeys);
+			indices.swap(tmpIndices);
+		}
+
+		mEntries.resize(_num);
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			mEntries[i].box = _boxes[indices[i]];
+			mEntries[i].index = indices[i];
+		}
+	}
+
+	template <typename AABBT>
+	void SweepAndPrune<AABBT>::InsertionSort() noexcept
+	{
+		const uint32_t axis = mAxis;
+		const uint32_t size = static_cast<uint32_t>(mEntries.size());
+
+		mSwapNum = 0u;
+
+		for (uint32_t i = 1u; i < size; ++i)
+		{
+			if (!(mEntries[i].box.min[axis] < mEntries[i - 1u].box.min[axis]))
+				continue;
+
+			const Entry entry = mEntries[i];
+			const T key = entry.box.min[axis];
+
+			uint32_t j = i;
+
+			for (; j > 0u && key < mEntries[j - 1u].box.min[axis]; --j)
+				mEntries[j] = mEntries[j - 1u];
+
+			mEntries[j] = entry;
+			mSwapNum += i - j;
+		}
+	}
+
+//}
+
+
+//{ Sweep
+
+	template <typename AABBT>
+	void SweepAndPrune<AABBT>::Sweep(uint32_t _start, uint32_t _end, std::vector<Pair>& _out) const
+	{
+		const uint32_t axis = mAxis;
+		const uint32_t size = static_cast<uint32_t>(mEntries.size());
+
+		for (uint32_t i = _start; i < _end; ++i)
+		{
+			const Entry& a = mEntries[i];
+			const T maxA = a.box.max[axis];
+
+			// Only boxes starting before a ends can overlap a (sweep may read past _end).
+			for (uint32_t j = i + 1u; j < size && mEntries[j].box.min[axis] <= maxA; ++j)
+			{
+				const Entry& b = mEntries[j];
+
+				// Same result as IsColliding, without branches (sweep axis already overlaps).
+				bool bOverlap = true;
+
+				for (uint32_t k = 0u; k < Dim; ++k)
+					bOverlap &= (a.box.min[k] <= b.box.max[k]) & (b.box.min[k] <= a.box.max[k]);
+
+				if (bOverlap)
+					_out.push_back(a.index < b.index ? Pair{ a.index, b.index } : Pair{ b.index, a.index });
+			}
+		}
+	}
+
+//}
+
+
+//{ Update
+
+	template <typename AABBT>
+	void SweepAndPrune<AABBT>::Build(const AABBT* _boxes, uint32_t _num)
+	{
+		Clear();
+
+		if (_num == 0u)
+			return;
+
+		// Major axis: highest variance of box centers.
+		T sum[Dim] = {};
+		T sum2[Dim] = {};
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			for (uint32_t a = 0u; a < Dim; ++a)
+			{
+				const T c = (_boxes[i].min[a] + _boxes[i].max[a]) * T(0.5);
+
+				sum[a] += c;
+				sum2[a] += c * c;
+			}
+		}
+
+		T bestVariance = T(-1);
+
+		for (uint32_t a = 0u; a < Dim; ++a)
+		{
+			const T variance = sum2[a] - sum[a] * sum[a] / T(_num);
+
+			if (variance > bestVariance)
+			{
+				bestVariance = variance;
+				mAxis = a;
+			}
+		}
+
+		RadixSort(_boxes, _num);
+
+		Sweep(0u, _num, mPairs);
+	}
+
+	template <typename AABBT>
+	void SweepAndPrune<AABBT>::Update(const AABBT* _boxes)
+	{
+		for (auto& entry : mEntries)
+			entry.box = _boxes[entry.index];
+
+		InsertionSort();
+
+		mPairs.clear();
+		Sweep(0u, Size(), mPairs);
+	}
+
+	template <typename AABBT>
+	template <typename Executor>
+	void SweepAndPrune<AABBT>::UpdateParallel(const AABBT* _boxes, Executor&& _executor, uint32_t _taskNum)
+	{
+		if (_taskNum <= 1u)
+		{
+			Update(_boxes);
+			return;
+		}
+
+		for (auto& entry : mEntries)
+			entry.box = _boxes[entry.index];
+
+		InsertionSort();
+
+		const uint32_t size = Size();
+
+		mTaskPairs.resize(_taskNum);
+
+		_executor(0u, _taskNum, [this, size, _taskNum](uint32_t _taskIndex)
+		{
+			// Static contiguous split of the sorted sweep axis.
+			const uint32_t start = static_cast<uint32_t>(uint64_t(size) * _taskIndex / _taskNum);
+			const uint32_t end = static_cast<uint32_t>(uint64_t(size) * (_taskIndex + 1u) / _taskNum);
+
+			mTaskPairs[_taskIndex].clear();
+			Sweep(start, end, mTaskPairs[_taskIndex]);
+		});
+
+
+		// Concatenate in range order: same output as Update().
+		mPairs.clear();
+
+		for (uint32_t t = 0u; t < _taskNum; ++t)
+			mPairs.insert(mPairs.end(), mTaskPairs[t].begin(), mTaskPairs[t].end());
+	}
+
+	template <typename AABBT>
+	void SweepAndPrune<AABBT>::Clear() noexcept
+	{
+		mEntries.clear();
+		mPairs.clear();
+
+		mAxis = 0u;
+		mSwapNum = 0u;
+	}
+
+//}
+
+
+//{ Getters
+
+	template <typename AABBT>
+	uint32_t SweepAndPrune<AABBT>::Size() const noexcept
+	{
+		return static_cast<uint32_t>(mEntries.size());
+	}
+
+	template <typename AABBT>
+	uint32_t SweepAndPrune<AABBT>::GetAxis() const noexcept
+	{
+		return mAxis;
+	}
+
+	template <typename AABBT>
+	uint32_t SweepAndPrune<AABBT>::GetSwapNum() const noexcept
+	{
+		return mSwapNum;
+	}
+
+	template <typename AABBT>
+	const std::vector<typename SweepAndPrune<AABBT>::Pair>& SweepAndPrune<AABBT>::GetPairs() const noexcept
+	{
+		return mPairs;
+	}
+
+//}
+}
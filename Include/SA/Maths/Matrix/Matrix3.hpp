@@ -711,7 +711,7 @@ namespace SA
 
 #endif
 
-#if SA_MATHS_MATRIX3_SIMD && SA_INTRISC_SSE // SIMD float
+#if SA_MATHS_MATRIX3_SIMD && SA_INTRISC_AVX // SIMD float
 
 //{ Row Major
 
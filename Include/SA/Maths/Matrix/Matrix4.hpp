@@ -6,6 +6,7 @@
 #define SAPPHIRE_MATHS_MATRIX4_GUARD
 
 #include <limits>
+#include <cstddef>
 
 #include <SA/Maths/Debug.hpp>
 #include <SA/Maths/Config.hpp>
@@ -13,9 +14,10 @@
 #include <SA/Maths/Matrix/Matrix4Base.hpp>
 
 #include <SA/Maths/Algorithms/Lerp.hpp>
+#include <SA/Maths/Algorithms/SinCos.hpp>
 #include <SA/Maths/Algorithms/Equals.hpp>
 
-#if SA_MATHS_MATRIX4_SIMD
+#if SA_MATHS_MATRIX4_SIMD || SA_MATHS_MATRIX4_BATCH_SIMD
 
 	#include <SA/Support/Intrinsics.hpp>
 
@@ -404,9 +406,78 @@ namespace SA
 		*	\param[in] _near		Near frustum.
 		*	\param[in] _far			Far frustum.
 		*
-		*	\return perspective matrix.
+		*	\return perspective matrix (constexpr: see SA_MATHS_CONSTEXPR_MATHS).
 		*/
-		static Mat4 MakePerspective(T _fov = T(90.0), T _aspect = T(1.0), T _near = T(0.35), T _far = T(10.0)) noexcept;
+		static constexpr Mat4 MakePerspective(T _fov = T(90.0), T _aspect = T(1.0), T _near = T(0.35), T _far = T(10.0)) noexcept;
+
+//}
+
+//{ Batch
+
+		/**
+		*	\brief \e Transform an array of \b points (w = 1).
+		*
+		*	Affine transform: translation is applied, projective row (e30, e31, e32, e33) is ignored.
+		*	Use TransformVec4 for projective transformation.
+		*
+		*	\param[in] _in		Input points.
+		*	\param[out] _out	Output transformed points. Can be _in.
+		*	\param[in] _num		Number of points.
+		*/
+		void TransformPoints(const Vec3<T>* _in, Vec3<T>* _out, size_t _num) const noexcept;
+
+		/**
+		*	\brief \e Transform an array of \b directions (w = 0).
+		*
+		*	Same as operator*(const Vec3<T>&) for each element: translation is ignored.
+		*
+		*	\param[in] _in		Input directions.
+		*	\param[out] _out	Output transformed directions. Can be _in.
+		*	\param[in] _num		Number of directions.
+		*/
+		void TransformDirections(const Vec3<T>* _in, Vec3<T>* _out, size_t _num) const noexcept;
+
+		/**
+		*	\brief \e Transform an array of \b Vec4.
+		*
+		*	Same as operator*(const Vec4<T>&) for each element.
+		*
+		*	\param[in] _in		Input vectors.
+		*	\param[out] _out	Output transformed vectors. Can be _in.
+		*	\param[in] _num		Number of vectors.
+		*/
+		void TransformVec4(const Vec4<T>* _in, Vec4<T>* _out, size_t _num) const noexcept;
+
+
+		/**
+		*	\brief \e Multiply arrays of matrices: _out[i] = _lhs[i] * _rhs[i].
+		*
+		*	\param[in] _lhs		Left hand side matrices.
+		*	\param[in] _rhs		Right hand side matrices.
+		*	\param[out] _out	Output matrices. Can be _lhs or _rhs.
+		*	\param[in] _num		Number of matrices.
+		*/
+		static void MultiplyBatch(const Mat4* _lhs, const Mat4* _rhs, Mat4* _out, size_t _num) noexcept;
+
+		/**
+		*	\brief \e Multiply a matrix by an array of matrices: _out[i] = _lhs * _rhs[i].
+		*
+		*	\param[in] _lhs		Left hand side matrix (parent).
+		*	\param[in] _rhs		Right hand side matrices.
+		*	\param[out] _out	Output matrices. Can be _rhs.
+		*	\param[in] _num		Number of matrices.
+		*/
+		static void MultiplyBatch(const Mat4& _lhs, const Mat4* _rhs, Mat4* _out, size_t _num) noexcept;
+
+		/**
+		*	\brief \e Multiply an array of matrices by a matrix: _out[i] = _lhs[i] * _rhs.
+		*
+		*	\param[in] _lhs		Left hand side matrices.
+		*	\param[in] _rhs		Right hand side matrix.
+		*	\param[out] _out	Output matrices. Can be _lhs.
+		*	\param[in] _num		Number of matrices.
+		*/
+		static void MultiplyBatch(const Mat4* _lhs, const Mat4& _rhs, Mat4* _out, size_t _num) noexcept;
 
 //}
 
@@ -788,7 +859,25 @@ namespace SA
 
 #endif
 
-#if SA_MATHS_MATRIX4_SIMD && SA_INTRISC_SSE // SIMD float
+#if SA_MATHS_MATRIX4_SIMD && SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512 // SIMD AVX-512
+
+	// Other AVX-512 specializations are declared by SIMD float and double.
+
+	template <>
+	RMat4f& RMat4f::Transpose() noexcept;
+
+	template <>
+	CMat4f& CMat4f::Transpose() noexcept;
+
+	template <>
+	RMat4d& RMat4d::Transpose() noexcept;
+
+	template <>
+	CMat4d& CMat4d::Transpose() noexcept;
+
+#endif
+
+#if SA_MATHS_MATRIX4_SIMD && SA_INTRISC_AVX // SIMD float
 
 //{ Row Major
 
@@ -1026,6 +1115,96 @@ namespace SA
 
 //}
 
+#endif
+
+#if SA_MATHS_MATRIX4_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH) // SIMD batch
+
+//{ Float
+
+	template <>
+	void RMat4f::TransformPoints(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept;
+
+	template <>
+	void RMat4f::TransformDirections(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept;
+
+	template <>
+	void RMat4f::TransformVec4(const Vec4<float>* _in, Vec4<float>* _out, size_t _num) const noexcept;
+
+
+	template <>
+	void RMat4f::MultiplyBatch(const RMat4f* _lhs, const RMat4f* _rhs, RMat4f* _out, size_t _num) noexcept;
+
+	template <>
+	void RMat4f::MultiplyBatch(const RMat4f& _lhs, const RMat4f* _rhs, RMat4f* _out, size_t _num) noexcept;
+
+	template <>
+	void RMat4f::MultiplyBatch(const RMat4f* _lhs, const RMat4f& _rhs, RMat4f* _out, size_t _num) noexcept;
+
+
+	template <>
+	void CMat4f::TransformPoints(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept;
+
+	template <>
+	void CMat4f::TransformDirections(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept;
+
+	template <>
+	void CMat4f::TransformVec4(const Vec4<float>* _in, Vec4<float>* _out, size_t _num) const noexcept;
+
+
+	template <>
+	void CMat4f::MultiplyBatch(const CMat4f* _lhs, const CMat4f* _rhs, CMat4f* _out, size_t _num) noexcept;
+
+	template <>
+	void CMat4f::MultiplyBatch(const CMat4f& _lhs, const CMat4f* _rhs, CMat4f* _out, size_t _num) noexcept;
+
+	template <>
+	void CMat4f::MultiplyBatch(const CMat4f* _lhs, const CMat4f& _rhs, CMat4f* _out, size_t _num) noexcept;
+
+//}
+
+//{ Double
+
+	template <>
+	void RMat4d::TransformPoints(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept;
+
+	template <>
+	void RMat4d::TransformDirections(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept;
+
+	template <>
+	void RMat4d::TransformVec4(const Vec4<double>* _in, Vec4<double>* _out, size_t _num) const noexcept;
+
+
+	template <>
+	void RMat4d::MultiplyBatch(const RMat4d* _lhs, const RMat4d* _rhs, RMat4d* _out, size_t _num) noexcept;
+
+	template <>
+	void RMat4d::MultiplyBatch(const RMat4d& _lhs, const RMat4d* _rhs, RMat4d* _out, size_t _num) noexcept;
+
+	template <>
+	void RMat4d::MultiplyBatch(const RMat4d* _lhs, const RMat4d& _rhs, RMat4d* _out, size_t _num) noexcept;
+
+
+	template <>
+	void CMat4d::TransformPoints(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept;
+
+	template <>
+	void CMat4d::TransformDirections(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept;
+
+	template <>
+	void CMat4d::TransformVec4(const Vec4<double>* _in, Vec4<double>* _out, size_t _num) const noexcept;
+
+
+	template <>
+	void CMat4d::MultiplyBatch(const CMat4d* _lhs, const CMat4d* _rhs, CMat4d* _out, size_t _num) noexcept;
+
+	template <>
+	void CMat4d::MultiplyBatch(const CMat4d& _lhs, const CMat4d* _rhs, CMat4d* _out, size_t _num) noexcept;
+
+	template <>
+	void CMat4d::MultiplyBatch(const CMat4d* _lhs, const CMat4d& _rhs, CMat4d* _out, size_t _num) noexcept;
+
+//}
+
 #endif
 
 	/// \endcond
@@ -551,9 +551,11 @@ namespace SA
 
 
 	template <typename T, MatrixMajor major>
-	Mat4<T, major> Mat4<T, major>::MakePerspective(T _fov, T _aspect, T _near, T _far) noexcept
+	constexpr Mat4<T, major> Mat4<T, major>::MakePerspective(T _fov, T _aspect, T _near, T _far) noexcept
 	{
-		const T focalLength = T(1) / std::tan(Maths::DegToRad<T> * _fov / T(2));
+		// 1 / tan(fov / 2).
+		const Maths::SinCosResult<T> halfFov = Maths::SinCos(Rad<T>(Maths::DegToRad<T> * _fov / T(2)));
+		const T focalLength = halfFov.cos / halfFov.sin;
 
 		/**
 		*	Vulkan/DX12 matrix
@@ -571,6 +573,61 @@ namespace SA
 
 //}
 
+//{ Batch
+
+	template <typename T, MatrixMajor major>
+	void Mat4<T, major>::TransformPoints(const Vec3<T>* _in, Vec3<T>* _out, size_t _num) const noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+		{
+			const Vec3<T> v = _in[i];
+
+			_out[i] = Vec3<T>(
+				e00 * v.x + e01 * v.y + e02 * v.z + e03,
+				e10 * v.x + e11 * v.y + e12 * v.z + e13,
+				e20 * v.x + e21 * v.y + e22 * v.z + e23
+			);
+		}
+	}
+
+	template <typename T, MatrixMajor major>
+	void Mat4<T, major>::TransformDirections(const Vec3<T>* _in, Vec3<T>* _out, size_t _num) const noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+			_out[i] = (*this) * _in[i];
+	}
+
+	template <typename T, MatrixMajor major>
+	void Mat4<T, major>::TransformVec4(const Vec4<T>* _in, Vec4<T>* _out, size_t _num) const noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+			_out[i] = (*this) * _in[i];
+	}
+
+
+	template <typename T, MatrixMajor major>
+	void Mat4<T, major>::MultiplyBatch(const Mat4* _lhs, const Mat4* _rhs, Mat4* _out, size_t _num) noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+			_out[i] = _lhs[i] * _rhs[i];
+	}
+
+	template <typename T, MatrixMajor major>
+	void Mat4<T, major>::MultiplyBatch(const Mat4& _lhs, const Mat4* _rhs, Mat4* _out, size_t _num) noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+			_out[i] = _lhs * _rhs[i];
+	}
+
+	template <typename T, MatrixMajor major>
+	void Mat4<T, major>::MultiplyBatch(const Mat4* _lhs, const Mat4& _rhs, Mat4* _out, size_t _num) noexcept
+	{
+		for (size_t i = 0; i < _num; ++i)
+			_out[i] = _lhs[i] * _rhs;
+	}
+
+//}
+
 //{ Operators
 
 	template <typename T, MatrixMajor major>
@@ -6,6 +6,7 @@
 #define SAPPHIRE_MATHS_QUATERNION_GUARD
 
 #include <cstdint>
+#include <cstddef>
 
 #include <SA/Maths/Debug.hpp>
 #include <SA/Maths/Config.hpp>
@@ -13,8 +14,10 @@
 #include <SA/Maths/Angle/Degree.hpp>
 #include <SA/Maths/Algorithms/Cos.hpp>
 #include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/SinCos.hpp>
 #include <SA/Maths/Algorithms/Tan.hpp>
 #include <SA/Maths/Algorithms/Sqrt.hpp>
+#include <SA/Maths/Algorithms/InvSqrt.hpp>
 #include <SA/Maths/Algorithms/Lerp.hpp>
 #include <SA/Maths/Algorithms/Equals.hpp>
 
@@ -116,7 +119,7 @@ namespace SA
 		*	\param[in] _angle	Angle rotation in Degree.
 		*	\param[in] _axis	Axis rotation.
 		*/
-		Quat(Deg<T> _angle, const Vec3<T>& _axis) noexcept;
+		constexpr Quat(Deg<T> _angle, const Vec3<T>& _axis) noexcept;
 
 //}
 
@@ -235,6 +238,28 @@ namespace SA
 		*/
 		Quat GetNormalized() const;
 
+		/**
+		*	\brief \b Normalize this quaternion using an approximated inverse square root.
+		*
+		*	Opt-in fast path: multiply by InvSqrt<T, precision>(SqrLength()) instead of dividing by Length().
+		*
+		*	\tparam precision	Precision of the inverse square root (see InvSqrtPrecision).
+		*
+		*	\return self quaternion normalized.
+		*/
+		template <Maths::InvSqrtPrecision precision>
+		Quat& Normalize();
+
+		/**
+		*	\brief \b Normalize this quaternion using an approximated inverse square root.
+		*
+		*	\tparam precision	Precision of the inverse square root (see InvSqrtPrecision).
+		*
+		*	\return new normalized quaternion.
+		*/
+		template <Maths::InvSqrtPrecision precision>
+		Quat GetNormalized() const;
+
 		/**
 		*	\brief Whether this quaternion is normalized.
 		*
@@ -479,6 +504,44 @@ namespace SA
 		*/
 		static Quat SLerpUnclamped(const Quat& _start, const Quat& _end, float _alpha);
 
+
+
+		/**
+		*	\brief <b> Clamped normalized Lerp </b> of Structure-Of-Arrays quaternions.
+		*
+		*	_out[i] = normalized lerp from _start[i] to _end[i] at _alpha.
+		*	Shortest path (unlike Lerp): _end[i] is negated when Dot(_start[i], _end[i]) < 0.
+		*	SIMD implementation computes one quaternion per lane (SA_MATHS_QUATERNION_BATCH_SIMD).
+		*
+		*	\param[in] _sw, _sx, _sy, _sz	Starting quaternions components (should be normalized).
+		*	\param[in] _ew, _ex, _ey, _ez	Ending quaternions components (should be normalized).
+		*	\param[out] _ow, _ox, _oy, _oz	Output quaternions components. May alias start or end arrays.
+		*	\param[in] _alpha				Alpha of the lerp, clamped to [0, 1].
+		*	\param[in] _num				Number of quaternions.
+		*/
+		static void NLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, float _alpha, size_t _num);
+
+		/**
+		*	\brief <b> Clamped SLerp </b> of Structure-Of-Arrays quaternions.
+		*
+		*	_out[i] = SLerp(_start[i], _end[i], _alpha) (shortest path).
+		*	SIMD implementation computes one quaternion per lane (SA_MATHS_QUATERNION_BATCH_SIMD).
+		*
+		*	\tparam precision	Precision (see Maths::SLerpPrecision).
+		*
+		*	\param[in] _sw, _sx, _sy, _sz	Starting quaternions components (should be normalized).
+		*	\param[in] _ew, _ex, _ey, _ez	Ending quaternions components (should be normalized).
+		*	\param[out] _ow, _ox, _oy, _oz	Output quaternions components. May alias start or end arrays.
+		*	\param[in] _alpha				Alpha of the lerp, clamped to [0, 1].
+		*	\param[in] _num				Number of quaternions.
+		*/
+		template <Maths::SLerpPrecision precision = Maths::SLerpPrecision::Exact>
+		static void SLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, float _alpha, size_t _num);
+
 //}
 
 //{ Operators
@@ -769,7 +832,56 @@ namespace SA
 
 
 	/// \cond Internal
-	
+
+	namespace Intl
+	{
+		/// Quat::NLerpBatch implementation, _alpha already clamped.
+		template <typename T>
+		void QuatNLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept;
+
+		/// Quat::SLerpBatch implementation, _alpha already clamped.
+		template <typename T, Maths::SLerpPrecision precision>
+		void QuatSLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept;
+
+#if SA_MATHS_QUATERNION_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+		template <>
+		void QuatNLerpBatch<float>(const float* _sw, const float* _sx, const float* _sy, const float* _sz,
+			const float* _ew, const float* _ex, const float* _ey, const float* _ez,
+			float* _ow, float* _ox, float* _oy, float* _oz, float _alpha, size_t _num) noexcept;
+
+		template <>
+		void QuatSLerpBatch<float, Maths::SLerpPrecision::Exact>(const float* _sw, const float* _sx, const float* _sy, const float* _sz,
+			const float* _ew, const float* _ex, const float* _ey, const float* _ez,
+			float* _ow, float* _ox, float* _oy, float* _oz, float _alpha, size_t _num) noexcept;
+
+		template <>
+		void QuatSLerpBatch<float, Maths::SLerpPrecision::Approx>(const float* _sw, const float* _sx, const float* _sy, const float* _sz,
+			const float* _ew, const float* _ex, const float* _ey, const float* _ez,
+			float* _ow, float* _ox, float* _oy, float* _oz, float _alpha, size_t _num) noexcept;
+
+		template <>
+		void QuatNLerpBatch<double>(const double* _sw, const double* _sx, const double* _sy, const double* _sz,
+			const double* _ew, const double* _ex, const double* _ey, const double* _ez,
+			double* _ow, double* _ox, double* _oy, double* _oz, double _alpha, size_t _num) noexcept;
+
+		template <>
+		void QuatSLerpBatch<double, Maths::SLerpPrecision::Exact>(const double* _sw, const double* _sx, const double* _sy, const double* _sz,
+			const double* _ew, const double* _ex, const double* _ey, const double* _ez,
+			double* _ow, double* _ox, double* _oy, double* _oz, double _alpha, size_t _num) noexcept;
+
+		template <>
+		void QuatSLerpBatch<double, Maths::SLerpPrecision::Approx>(const double* _sw, const double* _sx, const double* _sy, const double* _sz,
+			const double* _ew, const double* _ex, const double* _ey, const double* _ez,
+			double* _ow, double* _ox, double* _oy, double* _oz, double _alpha, size_t _num) noexcept;
+
+#endif
+	}
+
 
 #if SA_MATHS_QUATERNION_SIMD && SA_INTRISC_SSE	// SIMD float
 
@@ -790,9 +902,13 @@ namespace SA
 	template <>
 	float Quatf::Dot(const Quatf& _lhs, const Quatf& _rhs) noexcept;
 
+#if SA_INTRISC_AVX // 256 bits packs.
+
 	template <>
 	Vec3<Degf> Quatf::ToEuler() const noexcept;
 
+#endif
+
 	template <>
 	Quatf Quatf::FromEuler(const Vec3<Degf>& _angles) noexcept;
 
@@ -34,17 +34,18 @@ namespace SA
 	}
 
 	template <typename T>
-	Quat<T>::Quat(Deg<T> _angle, const Vec3<T>& _axis) noexcept
+	constexpr Quat<T>::Quat(Deg<T> _angle, const Vec3<T>& _axis) noexcept
 	{
-		const Rad<T> halfAngle = _angle / T(2.0);
+		const Maths::SinCosResult<T> halfAngle = Maths::SinCos(Rad<T>(_angle) * T(0.5));
 
-		w = Maths::Cos(halfAngle);
+		w = halfAngle.cos;
 
 		SA_WARN(_axis.IsNormalized(), SA.Maths.Quat, L"Axis should be normalized!");
 
-		// Quaternion imaginary axis.
-		Vec3<T>& imgAxis = ImgAxis();
-		imgAxis = _axis * Maths::Sin(halfAngle);
+		// Quaternion imaginary axis (member-wise: constexpr).
+		x = _axis.x * halfAngle.sin;
+		y = _axis.y * halfAngle.sin;
+		z = _axis.z * halfAngle.sin;
 	}
 
 //}
@@ -165,6 +166,32 @@ namespace SA
 		);
 	}
 
+	template <typename T>
+	template <Maths::InvSqrtPrecision precision>
+	Quat<T>& Quat<T>::Normalize()
+	{
+		SA_ASSERT((NotEquals, *this, Zero), SA.Maths.Quat, L"Normalize null quaternion!");
+
+		const T invNorm = Maths::InvSqrt<T, precision>(SqrLength());
+
+		w *= invNorm;
+		x *= invNorm;
+		y *= invNorm;
+		z *= invNorm;
+
+		return *this;
+	}
+
+	template <typename T>
+	template <Maths::InvSqrtPrecision precision>
+	Quat<T> Quat<T>::GetNormalized() const
+	{
+		Quat res = *this;
+		res.template Normalize<precision>();
+
+		return res;
+	}
+
 	template <typename T>
 	bool Quat<T>::IsNormalized() const noexcept
 	{
@@ -406,14 +433,9 @@ namespace SA
 
 		Vec3<Rad<T>> halfRadAngles = Vec3<T>(_angles) * T{ 0.5 } *Maths::DegToRad<T>;
 
-		const T cosPitch = Maths::Cos(halfRadAngles.x);
-		const T sinPitch = Maths::Sin(halfRadAngles.x);
-
-		const T cosYaw = Maths::Cos(halfRadAngles.y);
-		const T sinYaw = Maths::Sin(halfRadAngles.y);
-
-		const T cosRoll = Maths::Cos(halfRadAngles.z);
-		const T sinRoll = Maths::Sin(halfRadAngles.z);
+		const auto [sinPitch, cosPitch] = Maths::SinCos(halfRadAngles.x);
+		const auto [sinYaw, cosYaw] = Maths::SinCos(halfRadAngles.y);
+		const auto [sinRoll, cosRoll] = Maths::SinCos(halfRadAngles.z);
 
 		return Quat(
 			cosPitch * cosYaw * cosRoll + sinPitch * sinYaw * sinRoll,
@@ -476,6 +498,28 @@ namespace SA
 		return Maths::SLerpUnclamped(_start, _end, _alpha).GetNormalized();
 	}
 
+
+	template <typename T>
+	void Quat<T>::NLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+		const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+		T* _ow, T* _ox, T* _oy, T* _oz, float _alpha, size_t _num)
+	{
+		SA_WARN(_alpha >= 0.0f && _alpha <= 1.0f, SA.Maths.Quat, (L"Alpha[%1] clamped to range [0, 1]!", _alpha));
+
+		Intl::QuatNLerpBatch<T>(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, static_cast<T>(std::clamp(_alpha, 0.0f, 1.0f)), _num);
+	}
+
+	template <typename T>
+	template <Maths::SLerpPrecision precision>
+	void Quat<T>::SLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+		const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+		T* _ow, T* _ox, T* _oy, T* _oz, float _alpha, size_t _num)
+	{
+		SA_WARN(_alpha >= 0.0f && _alpha <= 1.0f, SA.Maths.Quat, (L"Alpha[%1] clamped to range [0, 1]!", _alpha));
+
+		Intl::QuatSLerpBatch<T, precision>(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, static_cast<T>(std::clamp(_alpha, 0.0f, 1.0f)), _num);
+	}
+
 //}
 
 //{ Operators
@@ -658,6 +702,140 @@ namespace SA
 	}
 
 
+	/// \cond Internal
+
+	namespace Intl
+	{
+		template <typename T>
+		void QuatNLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+			{
+				const Quat<T> start(_sw[i], _sx[i], _sy[i], _sz[i]);
+				Quat<T> end(_ew[i], _ex[i], _ey[i], _ez[i]);
+
+				// Ensure shortest path between start and end.
+				if (Quat<T>::Dot(start, end) < T(0))
+					end = -end;
+
+				const Quat<T> res = (start + (end - start) * _alpha).GetNormalized();
+
+				_ow[i] = res.w;
+				_ox[i] = res.x;
+				_oy[i] = res.y;
+				_oz[i] = res.z;
+			}
+		}
+
+		template <typename T, Maths::SLerpPrecision precision>
+		void QuatSLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept
+		{
+			if constexpr (precision == Maths::SLerpPrecision::Exact)
+			{
+				for (size_t i = 0; i < _num; ++i)
+				{
+					const Quat<T> start(_sw[i], _sx[i], _sy[i], _sz[i]);
+					Quat<T> end(_ew[i], _ex[i], _ey[i], _ez[i]);
+
+					// Ensure shortest path between start and end.
+					if (Quat<T>::Dot(start, end) < T(0))
+						end = -end;
+
+					/**
+					*	angle = 2 * atan2(|s - e|, |s + e|): ACos(Dot) loses precision near 1 (and is NaN above 1).
+					*	Same formula as the SIMD kernels.
+					*/
+					const T angle = T(2) * Maths::ATan2((start - end).Length(), (start + end).Length()).Handle();
+
+					T wStart = T(1) - _alpha;
+					T wEnd = _alpha;
+
+					if (angle > T(0))
+					{
+						const T invSin = T(1) / Maths::Sin(Rad<T>(angle));
+
+						wStart = Maths::Sin(Rad<T>(wStart * angle)) * invSin;
+						wEnd = Maths::Sin(Rad<T>(wEnd * angle)) * invSin;
+					}
+
+					const Quat<T> res = start * wStart + end * wEnd;
+
+					_ow[i] = res.w;
+					_ox[i] = res.x;
+					_oy[i] = res.y;
+					_oz[i] = res.z;
+				}
+			}
+			else
+			{
+				/**
+				*	Reference: D. Eberly, A Fast and Accurate Algorithm for Computing SLERP (2011).
+				*	sin(a * angle) / sin(angle) = a * (1 + b0 (x - 1) (1 + b1 (x - 1) (...))), x = cos(angle),
+				*	b(i) = (a^2 - (i + 1)^2) / ((i + 1) (2i + 3)): 8 terms, last term scaled to balance the truncation error.
+				*/
+				constexpr size_t termNum = 8u;
+				constexpr T mu = T(1.85298109240830);
+
+				const T beta = T(1) - _alpha;
+
+				T bStart[termNum];
+				T bEnd[termNum];
+
+				for (size_t j = 0; j < termNum; ++j)
+				{
+					const T n = static_cast<T>(j + 1);
+					const T scale = j == termNum - 1 ? mu : T(1);
+
+					const T u = scale / (n * (T(2) * n + T(1)));
+					const T v = scale * n / (T(2) * n + T(1));
+
+					bStart[j] = u * beta * beta - v;
+					bEnd[j] = u * _alpha * _alpha - v;
+				}
+
+				for (size_t i = 0; i < _num; ++i)
+				{
+					const Quat<T> start(_sw[i], _sx[i], _sy[i], _sz[i]);
+					Quat<T> end(_ew[i], _ex[i], _ey[i], _ez[i]);
+
+					T dot = Quat<T>::Dot(start, end);
+
+					// Ensure shortest path between start and end.
+					if (dot < T(0))
+					{
+						end = -end;
+						dot = -dot;
+					}
+
+					const T xm1 = dot - T(1);
+
+					T wStart = T(1) + bStart[termNum - 1] * xm1;
+					T wEnd = T(1) + bEnd[termNum - 1] * xm1;
+
+					for (size_t j = termNum - 1; j-- > 0;)
+					{
+						wStart = T(1) + bStart[j] * xm1 * wStart;
+						wEnd = T(1) + bEnd[j] * xm1 * wEnd;
+					}
+
+					const Quat<T> res = start * (wStart * beta) + end * (wEnd * _alpha);
+
+					_ow[i] = res.w;
+					_ox[i] = res.x;
+					_oy[i] = res.y;
+					_oz[i] = res.z;
+				}
+			}
+		}
+	}
+
+	/// \endcond
+
+
 #if SA_LOGGER_IMPL
 
 	template <typename T>
@@ -0,0 +1,425 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_QUATERNION_STREAM_GUARD
+#define SAPPHIRE_MATHS_QUATERNION_STREAM_GUARD
+
+#include <new>
+#include <cstddef>
+#include <utility>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Space/Quaternion.hpp>
+#include <SA/Maths/Space/Vector3Stream.hpp>
+
+#if SA_MATHS_QUATERNION_STREAM_SIMD
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+*	\file QuaternionStream.hpp
+*
+*	\brief <b>Quaternion stream</b> type implementation.
+*
+*	Structure-of-arrays container of Quat for bulk computation.
+*
+*	\ingroup Maths_Space
+*	\{
+*/
+
+
+namespace SA
+{
+	/**
+	*	\brief \e Quaternion stream Sapphire-Maths class.
+	*
+	*	Store N quaternions as 4 separated aligned arrays (W, X, Y and Z).
+	*	Bulk operations process one quaternion per SIMD lane.
+	*
+	*	\tparam T	Type of the quaternions.
+	*/
+	template <typename T>
+	class QuatStream
+	{
+		/// Single allocation of the 4 component arrays: [W...|X...|Y...|Z...].
+		T* mData = nullptr;
+
+		/// Number of quaternions in stream.
+		size_t mSize = 0u;
+
+		/// Number of allocated quaternions per component array.
+		size_t mCapacity = 0u;
+
+		/**
+		*	\brief Allocate a new buffer of _capacity and copy current content.
+		*
+		*	\param[in] _capacity	New capacity (already padded).
+		*/
+		void Reallocate(size_t _capacity);
+
+	public:
+		/// Type of the Quaternion.
+		using Type = T;
+
+		/// Alignment in bytes of each component array.
+		static constexpr size_t Alignment = 64u;
+
+		/// Capacity granularity: each component array start is aligned on Alignment.
+		static constexpr size_t Granularity = Alignment / sizeof(T) > 0u ? Alignment / sizeof(T) : 1u;
+
+//{ Constructors
+
+		/// \b Default constructor.
+		QuatStream() = default;
+
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _size	Number of quaternions (identity initialized).
+		*/
+		explicit QuatStream(size_t _size);
+
+		/**
+		*	\brief \e Value constructor from Array-Of-Structures (gather).
+		*
+		*	\param[in] _quats	Input quaternion array.
+		*	\param[in] _num		Number of quaternions in _quats.
+		*/
+		QuatStream(const Quat<T>* _quats, size_t _num);
+
+		/**
+		*	\brief \e Copy constructor.
+		*
+		*	\param[in] _other	Other stream to copy from.
+		*/
+		QuatStream(const QuatStream& _other);
+
+		/**
+		*	\brief \e Move constructor.
+		*
+		*	\param[in] _other	Other stream to move from.
+		*/
+		QuatStream(QuatStream&& _other) noexcept;
+
+		/// \b Destructor (free memory).
+		~QuatStream();
+
+//}
+
+//{ Size
+
+		/**
+		*	\brief Getter of stream size.
+		*
+		*	\return Number of quaternions in stream.
+		*/
+		size_t Size() const noexcept;
+
+		/**
+		*	\brief Getter of stream capacity.
+		*
+		*	\return Number of allocated quaternions.
+		*/
+		size_t Capacity() const noexcept;
+
+		/**
+		*	\brief Whether stream is empty.
+		*
+		*	\return true if Size() == 0.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief Reserve memory for at least _capacity quaternions.
+		*
+		*	\param[in] _capacity	Minimum capacity to allocate.
+		*/
+		void Reserve(size_t _capacity);
+
+		/**
+		*	\brief Resize stream. New quaternions are identity initialized.
+		*
+		*	\param[in] _size	New size.
+		*/
+		void Resize(size_t _size);
+
+		/// Set size to 0. Memory is kept.
+		void Clear() noexcept;
+
+//}
+
+//{ Accessors
+
+		/**
+		*	\brief Access W component array.
+		*
+		*	\return W array pointer (aligned on Alignment).
+		*/
+		T* W() noexcept;
+
+		/// \copydoc W()
+		const T* W() const noexcept;
+
+		/**
+		*	\brief Access X component array.
+		*
+		*	\return X array pointer (aligned on Alignment).
+		*/
+		T* X() noexcept;
+
+		/// \copydoc X()
+		const T* X() const noexcept;
+
+		/**
+		*	\brief Access Y component array.
+		*
+		*	\return Y array pointer (aligned on Alignment).
+		*/
+		T* Y() noexcept;
+
+		/// \copydoc Y()
+		const T* Y() const noexcept;
+
+		/**
+		*	\brief Access Z component array.
+		*
+		*	\return Z array pointer (aligned on Alignment).
+		*/
+		T* Z() noexcept;
+
+		/// \copydoc Z()
+		const T* Z() const noexcept;
+
+
+		/**
+		*	\brief Get the quaternion at index.
+		*
+		*	\param[in] _index	Index of the quaternion.
+		*
+		*	\return Quaternion at _index.
+		*/
+		Quat<T> Get(size_t _index) const;
+
+		/**
+		*	\brief Set the quaternion at index.
+		*
+		*	\param[in] _index	Index of the quaternion.
+		*	\param[in] _quat	Quaternion to assign.
+		*/
+		void Set(size_t _index, const Quat<T>& _quat);
+
+		/**
+		*	\brief Append a quaternion at the end of the stream.
+		*
+		*	\param[in] _quat	Quaternion to append.
+		*/
+		void Push(const Quat<T>& _quat);
+
+//}
+
+//{ Gather/Scatter
+
+		/**
+		*	\brief \b Gather: Array-Of-Structures to Structure-Of-Arrays.
+		*
+		*	Resize stream to _num and deinterleave _quats into W, X, Y and Z arrays.
+		*
+		*	\param[in] _quats	Input quaternion array.
+		*	\param[in] _num		Number of quaternions in _quats.
+		*/
+		void Gather(const Quat<T>* _quats, size_t _num);
+
+		/**
+		*	\brief \b Scatter: Structure-Of-Arrays to Array-Of-Structures.
+		*
+		*	\param[out] _out	Output quaternion array. Must be at least Size() long.
+		*/
+		void Scatter(Quat<T>* _out) const;
+
+//}
+
+//{ Normalize
+
+		/**
+		*	\brief \b Normalize every quaternion of the stream.
+		*
+		*	\return self stream normalized.
+		*/
+		QuatStream& Normalize();
+
+//}
+
+//{ Inverse
+
+		/**
+		*	\brief \b Inverse every quaternion of the stream.
+		*
+		*	Inverse of normalized quaternion is conjugate: quaternions should be normalized.
+		*
+		*	\return self stream inversed.
+		*/
+		QuatStream& Inverse() noexcept;
+
+//}
+
+//{ Rotate
+
+		/**
+		*	\brief \b Rotate each _vecs[i] by this[i].
+		*
+		*	v' = v + 2w (q x v) + 2q x (q x v), quaternions should be normalized.
+		*
+		*	\param[in] _vecs	Vectors to rotate (same size).
+		*	\param[out] _out	Output rotated vectors stream (resized to Size()). Can be _vecs.
+		*/
+		void Rotate(const Vec3Stream<T>& _vecs, Vec3Stream<T>& _out) const;
+
+		/**
+		*	\brief \b Un-Rotate each _vecs[i] by this[i].
+		*
+		*	Rotate by the conjugate, quaternions should be normalized.
+		*
+		*	\param[in] _vecs	Vectors to un-rotate (same size).
+		*	\param[out] _out	Output un-rotated vectors stream (resized to Size()). Can be _vecs.
+		*/
+		void UnRotate(const Vec3Stream<T>& _vecs, Vec3Stream<T>& _out) const;
+
+//}
+
+//{ Dot/Multiply
+
+		/**
+		*	\brief \e Compute the <b> Dot product </b> between each _lhs[i] and _rhs[i].
+		*
+		*	\param[in] _lhs		Left hand side stream.
+		*	\param[in] _rhs		Right hand side stream.
+		*	\param[out] _out	Output dot products. Must be at least _lhs.Size() long.
+		*/
+		static void Dot(const QuatStream& _lhs, const QuatStream& _rhs, T* _out) noexcept;
+
+		/**
+		*	\brief \e Compute the <b> Quaternion product </b> _lhs[i] * _rhs[i] (ie: _lhs[i].Rotate(_rhs[i])).
+		*
+		*	\param[in] _lhs		Left hand side stream.
+		*	\param[in] _rhs		Right hand side stream.
+		*	\param[out] _out	Output products stream (resized to _lhs.Size()). Can be _lhs or _rhs.
+		*/
+		static void Multiply(const QuatStream& _lhs, const QuatStream& _rhs, QuatStream& _out);
+
+//}
+
+//{ Operators
+
+		/**
+		*	\brief \e Copy assignment.
+		*
+		*	\param[in] _rhs		Other stream to copy from.
+		*
+		*	\return self stream.
+		*/
+		QuatStream& operator=(const QuatStream& _rhs);
+
+		/**
+		*	\brief \e Move assignment.
+		*
+		*	\param[in] _rhs		Other stream to move from.
+		*
+		*	\return self stream.
+		*/
+		QuatStream& operator=(QuatStream&& _rhs) noexcept;
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float QuatStream.
+	using QuatStreamf = QuatStream<float>;
+
+	/// Alias for double QuatStream.
+	using QuatStreamd = QuatStream<double>;
+
+
+	/// Template alias of QuatStream
+	template <typename T>
+	using QuaternionStream = QuatStream<T>;
+
+	/// Alias for float QuaternionStream.
+	using QuaternionStreamf = QuaternionStream<float>;
+
+	/// Alias for double QuaternionStream.
+	using QuaternionStreamd = QuaternionStream<double>;
+
+//}
+
+
+	/// \cond Internal
+
+#if SA_MATHS_QUATERNION_STREAM_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+//{ Float
+
+	template <>
+	QuatStreamf& QuatStreamf::Normalize();
+
+	template <>
+	QuatStreamf& QuatStreamf::Inverse() noexcept;
+
+	template <>
+	void QuatStreamf::Rotate(const Vec3Streamf& _vecs, Vec3Streamf& _out) const;
+
+	template <>
+	void QuatStreamf::UnRotate(const Vec3Streamf& _vecs, Vec3Streamf& _out) const;
+
+	template <>
+	void QuatStreamf::Dot(const QuatStreamf& _lhs, const QuatStreamf& _rhs, float* _out) noexcept;
+
+	template <>
+	void QuatStreamf::Multiply(const QuatStreamf& _lhs, const QuatStreamf& _rhs, QuatStreamf& _out);
+
+//}
+
+//{ Double
+
+	template <>
+	QuatStreamd& QuatStreamd::Normalize();
+
+	template <>
+	QuatStreamd& QuatStreamd::Inverse() noexcept;
+
+	template <>
+	void QuatStreamd::Rotate(const Vec3Streamd& _vecs, Vec3Streamd& _out) const;
+
+	template <>
+	void QuatStreamd::UnRotate(const Vec3Streamd& _vecs, Vec3Streamd& _out) const;
+
+	template <>
+	void QuatStreamd::Dot(const QuatStreamd& _lhs, const QuatStreamd& _rhs, double* _out) noexcept;
+
+	template <>
+	void QuatStreamd::Multiply(const QuatStreamd& _lhs, const QuatStreamd& _rhs, QuatStreamd& _out);
+
+//}
+
+#endif
+
+	/// \endcond
+}
+
+/**
+*	\example QuaternionStreamTests.cpp
+*	Examples and Unitary Tests for QuatStream.
+*/
+
+
+/** \} */
+
+#include <SA/Maths/Space/QuaternionStream.inl>
+
+#endif // GUARD
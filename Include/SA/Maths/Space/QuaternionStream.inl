@@ -0,0 +1,377 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T>
+	QuatStream<T>::QuatStream(size_t _size)
+	{
+		Resize(_size);
+	}
+
+	template <typename T>
+	QuatStream<T>::QuatStream(const Quat<T>* _quats, size_t _num)
+	{
+		Gather(_quats, _num);
+	}
+
+	template <typename T>
+	QuatStream<T>::QuatStream(const QuatStream& _other)
+	{
+		*this = _other;
+	}
+
+	template <typename T>
+	QuatStream<T>::QuatStream(QuatStream&& _other) noexcept
+	{
+		*this = std::move(_other);
+	}
+
+	template <typename T>
+	QuatStream<T>::~QuatStream()
+	{
+		if (mData)
+			::operator delete(mData, std::align_val_t(Alignment));
+	}
+
+//}
+
+//{ Size
+
+	template <typename T>
+	size_t QuatStream<T>::Size() const noexcept
+	{
+		return mSize;
+	}
+
+	template <typename T>
+	size_t QuatStream<T>::Capacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	template <typename T>
+	bool QuatStream<T>::IsEmpty() const noexcept
+	{
+		return mSize == 0u;
+	}
+
+
+	template <typename T>
+	void QuatStream<T>::Reallocate(size_t _capacity)
+	{
+		T* const data = static_cast<T*>(::operator new(4u * _capacity * sizeof(T), std::align_val_t(Alignment)));
+
+		if (mData)
+		{
+			for (size_t c = 0; c < 4u; ++c)
+			{
+				for (size_t i = 0; i < mSize; ++i)
+					data[c * _capacity + i] = mData[c * mCapacity + i];
+			}
+
+			::operator delete(mData, std::align_val_t(Alignment));
+		}
+
+		mData = data;
+		mCapacity = _capacity;
+	}
+
+	template <typename T>
+	void QuatStream<T>::Reserve(size_t _capacity)
+	{
+		if (_capacity <= mCapacity)
+			return;
+
+		// Pad to keep every component array aligned.
+		Reallocate((_capacity + Granularity - 1u) / Granularity * Granularity);
+	}
+
+	template <typename T>
+	void QuatStream<T>::Resize(size_t _size)
+	{
+		Reserve(_size);
+
+		for (size_t i = mSize; i < _size; ++i)
+		{
+			W()[i] = T(1);
+			X()[i] = T(0);
+			Y()[i] = T(0);
+			Z()[i] = T(0);
+		}
+
+		mSize = _size;
+	}
+
+	template <typename T>
+	void QuatStream<T>::Clear() noexcept
+	{
+		mSize = 0u;
+	}
+
+//}
+
+//{ Accessors
+
+	template <typename T>
+	T* QuatStream<T>::W() noexcept
+	{
+		return mData;
+	}
+
+	template <typename T>
+	const T* QuatStream<T>::W() const noexcept
+	{
+		return mData;
+	}
+
+	template <typename T>
+	T* QuatStream<T>::X() noexcept
+	{
+		return mData + mCapacity;
+	}
+
+	template <typename T>
+	const T* QuatStream<T>::X() const noexcept
+	{
+		return mData + mCapacity;
+	}
+
+	template <typename T>
+	T* QuatStream<T>::Y() noexcept
+	{
+		return mData + 2u * mCapacity;
+	}
+
+	template <typename T>
+	const T* QuatStream<T>::Y() const noexcept
+	{
+		return mData + 2u * mCapacity;
+	}
+
+	template <typename T>
+	T* QuatStream<T>::Z() noexcept
+	{
+		return mData + 3u * mCapacity;
+	}
+
+	template <typename T>
+	const T* QuatStream<T>::Z() const noexcept
+	{
+		return mData + 3u * mCapacity;
+	}
+
+
+	template <typename T>
+	Quat<T> QuatStream<T>::Get(size_t _index) const
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, mSize - 1u), SA.Maths.QuatStream);
+
+		return Quat<T>(W()[_index], X()[_index], Y()[_index], Z()[_index]);
+	}
+
+	template <typename T>
+	void QuatStream<T>::Set(size_t _index, const Quat<T>& _quat)
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, mSize - 1u), SA.Maths.QuatStream);
+
+		W()[_index] = _quat.w;
+		X()[_index] = _quat.x;
+		Y()[_index] = _quat.y;
+		Z()[_index] = _quat.z;
+	}
+
+	template <typename T>
+	void QuatStream<T>::Push(const Quat<T>& _quat)
+	{
+		if (mSize == mCapacity)
+			Reserve(mCapacity ? mCapacity * 2u : Granularity);
+
+		++mSize;
+		Set(mSize - 1u, _quat);
+	}
+
+//}
+
+//{ Gather/Scatter
+
+	template <typename T>
+	void QuatStream<T>::Gather(const Quat<T>* _quats, size_t _num)
+	{
+		Clear();
+		Reserve(_num);
+		mSize = _num;
+
+		T* const outW = W();
+		T* const outX = X();
+		T* const outY = Y();
+		T* const outZ = Z();
+
+		for (size_t i = 0; i < _num; ++i)
+		{
+			outW[i] = _quats[i].w;
+			outX[i] = _quats[i].x;
+			outY[i] = _quats[i].y;
+			outZ[i] = _quats[i].z;
+		}
+	}
+
+	template <typename T>
+	void QuatStream<T>::Scatter(Quat<T>* _out) const
+	{
+		const T* const inW = W();
+		const T* const inX = X();
+		const T* const inY = Y();
+		const T* const inZ = Z();
+
+		for (size_t i = 0; i < mSize; ++i)
+			_out[i] = Quat<T>(inW[i], inX[i], inY[i], inZ[i]);
+	}
+
+//}
+
+//{ Normalize
+
+	template <typename T>
+	QuatStream<T>& QuatStream<T>::Normalize()
+	{
+		T* const qW = W();
+		T* const qX = X();
+		T* const qY = Y();
+		T* const qZ = Z();
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			const T len = Maths::Sqrt(qW[i] * qW[i] + qX[i] * qX[i] + qY[i] * qY[i] + qZ[i] * qZ[i]);
+
+			SA_ASSERT((NotEquals0, len), SA.Maths.QuatStream, L"Normalize null quaternion!");
+
+			qW[i] /= len;
+			qX[i] /= len;
+			qY[i] /= len;
+			qZ[i] /= len;
+		}
+
+		return *this;
+	}
+
+//}
+
+//{ Inverse
+
+	template <typename T>
+	QuatStream<T>& QuatStream<T>::Inverse() noexcept
+	{
+		// Inverse of normalized quaternion is conjugate.
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			X()[i] = -X()[i];
+			Y()[i] = -Y()[i];
+			Z()[i] = -Z()[i];
+		}
+
+		return *this;
+	}
+
+//}
+
+//{ Rotate
+
+	template <typename T>
+	void QuatStream<T>::Rotate(const Vec3Stream<T>& _vecs, Vec3Stream<T>& _out) const
+	{
+		SA_ASSERT((Equals, mSize, _vecs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(mSize);
+
+		for (size_t i = 0; i < mSize; ++i)
+			_out.Set(i, Get(i).Rotate(_vecs.Get(i)));
+	}
+
+	template <typename T>
+	void QuatStream<T>::UnRotate(const Vec3Stream<T>& _vecs, Vec3Stream<T>& _out) const
+	{
+		SA_ASSERT((Equals, mSize, _vecs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(mSize);
+
+		for (size_t i = 0; i < mSize; ++i)
+			_out.Set(i, Get(i).UnRotate(_vecs.Get(i)));
+	}
+
+//}
+
+//{ Dot/Multiply
+
+	template <typename T>
+	void QuatStream<T>::Dot(const QuatStream& _lhs, const QuatStream& _rhs, T* _out) noexcept
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		for (size_t i = 0; i < _lhs.Size(); ++i)
+		{
+			_out[i] = _lhs.W()[i] * _rhs.W()[i] + _lhs.X()[i] * _rhs.X()[i] +
+				_lhs.Y()[i] * _rhs.Y()[i] + _lhs.Z()[i] * _rhs.Z()[i];
+		}
+	}
+
+	template <typename T>
+	void QuatStream<T>::Multiply(const QuatStream& _lhs, const QuatStream& _rhs, QuatStream& _out)
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(_lhs.Size());
+
+		for (size_t i = 0; i < _lhs.Size(); ++i)
+		{
+			const Quat<T> l = _lhs.Get(i);
+			const Quat<T> r = _rhs.Get(i);
+
+			_out.Set(i, Quat<T>(
+				l.w * r.w - l.x * r.x - l.y * r.y - l.z * r.z,
+				l.w * r.x + l.x * r.w + l.y * r.z - l.z * r.y,
+				l.w * r.y - l.x * r.z + l.y * r.w + l.z * r.x,
+				l.w * r.z + l.x * r.y - l.y * r.x + l.z * r.w
+			));
+		}
+	}
+
+//}
+
+//{ Operators
+
+	template <typename T>
+	QuatStream<T>& QuatStream<T>::operator=(const QuatStream& _rhs)
+	{
+		if (this == &_rhs)
+			return *this;
+
+		Clear();
+		Reserve(_rhs.mSize);
+		mSize = _rhs.mSize;
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			W()[i] = _rhs.W()[i];
+			X()[i] = _rhs.X()[i];
+			Y()[i] = _rhs.Y()[i];
+			Z()[i] = _rhs.Z()[i];
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	QuatStream<T>& QuatStream<T>::operator=(QuatStream&& _rhs) noexcept
+	{
+		std::swap(mData, _rhs.mData);
+		std::swap(mSize, _rhs.mSize);
+		std::swap(mCapacity, _rhs.mCapacity);
+
+		return *this;
+	}
+
+//}
+}
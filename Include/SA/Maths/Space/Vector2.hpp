@@ -13,6 +13,7 @@
 #include <SA/Maths/Algorithms/Cos.hpp>
 #include <SA/Maths/Algorithms/Tan.hpp>
 #include <SA/Maths/Algorithms/Sqrt.hpp>
+#include <SA/Maths/Algorithms/InvSqrt.hpp>
 #include <SA/Maths/Algorithms/Lerp.hpp>
 #include <SA/Maths/Algorithms/Equals.hpp>
 
@@ -229,6 +230,28 @@ namespace SA
 		*/
 		Vec2 GetNormalized() const;
 
+		/**
+		*	\brief \b Normalize this vector using an approximated inverse square root.
+		*
+		*	Opt-in fast path: multiply by InvSqrt<T, precision>(SqrLength()) instead of dividing by Length().
+		*
+		*	\tparam precision	Precision of the inverse square root (see InvSqrtPrecision).
+		*
+		*	\return self vector normalized.
+		*/
+		template <Maths::InvSqrtPrecision precision>
+		Vec2& Normalize();
+
+		/**
+		*	\brief \b Normalize this vector using an approximated inverse square root.
+		*
+		*	\tparam precision	Precision of the inverse square root (see InvSqrtPrecision).
+		*
+		*	\return new normalized vector.
+		*/
+		template <Maths::InvSqrtPrecision precision>
+		Vec2 GetNormalized() const;
+
 		/**
 		*	\brief Whether this vector is normalized.
 		*
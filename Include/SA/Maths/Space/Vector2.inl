@@ -157,6 +157,30 @@ namespace SA
 		return res;
 	}
 
+	template <typename T>
+	template <Maths::InvSqrtPrecision precision>
+	Vec2<T>& Vec2<T>::Normalize()
+	{
+		SA_ASSERT((NotEquals, *this, Zero), SA.Maths.Vec2, L"Normalize null vector!");
+
+		const T invNorm = Maths::InvSqrt<T, precision>(SqrLength());
+
+		x *= invNorm;
+		y *= invNorm;
+
+		return *this;
+	}
+
+	template <typename T>
+	template <Maths::InvSqrtPrecision precision>
+	Vec2<T> Vec2<T>::GetNormalized() const
+	{
+		Vec2 res = *this;
+		res.template Normalize<precision>();
+
+		return res;
+	}
+
 	template <typename T>
 	constexpr bool Vec2<T>::IsNormalized() const noexcept
 	{
@@ -177,6 +177,31 @@ namespace SA
 		return res;
 	}
 
+	template <typename T>
+	template <Maths::InvSqrtPrecision precision>
+	Vec3<T>& Vec3<T>::Normalize()
+	{
+		SA_ASSERT((NotEquals, *this, Zero), SA.Maths.Vec3, L"Normalize null vector!");
+
+		const T invNorm = Maths::InvSqrt<T, precision>(SqrLength());
+
+		x *= invNorm;
+		y *= invNorm;
+		z *= invNorm;
+
+		return *this;
+	}
+
+	template <typename T>
+	template <Maths::InvSqrtPrecision precision>
+	Vec3<T> Vec3<T>::GetNormalized() const
+	{
+		Vec3 res = *this;
+		res.template Normalize<precision>();
+
+		return res;
+	}
+
 	template <typename T>
 	constexpr bool Vec3<T>::IsNormalized() const noexcept
 	{
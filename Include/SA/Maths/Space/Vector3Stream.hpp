@@ -0,0 +1,495 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_VECTOR3_STREAM_GUARD
+#define SAPPHIRE_MATHS_VECTOR3_STREAM_GUARD
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+#include <SA/Maths/Debug.hpp>
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Space/Vector3.hpp>
+
+#if SA_MATHS_VECTOR3_STREAM_SIMD
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/**
+*	\file Vector3Stream.hpp
+*
+*	\brief <b>Vector 3 stream</b> type implementation.
+*
+*	Structure-of-arrays container of Vec3 for bulk computation.
+*
+*	\ingroup Maths_Space
+*	\{
+*/
+
+
+namespace SA
+{
+	/**
+	*	\brief \e Vector 3 stream Sapphire-Maths class.
+	*
+	*	Store N vectors as 3 separated aligned arrays (X, Y and Z).
+	*	Bulk operations process one vector per SIMD lane.
+	*
+	*	\tparam T	Type of the vectors.
+	*/
+	template <typename T>
+	class Vec3Stream
+	{
+		/// Single allocation of the 3 component arrays: [X...|Y...|Z...].
+		T* mData = nullptr;
+
+		/// Number of vectors in stream.
+		size_t mSize = 0u;
+
+		/// Number of allocated vectors per component array.
+		size_t mCapacity = 0u;
+
+		/**
+		*	\brief Allocate a new buffer of _capacity and copy current content.
+		*
+		*	\param[in] _capacity	New capacity (already padded).
+		*/
+		void Reallocate(size_t _capacity);
+
+	public:
+		/// Type of the Vector.
+		using Type = T;
+
+		/// Alignment in bytes of each component array.
+		static constexpr size_t Alignment = 64u;
+
+		/// Capacity granularity: each component array start is aligned on Alignment.
+		static constexpr size_t Granularity = Alignment / sizeof(T) > 0u ? Alignment / sizeof(T) : 1u;
+
+//{ Constructors
+
+		/// \b Default constructor.
+		Vec3Stream() = default;
+
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _size	Number of vectors (zero initialized).
+		*/
+		explicit Vec3Stream(size_t _size);
+
+		/**
+		*	\brief \e Value constructor from Array-Of-Structures (gather).
+		*
+		*	\param[in] _vecs	Input vector array.
+		*	\param[in] _num		Number of vectors in _vecs.
+		*/
+		Vec3Stream(const Vec3<T>* _vecs, size_t _num);
+
+		/**
+		*	\brief \e Copy constructor.
+		*
+		*	\param[in] _other	Other stream to copy from.
+		*/
+		Vec3Stream(const Vec3Stream& _other);
+
+		/**
+		*	\brief \e Move constructor.
+		*
+		*	\param[in] _other	Other stream to move from.
+		*/
+		Vec3Stream(Vec3Stream&& _other) noexcept;
+
+		/// \b Destructor (free memory).
+		~Vec3Stream();
+
+//}
+
+//{ Size
+
+		/**
+		*	\brief Getter of stream size.
+		*
+		*	\return Number of vectors in stream.
+		*/
+		size_t Size() const noexcept;
+
+		/**
+		*	\brief Getter of stream capacity.
+		*
+		*	\return Number of allocated vectors.
+		*/
+		size_t Capacity() const noexcept;
+
+		/**
+		*	\brief Whether stream is empty.
+		*
+		*	\return true if Size() == 0.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief Reserve memory for at least _capacity vectors.
+		*
+		*	\param[in] _capacity	Minimum capacity to allocate.
+		*/
+		void Reserve(size_t _capacity);
+
+		/**
+		*	\brief Resize stream. New vectors are zero initialized.
+		*
+		*	\param[in] _size	New size.
+		*/
+		void Resize(size_t _size);
+
+		/// Set size to 0. Memory is kept.
+		void Clear() noexcept;
+
+//}
+
+//{ Accessors
+
+		/**
+		*	\brief Access X component array.
+		*
+		*	\return X array pointer (aligned on Alignment).
+		*/
+		T* X() noexcept;
+
+		/// \copydoc X()
+		const T* X() const noexcept;
+
+		/**
+		*	\brief Access Y component array.
+		*
+		*	\return Y array pointer (aligned on Alignment).
+		*/
+		T* Y() noexcept;
+
+		/// \copydoc Y()
+		const T* Y() const noexcept;
+
+		/**
+		*	\brief Access Z component array.
+		*
+		*	\return Z array pointer (aligned on Alignment).
+		*/
+		T* Z() noexcept;
+
+		/// \copydoc Z()
+		const T* Z() const noexcept;
+
+
+		/**
+		*	\brief Get the vector at index.
+		*
+		*	\param[in] _index	Index of the vector.
+		*
+		*	\return Vector at _index.
+		*/
+		Vec3<T> Get(size_t _index) const;
+
+		/**
+		*	\brief Set the vector at index.
+		*
+		*	\param[in] _index	Index of the vector.
+		*	\param[in] _vec		Vector to assign.
+		*/
+		void Set(size_t _index, const Vec3<T>& _vec);
+
+		/**
+		*	\brief Append a vector at the end of the stream.
+		*
+		*	\param[in] _vec		Vector to append.
+		*/
+		void Push(const Vec3<T>& _vec);
+
+//}
+
+//{ Gather/Scatter
+
+		/**
+		*	\brief \b Gather: Array-Of-Structures to Structure-Of-Arrays.
+		*
+		*	Resize stream to _num and deinterleave _vecs into X, Y and Z arrays.
+		*
+		*	\param[in] _vecs	Input vector array.
+		*	\param[in] _num		Number of vectors in _vecs.
+		*/
+		void Gather(const Vec3<T>* _vecs, size_t _num);
+
+		/**
+		*	\brief \b Scatter: Structure-Of-Arrays to Array-Of-Structures.
+		*
+		*	\param[out] _out	Output vector array. Must be at least Size() long.
+		*/
+		void Scatter(Vec3<T>* _out) const;
+
+//}
+
+//{ Normalize
+
+		/**
+		*	\brief \b Normalize every vector of the stream.
+		*
+		*	\return self stream normalized.
+		*/
+		Vec3Stream& Normalize();
+
+//}
+
+//{ Dot/Cross
+
+		/**
+		*	\brief \e Compute the <b> Dot product </b> between each _lhs[i] and _rhs[i].
+		*
+		*	\param[in] _lhs		Left hand side stream.
+		*	\param[in] _rhs		Right hand side stream.
+		*	\param[out] _out	Output dot products. Must be at least _lhs.Size() long.
+		*/
+		static void Dot(const Vec3Stream& _lhs, const Vec3Stream& _rhs, T* _out) noexcept;
+
+		/**
+		*	\brief \e Compute the <b> Cross product </b> between each _lhs[i] and _rhs[i].
+		*
+		*	\param[in] _lhs		Left hand side stream.
+		*	\param[in] _rhs		Right hand side stream.
+		*	\param[out] _out	Output cross products stream (resized to _lhs.Size()). Must not alias inputs.
+		*/
+		static void Cross(const Vec3Stream& _lhs, const Vec3Stream& _rhs, Vec3Stream& _out);
+
+//}
+
+//{ Dist
+
+		/**
+		*	\brief \e Compute the <b> Distance </b> between each _start[i] and _end[i].
+		*
+		*	\param[in] _start	Starting points.
+		*	\param[in] _end		Ending points.
+		*	\param[out] _out	Output distances. Must be at least _start.Size() long.
+		*/
+		static void Dist(const Vec3Stream& _start, const Vec3Stream& _end, T* _out);
+
+//}
+
+//{ Lerp
+
+		/**
+		*	\brief <b> Clamped Lerp </b> from each _start[i] to _end[i] at _alpha.
+		*
+		*	Reference: https://en.wikipedia.org/wiki/Linear_interpolation
+		*
+		*	\param[in] _start	Starting points of the lerp.
+		*	\param[in] _end		Ending points of the lerp.
+		*	\param[in] _alpha	Alpha of the lerp.
+		*	\param[out] _out	Output interpolated stream (resized to _start.Size()).
+		*/
+		static void Lerp(const Vec3Stream& _start, const Vec3Stream& _end, float _alpha, Vec3Stream& _out);
+
+		/**
+		*	\brief <b> Unclamped Lerp </b> from each _start[i] to _end[i] at _alpha.
+		*
+		*	Reference: https://en.wikipedia.org/wiki/Linear_interpolation
+		*
+		*	\param[in] _start	Starting points of the lerp.
+		*	\param[in] _end		Ending points of the lerp.
+		*	\param[in] _alpha	Alpha of the lerp.
+		*	\param[out] _out	Output interpolated stream (resized to _start.Size()).
+		*/
+		static void LerpUnclamped(const Vec3Stream& _start, const Vec3Stream& _end, float _alpha, Vec3Stream& _out);
+
+//}
+
+//{ Operators
+
+		/**
+		*	\brief \e Copy assignment.
+		*
+		*	\param[in] _rhs		Other stream to copy from.
+		*
+		*	\return self stream.
+		*/
+		Vec3Stream& operator=(const Vec3Stream& _rhs);
+
+		/**
+		*	\brief \e Move assignment.
+		*
+		*	\param[in] _rhs		Other stream to move from.
+		*
+		*	\return self stream.
+		*/
+		Vec3Stream& operator=(Vec3Stream&& _rhs) noexcept;
+
+
+		/**
+		*	\brief \b Add each _rhs[i] to this[i].
+		*
+		*	\param[in] _rhs		Stream to add (same size).
+		*
+		*	\return self stream.
+		*/
+		Vec3Stream& operator+=(const Vec3Stream& _rhs) noexcept;
+
+		/**
+		*	\brief \b Subtract each _rhs[i] to this[i].
+		*
+		*	\param[in] _rhs		Stream to subtract (same size).
+		*
+		*	\return self stream.
+		*/
+		Vec3Stream& operator-=(const Vec3Stream& _rhs) noexcept;
+
+		/**
+		*	\b Add _rhs to every vector of the stream.
+		*
+		*	\param[in] _rhs		Vector to add.
+		*
+		*	\return self stream.
+		*/
+		Vec3Stream& operator+=(const Vec3<T>& _rhs) noexcept;
+
+		/**
+		*	\b Scale every vector of the stream.
+		*
+		*	\param[in] _scale	Scale value.
+		*
+		*	\return self stream.
+		*/
+		Vec3Stream& operator*=(T _scale) noexcept;
+
+		/**
+		*	\b Inverse scale every vector of the stream.
+		*
+		*	\param[in] _scale	Inverse scale value.
+		*
+		*	\return self stream.
+		*/
+		Vec3Stream& operator/=(T _scale);
+
+//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float Vec3Stream.
+	using Vec3Streamf = Vec3Stream<float>;
+
+	/// Alias for double Vec3Stream.
+	using Vec3Streamd = Vec3Stream<double>;
+
+
+	/// Template alias of Vec3Stream
+	template <typename T>
+	using Vector3Stream = Vec3Stream<T>;
+
+	/// Alias for float Vector3Stream.
+	using Vector3Streamf = Vector3Stream<float>;
+
+	/// Alias for double Vector3Stream.
+	using Vector3Streamd = Vector3Stream<double>;
+
+//}
+
+
+	/// \cond Internal
+
+#if SA_MATHS_VECTOR3_STREAM_SIMD && SA_INTRISC_SSE
+
+	template <>
+	void Vec3Streamf::Gather(const Vec3<float>* _vecs, size_t _num);
+
+	template <>
+	void Vec3Streamf::Scatter(Vec3<float>* _out) const;
+
+#endif
+
+#if SA_MATHS_VECTOR3_STREAM_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+//{ Float
+
+	template <>
+	Vec3Streamf& Vec3Streamf::Normalize();
+
+	template <>
+	void Vec3Streamf::Dot(const Vec3Streamf& _lhs, const Vec3Streamf& _rhs, float* _out) noexcept;
+
+	template <>
+	void Vec3Streamf::Cross(const Vec3Streamf& _lhs, const Vec3Streamf& _rhs, Vec3Streamf& _out);
+
+	template <>
+	void Vec3Streamf::Dist(const Vec3Streamf& _start, const Vec3Streamf& _end, float* _out);
+
+	template <>
+	void Vec3Streamf::LerpUnclamped(const Vec3Streamf& _start, const Vec3Streamf& _end, float _alpha, Vec3Streamf& _out);
+
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator+=(const Vec3Streamf& _rhs) noexcept;
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator-=(const Vec3Streamf& _rhs) noexcept;
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator+=(const Vec3<float>& _rhs) noexcept;
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator*=(float _scale) noexcept;
+
+//}
+
+//{ Double
+
+	template <>
+	Vec3Streamd& Vec3Streamd::Normalize();
+
+	template <>
+	void Vec3Streamd::Dot(const Vec3Streamd& _lhs, const Vec3Streamd& _rhs, double* _out) noexcept;
+
+	template <>
+	void Vec3Streamd::Cross(const Vec3Streamd& _lhs, const Vec3Streamd& _rhs, Vec3Streamd& _out);
+
+	template <>
+	void Vec3Streamd::Dist(const Vec3Streamd& _start, const Vec3Streamd& _end, double* _out);
+
+	template <>
+	void Vec3Streamd::LerpUnclamped(const Vec3Streamd& _start, const Vec3Streamd& _end, float _alpha, Vec3Streamd& _out);
+
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator+=(const Vec3Streamd& _rhs) noexcept;
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator-=(const Vec3Streamd& _rhs) noexcept;
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator+=(const Vec3<double>& _rhs) noexcept;
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator*=(double _scale) noexcept;
+
+//}
+
+#endif
+
+	/// \endcond
+}
+
+/**
+*	\example Vector3StreamTests.cpp
+*	Examples and Unitary Tests for Vec3Stream.
+*/
+
+
+/** \} */
+
+#include <SA/Maths/Space/Vector3Stream.inl>
+
+#endif // GUARD
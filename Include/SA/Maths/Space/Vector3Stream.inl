@@ -0,0 +1,415 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+namespace SA
+{
+//{ Constructors
+
+	template <typename T>
+	Vec3Stream<T>::Vec3Stream(size_t _size)
+	{
+		Resize(_size);
+	}
+
+	template <typename T>
+	Vec3Stream<T>::Vec3Stream(const Vec3<T>* _vecs, size_t _num)
+	{
+		Gather(_vecs, _num);
+	}
+
+	template <typename T>
+	Vec3Stream<T>::Vec3Stream(const Vec3Stream& _other)
+	{
+		*this = _other;
+	}
+
+	template <typename T>
+	Vec3Stream<T>::Vec3Stream(Vec3Stream&& _other) noexcept
+	{
+		*this = std::move(_other);
+	}
+
+	template <typename T>
+	Vec3Stream<T>::~Vec3Stream()
+	{
+		if (mData)
+			::operator delete(mData, std::align_val_t(Alignment));
+	}
+
+//}
+
+//{ Size
+
+	template <typename T>
+	size_t Vec3Stream<T>::Size() const noexcept
+	{
+		return mSize;
+	}
+
+	template <typename T>
+	size_t Vec3Stream<T>::Capacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	template <typename T>
+	bool Vec3Stream<T>::IsEmpty() const noexcept
+	{
+		return mSize == 0u;
+	}
+
+
+	template <typename T>
+	void Vec3Stream<T>::Reallocate(size_t _capacity)
+	{
+		T* const data = static_cast<T*>(::operator new(3u * _capacity * sizeof(T), std::align_val_t(Alignment)));
+
+		if (mData)
+		{
+			for (size_t i = 0; i < mSize; ++i)
+			{
+				data[i] = mData[i];
+				data[_capacity + i] = mData[mCapacity + i];
+				data[2u * _capacity + i] = mData[2u * mCapacity + i];
+			}
+
+			::operator delete(mData, std::align_val_t(Alignment));
+		}
+
+		mData = data;
+		mCapacity = _capacity;
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::Reserve(size_t _capacity)
+	{
+		if (_capacity <= mCapacity)
+			return;
+
+		// Pad to keep every component array aligned.
+		Reallocate((_capacity + Granularity - 1u) / Granularity * Granularity);
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::Resize(size_t _size)
+	{
+		Reserve(_size);
+
+		for (size_t i = mSize; i < _size; ++i)
+		{
+			mData[i] = T(0);
+			mData[mCapacity + i] = T(0);
+			mData[2u * mCapacity + i] = T(0);
+		}
+
+		mSize = _size;
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::Clear() noexcept
+	{
+		mSize = 0u;
+	}
+
+//}
+
+//{ Accessors
+
+	template <typename T>
+	T* Vec3Stream<T>::X() noexcept
+	{
+		return mData;
+	}
+
+	template <typename T>
+	const T* Vec3Stream<T>::X() const noexcept
+	{
+		return mData;
+	}
+
+	template <typename T>
+	T* Vec3Stream<T>::Y() noexcept
+	{
+		return mData + mCapacity;
+	}
+
+	template <typename T>
+	const T* Vec3Stream<T>::Y() const noexcept
+	{
+		return mData + mCapacity;
+	}
+
+	template <typename T>
+	T* Vec3Stream<T>::Z() noexcept
+	{
+		return mData + 2u * mCapacity;
+	}
+
+	template <typename T>
+	const T* Vec3Stream<T>::Z() const noexcept
+	{
+		return mData + 2u * mCapacity;
+	}
+
+
+	template <typename T>
+	Vec3<T> Vec3Stream<T>::Get(size_t _index) const
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, mSize - 1u), SA.Maths.Vec3Stream);
+
+		return Vec3<T>(X()[_index], Y()[_index], Z()[_index]);
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::Set(size_t _index, const Vec3<T>& _vec)
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, mSize - 1u), SA.Maths.Vec3Stream);
+
+		X()[_index] = _vec.x;
+		Y()[_index] = _vec.y;
+		Z()[_index] = _vec.z;
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::Push(const Vec3<T>& _vec)
+	{
+		if (mSize == mCapacity)
+			Reserve(mCapacity ? mCapacity * 2u : Granularity);
+
+		++mSize;
+		Set(mSize - 1u, _vec);
+	}
+
+//}
+
+//{ Gather/Scatter
+
+	template <typename T>
+	void Vec3Stream<T>::Gather(const Vec3<T>* _vecs, size_t _num)
+	{
+		Clear();
+		Reserve(_num);
+		mSize = _num;
+
+		T* const outX = X();
+		T* const outY = Y();
+		T* const outZ = Z();
+
+		for (size_t i = 0; i < _num; ++i)
+		{
+			outX[i] = _vecs[i].x;
+			outY[i] = _vecs[i].y;
+			outZ[i] = _vecs[i].z;
+		}
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::Scatter(Vec3<T>* _out) const
+	{
+		const T* const inX = X();
+		const T* const inY = Y();
+		const T* const inZ = Z();
+
+		for (size_t i = 0; i < mSize; ++i)
+			_out[i] = Vec3<T>(inX[i], inY[i], inZ[i]);
+	}
+
+//}
+
+//{ Normalize
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::Normalize()
+	{
+		T* const vX = X();
+		T* const vY = Y();
+		T* const vZ = Z();
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			const T len = Maths::Sqrt(vX[i] * vX[i] + vY[i] * vY[i] + vZ[i] * vZ[i]);
+
+			SA_ASSERT((NotEquals0, len), SA.Maths.Vec3Stream, L"Normalize null vector!");
+
+			vX[i] /= len;
+			vY[i] /= len;
+			vZ[i] /= len;
+		}
+
+		return *this;
+	}
+
+//}
+
+//{ Dot/Cross
+
+	template <typename T>
+	void Vec3Stream<T>::Dot(const Vec3Stream& _lhs, const Vec3Stream& _rhs, T* _out) noexcept
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		for (size_t i = 0; i < _lhs.Size(); ++i)
+			_out[i] = _lhs.X()[i] * _rhs.X()[i] + _lhs.Y()[i] * _rhs.Y()[i] + _lhs.Z()[i] * _rhs.Z()[i];
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::Cross(const Vec3Stream& _lhs, const Vec3Stream& _rhs, Vec3Stream& _out)
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		_out.Resize(_lhs.Size());
+
+		for (size_t i = 0; i < _lhs.Size(); ++i)
+		{
+			_out.X()[i] = _lhs.Y()[i] * _rhs.Z()[i] - _lhs.Z()[i] * _rhs.Y()[i];
+			_out.Y()[i] = _lhs.Z()[i] * _rhs.X()[i] - _lhs.X()[i] * _rhs.Z()[i];
+			_out.Z()[i] = _lhs.X()[i] * _rhs.Y()[i] - _lhs.Y()[i] * _rhs.X()[i];
+		}
+	}
+
+//}
+
+//{ Dist
+
+	template <typename T>
+	void Vec3Stream<T>::Dist(const Vec3Stream& _start, const Vec3Stream& _end, T* _out)
+	{
+		SA_ASSERT((Equals, _start.Size(), _end.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		for (size_t i = 0; i < _start.Size(); ++i)
+		{
+			const T dX = _end.X()[i] - _start.X()[i];
+			const T dY = _end.Y()[i] - _start.Y()[i];
+			const T dZ = _end.Z()[i] - _start.Z()[i];
+
+			_out[i] = Maths::Sqrt(dX * dX + dY * dY + dZ * dZ);
+		}
+	}
+
+//}
+
+//{ Lerp
+
+	template <typename T>
+	void Vec3Stream<T>::Lerp(const Vec3Stream& _start, const Vec3Stream& _end, float _alpha, Vec3Stream& _out)
+	{
+		SA_WARN(_alpha >= 0.0f && _alpha <= 1.0f, SA.Maths, (L"Alpha[%1] clamped to range [0, 1]! Use LerpUnclamped if intended instead.", _alpha));
+
+		LerpUnclamped(_start, _end, std::clamp(_alpha, 0.0f, 1.0f), _out);
+	}
+
+	template <typename T>
+	void Vec3Stream<T>::LerpUnclamped(const Vec3Stream& _start, const Vec3Stream& _end, float _alpha, Vec3Stream& _out)
+	{
+		SA_ASSERT((Equals, _start.Size(), _end.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		_out.Resize(_start.Size());
+
+		for (size_t i = 0; i < _start.Size(); ++i)
+		{
+			_out.X()[i] = (1.0f - _alpha) * _start.X()[i] + _alpha * _end.X()[i];
+			_out.Y()[i] = (1.0f - _alpha) * _start.Y()[i] + _alpha * _end.Y()[i];
+			_out.Z()[i] = (1.0f - _alpha) * _start.Z()[i] + _alpha * _end.Z()[i];
+		}
+	}
+
+//}
+
+//{ Operators
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::operator=(const Vec3Stream& _rhs)
+	{
+		if (this == &_rhs)
+			return *this;
+
+		Clear();
+		Reserve(_rhs.mSize);
+		mSize = _rhs.mSize;
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			X()[i] = _rhs.X()[i];
+			Y()[i] = _rhs.Y()[i];
+			Z()[i] = _rhs.Z()[i];
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::operator=(Vec3Stream&& _rhs) noexcept
+	{
+		std::swap(mData, _rhs.mData);
+		std::swap(mSize, _rhs.mSize);
+		std::swap(mCapacity, _rhs.mCapacity);
+
+		return *this;
+	}
+
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::operator+=(const Vec3Stream& _rhs) noexcept
+	{
+		SA_ASSERT((Equals, mSize, _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			X()[i] += _rhs.X()[i];
+			Y()[i] += _rhs.Y()[i];
+			Z()[i] += _rhs.Z()[i];
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::operator-=(const Vec3Stream& _rhs) noexcept
+	{
+		SA_ASSERT((Equals, mSize, _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			X()[i] -= _rhs.X()[i];
+			Y()[i] -= _rhs.Y()[i];
+			Z()[i] -= _rhs.Z()[i];
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::operator+=(const Vec3<T>& _rhs) noexcept
+	{
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			X()[i] += _rhs.x;
+			Y()[i] += _rhs.y;
+			Z()[i] += _rhs.z;
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::operator*=(T _scale) noexcept
+	{
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			X()[i] *= _scale;
+			Y()[i] *= _scale;
+			Z()[i] *= _scale;
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	Vec3Stream<T>& Vec3Stream<T>::operator/=(T _scale)
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Vec3Stream, L"Unscale stream by 0 (division by 0)!");
+
+		return *this *= T(1) / _scale;
+	}
+
+//}
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2023 Sapphire Development Team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_TRANSFORM_TRS_MATRIX_BATCH_FUNCTOR_GUARD
+#define SAPPHIRE_MATHS_TRANSFORM_TRS_MATRIX_BATCH_FUNCTOR_GUARD
+
+#include <cstddef>
+
+#include <SA/Maths/Config.hpp>
+
+#include <SA/Maths/Matrix/Matrix4.hpp>
+#include <SA/Maths/Space/Vector3Stream.hpp>
+
+/**
+ * @file TransformTRSMatrixBatchFunctor.hpp
+ *
+ * @brief Transform TRS Matrix batch functor definition.
+ *
+ * @ingroup Maths_Transform
+ * @{
+ */
+
+
+namespace SA
+{
+	/**
+	 * @brief Compute TRS Matrices from arrays of positions, rotations and scales.
+	 * Same result as TrTRSMatrixFunctor on each TrPRS: (T * (R * S)).
+	 * Inputs are Structure-Of-Arrays: SIMD implementation computes one transform per lane.
+	 * Functor implementation.
+	 */
+	class TrTRSMatrixBatchFunctor
+	{
+	public:
+		/**
+		 * @brief Compute _num matrices from component arrays.
+		 *
+		 * @tparam T 		Transform type.
+		 * @tparam major 	Output matrix major.
+		 * @param _px 		Positions X array.
+		 * @param _py 		Positions Y array.
+		 * @param _pz 		Positions Z array.
+		 * @param _rw 		Rotations W array (normalized quaternions).
+		 * @param _rx 		Rotations X array.
+		 * @param _ry 		Rotations Y array.
+		 * @param _rz 		Rotations Z array.
+		 * @param _sx 		Scales X array.
+		 * @param _sy 		Scales Y array.
+		 * @param _sz 		Scales Z array.
+		 * @param _out 		Output matrices.
+		 * @param _num 		Number of transforms.
+		 */
+		template <typename T, MatrixMajor major>
+		void operator()(const T* _px, const T* _py, const T* _pz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz,
+			const T* _sx, const T* _sy, const T* _sz,
+			Mat4<T, major>* _out, size_t _num) const noexcept
+		{
+			for (size_t i = 0; i < _num; ++i)
+			{
+				// Same operations as Mat4::MakeRotation and TrTRSMatrixFunctor.
+
+				const T XW2 = T(2) * _rx[i] * _rw[i];
+				const T XX2 = T(2) * _rx[i] * _rx[i];
+				const T XY2 = T(2) * _rx[i] * _ry[i];
+				const T XZ2 = T(2) * _rx[i] * _rz[i];
+
+				const T YW2 = T(2) * _ry[i] * _rw[i];
+				const T YY2 = T(2) * _ry[i] * _ry[i];
+				const T YZ2 = T(2) * _ry[i] * _rz[i];
+
+				const T ZW2 = T(2) * _rz[i] * _rw[i];
+				const T ZZ2 = T(2) * _rz[i] * _rz[i];
+
+				Mat4<T, major>& out = _out[i];
+
+				out = Mat4<T, major>::Identity;
+
+				out.e00 = (T(1) - YY2 - ZZ2) * _sx[i];
+				out.e01 = (XY2 - ZW2) * _sy[i];
+				out.e02 = (XZ2 + YW2) * _sz[i];
+				out.e03 = _px[i];
+
+				out.e10 = (XY2 + ZW2) * _sx[i];
+				out.e11 = (T(1) - XX2 - ZZ2) * _sy[i];
+				out.e12 = (YZ2 - XW2) * _sz[i];
+				out.e13 = _py[i];
+
+				out.e20 = (XZ2 - YW2) * _sx[i];
+				out.e21 = (YZ2 + XW2) * _sy[i];
+				out.e22 = (T(1) - XX2 - YY2) * _sz[i];
+				out.e23 = _pz[i];
+			}
+		}
+
+		/**
+		 * @brief Compute matrices from position and scale streams.
+		 *
+		 * @tparam T 			Transform type.
+		 * @tparam major 		Output matrix major.
+		 * @param _positions 	Positions stream.
+		 * @param _rw 			Rotations W array (normalized quaternions, _positions.Size() elements).
+		 * @param _rx 			Rotations X array.
+		 * @param _ry 			Rotations Y array.
+		 * @param _rz 			Rotations Z array.
+		 * @param _scales 		Scales stream (same size as _positions).
+		 * @param _out 			Output matrices (_positions.Size() elements).
+		 */
+		template <typename T, MatrixMajor major>
+		void operator()(const Vec3Stream<T>& _positions,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz,
+			const Vec3Stream<T>& _scales,
+			Mat4<T, major>* _out) const noexcept
+		{
+			SA_ASSERT((Default, _positions.Size() == _scales.Size()), SA.Maths.Transform,
+				(L"Positions [%1] and scales [%2] stream size mismatch!", _positions.Size(), _scales.Size()));
+
+			(*this)(_positions.X(), _positions.Y(), _positions.Z(),
+				_rw, _rx, _ry, _rz,
+				_scales.X(), _scales.Y(), _scales.Z(),
+				_out, _positions.Size());
+		}
+	};
+
+
+	/// \cond Internal
+
+#if SA_MATHS_TRANSFORM_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const float* _px, const float* _py, const float* _pz,
+		const float* _rw, const float* _rx, const float* _ry, const float* _rz,
+		const float* _sx, const float* _sy, const float* _sz,
+		RMat4f* _out, size_t _num) const noexcept;
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const float* _px, const float* _py, const float* _pz,
+		const float* _rw, const float* _rx, const float* _ry, const float* _rz,
+		const float* _sx, const float* _sy, const float* _sz,
+		CMat4f* _out, size_t _num) const noexcept;
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const double* _px, const double* _py, const double* _pz,
+		const double* _rw, const double* _rx, const double* _ry, const double* _rz,
+		const double* _sx, const double* _sy, const double* _sz,
+		RMat4d* _out, size_t _num) const noexcept;
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const double* _px, const double* _py, const double* _pz,
+		const double* _rw, const double* _rx, const double* _ry, const double* _rz,
+		const double* _sx, const double* _sy, const double* _sz,
+		CMat4d* _out, size_t _num) const noexcept;
+
+#endif
+
+	/// \endcond
+}
+
+
+/** @} */
+
+#endif // GUARD
@@ -0,0 +1,281 @@
+// Copyright (c) 2023 Sapphire Development Team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_TRANSFORM_HIERARCHY_GUARD
+#define SAPPHIRE_MATHS_TRANSFORM_HIERARCHY_GUARD
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <SA/Maths/Debug.hpp>
+
+#include <SA/Maths/Transform/Transform.hpp>
+
+/**
+ * @file TransformHierarchy.hpp
+ *
+ * @brief \b Transform hierarchy type definition.
+ *
+ * @ingroup Maths_Transform
+ * @{
+ */
+
+
+namespace SA
+{
+	/**
+	 * @brief \e Transform hierarchy Sapphire's class.
+	 *
+	 * Flat array of local transforms sorted by parent index: a parent is always stored before its children.
+	 * Modified nodes are flagged in a dirty bit set, Update() recomputes world transforms and world matrices
+	 * of dirty subtrees only, in a single linear pass over the arrays.
+	 *
+	 * World transform of a node is (parent world * local) using Tr::operator*.
+	 * World matrix is computed from world transform using TrFunc (default TrTRSMatrixFunctor).
+	 *
+	 * @tparam T Transform type.
+	 */
+	template <typename T>
+	class TrHierarchy
+	{
+	public:
+		/// Node index type.
+		using Index = uint32_t;
+
+		/// Local and world transform type.
+		using TrT = TrPRS<T>;
+
+		/// Parent index of root nodes.
+		static constexpr Index NoParent = ~Index(0);
+
+		/// Minimum number of nodes per task for a level to be dispatched by UpdateParallel().
+		static constexpr Index ParallelMinNodeNum = 256u;
+
+	private:
+		/// Local transforms (relative to parent).
+		std::vector<TrT> mLocals;
+
+		/// Parent index of each node (NoParent for roots). Always < node index.
+		std::vector<Index> mParents;
+
+		/// World transforms (computed).
+		std::vector<TrT> mWorlds;
+
+		/// World matrices (computed).
+		std::vector<Mat4<T>> mMatrices;
+
+		/// Dirty bit set: 1 bit per node.
+		std::vector<uint64_t> mDirty;
+
+		/// Lowest dirty node index: nodes before are up to date.
+		Index mFirstDirty = NoParent;
+
+
+		/// Node indices sorted by depth (parallel update).
+		std::vector<Index> mLevelNodes;
+
+		/// Start offset of each depth level in mLevelNodes (+ end offset).
+		std::vector<Index> mLevelOffsets;
+
+		/// Per-node updated flag (parallel update): 1 byte per node to allow concurrent writes.
+		std::vector<uint8_t> mUpdated;
+
+		/// Whether depth levels must be rebuilt (nodes added or removed).
+		bool mLevelsDirty = true;
+
+
+		/**
+		 * @brief Flag node as dirty.
+		 *
+		 * @param _index Node index.
+		 */
+		void SetDirtyBit(Index _index) noexcept;
+
+		/**
+		 * @brief Whether node is flagged dirty.
+		 *
+		 * @param _index Node index.
+		 * @return dirty bit value.
+		 */
+		bool GetDirtyBit(Index _index) const noexcept;
+
+		/// Sort nodes by depth level (counting sort: node order is kept inside a level).
+		void BuildLevels();
+
+		/// Reset all dirty bits.
+		void ClearDirty() noexcept;
+
+	public:
+
+	//{ Size
+
+		/**
+		 * @brief Getter of node count.
+		 *
+		 * @return Number of nodes in hierarchy.
+		 */
+		Index Size() const noexcept;
+
+		/**
+		 * @brief Whether hierarchy is empty.
+		 *
+		 * @return true if Size() == 0.
+		 */
+		bool IsEmpty() const noexcept;
+
+		/**
+		 * @brief Reserve memory for at least _capacity nodes.
+		 *
+		 * @param _capacity Minimum capacity to allocate.
+		 */
+		void Reserve(Index _capacity);
+
+		/// Remove all nodes.
+		void Clear() noexcept;
+
+	//}
+
+
+	//{ Nodes
+
+		/**
+		 * @brief Add a new node at the end of the hierarchy.
+		 * New node is flagged dirty.
+		 *
+		 * @param _local 	Local transform of the node.
+		 * @param _parent 	Index of the parent node (must already exist) or NoParent for root.
+		 * @return Index of the new node.
+		 */
+		Index Add(const TrT& _local = TrT(), Index _parent = NoParent);
+
+		/**
+		 * @brief Getter of parent index.
+		 *
+		 * @param _index Node index.
+		 * @return parent index or NoParent.
+		 */
+		Index GetParent(Index _index) const noexcept;
+
+
+		/**
+		 * @brief Getter of local transform.
+		 *
+		 * @param _index Node index.
+		 * @return local transform.
+		 */
+		const TrT& GetLocal(Index _index) const noexcept;
+
+		/**
+		 * @brief Setter of local transform.
+		 * Flag node (and its subtree on next Update) as dirty.
+		 *
+		 * @param _index Node index.
+		 * @param _local New local transform.
+		 */
+		void SetLocal(Index _index, const TrT& _local) noexcept;
+
+
+		/**
+		 * @brief Getter of world transform.
+		 * Valid after Update() for clean nodes.
+		 *
+		 * @param _index Node index.
+		 * @return world transform.
+		 */
+		const TrT& GetWorld(Index _index) const noexcept;
+
+		/**
+		 * @brief Getter of world matrix.
+		 * Valid after Update() for clean nodes.
+		 *
+		 * @param _index Node index.
+		 * @return world matrix.
+		 */
+		const Mat4<T>& GetMatrix(Index _index) const noexcept;
+
+		/**
+		 * @brief Getter of world matrices array (Size() elements).
+		 *
+		 * @return world matrices data.
+		 */
+		const Mat4<T>* GetMatrices() const noexcept;
+
+	//}
+
+
+	//{ Dirty
+
+		/**
+		 * @brief Whether node is flagged dirty.
+		 * Children of dirty nodes are only flagged during Update().
+		 *
+		 * @param _index Node index.
+		 * @return true if node must be updated.
+		 */
+		bool IsDirty(Index _index) const noexcept;
+
+		/**
+		 * @brief Flag node as dirty.
+		 *
+		 * @param _index Node index.
+		 */
+		void SetDirty(Index _index) noexcept;
+
+
+		/**
+		 * @brief Recompute world transforms and matrices of dirty subtrees.
+		 * Single pass from first dirty node: a node is updated if it is dirty or its parent was updated.
+		 *
+		 * @tparam TrFunc 	Functor computing matrix from world transform.
+		 * @param _functor 	Functor instance.
+		 * @return Number of updated nodes.
+		 */
+		template <typename TrFunc = TrTRSMatrixFunctor>
+		Index Update(TrFunc _functor = TrFunc());
+
+		/**
+		 * @brief Recompute world transforms and matrices of dirty subtrees split in _taskNum tasks.
+		 *
+		 * Nodes are grouped by depth level: nodes of the same level are independent and split
+		 * in _taskNum contiguous ranges run by _executor, levels are processed in order (one executor call per level).
+		 * Levels smaller than ParallelMinNodeNum nodes per task are run on the calling thread.
+		 * Output is identical to Update() (same operations per node, whatever the task count).
+		 *
+		 * @tparam Executor 	parallel_for callable: executor(begin, end, fn) calls fn(uint32_t) for each index
+		 * 						in [begin, end), possibly concurrently, and returns once all calls returned (see Maths::ThreadPool).
+		 * @tparam TrFunc 		Functor computing matrix from world transform (shared by tasks: must be thread-safe).
+		 * @param _executor 	Executor instance (threads are owned by the caller, none is created here).
+		 * @param _taskNum 		Number of tasks per level (usually executor thread count). <= 1 fallback to Update().
+		 * @param _functor 		Functor instance.
+		 * @return Number of updated nodes.
+		 */
+		template <typename Executor, typename TrFunc = TrTRSMatrixFunctor>
+		Index UpdateParallel(Executor&& _executor, uint32_t _taskNum, TrFunc _functor = TrFunc());
+
+	//}
+	};
+
+
+//{ Aliases
+
+	/// Alias for float TrHierarchy.
+	using TrHierarchyf = TrHierarchy<float>;
+
+	/// Alias for double TrHierarchy.
+	using TrHierarchyd = TrHierarchy<double>;
+
+//}
+}
+
+/**
+*	@example TransformHierarchyTests.cpp
+*	Examples and Unitary Tests for TrHierarchy.
+*/
+
+/** @} */
+
+#include <SA/Maths/Transform/TransformHierarchy.inl>
+
+#endif // GUARD
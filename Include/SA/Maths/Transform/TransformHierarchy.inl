@@ -0,0 +1,339 @@
+// Copyright (c) 2023 Sapphire Development Team. All Rights Reserved.
+
+namespace SA
+{
+	template <typename T>
+	void TrHierarchy<T>::SetDirtyBit(Index _index) noexcept
+	{
+		mDirty[_index / 64u] |= uint64_t(1u) << (_index % 64u);
+	}
+
+	template <typename T>
+	bool TrHierarchy<T>::GetDirtyBit(Index _index) const noexcept
+	{
+		return (mDirty[_index / 64u] >> (_index % 64u)) & 1u;
+	}
+
+	template <typename T>
+	void TrHierarchy<T>::ClearDirty() noexcept
+	{
+		std::fill(mDirty.begin() + mFirstDirty / 64u, mDirty.end(), 0u);
+		mFirstDirty = NoParent;
+	}
+
+	template <typename T>
+	void TrHierarchy<T>::BuildLevels()
+	{
+		const Index size = Size();
+
+		// Depth of each node: parent is always computed first.
+		std::vector<Index> depths(size);
+		Index levelNum = 0u;
+
+		for (Index i = 0u; i < size; ++i)
+		{
+			const Index parent = mParents[i];
+
+			depths[i] = parent == NoParent ? 0u : depths[parent] + 1u;
+			levelNum = std::max(levelNum, depths[i] + 1u);
+		}
+
+		mLevelOffsets.assign(levelNum + 1u, 0u);
+
+		for (Index i = 0u; i < size; ++i)
+			++mLevelOffsets[depths[i] + 1u];
+
+		for (Index l = 0u; l < levelNum; ++l)
+			mLevelOffsets[l + 1u] += mLevelOffsets[l];
+
+		// Counting sort.
+		std::vector<Index> cursors(mLevelOffsets.begin(), mLevelOffsets.end() - 1);
+		mLevelNodes.resize(size);
+
+		for (Index i = 0u; i < size; ++i)
+			mLevelNodes[cursors[depths[i]]++] = i;
+
+		mLevelsDirty = false;
+	}
+
+//{ Size
+
+	template <typename T>
+	typename TrHierarchy<T>::Index TrHierarchy<T>::Size() const noexcept
+	{
+		return static_cast<Index>(mLocals.size());
+	}
+
+	template <typename T>
+	bool TrHierarchy<T>::IsEmpty() const noexcept
+	{
+		return mLocals.empty();
+	}
+
+	template <typename T>
+	void TrHierarchy<T>::Reserve(Index _capacity)
+	{
+		mLocals.reserve(_capacity);
+		mParents.reserve(_capacity);
+		mWorlds.reserve(_capacity);
+		mMatrices.reserve(_capacity);
+		mDirty.reserve((_capacity + 63u) / 64u);
+	}
+
+	template <typename T>
+	void TrHierarchy<T>::Clear() noexcept
+	{
+		mLocals.clear();
+		mParents.clear();
+		mWorlds.clear();
+		mMatrices.clear();
+		mDirty.clear();
+
+		mFirstDirty = NoParent;
+		mLevelsDirty = true;
+	}
+
+//}
+
+
+//{ Nodes
+
+	template <typename T>
+	typename TrHierarchy<T>::Index TrHierarchy<T>::Add(const TrT& _local, Index _parent)
+	{
+		SA_ASSERT((Default, _parent == NoParent || _parent < Size()), SA.Maths.Transform,
+			(L"Parent index [%1] must be added before its children (size: %2)!", _parent, Size()));
+
+		const Index index = Size();
+
+		mLocals.push_back(_local);
+		mParents.push_back(_parent);
+		mWorlds.push_back(_local);
+		mMatrices.push_back(Mat4<T>::Identity);
+
+		if (index % 64u == 0u)
+			mDirty.push_back(0u);
+
+		mLevelsDirty = true;
+
+		SetDirty(index);
+
+		return index;
+	}
+
+	template <typename T>
+	typename TrHierarchy<T>::Index TrHierarchy<T>::GetParent(Index _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, Size() - 1u), SA.Maths.Transform);
+
+		return mParents[_index];
+	}
+
+
+	template <typename T>
+	const typename TrHierarchy<T>::TrT& TrHierarchy<T>::GetLocal(Index _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, Size() - 1u), SA.Maths.Transform);
+
+		return mLocals[_index];
+	}
+
+	template <typename T>
+	void TrHierarchy<T>::SetLocal(Index _index, const TrT& _local) noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, Size() - 1u), SA.Maths.Transform);
+
+		mLocals[_index] = _local;
+
+		SetDirty(_index);
+	}
+
+
+	template <typename T>
+	const typename TrHierarchy<T>::TrT& TrHierarchy<T>::GetWorld(Index _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, Size() - 1u), SA.Maths.Transform);
+
+		return mWorlds[_index];
+	}
+
+	template <typename T>
+	const Mat4<T>& TrHierarchy<T>::GetMatrix(Index _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, Size() - 1u), SA.Maths.Transform);
+
+		return mMatrices[_index];
+	}
+
+	template <typename T>
+	const Mat4<T>* TrHierarchy<T>::GetMatrices() const noexcept
+	{
+		return mMatrices.data();
+	}
+
+//}
+
+
+//{ Dirty
+
+	template <typename T>
+	bool TrHierarchy<T>::IsDirty(Index _index) const noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, Size() - 1u), SA.Maths.Transform);
+
+		return GetDirtyBit(_index);
+	}
+
+	template <typename T>
+	void TrHierarchy<T>::SetDirty(Index _index) noexcept
+	{
+		SA_ASSERT((OutOfRange, _index, 0u, Size() - 1u), SA.Maths.Transform);
+
+		SetDirtyBit(_index);
+
+		if (mFirstDirty == NoParent || _index < mFirstDirty)
+			mFirstDirty = _index;
+	}
+
+
+	template <typename T>
+	template <typename TrFunc>
+	typename TrHierarchy<T>::Index TrHierarchy<T>::Update(TrFunc _functor)
+	{
+		if (mFirstDirty == NoParent)
+			return 0u;
+
+		const Index size = Size();
+		Index num = 0u;
+
+		/**
+		*	Parents are always stored before their children:
+		*	parent dirty bit is final when child is reached, so the dirty state propagates down in the same pass.
+		*/
+		for (Index i = mFirstDirty; i < size; ++i)
+		{
+			const Index parent = mParents[i];
+
+			if (parent == NoParent)
+			{
+				if (!GetDirtyBit(i))
+					continue;
+
+				mWorlds[i] = mLocals[i];
+			}
+			else
+			{
+				if (!GetDirtyBit(i) && !GetDirtyBit(parent))
+					continue;
+
+				mWorlds[i] = mWorlds[parent] * mLocals[i];
+				SetDirtyBit(i);
+			}
+
+			mMatrices[i] = _functor(mWorlds[i]);
+			++num;
+		}
+
+		ClearDirty();
+
+		return num;
+	}
+
+
+	template <typename T>
+	template <typename Executor, typename TrFunc>
+	typename TrHierarchy<T>::Index TrHierarchy<T>::UpdateParallel(Executor&& _executor, uint32_t _taskNum, TrFunc _functor)
+	{
+		if (_taskNum <= 1u)
+			return Update(_functor);
+
+		if (mFirstDirty == NoParent)
+			return 0u;
+
+		if (mLevelsDirty)
+			BuildLevels();
+
+		const Index size = Size();
+
+		// Unpack dirty bits: updated flags are written concurrently by tasks.
+		mUpdated.resize(size);
+
+		for (Index i = 0u; i < size; ++i)
+			mUpdated[i] = GetDirtyBit(i);
+
+		const Index levelNum = static_cast<Index>(mLevelOffsets.size() - 1u);
+
+		// One counter per task (accumulated over levels).
+		std::vector<Index> counts(_taskNum, 0u);
+
+		// Update nodes [_start, _end) of mLevelNodes.
+		auto updateRange = [this, &_functor](Index _start, Index _end)
+		{
+			Index num = 0u;
+
+			for (Index k = _start; k < _end; ++k)
+			{
+				const Index i = mLevelNodes[k];
+				const Index parent = mParents[i];
+
+				if (parent == NoParent)
+				{
+					if (!mUpdated[i])
+						continue;
+
+					mWorlds[i] = mLocals[i];
+				}
+				else
+				{
+					if (!mUpdated[i] && !mUpdated[parent])
+						continue;
+
+					mWorlds[i] = mWorlds[parent] * mLocals[i];
+					mUpdated[i] = 1u;
+				}
+
+				mMatrices[i] = _functor(mWorlds[i]);
+				++num;
+			}
+
+			return num;
+		};
+
+		// Levels are processed in order: executor call returns once the level is done,
+		// next level reads parents written by this level.
+		for (Index l = 0u; l < levelNum; ++l)
+		{
+			const Index levelStart = mLevelOffsets[l];
+			const Index levelSize = mLevelOffsets[l + 1u] - levelStart;
+
+			// Small levels (tree top, deep chains) are not worth a dispatch.
+			const uint32_t taskNum = std::min<uint32_t>(_taskNum, levelSize / ParallelMinNodeNum);
+
+			if (taskNum <= 1u)
+			{
+				counts[0] += updateRange(levelStart, levelStart + levelSize);
+				continue;
+			}
+
+			_executor(0u, taskNum, [&updateRange, &counts, levelStart, levelSize, taskNum](uint32_t _taskIndex)
+			{
+				// Static contiguous split of the level.
+				const Index start = levelStart + static_cast<Index>(uint64_t(levelSize) * _taskIndex / taskNum);
+				const Index end = levelStart + static_cast<Index>(uint64_t(levelSize) * (_taskIndex + 1u) / taskNum);
+
+				counts[_taskIndex] += updateRange(start, end);
+			});
+		}
+
+		ClearDirty();
+
+		Index num = 0u;
+
+		for (Index count : counts)
+			num += count;
+
+		return num;
+	}
+
+//}
+}
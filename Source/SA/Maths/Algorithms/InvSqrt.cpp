@@ -0,0 +1,213 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <type_traits>
+
+#include <Algorithms/InvSqrt.hpp>
+
+#if SA_MATHS_INV_SQRT_SIMD && SA_INTRISC_SSE
+
+namespace SA::Intl
+{
+	namespace
+	{
+		/// Bit-level estimate of 2 doubles (SSE2 64-bit integer operations).
+		__m128d InvSqrtEstimate2d(__m128d _in) noexcept
+		{
+			const __m128i bits = _mm_srli_epi64(_mm_castpd_si128(_in), 1);
+
+			return _mm_castsi128_pd(_mm_sub_epi64(_mm_set1_epi64x(static_cast<int64_t>(InvSqrtMagic<double>::value)), bits));
+		}
+
+
+		struct InvSqrtPack4f
+		{
+			using Type = float;
+			using Reg = __m128;
+			static constexpr size_t Width = 4u;
+
+			static Reg LoadU(const float* _p) noexcept { return _mm_loadu_ps(_p); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm_set1_ps(_v); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_ps(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm_sqrt_ps(_r); }
+
+			/// rsqrt instruction: 12 bits.
+			static Reg Estimate(Reg _r) noexcept { return _mm_rsqrt_ps(_r); }
+		};
+
+		struct InvSqrtPack2d
+		{
+			using Type = double;
+			using Reg = __m128d;
+			static constexpr size_t Width = 2u;
+
+			static Reg LoadU(const double* _p) noexcept { return _mm_loadu_pd(_p); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm_set1_pd(_v); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_pd(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm_sqrt_pd(_r); }
+
+			/// Bit-level estimate refined once (same as scalar).
+			static Reg Estimate(Reg _r) noexcept
+			{
+				const Reg y = InvSqrtEstimate2d(_r);
+
+				return Mul(y, Sub(Set1(1.5), Mul(Mul(Set1(0.5), _r), Mul(y, y))));
+			}
+		};
+
+#if SA_INTRISC_AVX
+
+		struct InvSqrtPack8f
+		{
+			using Type = float;
+			using Reg = __m256;
+			static constexpr size_t Width = 8u;
+
+			static Reg LoadU(const float* _p) noexcept { return _mm256_loadu_ps(_p); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm256_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm256_set1_ps(_v); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_ps(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm256_sqrt_ps(_r); }
+
+			/// rsqrt instruction: 12 bits.
+			static Reg Estimate(Reg _r) noexcept { return _mm256_rsqrt_ps(_r); }
+		};
+
+		struct InvSqrtPack4d
+		{
+			using Type = double;
+			using Reg = __m256d;
+			static constexpr size_t Width = 4u;
+
+			static Reg LoadU(const double* _p) noexcept { return _mm256_loadu_pd(_p); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm256_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm256_set1_pd(_v); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_pd(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm256_sqrt_pd(_r); }
+
+			/// Bit-level estimate on 128 bits halves (no 256 bits integer operations without AVX2), refined once.
+			static Reg Estimate(Reg _r) noexcept
+			{
+				const __m128d lo = InvSqrtEstimate2d(_mm256_castpd256_pd128(_r));
+				const __m128d hi = InvSqrtEstimate2d(_mm256_extractf128_pd(_r, 1));
+
+				const Reg y = _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+
+				return Mul(y, Sub(Set1(1.5), Mul(Mul(Set1(0.5), _r), Mul(y, y))));
+			}
+		};
+
+		/// Widest register wrapper of the compilation target.
+		using InvSqrtPackf = InvSqrtPack8f;
+		using InvSqrtPackd = InvSqrtPack4d;
+
+#else
+
+		using InvSqrtPackf = InvSqrtPack4f;
+		using InvSqrtPackd = InvSqrtPack2d;
+
+#endif
+
+		template <typename P, Maths::InvSqrtPrecision precision>
+		typename P::Reg InvSqrtEval(typename P::Reg _in) noexcept
+		{
+			using Reg = typename P::Reg;
+
+			if constexpr (precision == Maths::InvSqrtPrecision::Exact)
+				return P::Div(P::Set1(1), P::Sqrt(_in));
+			else
+			{
+				const Reg y = P::Estimate(_in);
+
+				if constexpr (precision == Maths::InvSqrtPrecision::Raw)
+					return y;
+				else
+					return P::Mul(y, P::Sub(P::Set1(1.5), P::Mul(P::Mul(P::Set1(0.5), _in), P::Mul(y, y))));
+			}
+		}
+
+		template <typename P, Maths::InvSqrtPrecision precision>
+		void InvSqrtBatchImpl(const typename P::Type* _in, typename P::Type* _out, size_t _num) noexcept
+		{
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+				P::StoreU(_out + i, InvSqrtEval<P, precision>(P::LoadU(_in + i)));
+
+			// Tail: same estimates as the SIMD body.
+			for (; i < _num; ++i)
+			{
+				if constexpr (std::is_same_v<typename P::Type, float>)
+				{
+					const __m128 res = InvSqrtEval<InvSqrtPack4f, precision>(_mm_set_ss(_in[i]));
+					_out[i] = _mm_cvtss_f32(res);
+				}
+				else
+				{
+					const __m128d res = InvSqrtEval<InvSqrtPack2d, precision>(_mm_set_sd(_in[i]));
+					_out[i] = _mm_cvtsd_f64(res);
+				}
+			}
+		}
+	}
+}
+
+
+namespace SA::Maths
+{
+//{ Float
+
+	template <>
+	void InvSqrtBatch<float, InvSqrtPrecision::Exact>(const float* _in, float* _out, size_t _num)
+	{
+		Intl::InvSqrtBatchImpl<Intl::InvSqrtPackf, InvSqrtPrecision::Exact>(_in, _out, _num);
+	}
+
+	template <>
+	void InvSqrtBatch<float, InvSqrtPrecision::Newton>(const float* _in, float* _out, size_t _num)
+	{
+		Intl::InvSqrtBatchImpl<Intl::InvSqrtPackf, InvSqrtPrecision::Newton>(_in, _out, _num);
+	}
+
+	template <>
+	void InvSqrtBatch<float, InvSqrtPrecision::Raw>(const float* _in, float* _out, size_t _num)
+	{
+		Intl::InvSqrtBatchImpl<Intl::InvSqrtPackf, InvSqrtPrecision::Raw>(_in, _out, _num);
+	}
+
+//}
+
+
+//{ Double
+
+	template <>
+	void InvSqrtBatch<double, InvSqrtPrecision::Exact>(const double* _in, double* _out, size_t _num)
+	{
+		Intl::InvSqrtBatchImpl<Intl::InvSqrtPackd, InvSqrtPrecision::Exact>(_in, _out, _num);
+	}
+
+	template <>
+	void InvSqrtBatch<double, InvSqrtPrecision::Newton>(const double* _in, double* _out, size_t _num)
+	{
+		Intl::InvSqrtBatchImpl<Intl::InvSqrtPackd, InvSqrtPrecision::Newton>(_in, _out, _num);
+	}
+
+	template <>
+	void InvSqrtBatch<double, InvSqrtPrecision::Raw>(const double* _in, double* _out, size_t _num)
+	{
+		Intl::InvSqrtBatchImpl<Intl::InvSqrtPackd, InvSqrtPrecision::Raw>(_in, _out, _num);
+	}
+
+//}
+}
+
+#endif
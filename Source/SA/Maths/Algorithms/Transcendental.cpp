@@ -0,0 +1,694 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <limits>
+#include <type_traits>
+
+#include <Algorithms/Sin.hpp>
+#include <Algorithms/Cos.hpp>
+#include <Algorithms/Tan.hpp>
+#include <Algorithms/Exp.hpp>
+#include <Algorithms/Log.hpp>
+
+#if SA_MATHS_TRANSCENDENTAL_SIMD && SA_INTRISC_SSE
+
+/**
+*	Lane-parallel acos, asin, atan, atan2, exp and log.
+*	Approximations and coefficients from Cephes (S. L. Moshier): polynomial for float, rational for double.
+*/
+
+namespace SA::Intl
+{
+	namespace
+	{
+		template <typename T>
+		struct TranscCoefficients;
+
+		template <>
+		struct TranscCoefficients<float>
+		{
+			/// atan(t) = t + t^3 * P(t^2), |t| <= tan(Pi / 8).
+			static constexpr float atanP[] = { 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f, -3.33329491539e-1f };
+
+			/// exp(r) = 1 + r + r^2 * P(r), |r| <= ln(2) / 2.
+			static constexpr float expP[] = { 1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f, 4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f };
+
+			/// ln(2) split: C1 is exact for n * C1.
+			static constexpr float ln2C1 = 0.693359375f;
+			static constexpr float ln2C2 = -2.12194440e-4f;
+
+			/// Clamp of exp input: results are 0 or inf out of range.
+			static constexpr float expMin = -104.0f;
+			static constexpr float expMax = 89.0f;
+
+			/// log(1 + m) = m - m^2 / 2 + m^3 * P(m), sqrt(0.5) - 1 <= m <= sqrt(2) - 1.
+			static constexpr float logP[] = {
+				7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f, -1.2420140846e-1f, 1.4249322787e-1f,
+				-1.6668057665e-1f, 2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f
+			};
+		};
+
+		template <>
+		struct TranscCoefficients<double>
+		{
+			/// atan(t) = t + t^3 * P(t^2) / Q(t^2), |t| <= 0.66, Q monic.
+			static constexpr double atanP[] = {
+				-8.750608600031904122785e-1, -1.615753718733365076637e1, -7.500855792314704667340e1,
+				-1.228866684490136173410e2, -6.485021904942025371773e1
+			};
+
+			static constexpr double atanQ[] = {
+				2.485846490142306297962e1, 1.650270098316988542046e2, 4.328810604912902668951e2,
+				4.853903996359136964868e2, 1.945506571482613964425e2
+			};
+
+			/// exp(r) = 1 + 2 * r * P(r^2) / (Q(r^2) - r * P(r^2)).
+			static constexpr double expP[] = { 1.26177193074810590878e-4, 3.02994407707441961300e-2, 9.99999999999999999910e-1 };
+			static constexpr double expQ[] = { 3.00198505138664455042e-6, 2.52448340349684104192e-3, 2.27265548208155028766e-1, 2.00000000000000000009e0 };
+
+			static constexpr double ln2C1 = 6.93145751953125e-1;
+			static constexpr double ln2C2 = 1.42860682030941723212e-6;
+
+			static constexpr double expMin = -746.0;
+			static constexpr double expMax = 710.0;
+
+			/// log(1 + m) = m - m^2 / 2 + m^3 * P(m) / Q(m), Q monic.
+			static constexpr double logP[] = {
+				1.01875663804580931796e-4, 4.97494994976747001425e-1, 4.70579119878881725854e0,
+				1.44989225341610930846e1, 1.79368678507819816313e1, 7.70838733755885391666e0
+			};
+
+			static constexpr double logQ[] = {
+				1.12873587189167450590e1, 4.52279145837532221105e1, 8.29875266912776603211e1,
+				7.11544750618563894466e1, 2.31251620126765340583e1
+			};
+
+			/// log uses the ln(2) split of float.
+			static constexpr double logC1 = 0.693359375;
+			static constexpr double logC2 = -2.121944400546905827679e-4;
+		};
+
+
+		/// Horner evaluation, highest order first.
+		template <typename P, size_t N>
+		typename P::Reg TranscPoly(const typename P::Type (&_coeffs)[N], typename P::Reg _x) noexcept
+		{
+			typename P::Reg res = P::Set1(_coeffs[0]);
+
+			for (size_t i = 1; i < N; ++i)
+				res = P::Madd(res, _x, P::Set1(_coeffs[i]));
+
+			return res;
+		}
+
+		/// Horner evaluation of a monic polynomial (implicit leading 1), highest order first.
+		template <typename P, size_t N>
+		typename P::Reg TranscPoly1(const typename P::Type (&_coeffs)[N], typename P::Reg _x) noexcept
+		{
+			typename P::Reg res = P::Add(_x, P::Set1(_coeffs[0]));
+
+			for (size_t i = 1; i < N; ++i)
+				res = P::Madd(res, _x, P::Set1(_coeffs[i]));
+
+			return res;
+		}
+
+
+		/// atan(_t) for |_t| <= tan(Pi / 8).
+		template <typename P>
+		typename P::Reg ATanReduced(typename P::Reg _t) noexcept
+		{
+			using T = typename P::Type;
+			using Coeffs = TranscCoefficients<T>;
+
+			const typename P::Reg z = P::Mul(_t, _t);
+
+			if constexpr (std::is_same_v<T, float>)
+				return P::Madd(P::Mul(TranscPoly<P>(Coeffs::atanP, z), z), _t, _t);
+			else
+			{
+				const typename P::Reg ratio = P::Div(TranscPoly<P>(Coeffs::atanP, z), TranscPoly1<P>(Coeffs::atanQ, z));
+
+				return P::Madd(P::Mul(_t, z), ratio, _t);
+			}
+		}
+
+		/**
+		*	atan2 from |y| and |x|: t = min / max in [0, 1], reduced to |t| <= tan(Pi / 8) with
+		*	atan(t) = Pi / 4 + atan((min - max) / (min + max)), then mirrored in octants and quadrants.
+		*/
+		template <typename P>
+		typename P::Reg ATan2Eval(typename P::Reg _y, typename P::Reg _x) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+
+			const Reg zero = P::Set1(T(0));
+			const Reg signMask = P::Set1(T(-0.0));
+
+			const Reg ax = P::Abs(_x);
+			const Reg ay = P::Abs(_y);
+
+			const Reg num = P::Min(ax, ay);
+			const Reg den = P::Max(ax, ay);
+
+			// t > tan(Pi / 8).
+			const Reg big = P::CmpGT(num, P::Mul(den, P::Set1(T(0.41421356237309504880))));
+
+			const Reg redNum = P::BlendV(num, P::Sub(num, den), big);
+			const Reg redDen = P::BlendV(den, P::Add(num, den), big);
+
+			// atan2(0, 0) = 0.
+			const Reg t = P::And(P::Div(redNum, redDen), P::CmpNEq(redDen, zero));
+
+			Reg res = P::Add(ATanReduced<P>(t), P::And(big, P::Set1(T(0.78539816339744830962))));
+
+			res = P::BlendV(res, P::Sub(P::Set1(T(1.57079632679489661923)), res), P::CmpGT(ay, ax));
+			res = P::BlendV(res, P::Sub(P::Set1(T(3.14159265358979323846)), res), P::CmpLT(_x, zero));
+
+			// Sign of y.
+			return P::Or(res, P::And(_y, signMask));
+		}
+
+		/// sqrt(1 - x^2) with (1 - x) * (1 + x): exact 1 - x near 1.
+		template <typename P>
+		typename P::Reg ASinCosComplement(typename P::Reg _x) noexcept
+		{
+			using T = typename P::Type;
+
+			const typename P::Reg one = P::Set1(T(1));
+
+			return P::Sqrt(P::Mul(P::Sub(one, _x), P::Add(one, _x)));
+		}
+
+		/**
+		*	exp(x) = 2^n * exp(r), x = n * ln(2) + r.
+		*	2^n is applied in two halves: results down to denormals and up to overflow stay exact.
+		*/
+		template <typename P>
+		typename P::Reg ExpEval(typename P::Reg _x) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+			using Coeffs = TranscCoefficients<T>;
+
+			// Max(min, x) keeps NaN (second operand).
+			const Reg x = P::Min(P::Set1(Coeffs::expMax), P::Max(P::Set1(Coeffs::expMin), _x));
+
+			const Reg n = P::Round(P::Mul(x, P::Set1(T(1.44269504088896340736))));
+			const Reg r = P::Sub(P::Sub(x, P::Mul(n, P::Set1(Coeffs::ln2C1))), P::Mul(n, P::Set1(Coeffs::ln2C2)));
+
+			const Reg one = P::Set1(T(1));
+			const Reg rr = P::Mul(r, r);
+
+			Reg y;
+
+			if constexpr (std::is_same_v<T, float>)
+				y = P::Add(P::Madd(TranscPoly<P>(Coeffs::expP, r), rr, r), one);
+			else
+			{
+				const Reg px = P::Mul(r, TranscPoly<P>(Coeffs::expP, rr));
+				const Reg ratio = P::Div(px, P::Sub(TranscPoly<P>(Coeffs::expQ, rr), px));
+
+				y = P::Madd(P::Set1(T(2)), ratio, one);
+			}
+
+			const Reg nHalf = P::Floor(P::Mul(n, P::Set1(T(0.5))));
+
+			return P::Mul(P::Mul(y, P::Pow2i(nHalf)), P::Pow2i(P::Sub(n, nHalf)));
+		}
+
+		/**
+		*	log(x) = e * ln(2) + log(1 + m), x = 2^e * (1 + m), sqrt(0.5) <= 1 + m < sqrt(2).
+		*	Denormals are scaled to normals first.
+		*/
+		template <typename P>
+		typename P::Reg LogEval(typename P::Reg _x) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+			using Coeffs = TranscCoefficients<T>;
+
+			constexpr T mantBits = T(std::numeric_limits<T>::digits - 1);
+
+			const Reg zero = P::Set1(T(0));
+			const Reg one = P::Set1(T(1));
+
+			const Reg denorm = P::CmpLT(_x, P::Set1(std::numeric_limits<T>::min()));
+			const Reg x = P::BlendV(_x, P::Mul(_x, P::Set1(T(1ull << static_cast<int>(mantBits)))), denorm);
+
+			// x = m * 2^e, m in [0.5, 1).
+			Reg e;
+			Reg m = P::Frexp(x, e);
+
+			e = P::Sub(e, P::And(denorm, P::Set1(mantBits)));
+
+			const Reg small = P::CmpLT(m, P::Set1(T(0.70710678118654752440)));
+			e = P::Sub(e, P::And(small, one));
+			m = P::Sub(P::Add(m, P::And(small, m)), one);
+
+			const Reg z = P::Mul(m, m);
+
+			Reg y;
+			Reg res;
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				y = P::Mul(P::Mul(TranscPoly<P>(Coeffs::logP, m), m), z);
+				y = P::Madd(e, P::Set1(Coeffs::ln2C2), y);
+				y = P::Madd(z, P::Set1(T(-0.5)), y);
+				res = P::Madd(e, P::Set1(Coeffs::ln2C1), P::Add(m, y));
+			}
+			else
+			{
+				y = P::Mul(m, P::Div(P::Mul(z, TranscPoly<P>(Coeffs::logP, m)), TranscPoly1<P>(Coeffs::logQ, m)));
+				y = P::Madd(e, P::Set1(Coeffs::logC2), y);
+				y = P::Madd(z, P::Set1(T(-0.5)), y);
+				res = P::Madd(e, P::Set1(Coeffs::logC1), P::Add(m, y));
+			}
+
+			// log(0) = -inf, log(x < 0) = NaN, log(inf) = inf, log(NaN) = NaN.
+			res = P::BlendV(res, P::Set1(-std::numeric_limits<T>::infinity()), P::CmpEq(_x, zero));
+			res = P::BlendV(res, P::Set1(std::numeric_limits<T>::quiet_NaN()), P::CmpLT(_x, zero));
+			res = P::BlendV(res, _x, P::CmpNLT(_x, P::Set1(std::numeric_limits<T>::infinity())));
+
+			return res;
+		}
+
+
+		enum class TranscFunc
+		{
+			ACos,
+			ASin,
+			ATan,
+			Exp,
+			Log,
+		};
+
+		template <typename P, TranscFunc func>
+		typename P::Reg TranscEval(typename P::Reg _x) noexcept
+		{
+			using T = typename P::Type;
+
+			if constexpr (func == TranscFunc::ACos)
+				return ATan2Eval<P>(ASinCosComplement<P>(_x), _x);
+			else if constexpr (func == TranscFunc::ASin)
+				return ATan2Eval<P>(_x, ASinCosComplement<P>(_x));
+			else if constexpr (func == TranscFunc::ATan)
+				return ATan2Eval<P>(_x, P::Set1(T(1)));
+			else if constexpr (func == TranscFunc::Exp)
+				return ExpEval<P>(_x);
+			else
+				return LogEval<P>(_x);
+		}
+
+		/// Tail is computed on a padded register: same results as the SIMD body.
+		template <typename P, TranscFunc func>
+		void TranscBatch(const typename P::Type* _in, typename P::Type* _out, size_t _num) noexcept
+		{
+			using T = typename P::Type;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+				P::StoreU(_out + i, TranscEval<P, func>(P::LoadU(_in + i)));
+
+			if (i < _num)
+			{
+				T buffer[P::Width];
+
+				for (size_t j = 0; j < P::Width; ++j)
+					buffer[j] = i + j < _num ? _in[i + j] : T(1);
+
+				P::StoreU(buffer, TranscEval<P, func>(P::LoadU(buffer)));
+
+				for (size_t j = 0; i + j < _num; ++j)
+					_out[i + j] = buffer[j];
+			}
+		}
+
+		template <typename P>
+		void ATan2BatchImpl(const typename P::Type* _y, const typename P::Type* _x, typename P::Type* _out, size_t _num) noexcept
+		{
+			using T = typename P::Type;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+				P::StoreU(_out + i, ATan2Eval<P>(P::LoadU(_y + i), P::LoadU(_x + i)));
+
+			if (i < _num)
+			{
+				T yBuffer[P::Width];
+				T xBuffer[P::Width];
+
+				for (size_t j = 0; j < P::Width; ++j)
+				{
+					yBuffer[j] = i + j < _num ? _y[i + j] : T(1);
+					xBuffer[j] = i + j < _num ? _x[i + j] : T(1);
+				}
+
+				P::StoreU(yBuffer, ATan2Eval<P>(P::LoadU(yBuffer), P::LoadU(xBuffer)));
+
+				for (size_t j = 0; i + j < _num; ++j)
+					_out[i + j] = yBuffer[j];
+			}
+		}
+
+
+//{ Bit-level helpers (SSE2)
+
+		/// 2^n for integral n in [-126, 127].
+		__m128 Pow2i4f(__m128 _n) noexcept
+		{
+			const __m128i bits = _mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(_n), _mm_set1_epi32(127)), 23);
+
+			return _mm_castsi128_ps(bits);
+		}
+
+		/// x = m * 2^e, m in [0.5, 1) (normal positive x).
+		__m128 Frexp4f(__m128 _x, __m128& _e) noexcept
+		{
+			const __m128i bits = _mm_castps_si128(_x);
+
+			const __m128i exp = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126));
+			_e = _mm_cvtepi32_ps(exp);
+
+			const __m128i mant = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x807fffff)), _mm_set1_epi32(0x3f000000));
+
+			return _mm_castsi128_ps(mant);
+		}
+
+		/// 2^n for integral n in [-1022, 1023].
+		__m128d Pow2i2d(__m128d _n) noexcept
+		{
+			const __m128i n = _mm_cvtepi32_epi64(_mm_cvtpd_epi32(_n));
+			const __m128i bits = _mm_slli_epi64(_mm_add_epi64(n, _mm_set1_epi64x(1023)), 52);
+
+			return _mm_castsi128_pd(bits);
+		}
+
+		/// x = m * 2^e, m in [0.5, 1) (normal positive x).
+		__m128d Frexp2d(__m128d _x, __m128d& _e) noexcept
+		{
+			const __m128i bits = _mm_castpd_si128(_x);
+
+			// Exponent field to double: 2^52 + field - 2^52.
+			const __m128i field = _mm_srli_epi64(bits, 52);
+			const __m128d magic = _mm_set1_pd(4503599627370496.0);
+			const __m128d fieldd = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(field, _mm_castpd_si128(magic))), magic);
+
+			_e = _mm_sub_pd(fieldd, _mm_set1_pd(1022.0));
+
+			const __m128i mant = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(static_cast<int64_t>(0x800fffffffffffffull))),
+				_mm_set1_epi64x(0x3fe0000000000000ll));
+
+			return _mm_castsi128_pd(mant);
+		}
+
+//}
+
+
+		struct TranscPack4f
+		{
+			using Type = float;
+			using Reg = __m128;
+			static constexpr size_t Width = 4u;
+
+			static Reg LoadU(const float* _p) noexcept { return _mm_loadu_ps(_p); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm_set1_ps(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_ps(_l, _r); }
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept { return _mm_add_ps(_mm_mul_ps(_a, _b), _c); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm_sqrt_ps(_r); }
+			static Reg Min(Reg _l, Reg _r) noexcept { return _mm_min_ps(_l, _r); }
+			static Reg Max(Reg _l, Reg _r) noexcept { return _mm_max_ps(_l, _r); }
+			static Reg Abs(Reg _r) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), _r); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm_and_ps(_l, _r); }
+			static Reg Or(Reg _l, Reg _r) noexcept { return _mm_or_ps(_l, _r); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm_blendv_ps(_l, _r, _mask); }
+			static Reg CmpGT(Reg _l, Reg _r) noexcept { return _mm_cmpgt_ps(_l, _r); }
+			static Reg CmpLT(Reg _l, Reg _r) noexcept { return _mm_cmplt_ps(_l, _r); }
+			static Reg CmpEq(Reg _l, Reg _r) noexcept { return _mm_cmpeq_ps(_l, _r); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm_cmpneq_ps(_l, _r); }
+			static Reg CmpNLT(Reg _l, Reg _r) noexcept { return _mm_cmpnlt_ps(_l, _r); }
+			static Reg Round(Reg _r) noexcept { return _mm_round_ps(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm_floor_ps(_r); }
+			static Reg Pow2i(Reg _n) noexcept { return Pow2i4f(_n); }
+			static Reg Frexp(Reg _x, Reg& _e) noexcept { return Frexp4f(_x, _e); }
+		};
+
+		struct TranscPack2d
+		{
+			using Type = double;
+			using Reg = __m128d;
+			static constexpr size_t Width = 2u;
+
+			static Reg LoadU(const double* _p) noexcept { return _mm_loadu_pd(_p); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm_set1_pd(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_pd(_l, _r); }
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept { return _mm_add_pd(_mm_mul_pd(_a, _b), _c); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm_sqrt_pd(_r); }
+			static Reg Min(Reg _l, Reg _r) noexcept { return _mm_min_pd(_l, _r); }
+			static Reg Max(Reg _l, Reg _r) noexcept { return _mm_max_pd(_l, _r); }
+			static Reg Abs(Reg _r) noexcept { return _mm_andnot_pd(_mm_set1_pd(-0.0), _r); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm_and_pd(_l, _r); }
+			static Reg Or(Reg _l, Reg _r) noexcept { return _mm_or_pd(_l, _r); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm_blendv_pd(_l, _r, _mask); }
+			static Reg CmpGT(Reg _l, Reg _r) noexcept { return _mm_cmpgt_pd(_l, _r); }
+			static Reg CmpLT(Reg _l, Reg _r) noexcept { return _mm_cmplt_pd(_l, _r); }
+			static Reg CmpEq(Reg _l, Reg _r) noexcept { return _mm_cmpeq_pd(_l, _r); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm_cmpneq_pd(_l, _r); }
+			static Reg CmpNLT(Reg _l, Reg _r) noexcept { return _mm_cmpnlt_pd(_l, _r); }
+			static Reg Round(Reg _r) noexcept { return _mm_round_pd(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm_floor_pd(_r); }
+			static Reg Pow2i(Reg _n) noexcept { return Pow2i2d(_n); }
+			static Reg Frexp(Reg _x, Reg& _e) noexcept { return Frexp2d(_x, _e); }
+		};
+
+#if SA_INTRISC_AVX
+
+		/// AVX has no 256 bits integer operations (AVX2): bit-level helpers run on 128 bits halves.
+		struct TranscPack8f
+		{
+			using Type = float;
+			using Reg = __m256;
+			static constexpr size_t Width = 8u;
+
+			static Reg LoadU(const float* _p) noexcept { return _mm256_loadu_ps(_p); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm256_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm256_set1_ps(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_ps(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm256_sqrt_ps(_r); }
+			static Reg Min(Reg _l, Reg _r) noexcept { return _mm256_min_ps(_l, _r); }
+			static Reg Max(Reg _l, Reg _r) noexcept { return _mm256_max_ps(_l, _r); }
+			static Reg Abs(Reg _r) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _r); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm256_and_ps(_l, _r); }
+			static Reg Or(Reg _l, Reg _r) noexcept { return _mm256_or_ps(_l, _r); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm256_blendv_ps(_l, _r, _mask); }
+			static Reg CmpGT(Reg _l, Reg _r) noexcept { return _mm256_cmp_ps(_l, _r, _CMP_GT_OQ); }
+			static Reg CmpLT(Reg _l, Reg _r) noexcept { return _mm256_cmp_ps(_l, _r, _CMP_LT_OQ); }
+			static Reg CmpEq(Reg _l, Reg _r) noexcept { return _mm256_cmp_ps(_l, _r, _CMP_EQ_OQ); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm256_cmp_ps(_l, _r, _CMP_NEQ_UQ); }
+			static Reg CmpNLT(Reg _l, Reg _r) noexcept { return _mm256_cmp_ps(_l, _r, _CMP_NLT_UQ); }
+			static Reg Round(Reg _r) noexcept { return _mm256_round_ps(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm256_floor_ps(_r); }
+
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept
+			{
+#if SA_INTRISC_FMA
+				return _mm256_fmadd_ps(_a, _b, _c);
+#else
+				return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+			}
+
+			static Reg Pow2i(Reg _n) noexcept
+			{
+				const __m128 lo = Pow2i4f(_mm256_castps256_ps128(_n));
+				const __m128 hi = Pow2i4f(_mm256_extractf128_ps(_n, 1));
+
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+			}
+
+			static Reg Frexp(Reg _x, Reg& _e) noexcept
+			{
+				__m128 eLo;
+				__m128 eHi;
+
+				const __m128 lo = Frexp4f(_mm256_castps256_ps128(_x), eLo);
+				const __m128 hi = Frexp4f(_mm256_extractf128_ps(_x, 1), eHi);
+
+				_e = _mm256_insertf128_ps(_mm256_castps128_ps256(eLo), eHi, 1);
+
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+			}
+		};
+
+		struct TranscPack4d
+		{
+			using Type = double;
+			using Reg = __m256d;
+			static constexpr size_t Width = 4u;
+
+			static Reg LoadU(const double* _p) noexcept { return _mm256_loadu_pd(_p); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm256_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm256_set1_pd(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_pd(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm256_sqrt_pd(_r); }
+			static Reg Min(Reg _l, Reg _r) noexcept { return _mm256_min_pd(_l, _r); }
+			static Reg Max(Reg _l, Reg _r) noexcept { return _mm256_max_pd(_l, _r); }
+			static Reg Abs(Reg _r) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), _r); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm256_and_pd(_l, _r); }
+			static Reg Or(Reg _l, Reg _r) noexcept { return _mm256_or_pd(_l, _r); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm256_blendv_pd(_l, _r, _mask); }
+			static Reg CmpGT(Reg _l, Reg _r) noexcept { return _mm256_cmp_pd(_l, _r, _CMP_GT_OQ); }
+			static Reg CmpLT(Reg _l, Reg _r) noexcept { return _mm256_cmp_pd(_l, _r, _CMP_LT_OQ); }
+			static Reg CmpEq(Reg _l, Reg _r) noexcept { return _mm256_cmp_pd(_l, _r, _CMP_EQ_OQ); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm256_cmp_pd(_l, _r, _CMP_NEQ_UQ); }
+			static Reg CmpNLT(Reg _l, Reg _r) noexcept { return _mm256_cmp_pd(_l, _r, _CMP_NLT_UQ); }
+			static Reg Round(Reg _r) noexcept { return _mm256_round_pd(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm256_floor_pd(_r); }
+
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept
+			{
+#if SA_INTRISC_FMA
+				return _mm256_fmadd_pd(_a, _b, _c);
+#else
+				return _mm256_add_pd(_mm256_mul_pd(_a, _b), _c);
+#endif
+			}
+
+			static Reg Pow2i(Reg _n) noexcept
+			{
+				const __m128d lo = Pow2i2d(_mm256_castpd256_pd128(_n));
+				const __m128d hi = Pow2i2d(_mm256_extractf128_pd(_n, 1));
+
+				return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+			}
+
+			static Reg Frexp(Reg _x, Reg& _e) noexcept
+			{
+				__m128d eLo;
+				__m128d eHi;
+
+				const __m128d lo = Frexp2d(_mm256_castpd256_pd128(_x), eLo);
+				const __m128d hi = Frexp2d(_mm256_extractf128_pd(_x, 1), eHi);
+
+				_e = _mm256_insertf128_pd(_mm256_castpd128_pd256(eLo), eHi, 1);
+
+				return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+			}
+		};
+
+		/// Widest register wrapper of the compilation target.
+		using TranscPackf = TranscPack8f;
+		using TranscPackd = TranscPack4d;
+
+#else
+
+		using TranscPackf = TranscPack4f;
+		using TranscPackd = TranscPack2d;
+
+#endif
+	}
+}
+
+
+namespace SA::Maths
+{
+//{ Float
+
+	template <>
+	void ACosBatch<float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackf, Intl::TranscFunc::ACos>(_in, _out, _num);
+	}
+
+	template <>
+	void ASinBatch<float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackf, Intl::TranscFunc::ASin>(_in, _out, _num);
+	}
+
+	template <>
+	void ATanBatch<float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackf, Intl::TranscFunc::ATan>(_in, _out, _num);
+	}
+
+	template <>
+	void ATan2Batch<float>(const float* _y, const float* _x, float* _out, size_t _num) noexcept
+	{
+		Intl::ATan2BatchImpl<Intl::TranscPackf>(_y, _x, _out, _num);
+	}
+
+	template <>
+	void ExpBatch<float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackf, Intl::TranscFunc::Exp>(_in, _out, _num);
+	}
+
+	template <>
+	void LogBatch<float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackf, Intl::TranscFunc::Log>(_in, _out, _num);
+	}
+
+//}
+
+
+//{ Double
+
+	template <>
+	void ACosBatch<double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackd, Intl::TranscFunc::ACos>(_in, _out, _num);
+	}
+
+	template <>
+	void ASinBatch<double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackd, Intl::TranscFunc::ASin>(_in, _out, _num);
+	}
+
+	template <>
+	void ATanBatch<double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackd, Intl::TranscFunc::ATan>(_in, _out, _num);
+	}
+
+	template <>
+	void ATan2Batch<double>(const double* _y, const double* _x, double* _out, size_t _num) noexcept
+	{
+		Intl::ATan2BatchImpl<Intl::TranscPackd>(_y, _x, _out, _num);
+	}
+
+	template <>
+	void ExpBatch<double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackd, Intl::TranscFunc::Exp>(_in, _out, _num);
+	}
+
+	template <>
+	void LogBatch<double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TranscBatch<Intl::TranscPackd, Intl::TranscFunc::Log>(_in, _out, _num);
+	}
+
+//}
+}
+
+#endif
@@ -0,0 +1,457 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <iterator>
+
+#include <Algorithms/Sin.hpp>
+#include <Algorithms/Cos.hpp>
+#include <Algorithms/Tan.hpp>
+#include <Algorithms/SinCos.hpp>
+
+#if SA_MATHS_TRIGONOMETRY_SIMD && SA_INTRISC_SSE
+
+namespace SA::Intl
+{
+	namespace
+	{
+		enum class TrigFunc
+		{
+			Sin,
+			Cos,
+			Tan,
+		};
+
+		/**
+		*	One input per lane, generic over the register wrapper.
+		*	Same operations as TrigSinCosReduced: output quadrant k, sin(r) and cos(r).
+		*/
+		template <typename P, Maths::TrigPrecision precision>
+		void TrigReduce(typename P::Reg _x, typename P::Reg& _k, typename P::Reg& _sin, typename P::Reg& _cos) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+			using Coeffs = TrigCoefficients<T, precision>;
+			using Reduction = TrigReduction<T>;
+
+			_k = P::Round(P::Mul(_x, P::Set1(trigTwoOvPi<T>)));
+
+			Reg r = P::Sub(_x, P::Mul(_k, P::Set1(Reduction::pio2[0])));
+
+			if constexpr (precision == Maths::TrigPrecision::High)
+				r = P::Sub(P::Sub(r, P::Mul(_k, P::Set1(Reduction::pio2[1]))), P::Mul(_k, P::Set1(Reduction::pio2[2])));
+			else
+				r = P::Sub(r, P::Mul(_k, P::Set1(Reduction::pio2[1] + Reduction::pio2[2])));
+
+			const Reg t = P::Mul(r, r);
+
+			Reg sinPoly = P::Set1(Coeffs::sinCoeffs[std::size(Coeffs::sinCoeffs) - 1]);
+
+			for (size_t i = std::size(Coeffs::sinCoeffs) - 1; i > 0; --i)
+				sinPoly = P::Madd(sinPoly, t, P::Set1(Coeffs::sinCoeffs[i - 1]));
+
+			Reg cosPoly = P::Set1(Coeffs::cosCoeffs[std::size(Coeffs::cosCoeffs) - 1]);
+
+			for (size_t i = std::size(Coeffs::cosCoeffs) - 1; i > 0; --i)
+				cosPoly = P::Madd(cosPoly, t, P::Set1(Coeffs::cosCoeffs[i - 1]));
+
+			_sin = P::Madd(P::Mul(r, t), sinPoly, r);
+			_cos = P::Madd(t, cosPoly, P::Set1(T(1)));
+		}
+
+		/**
+		*	Masks of (q & 1) and (q & 2) computed with floor (exact while q fits in the mantissa).
+		*/
+		template <typename P>
+		void TrigQuadrant(typename P::Reg _q, typename P::Reg& _odd, typename P::Reg& _neg) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+
+			const Reg zero = P::Set1(T(0));
+			const Reg half = P::Set1(T(0.5));
+
+			const Reg qHalf = P::Floor(P::Mul(_q, half));
+			_odd = P::CmpNEq(P::Sub(_q, P::Add(qHalf, qHalf)), zero);
+
+			const Reg qHalfHalf = P::Floor(P::Mul(qHalf, half));
+			_neg = P::CmpNEq(P::Sub(qHalf, P::Add(qHalfHalf, qHalfHalf)), zero);
+		}
+
+		/// sin(k * Pi / 2 + r): sin(r), cos(r), -sin(r), -cos(r).
+		template <typename P>
+		typename P::Reg TrigSelect(typename P::Reg _q, typename P::Reg _sin, typename P::Reg _cos) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+
+			Reg odd;
+			Reg neg;
+			TrigQuadrant<P>(_q, odd, neg);
+
+			return P::Xor(P::BlendV(_sin, _cos, odd), P::And(neg, P::Set1(T(-0.0))));
+		}
+
+		template <typename P, Maths::TrigPrecision precision, TrigFunc func>
+		typename P::Reg TrigEval(typename P::Reg _x) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+
+			Reg k;
+			Reg s;
+			Reg c;
+			TrigReduce<P, precision>(_x, k, s, c);
+
+			if constexpr (func == TrigFunc::Sin)
+				return TrigSelect<P>(k, s, c);
+			else if constexpr (func == TrigFunc::Cos)
+			{
+				// cos(x) = sin(x + Pi / 2).
+				return TrigSelect<P>(P::Add(k, P::Set1(T(1))), s, c);
+			}
+			else
+			{
+				Reg odd;
+				Reg neg;
+				TrigQuadrant<P>(k, odd, neg);
+
+				// tan(r) or -1 / tan(r).
+				const Reg tan = P::Div(P::BlendV(s, c, odd), P::BlendV(c, s, odd));
+
+				return P::Xor(tan, P::And(odd, P::Set1(T(-0.0))));
+			}
+		}
+
+		template <typename P, Maths::TrigPrecision precision, TrigFunc func>
+		void TrigBatch(const typename P::Type* _in, typename P::Type* _out, size_t _num) noexcept
+		{
+			using T = typename P::Type;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+				P::StoreU(_out + i, TrigEval<P, precision, func>(P::LoadU(_in + i)));
+
+			for (; i < _num; ++i)
+			{
+				if constexpr (func == TrigFunc::Sin)
+					_out[i] = Maths::Sin<precision>(Rad<T>(_in[i]));
+				else if constexpr (func == TrigFunc::Cos)
+					_out[i] = Maths::Cos<precision>(Rad<T>(_in[i]));
+				else
+					_out[i] = Maths::Tan<precision>(Rad<T>(_in[i]));
+			}
+		}
+
+		/// Sine and cosine from a single reduction.
+		template <typename P, Maths::TrigPrecision precision>
+		void SinCosBatchImpl(const typename P::Type* _in, typename P::Type* _sin, typename P::Type* _cos, size_t _num) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				Reg k;
+				Reg s;
+				Reg c;
+				TrigReduce<P, precision>(P::LoadU(_in + i), k, s, c);
+
+				P::StoreU(_sin + i, TrigSelect<P>(k, s, c));
+				P::StoreU(_cos + i, TrigSelect<P>(P::Add(k, P::Set1(T(1))), s, c));
+			}
+
+			for (; i < _num; ++i)
+			{
+				const Maths::SinCosResult<T> res = Maths::SinCos<precision>(Rad<T>(_in[i]));
+
+				_sin[i] = res.sin;
+				_cos[i] = res.cos;
+			}
+		}
+
+
+		struct TrigPack4f
+		{
+			using Type = float;
+			using Reg = __m128;
+			static constexpr size_t Width = 4u;
+
+			static Reg LoadU(const float* _p) noexcept { return _mm_loadu_ps(_p); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm_set1_ps(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_ps(_l, _r); }
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept { return _mm_add_ps(_mm_mul_ps(_a, _b), _c); }
+			static Reg Round(Reg _r) noexcept { return _mm_round_ps(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm_floor_ps(_r); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm_cmpneq_ps(_l, _r); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm_blendv_ps(_l, _r, _mask); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm_and_ps(_l, _r); }
+			static Reg Xor(Reg _l, Reg _r) noexcept { return _mm_xor_ps(_l, _r); }
+		};
+
+		struct TrigPack2d
+		{
+			using Type = double;
+			using Reg = __m128d;
+			static constexpr size_t Width = 2u;
+
+			static Reg LoadU(const double* _p) noexcept { return _mm_loadu_pd(_p); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm_set1_pd(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_pd(_l, _r); }
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept { return _mm_add_pd(_mm_mul_pd(_a, _b), _c); }
+			static Reg Round(Reg _r) noexcept { return _mm_round_pd(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm_floor_pd(_r); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm_cmpneq_pd(_l, _r); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm_blendv_pd(_l, _r, _mask); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm_and_pd(_l, _r); }
+			static Reg Xor(Reg _l, Reg _r) noexcept { return _mm_xor_pd(_l, _r); }
+		};
+
+#if SA_INTRISC_AVX
+
+		struct TrigPack8f
+		{
+			using Type = float;
+			using Reg = __m256;
+			static constexpr size_t Width = 8u;
+
+			static Reg LoadU(const float* _p) noexcept { return _mm256_loadu_ps(_p); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm256_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm256_set1_ps(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_ps(_l, _r); }
+			static Reg Round(Reg _r) noexcept { return _mm256_round_ps(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm256_floor_ps(_r); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm256_cmp_ps(_l, _r, _CMP_NEQ_UQ); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm256_blendv_ps(_l, _r, _mask); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm256_and_ps(_l, _r); }
+			static Reg Xor(Reg _l, Reg _r) noexcept { return _mm256_xor_ps(_l, _r); }
+
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept
+			{
+#if SA_INTRISC_FMA
+				return _mm256_fmadd_ps(_a, _b, _c);
+#else
+				return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+			}
+		};
+
+		struct TrigPack4d
+		{
+			using Type = double;
+			using Reg = __m256d;
+			static constexpr size_t Width = 4u;
+
+			static Reg LoadU(const double* _p) noexcept { return _mm256_loadu_pd(_p); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm256_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm256_set1_pd(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_pd(_l, _r); }
+			static Reg Round(Reg _r) noexcept { return _mm256_round_pd(_r, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+			static Reg Floor(Reg _r) noexcept { return _mm256_floor_pd(_r); }
+			static Reg CmpNEq(Reg _l, Reg _r) noexcept { return _mm256_cmp_pd(_l, _r, _CMP_NEQ_UQ); }
+			static Reg BlendV(Reg _l, Reg _r, Reg _mask) noexcept { return _mm256_blendv_pd(_l, _r, _mask); }
+			static Reg And(Reg _l, Reg _r) noexcept { return _mm256_and_pd(_l, _r); }
+			static Reg Xor(Reg _l, Reg _r) noexcept { return _mm256_xor_pd(_l, _r); }
+
+			static Reg Madd(Reg _a, Reg _b, Reg _c) noexcept
+			{
+#if SA_INTRISC_FMA
+				return _mm256_fmadd_pd(_a, _b, _c);
+#else
+				return _mm256_add_pd(_mm256_mul_pd(_a, _b), _c);
+#endif
+			}
+		};
+
+		/// Widest register wrapper of the compilation target.
+		using TrigPackf = TrigPack8f;
+		using TrigPackd = TrigPack4d;
+
+#else
+
+		using TrigPackf = TrigPack4f;
+		using TrigPackd = TrigPack2d;
+
+#endif
+	}
+}
+
+
+namespace SA::Maths
+{
+//{ Float
+
+	template <>
+	void SinBatch<TrigPrecision::Low, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::Low, Intl::TrigFunc::Sin>(_in, _out, _num);
+	}
+
+	template <>
+	void SinBatch<TrigPrecision::Medium, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::Medium, Intl::TrigFunc::Sin>(_in, _out, _num);
+	}
+
+	template <>
+	void SinBatch<TrigPrecision::High, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::High, Intl::TrigFunc::Sin>(_in, _out, _num);
+	}
+
+
+	template <>
+	void CosBatch<TrigPrecision::Low, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::Low, Intl::TrigFunc::Cos>(_in, _out, _num);
+	}
+
+	template <>
+	void CosBatch<TrigPrecision::Medium, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::Medium, Intl::TrigFunc::Cos>(_in, _out, _num);
+	}
+
+	template <>
+	void CosBatch<TrigPrecision::High, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::High, Intl::TrigFunc::Cos>(_in, _out, _num);
+	}
+
+
+	template <>
+	void TanBatch<TrigPrecision::Low, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::Low, Intl::TrigFunc::Tan>(_in, _out, _num);
+	}
+
+	template <>
+	void TanBatch<TrigPrecision::Medium, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::Medium, Intl::TrigFunc::Tan>(_in, _out, _num);
+	}
+
+	template <>
+	void TanBatch<TrigPrecision::High, float>(const float* _in, float* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackf, TrigPrecision::High, Intl::TrigFunc::Tan>(_in, _out, _num);
+	}
+
+
+	template <>
+	void SinCosBatch<TrigPrecision::Low, float>(const float* _in, float* _sin, float* _cos, size_t _num) noexcept
+	{
+		Intl::SinCosBatchImpl<Intl::TrigPackf, TrigPrecision::Low>(_in, _sin, _cos, _num);
+	}
+
+	template <>
+	void SinCosBatch<TrigPrecision::Medium, float>(const float* _in, float* _sin, float* _cos, size_t _num) noexcept
+	{
+		Intl::SinCosBatchImpl<Intl::TrigPackf, TrigPrecision::Medium>(_in, _sin, _cos, _num);
+	}
+
+	template <>
+	void SinCosBatch<TrigPrecision::High, float>(const float* _in, float* _sin, float* _cos, size_t _num) noexcept
+	{
+		Intl::SinCosBatchImpl<Intl::TrigPackf, TrigPrecision::High>(_in, _sin, _cos, _num);
+	}
+
+//}
+
+
+//{ Double
+
+	template <>
+	void SinBatch<TrigPrecision::Low, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::Low, Intl::TrigFunc::Sin>(_in, _out, _num);
+	}
+
+	template <>
+	void SinBatch<TrigPrecision::Medium, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::Medium, Intl::TrigFunc::Sin>(_in, _out, _num);
+	}
+
+	template <>
+	void SinBatch<TrigPrecision::High, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::High, Intl::TrigFunc::Sin>(_in, _out, _num);
+	}
+
+
+	template <>
+	void CosBatch<TrigPrecision::Low, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::Low, Intl::TrigFunc::Cos>(_in, _out, _num);
+	}
+
+	template <>
+	void CosBatch<TrigPrecision::Medium, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::Medium, Intl::TrigFunc::Cos>(_in, _out, _num);
+	}
+
+	template <>
+	void CosBatch<TrigPrecision::High, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::High, Intl::TrigFunc::Cos>(_in, _out, _num);
+	}
+
+
+	template <>
+	void TanBatch<TrigPrecision::Low, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::Low, Intl::TrigFunc::Tan>(_in, _out, _num);
+	}
+
+	template <>
+	void TanBatch<TrigPrecision::Medium, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::Medium, Intl::TrigFunc::Tan>(_in, _out, _num);
+	}
+
+	template <>
+	void TanBatch<TrigPrecision::High, double>(const double* _in, double* _out, size_t _num) noexcept
+	{
+		Intl::TrigBatch<Intl::TrigPackd, TrigPrecision::High, Intl::TrigFunc::Tan>(_in, _out, _num);
+	}
+
+
+	template <>
+	void SinCosBatch<TrigPrecision::Low, double>(const double* _in, double* _sin, double* _cos, size_t _num) noexcept
+	{
+		Intl::SinCosBatchImpl<Intl::TrigPackd, TrigPrecision::Low>(_in, _sin, _cos, _num);
+	}
+
+	template <>
+	void SinCosBatch<TrigPrecision::Medium, double>(const double* _in, double* _sin, double* _cos, size_t _num) noexcept
+	{
+		Intl::SinCosBatchImpl<Intl::TrigPackd, TrigPrecision::Medium>(_in, _sin, _cos, _num);
+	}
+
+	template <>
+	void SinCosBatch<TrigPrecision::High, double>(const double* _in, double* _sin, double* _cos, size_t _num) noexcept
+	{
+		Intl::SinCosBatchImpl<Intl::TrigPackd, TrigPrecision::High>(_in, _sin, _cos, _num);
+	}
+
+//}
+}
+
+#endif
@@ -0,0 +1,290 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+/**
+*	AABB3D transform kernels (Arvo method) using 256-bit AVX / FMA3 registers (no AVX2 lane crossing permutes).
+*
+*	Included by BatchKernelsAVX.cpp and BatchKernelsAVX512.cpp: boxes are interleaved 6 element structures,
+*	one box per 128-bit lane (float) or per register (double) is already the widest useful layout,
+*	512-bit registers would only add lane shuffles.
+*/
+
+namespace SA::Intl
+{
+	namespace
+	{
+		/// Multiply-add helper: use FMA3 when available (SA_INTRISC_FMA).
+		inline __m256 AABB3DMadd(__m256 _a, __m256 _b, __m256 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmadd_ps(_a, _b, _c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+		}
+
+		/// \copydoc AABB3DMadd
+		inline __m256d AABB3DMadd(__m256d _a, __m256d _b, __m256d _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmadd_pd(_a, _b, _c);
+#else
+			return _mm256_add_pd(_mm256_mul_pd(_a, _b), _c);
+#endif
+		}
+
+
+//{ Float
+
+		/// Matrix columns (x, y, z, _) and absolute 3x3 columns, one matrix per 128-bit lane.
+		struct AABB3DfMat_AVX
+		{
+			__m256 cols[4];
+			__m256 absCols[3];
+		};
+
+		/// Load 4 floats from _low and _high to the low and high 128-bit lanes.
+		inline __m256 AABB3DfLoad2(const float* _low, const float* _high) noexcept
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(_low)), _mm_loadu_ps(_high), 1);
+		}
+
+		template <bool bColumn>
+		inline void AABB3DfLoadMat_AVX(const float* _low, const float* _high, AABB3DfMat_AVX& _res) noexcept
+		{
+			const __m256 r0 = AABB3DfLoad2(_low, _high);
+			const __m256 r1 = AABB3DfLoad2(_low + 4, _high + 4);
+			const __m256 r2 = AABB3DfLoad2(_low + 8, _high + 8);
+			const __m256 r3 = AABB3DfLoad2(_low + 12, _high + 12);
+
+			if constexpr (bColumn)
+			{
+				_res.cols[0] = r0;
+				_res.cols[1] = r1;
+				_res.cols[2] = r2;
+				_res.cols[3] = r3;
+			}
+			else
+			{
+				// Row major: memory rows to columns, 4x4 transpose per 128-bit lane.
+				const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+				const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+				const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+				const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+				_res.cols[0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				_res.cols[1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				_res.cols[2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				_res.cols[3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+			_res.absCols[0] = _mm256_andnot_ps(signMask, _res.cols[0]);
+			_res.absCols[1] = _mm256_andnot_ps(signMask, _res.cols[1]);
+			_res.absCols[2] = _mm256_andnot_ps(signMask, _res.cols[2]);
+		}
+
+		/**
+		*	Transform 2 boxes: one box per 128-bit lane, center and extents (x, y, z, _) in one register.
+		*	Each box is loaded and stored with 2 overlapping 4 float accesses (min.xyz max.x / min.z max.xyz)
+		*	to stay inside the 6 float box.
+		*	With _bSecond false, only the first box is read and written (high lane computes a copy).
+		*/
+		template <bool bSecond>
+		inline void AABB3DfTransform2_AVX(const AABB3DfMat_AVX& _mat, const float* _in, float* _out) noexcept
+		{
+			const __m256 half = _mm256_set1_ps(0.5f);
+
+			const __m256 bMin = AABB3DfLoad2(_in, bSecond ? _in + 6 : _in);
+			const __m256 hi = AABB3DfLoad2(_in + 2, bSecond ? _in + 8 : _in + 2);
+			const __m256 bMax = _mm256_permute_ps(hi, _MM_SHUFFLE(3, 3, 2, 1));
+
+			const __m256 c = _mm256_mul_ps(_mm256_add_ps(bMin, bMax), half);
+			const __m256 e = _mm256_mul_ps(_mm256_sub_ps(bMax, bMin), half);
+
+			const __m256 oc = AABB3DMadd(_mat.cols[2], _mm256_permute_ps(c, _MM_SHUFFLE(2, 2, 2, 2)),
+				AABB3DMadd(_mat.cols[1], _mm256_permute_ps(c, _MM_SHUFFLE(1, 1, 1, 1)),
+				AABB3DMadd(_mat.cols[0], _mm256_permute_ps(c, _MM_SHUFFLE(0, 0, 0, 0)), _mat.cols[3])));
+
+			const __m256 oe = AABB3DMadd(_mat.absCols[2], _mm256_permute_ps(e, _MM_SHUFFLE(2, 2, 2, 2)),
+				AABB3DMadd(_mat.absCols[1], _mm256_permute_ps(e, _MM_SHUFFLE(1, 1, 1, 1)),
+				_mm256_mul_ps(_mat.absCols[0], _mm256_permute_ps(e, _MM_SHUFFLE(0, 0, 0, 0)))));
+
+			const __m256 oMin = _mm256_sub_ps(oc, oe);
+			const __m256 oMax = _mm256_add_ps(oc, oe);
+
+			// (min.z, max.x, max.y, max.z): overwrite the 4th float of the first store.
+			const __m256 oHi = _mm256_blend_ps(_mm256_permute_ps(oMax, _MM_SHUFFLE(2, 1, 0, 0)),
+				_mm256_permute_ps(oMin, _MM_SHUFFLE(2, 2, 2, 2)), 0x11);
+
+			_mm_storeu_ps(_out, _mm256_castps256_ps128(oMin));
+			_mm_storeu_ps(_out + 2, _mm256_castps256_ps128(oHi));
+
+			if constexpr (bSecond)
+			{
+				_mm_storeu_ps(_out + 6, _mm256_extractf128_ps(oMin, 1));
+				_mm_storeu_ps(_out + 8, _mm256_extractf128_ps(oHi, 1));
+			}
+		}
+
+		template <bool bConstMat, bool bColumn>
+		void AABB3DfTransformMajor_AVX(const float* _mats, const AABB3D<float>* _in, AABB3D<float>* _out, size_t _num) noexcept
+		{
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			AABB3DfMat_AVX mat;
+
+			if constexpr (bConstMat)
+				AABB3DfLoadMat_AVX<bColumn>(_mats, _mats, mat);
+
+			size_t i = 0;
+
+			for (; i + 2 <= _num; i += 2, in += 12, out += 12)
+			{
+				if constexpr (!bConstMat)
+				{
+					AABB3DfLoadMat_AVX<bColumn>(_mats, _mats + 16, mat);
+					_mats += 32;
+				}
+
+				AABB3DfTransform2_AVX<true>(mat, in, out);
+			}
+
+			if (i < _num)
+			{
+				if constexpr (!bConstMat)
+					AABB3DfLoadMat_AVX<bColumn>(_mats, _mats, mat);
+
+				AABB3DfTransform2_AVX<false>(mat, in, out);
+			}
+		}
+
+		template <bool bConstMat>
+		void AABB3DfTransformBatch_AVX(const float* _mats, const AABB3D<float>* _in, AABB3D<float>* _out, size_t _num, bool _bColumnMajor) noexcept
+		{
+			if (_bColumnMajor)
+				AABB3DfTransformMajor_AVX<bConstMat, true>(_mats, _in, _out, _num);
+			else
+				AABB3DfTransformMajor_AVX<bConstMat, false>(_mats, _in, _out, _num);
+		}
+
+//}
+
+
+//{ Double
+
+		/// Matrix columns (x, y, z, _) and absolute 3x3 columns.
+		struct AABB3DdMat_AVX
+		{
+			__m256d cols[4];
+			__m256d absCols[3];
+		};
+
+		template <bool bColumn>
+		inline void AABB3DdLoadMat_AVX(const double* _mat, AABB3DdMat_AVX& _res) noexcept
+		{
+			const __m256d r0 = _mm256_loadu_pd(_mat);
+			const __m256d r1 = _mm256_loadu_pd(_mat + 4);
+			const __m256d r2 = _mm256_loadu_pd(_mat + 8);
+			const __m256d r3 = _mm256_loadu_pd(_mat + 12);
+
+			if constexpr (bColumn)
+			{
+				_res.cols[0] = r0;
+				_res.cols[1] = r1;
+				_res.cols[2] = r2;
+				_res.cols[3] = r3;
+			}
+			else
+			{
+				// Row major: memory rows to columns.
+				const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+				const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+				const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+				const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+				_res.cols[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+				_res.cols[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+				_res.cols[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+				_res.cols[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+			}
+
+			const __m256d signMask = _mm256_set1_pd(-0.0);
+
+			_res.absCols[0] = _mm256_andnot_pd(signMask, _res.cols[0]);
+			_res.absCols[1] = _mm256_andnot_pd(signMask, _res.cols[1]);
+			_res.absCols[2] = _mm256_andnot_pd(signMask, _res.cols[2]);
+		}
+
+		/// Transform 1 box: same overlapping accesses as the float version with 4 double registers.
+		inline void AABB3DdTransform_AVX(const AABB3DdMat_AVX& _mat, const double* _in, double* _out) noexcept
+		{
+			const __m256d half = _mm256_set1_pd(0.5);
+
+			const __m256d bMin = _mm256_loadu_pd(_in);
+
+			// (min.z, max.x, max.y, max.z) shifted by one element: (max.x, max.y, max.z, max.z).
+			const __m256d bHi = _mm256_loadu_pd(_in + 2);
+			const __m256d bMax = _mm256_shuffle_pd(bHi, _mm256_permute2f128_pd(bHi, bHi, 0x11), 0xD);
+
+			const __m256d c = _mm256_mul_pd(_mm256_add_pd(bMin, bMax), half);
+			const __m256d e = _mm256_mul_pd(_mm256_sub_pd(bMax, bMin), half);
+
+			// Broadcast x, y from the low 128-bit lane and z from the high one: in-lane permutes only (AVX).
+			const __m256d cLo = _mm256_permute2f128_pd(c, c, 0x00);
+			const __m256d eLo = _mm256_permute2f128_pd(e, e, 0x00);
+
+			const __m256d oc = AABB3DMadd(_mat.cols[2], _mm256_permute_pd(_mm256_permute2f128_pd(c, c, 0x11), 0x0),
+				AABB3DMadd(_mat.cols[1], _mm256_permute_pd(cLo, 0xF),
+				AABB3DMadd(_mat.cols[0], _mm256_permute_pd(cLo, 0x0), _mat.cols[3])));
+
+			const __m256d oe = AABB3DMadd(_mat.absCols[2], _mm256_permute_pd(_mm256_permute2f128_pd(e, e, 0x11), 0x0),
+				AABB3DMadd(_mat.absCols[1], _mm256_permute_pd(eLo, 0xF),
+				_mm256_mul_pd(_mat.absCols[0], _mm256_permute_pd(eLo, 0x0))));
+
+			const __m256d oMin = _mm256_sub_pd(oc, oe);
+			const __m256d oMax = _mm256_add_pd(oc, oe);
+
+			// (min.z, max.x, max.y, max.z): overwrite the 4th double of the first store.
+			const __m256d oHi = _mm256_shuffle_pd(_mm256_permute2f128_pd(oMin, oMax, 0x21), oMax, 0x4);
+
+			_mm256_storeu_pd(_out, oMin);
+			_mm256_storeu_pd(_out + 2, oHi);
+		}
+
+		template <bool bConstMat, bool bColumn>
+		void AABB3DdTransformMajor_AVX(const double* _mats, const AABB3D<double>* _in, AABB3D<double>* _out, size_t _num) noexcept
+		{
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			AABB3DdMat_AVX mat;
+
+			if constexpr (bConstMat)
+				AABB3DdLoadMat_AVX<bColumn>(_mats, mat);
+
+			for (size_t i = 0; i < _num; ++i, in += 6, out += 6)
+			{
+				if constexpr (!bConstMat)
+				{
+					AABB3DdLoadMat_AVX<bColumn>(_mats, mat);
+					_mats += 16;
+				}
+
+				AABB3DdTransform_AVX(mat, in, out);
+			}
+		}
+
+		template <bool bConstMat>
+		void AABB3DdTransformBatch_AVX(const double* _mats, const AABB3D<double>* _in, AABB3D<double>* _out, size_t _num, bool _bColumnMajor) noexcept
+		{
+			if (_bColumnMajor)
+				AABB3DdTransformMajor_AVX<bConstMat, true>(_mats, _in, _out, _num);
+			else
+				AABB3DdTransformMajor_AVX<bConstMat, false>(_mats, _in, _out, _num);
+		}
+
+//}
+	}
+}
@@ -0,0 +1,255 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include "BatchKernels.hpp"
+
+#include <cmath>
+
+namespace SA::Intl
+{
+	namespace
+	{
+		/// Scalar "register": one vector per iteration, no tail loop.
+		template <typename T>
+		struct Vec3StreamPack
+		{
+			using Reg = T;
+			static constexpr size_t Width = 1u;
+
+			static Reg Load(const T* _p) noexcept { return *_p; }
+			static Reg LoadU(const T* _p) noexcept { return *_p; }
+			static void Store(T* _p, Reg _r) noexcept { *_p = _r; }
+			static void StoreU(T* _p, Reg _r) noexcept { *_p = _r; }
+			static Reg Set1(T _v) noexcept { return _v; }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _l + _r; }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _l - _r; }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _l * _r; }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _l / _r; }
+			static Reg Sqrt(Reg _r) noexcept { return std::sqrt(_r); }
+			static T ScalarSqrt(T _v) noexcept { return std::sqrt(_v); }
+			static Reg XorSign(Reg _v, Reg _s) noexcept { return std::signbit(_s) ? -_v : _v; }
+
+			static void StoreMat4(T* _out, const Reg* _elems) noexcept
+			{
+				for (size_t j = 0; j < 16u; ++j)
+					_out[j] = _elems[j];
+			}
+		};
+	}
+}
+
+#include "Vector3StreamKernels.inl"
+#include "TransformKernels.inl"
+#include "QuaternionKernels.inl"
+
+namespace SA::Intl
+{
+	namespace
+	{
+//{ Matrix4
+
+		template <bool bTranslate, typename T>
+		void Mat4TransformVec3_Scalar(const T* _mat, const Vec3<T>* _in, Vec3<T>* _out, size_t _num) noexcept
+		{
+			const T* in = reinterpret_cast<const T*>(_in);
+			T* out = reinterpret_cast<T*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 3, out += 3)
+			{
+				const T x = in[0];
+				const T y = in[1];
+				const T z = in[2];
+
+				out[0] = _mat[0] * x + _mat[1] * y + _mat[2] * z + (bTranslate ? _mat[3] : T(0));
+				out[1] = _mat[4] * x + _mat[5] * y + _mat[6] * z + (bTranslate ? _mat[7] : T(0));
+				out[2] = _mat[8] * x + _mat[9] * y + _mat[10] * z + (bTranslate ? _mat[11] : T(0));
+			}
+		}
+
+		template <typename T>
+		void Mat4TransformVec4_Scalar(const T* _mat, const Vec4<T>* _in, Vec4<T>* _out, size_t _num) noexcept
+		{
+			const T* in = reinterpret_cast<const T*>(_in);
+			T* out = reinterpret_cast<T*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 4, out += 4)
+			{
+				const T x = in[0];
+				const T y = in[1];
+				const T z = in[2];
+				const T w = in[3];
+
+				out[0] = _mat[0] * x + _mat[1] * y + _mat[2] * z + _mat[3] * w;
+				out[1] = _mat[4] * x + _mat[5] * y + _mat[6] * z + _mat[7] * w;
+				out[2] = _mat[8] * x + _mat[9] * y + _mat[10] * z + _mat[11] * w;
+				out[3] = _mat[12] * x + _mat[13] * y + _mat[14] * z + _mat[15] * w;
+			}
+		}
+
+		template <bool bConstA, bool bConstB, typename T>
+		void Mat4MultiplyBatch_Scalar(const T* _a, const T* _b, T* _c, size_t _num) noexcept
+		{
+			for (size_t i = 0; i < _num; ++i, _c += 16)
+			{
+				// Compute in temporary before store: _c may alias _a or _b.
+				T res[16];
+
+				for (size_t r = 0; r < 4u; ++r)
+				{
+					for (size_t c = 0; c < 4u; ++c)
+						res[r * 4 + c] = _a[r * 4] * _b[c] + _a[r * 4 + 1] * _b[4 + c] + _a[r * 4 + 2] * _b[8 + c] + _a[r * 4 + 3] * _b[12 + c];
+				}
+
+				for (size_t j = 0; j < 16u; ++j)
+					_c[j] = res[j];
+
+				if constexpr (!bConstA)
+					_a += 16;
+
+				if constexpr (!bConstB)
+					_b += 16;
+			}
+		}
+
+//}
+
+//{ AABB3D
+
+		template <bool bConstMat, bool bColumn, typename T>
+		void AABB3DTransformMajor_Scalar(const T* _mats, const AABB3D<T>* _in, AABB3D<T>* _out, size_t _num) noexcept
+		{
+			// Element index in memory order.
+			constexpr auto Index = [](size_t _r, size_t _c) { return bColumn ? _c * 4 + _r : _r * 4 + _c; };
+
+			const T* in = reinterpret_cast<const T*>(_in);
+			T* out = reinterpret_cast<T*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 6, out += 6)
+			{
+				const T c[3] = { (in[0] + in[3]) * T(0.5), (in[1] + in[4]) * T(0.5), (in[2] + in[5]) * T(0.5) };
+				const T e[3] = { (in[3] - in[0]) * T(0.5), (in[4] - in[1]) * T(0.5), (in[5] - in[2]) * T(0.5) };
+
+				for (size_t r = 0; r < 3u; ++r)
+				{
+					const T oc = _mats[Index(r, 0)] * c[0] + _mats[Index(r, 1)] * c[1] + _mats[Index(r, 2)] * c[2] + _mats[Index(r, 3)];
+					const T oe = std::abs(_mats[Index(r, 0)]) * e[0] + std::abs(_mats[Index(r, 1)]) * e[1] + std::abs(_mats[Index(r, 2)]) * e[2];
+
+					out[r] = oc - oe;
+					out[r + 3] = oc + oe;
+				}
+
+				if constexpr (!bConstMat)
+					_mats += 16;
+			}
+		}
+
+		template <bool bConstMat, typename T>
+		void AABB3DTransformBatch_Scalar(const T* _mats, const AABB3D<T>* _in, AABB3D<T>* _out, size_t _num, bool _bColumnMajor) noexcept
+		{
+			if (_bColumnMajor)
+				AABB3DTransformMajor_Scalar<bConstMat, true>(_mats, _in, _out, _num);
+			else
+				AABB3DTransformMajor_Scalar<bConstMat, false>(_mats, _in, _out, _num);
+		}
+
+//}
+
+		template <typename T>
+		const BatchKernels<T>& MakeBatchKernelsScalar() noexcept
+		{
+			static constexpr BatchKernels<T> kernels{
+				&Mat4TransformVec3_Scalar<true, T>,
+				&Mat4TransformVec3_Scalar<false, T>,
+				&Mat4TransformVec4_Scalar<T>,
+				&Mat4MultiplyBatch_Scalar<false, false, T>,
+				&Mat4MultiplyBatch_Scalar<true, false, T>,
+				&Mat4MultiplyBatch_Scalar<false, true, T>,
+
+				&Vec3StreamAdd<T>,
+				&Vec3StreamSub<T>,
+				&Vec3StreamAddBroadcast<T>,
+				&Vec3StreamScale<T>,
+				&Vec3StreamNormalize<T>,
+				&Vec3StreamDot<T>,
+				&Vec3StreamCross<T>,
+				&Vec3StreamDist<T>,
+				&Vec3StreamLerp<T>,
+
+				&TrTRSMatrixBatch<T>,
+
+				&QuatNLerp<T>,
+				&QuatSLerp<T>,
+				&QuatSLerpApprox<T>,
+
+				&QuatStreamNormalize<T>,
+				&QuatStreamDot<T>,
+				&QuatStreamMultiply<T>,
+				&QuatStreamRotate<false, T>,
+				&QuatStreamRotate<true, T>,
+
+				&AABB3DTransformBatch_Scalar<false, T>,
+				&AABB3DTransformBatch_Scalar<true, T>,
+			};
+
+			return kernels;
+		}
+	}
+
+
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsScalar() noexcept
+	{
+		return MakeBatchKernelsScalar<T>();
+	}
+
+	template const BatchKernels<float>& GetBatchKernelsScalar<float>() noexcept;
+	template const BatchKernels<double>& GetBatchKernelsScalar<double>() noexcept;
+
+
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernels() noexcept
+	{
+#if SA_MATHS_RUNTIME_DISPATCH
+
+		switch (Maths::GetSIMDLevel())
+		{
+	#if SA_MATHS_BATCH_KERNELS_AVX512
+			case Maths::SIMDLevel::AVX512:
+				return GetBatchKernelsAVX512<T>();
+	#endif
+	#if SA_MATHS_BATCH_KERNELS_AVX
+		#if !SA_MATHS_BATCH_KERNELS_AVX512
+			case Maths::SIMDLevel::AVX512:	// AVX-512 kernels disabled: use AVX2.
+		#endif
+			case Maths::SIMDLevel::AVX2:
+				return GetBatchKernelsAVX<T>();
+	#endif
+	#if SA_MATHS_BATCH_KERNELS_SSE
+			case Maths::SIMDLevel::SSE41:
+				return GetBatchKernelsSSE<T>();
+	#endif
+			default:
+				return GetBatchKernelsScalar<T>();
+		}
+
+#elif SA_MATHS_BATCH_KERNELS_AVX512
+
+		return GetBatchKernelsAVX512<T>();
+
+#elif SA_MATHS_BATCH_KERNELS_AVX
+
+		return GetBatchKernelsAVX<T>();
+
+#elif SA_MATHS_BATCH_KERNELS_SSE
+
+		return GetBatchKernelsSSE<T>();
+
+#else
+
+		return GetBatchKernelsScalar<T>();
+
+#endif
+	}
+
+	template const BatchKernels<float>& GetBatchKernels<float>() noexcept;
+	template const BatchKernels<double>& GetBatchKernels<double>() noexcept;
+}
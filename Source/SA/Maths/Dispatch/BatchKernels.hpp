@@ -0,0 +1,210 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_BATCH_KERNELS_GUARD
+#define SAPPHIRE_MATHS_BATCH_KERNELS_GUARD
+
+#include <cstddef>
+
+#include <SA/Maths/Config.hpp>
+#include <SA/Maths/Dispatch/CPUFeatures.hpp>
+
+#include <SA/Maths/Space/Vector3.hpp>
+#include <SA/Maths/Space/Vector4.hpp>
+
+#if SA_MATHS_INTRINSICS_OPT
+
+	#include <SA/Support/Intrinsics.hpp>
+
+#endif
+
+/// Whether SSE4.1 / AVX / AVX-512 kernels tables are built (BatchKernelsSSE.cpp / BatchKernelsAVX.cpp / BatchKernelsAVX512.cpp).
+#if SA_MATHS_RUNTIME_DISPATCH && (defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+
+	#define SA_MATHS_BATCH_KERNELS_SSE 1
+	#define SA_MATHS_BATCH_KERNELS_AVX 1
+	#define SA_MATHS_BATCH_KERNELS_AVX512 SA_MATHS_MATRIX4_AVX512
+
+#else
+
+	#define SA_MATHS_BATCH_KERNELS_SSE SA_INTRISC_SSE
+	#define SA_MATHS_BATCH_KERNELS_AVX SA_INTRISC_AVX
+	#define SA_MATHS_BATCH_KERNELS_AVX512 (SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512)
+
+#endif
+
+/**
+*	\file BatchKernels.hpp
+*
+*	\brief Internal <b>batch kernels</b> function tables.
+*
+*	One table per instruction set, each implemented in its own translation unit
+*	(BatchKernels<ISA>.cpp) so it can be compiled with its own target flags.
+*	Matrices are given as memory-order (row major) element pointers.
+*
+*	\ingroup Maths_Dispatch
+*	\{
+*/
+
+
+namespace SA
+{
+	template <typename T>
+	struct AABB3D;
+}
+
+namespace SA::Intl
+{
+	template <typename T>
+	struct BatchKernels
+	{
+//{ Matrix4
+
+		/// _out[i] = _mat * (_in[i], 1) (affine).
+		void (*mat4TransformPoints)(const T* _mat, const Vec3<T>* _in, Vec3<T>* _out, size_t _num) noexcept;
+
+		/// _out[i] = _mat * (_in[i], 0).
+		void (*mat4TransformDirections)(const T* _mat, const Vec3<T>* _in, Vec3<T>* _out, size_t _num) noexcept;
+
+		/// _out[i] = _mat * _in[i].
+		void (*mat4TransformVec4)(const T* _mat, const Vec4<T>* _in, Vec4<T>* _out, size_t _num) noexcept;
+
+
+		/// _c[i] = _a[i] * _b[i].
+		void (*mat4Multiply)(const T* _a, const T* _b, T* _c, size_t _num) noexcept;
+
+		/// _c[i] = _a * _b[i].
+		void (*mat4MultiplyConstA)(const T* _a, const T* _b, T* _c, size_t _num) noexcept;
+
+		/// _c[i] = _a[i] * _b.
+		void (*mat4MultiplyConstB)(const T* _a, const T* _b, T* _c, size_t _num) noexcept;
+
+//}
+
+//{ Vector3 Stream
+
+		void (*vec3StreamAdd)(T* _x, T* _y, T* _z, const T* _rx, const T* _ry, const T* _rz, size_t _num) noexcept;
+
+		void (*vec3StreamSub)(T* _x, T* _y, T* _z, const T* _rx, const T* _ry, const T* _rz, size_t _num) noexcept;
+
+		void (*vec3StreamAddBroadcast)(T* _x, T* _y, T* _z, const Vec3<T>& _rhs, size_t _num) noexcept;
+
+		void (*vec3StreamScale)(T* _x, T* _y, T* _z, T _scale, size_t _num) noexcept;
+
+		void (*vec3StreamNormalize)(T* _x, T* _y, T* _z, size_t _num) noexcept;
+
+		void (*vec3StreamDot)(const T* _lx, const T* _ly, const T* _lz,
+			const T* _rx, const T* _ry, const T* _rz, T* _out, size_t _num) noexcept;
+
+		void (*vec3StreamCross)(const T* _lx, const T* _ly, const T* _lz,
+			const T* _rx, const T* _ry, const T* _rz,
+			T* _ox, T* _oy, T* _oz, size_t _num) noexcept;
+
+		void (*vec3StreamDist)(const T* _sx, const T* _sy, const T* _sz,
+			const T* _ex, const T* _ey, const T* _ez, T* _out, size_t _num) noexcept;
+
+		void (*vec3StreamLerp)(const T* _sx, const T* _sy, const T* _sz,
+			const T* _ex, const T* _ey, const T* _ez,
+			T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept;
+
+//}
+
+//{ Transform
+
+		/// _out[i] = TRS matrix from position _p[i], rotation quaternion _r[i] and scale _s[i] (TrTRSMatrixFunctor), stored in memory order.
+		void (*trTRSMatrix)(const T* _px, const T* _py, const T* _pz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz,
+			const T* _sx, const T* _sy, const T* _sz,
+			T* _out, size_t _num, bool _bColumnMajor) noexcept;
+
+//}
+
+//{ Quaternion
+
+		/// _o[i] = normalized lerp from _s[i] to _e[i] at _alpha, shortest path (Quat::NLerpBatch).
+		void (*quatNLerp)(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept;
+
+		/// _o[i] = slerp from _s[i] to _e[i] at _alpha, shortest path (Quat::SLerpBatch, SLerpPrecision::Exact).
+		void (*quatSLerp)(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept;
+
+		/// _o[i] = polynomial slerp from _s[i] to _e[i] at _alpha, shortest path (Quat::SLerpBatch, SLerpPrecision::Approx).
+		void (*quatSLerpApprox)(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept;
+
+//}
+
+//{ Quaternion Stream
+
+		void (*quatStreamNormalize)(T* _w, T* _x, T* _y, T* _z, size_t _num) noexcept;
+
+		void (*quatStreamDot)(const T* _lw, const T* _lx, const T* _ly, const T* _lz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz, T* _out, size_t _num) noexcept;
+
+		/// _o[i] = _l[i] * _r[i] (Hamilton product).
+		void (*quatStreamMultiply)(const T* _lw, const T* _lx, const T* _ly, const T* _lz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz,
+			T* _ow, T* _ox, T* _oy, T* _oz, size_t _num) noexcept;
+
+		/// _o[i] = _v[i] rotated by _q[i].
+		void (*quatStreamRotate)(const T* _qw, const T* _qx, const T* _qy, const T* _qz,
+			const T* _vx, const T* _vy, const T* _vz,
+			T* _ox, T* _oy, T* _oz, size_t _num) noexcept;
+
+		/// _o[i] = _v[i] un-rotated by _q[i].
+		void (*quatStreamUnRotate)(const T* _qw, const T* _qx, const T* _qy, const T* _qz,
+			const T* _vx, const T* _vy, const T* _vz,
+			T* _ox, T* _oy, T* _oz, size_t _num) noexcept;
+
+//}
+
+//{ AABB3D
+
+		/// _out[i] = _in[i] transformed by _mats[i] (Arvo method, AABB3D::Transform), matrices stored in memory order.
+		void (*aabb3DTransform)(const T* _mats, const AABB3D<T>* _in, AABB3D<T>* _out, size_t _num, bool _bColumnMajor) noexcept;
+
+		/// _out[i] = _in[i] transformed by _mat (Arvo method, AABB3D::Transform), matrix stored in memory order.
+		void (*aabb3DTransformConstMat)(const T* _mat, const AABB3D<T>* _in, AABB3D<T>* _out, size_t _num, bool _bColumnMajor) noexcept;
+
+//}
+	};
+
+
+	/// Plain C++ kernels (BatchKernels.cpp).
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsScalar() noexcept;
+
+	/// SSE4.1 kernels (BatchKernelsSSE.cpp).
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsSSE() noexcept;
+
+	/// AVX kernels, using FMA3 when available (BatchKernelsAVX.cpp).
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsAVX() noexcept;
+
+	/// AVX-512F kernels (BatchKernelsAVX512.cpp).
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsAVX512() noexcept;
+
+
+	/**
+	*	\brief Get the kernels table to use.
+	*
+	*	With SA_MATHS_RUNTIME_DISPATCH: table of Maths::GetSIMDLevel().
+	*	Otherwise: best table enabled by the compilation flags.
+	*
+	*	\return kernels table.
+	*/
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernels() noexcept;
+}
+
+
+/** \} */
+
+#endif // GUARD
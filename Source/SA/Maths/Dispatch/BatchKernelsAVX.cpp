@@ -0,0 +1,513 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include "BatchKernels.hpp"
+
+#if SA_MATHS_BATCH_KERNELS_AVX
+
+/*
+*	AVX kernels (AVX2 + FMA3 flags with SA_MATHS_RUNTIME_DISPATCH).
+*	With SA_MATHS_RUNTIME_DISPATCH, this translation unit is the only one built with AVX2 flags:
+*	only use intrinsics and plain arithmetic here, inline functions from other headers
+*	would be emitted with these flags and could be picked by the linker for the whole program.
+*/
+
+#include <cmath>
+
+#include <immintrin.h>
+
+namespace SA::Intl
+{
+	namespace
+	{
+		template <typename T>
+		struct Vec3StreamPack;
+
+		template <>
+		struct Vec3StreamPack<float>
+		{
+			using Reg = __m256;
+			static constexpr size_t Width = 8u;
+
+			static Reg Load(const float* _p) noexcept { return _mm256_load_ps(_p); }
+			static Reg LoadU(const float* _p) noexcept { return _mm256_loadu_ps(_p); }
+			static void Store(float* _p, Reg _r) noexcept { _mm256_store_ps(_p, _r); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm256_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm256_set1_ps(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_ps(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm256_sqrt_ps(_r); }
+			static float ScalarSqrt(float _v) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(_v))); }
+			static Reg XorSign(Reg _v, Reg _s) noexcept { return _mm256_xor_ps(_v, _mm256_and_ps(_s, _mm256_set1_ps(-0.0f))); }
+
+			/// 16 element registers (one matrix per lane) to 8 matrices: 4x4 transpose per row and 128-bit lane.
+			static void StoreMat4(float* _out, const Reg* _elems) noexcept
+			{
+				for (size_t r = 0; r < 4u; ++r)
+				{
+					const Reg t0 = _mm256_unpacklo_ps(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t1 = _mm256_unpackhi_ps(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t2 = _mm256_unpacklo_ps(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+					const Reg t3 = _mm256_unpackhi_ps(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+
+					// Matrix k in low 128-bit lane, matrix k + 4 in high lane.
+					const Reg rows[4] = {
+						_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)),
+						_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+						_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+						_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)),
+					};
+
+					for (size_t k = 0; k < 4u; ++k)
+					{
+						_mm_storeu_ps(_out + k * 16 + r * 4, _mm256_castps256_ps128(rows[k]));
+						_mm_storeu_ps(_out + (k + 4) * 16 + r * 4, _mm256_extractf128_ps(rows[k], 1));
+					}
+				}
+			}
+		};
+
+		template <>
+		struct Vec3StreamPack<double>
+		{
+			using Reg = __m256d;
+			static constexpr size_t Width = 4u;
+
+			static Reg Load(const double* _p) noexcept { return _mm256_load_pd(_p); }
+			static Reg LoadU(const double* _p) noexcept { return _mm256_loadu_pd(_p); }
+			static void Store(double* _p, Reg _r) noexcept { _mm256_store_pd(_p, _r); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm256_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm256_set1_pd(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm256_div_pd(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm256_sqrt_pd(_r); }
+			static double ScalarSqrt(double _v) noexcept { return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(_v))); }
+			static Reg XorSign(Reg _v, Reg _s) noexcept { return _mm256_xor_pd(_v, _mm256_and_pd(_s, _mm256_set1_pd(-0.0))); }
+
+			/// 16 element registers (one matrix per lane) to 4 matrices: 4x4 transpose per row.
+			static void StoreMat4(double* _out, const Reg* _elems) noexcept
+			{
+				for (size_t r = 0; r < 4u; ++r)
+				{
+					const Reg t0 = _mm256_unpacklo_pd(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t1 = _mm256_unpackhi_pd(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t2 = _mm256_unpacklo_pd(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+					const Reg t3 = _mm256_unpackhi_pd(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+
+					_mm256_storeu_pd(_out + r * 4, _mm256_permute2f128_pd(t0, t2, 0x20));
+					_mm256_storeu_pd(_out + 16 + r * 4, _mm256_permute2f128_pd(t1, t3, 0x20));
+					_mm256_storeu_pd(_out + 32 + r * 4, _mm256_permute2f128_pd(t0, t2, 0x31));
+					_mm256_storeu_pd(_out + 48 + r * 4, _mm256_permute2f128_pd(t1, t3, 0x31));
+				}
+			}
+		};
+	}
+}
+
+#include "Vector3StreamKernels.inl"
+#include "TransformKernels.inl"
+#include "QuaternionKernels.inl"
+#include "AABB3DKernelsAVX.inl"
+
+namespace SA::Intl
+{
+	namespace
+	{
+//{ Float
+
+		/**
+		*	Transform 8 Vec3 per iteration.
+		*	Vectors are deinterleaved to X, Y, Z registers (one vector per lane) so each matrix element
+		*	is broadcast once for the whole array.
+		*/
+		template <bool bTranslate>
+		void Mat4fTransformVec3_AVX(const float* _mat, const Vec3<float>* _in, Vec3<float>* _out, size_t _num) noexcept
+		{
+			const __m256 m00 = _mm256_set1_ps(_mat[0]);
+			const __m256 m01 = _mm256_set1_ps(_mat[1]);
+			const __m256 m02 = _mm256_set1_ps(_mat[2]);
+			const __m256 m10 = _mm256_set1_ps(_mat[4]);
+			const __m256 m11 = _mm256_set1_ps(_mat[5]);
+			const __m256 m12 = _mm256_set1_ps(_mat[6]);
+			const __m256 m20 = _mm256_set1_ps(_mat[8]);
+			const __m256 m21 = _mm256_set1_ps(_mat[9]);
+			const __m256 m22 = _mm256_set1_ps(_mat[10]);
+
+			const __m256 t0 = _mm256_set1_ps(bTranslate ? _mat[3] : 0.0f);
+			const __m256 t1 = _mm256_set1_ps(bTranslate ? _mat[7] : 0.0f);
+			const __m256 t2 = _mm256_set1_ps(bTranslate ? _mat[11] : 0.0f);
+
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			size_t i = 0;
+
+			for (; i + 8u <= _num; i += 8u, in += 24, out += 24)
+			{
+				// Vectors 0-3 in low lane, 4-7 in high lane: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3].
+				const __m256 l0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in)), _mm_loadu_ps(in + 12), 1);
+				const __m256 l1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 4)), _mm_loadu_ps(in + 16), 1);
+				const __m256 l2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 8)), _mm_loadu_ps(in + 20), 1);
+
+				const __m256 t = _mm256_shuffle_ps(l1, l2, _MM_SHUFFLE(2, 1, 3, 2));
+				const __m256 u = _mm256_shuffle_ps(l0, l1, _MM_SHUFFLE(1, 0, 2, 1));
+
+				const __m256 x = _mm256_shuffle_ps(l0, t, _MM_SHUFFLE(2, 0, 3, 0));
+				const __m256 y = _mm256_shuffle_ps(u, t, _MM_SHUFFLE(3, 1, 2, 0));
+				const __m256 z = _mm256_shuffle_ps(u, l2, _MM_SHUFFLE(3, 0, 3, 1));
+
+				const __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m00, x), _mm256_mul_ps(m01, y)), _mm256_add_ps(_mm256_mul_ps(m02, z), t0));
+				const __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m10, x), _mm256_mul_ps(m11, y)), _mm256_add_ps(_mm256_mul_ps(m12, z), t1));
+				const __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m20, x), _mm256_mul_ps(m21, y)), _mm256_add_ps(_mm256_mul_ps(m22, z), t2));
+
+				// Interleave back.
+				const __m256 a = _mm256_shuffle_ps(_mm256_shuffle_ps(rx, ry, _MM_SHUFFLE(1, 0, 1, 0)), _mm256_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+				const __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+				const __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+				_mm256_storeu_ps(out, _mm256_permute2f128_ps(a, b, 0x20));
+				_mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(c, a, 0x30));
+				_mm256_storeu_ps(out + 16, _mm256_permute2f128_ps(b, c, 0x31));
+			}
+
+			for (; i < _num; ++i, in += 3, out += 3)
+			{
+				const float x = in[0];
+				const float y = in[1];
+				const float z = in[2];
+
+				out[0] = _mat[0] * x + _mat[1] * y + _mat[2] * z + (bTranslate ? _mat[3] : 0.0f);
+				out[1] = _mat[4] * x + _mat[5] * y + _mat[6] * z + (bTranslate ? _mat[7] : 0.0f);
+				out[2] = _mat[8] * x + _mat[9] * y + _mat[10] * z + (bTranslate ? _mat[11] : 0.0f);
+			}
+		}
+
+		/**
+		*	Transform 2 Vec4 per iteration.
+		*	Matrix columns are loaded once and duplicated in both lanes, each vector component is broadcast in-lane.
+		*/
+		void Mat4fTransformVec4_AVX(const float* _mat, const Vec4<float>* _in, Vec4<float>* _out, size_t _num) noexcept
+		{
+			const __m256 c0 = _mm256_setr_ps(_mat[0], _mat[4], _mat[8], _mat[12], _mat[0], _mat[4], _mat[8], _mat[12]);
+			const __m256 c1 = _mm256_setr_ps(_mat[1], _mat[5], _mat[9], _mat[13], _mat[1], _mat[5], _mat[9], _mat[13]);
+			const __m256 c2 = _mm256_setr_ps(_mat[2], _mat[6], _mat[10], _mat[14], _mat[2], _mat[6], _mat[10], _mat[14]);
+			const __m256 c3 = _mm256_setr_ps(_mat[3], _mat[7], _mat[11], _mat[15], _mat[3], _mat[7], _mat[11], _mat[15]);
+
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			size_t i = 0;
+
+			for (; i + 2u <= _num; i += 2u, in += 8, out += 8)
+			{
+				const __m256 v = _mm256_loadu_ps(in);
+
+				const __m256 r01 = _mm256_add_ps(_mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00)), _mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55)));
+				const __m256 r23 = _mm256_add_ps(_mm256_mul_ps(c2, _mm256_permute_ps(v, 0xAA)), _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF)));
+
+				_mm256_storeu_ps(out, _mm256_add_ps(r01, r23));
+			}
+
+			if (i < _num)
+			{
+				const __m128 v = _mm_loadu_ps(in);
+
+				const __m128 r01 = _mm_add_ps(_mm_mul_ps(_mm256_castps256_ps128(c0), _mm_permute_ps(v, 0x00)), _mm_mul_ps(_mm256_castps256_ps128(c1), _mm_permute_ps(v, 0x55)));
+				const __m128 r23 = _mm_add_ps(_mm_mul_ps(_mm256_castps256_ps128(c2), _mm_permute_ps(v, 0xAA)), _mm_mul_ps(_mm256_castps256_ps128(c3), _mm_permute_ps(v, 0xFF)));
+
+				_mm_storeu_ps(out, _mm_add_ps(r01, r23));
+			}
+		}
+
+//}
+
+//{ Double
+
+		/**
+		*	Transform 1 Vec3 per iteration: matrix columns are loaded once, vector components are broadcast.
+		*	Masked store writes only x, y, z.
+		*/
+		template <bool bTranslate>
+		void Mat4dTransformVec3_AVX(const double* _mat, const Vec3<double>* _in, Vec3<double>* _out, size_t _num) noexcept
+		{
+			const __m256d c0 = _mm256_setr_pd(_mat[0], _mat[4], _mat[8], 0.0);
+			const __m256d c1 = _mm256_setr_pd(_mat[1], _mat[5], _mat[9], 0.0);
+			const __m256d c2 = _mm256_setr_pd(_mat[2], _mat[6], _mat[10], 0.0);
+			const __m256d c3 = bTranslate ? _mm256_setr_pd(_mat[3], _mat[7], _mat[11], 0.0) : _mm256_setzero_pd();
+
+			const __m256i storeMask = _mm256_setr_epi64x(-1, -1, -1, 0);
+
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 3, out += 3)
+			{
+
+				const __m256d r01 = _mm256_add_pd(_mm256_mul_pd(c0, _mm256_broadcast_sd(in)), _mm256_mul_pd(c1, _mm256_broadcast_sd(in + 1)));
+				const __m256d r23 = _mm256_add_pd(_mm256_mul_pd(c2, _mm256_broadcast_sd(in + 2)), c3);
+
+				_mm256_maskstore_pd(out, storeMask, _mm256_add_pd(r01, r23));
+			}
+		}
+
+		/// Transform 1 Vec4 per iteration: matrix columns are loaded once, vector components are broadcast.
+		void Mat4dTransformVec4_AVX(const double* _mat, const Vec4<double>* _in, Vec4<double>* _out, size_t _num) noexcept
+		{
+			const __m256d c0 = _mm256_setr_pd(_mat[0], _mat[4], _mat[8], _mat[12]);
+			const __m256d c1 = _mm256_setr_pd(_mat[1], _mat[5], _mat[9], _mat[13]);
+			const __m256d c2 = _mm256_setr_pd(_mat[2], _mat[6], _mat[10], _mat[14]);
+			const __m256d c3 = _mm256_setr_pd(_mat[3], _mat[7], _mat[11], _mat[15]);
+
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 4, out += 4)
+			{
+
+				const __m256d r01 = _mm256_add_pd(_mm256_mul_pd(c0, _mm256_broadcast_sd(in)), _mm256_mul_pd(c1, _mm256_broadcast_sd(in + 1)));
+				const __m256d r23 = _mm256_add_pd(_mm256_mul_pd(c2, _mm256_broadcast_sd(in + 2)), _mm256_mul_pd(c3, _mm256_broadcast_sd(in + 3)));
+
+				_mm256_storeu_pd(out, _mm256_add_pd(r01, r23));
+			}
+		}
+
+//}
+
+//{ Multiply
+
+		/// Multiply-add helper: use FMA3 when available (SA_INTRISC_FMA).
+		inline __m256 Mat4Madd(__m256 _a, __m256 _b, __m256 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmadd_ps(_a, _b, _c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+		}
+
+		/// \copydoc Mat4Madd
+		inline __m256d Mat4Madd(__m256d _a, __m256d _b, __m256d _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmadd_pd(_a, _b, _c);
+#else
+			return _mm256_add_pd(_mm256_mul_pd(_a, _b), _c);
+#endif
+		}
+
+
+		/**
+		*	Memory-order (row major) kernels: C = A * B.
+		*	Column major matrices use the same kernel with swapped operands: (A * B)^T = B^T * A^T.
+		*
+		*	Float: compute 2 rows of C per register.
+		*	A elements are broadcast in-lane, B rows are duplicated in both lanes.
+		*/
+		inline void Mat4fMulLoadA(const float* _a, __m256 (&_res)[8]) noexcept
+		{
+			const __m256 a01 = _mm256_loadu_ps(_a);
+			const __m256 a23 = _mm256_loadu_ps(_a + 8);
+
+			_res[0] = _mm256_permute_ps(a01, 0x00);
+			_res[1] = _mm256_permute_ps(a01, 0x55);
+			_res[2] = _mm256_permute_ps(a01, 0xAA);
+			_res[3] = _mm256_permute_ps(a01, 0xFF);
+
+			_res[4] = _mm256_permute_ps(a23, 0x00);
+			_res[5] = _mm256_permute_ps(a23, 0x55);
+			_res[6] = _mm256_permute_ps(a23, 0xAA);
+			_res[7] = _mm256_permute_ps(a23, 0xFF);
+		}
+
+		inline void Mat4fMulLoadB(const float* _b, __m256 (&_res)[4]) noexcept
+		{
+			_res[0] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(_b));
+			_res[1] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(_b + 4));
+			_res[2] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(_b + 8));
+			_res[3] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(_b + 12));
+		}
+
+		inline void Mat4fMul(const __m256 (&_a)[8], const __m256 (&_b)[4], float* _c) noexcept
+		{
+			// Row 0 and 1.
+			_mm256_storeu_ps(_c, _mm256_add_ps(
+				Mat4Madd(_a[1], _b[1], _mm256_mul_ps(_a[0], _b[0])),
+				Mat4Madd(_a[3], _b[3], _mm256_mul_ps(_a[2], _b[2]))
+			));
+
+			// Row 2 and 3.
+			_mm256_storeu_ps(_c + 8, _mm256_add_ps(
+				Mat4Madd(_a[5], _b[1], _mm256_mul_ps(_a[4], _b[0])),
+				Mat4Madd(_a[7], _b[3], _mm256_mul_ps(_a[6], _b[2]))
+			));
+		}
+
+		template <bool bConstA, bool bConstB>
+		void Mat4fMultiplyBatch_AVX(const float* _a, const float* _b, float* _c, size_t _num) noexcept
+		{
+			__m256 a[8];
+			__m256 b[4];
+
+			if constexpr (bConstA)
+				Mat4fMulLoadA(_a, a);
+
+			if constexpr (bConstB)
+				Mat4fMulLoadB(_b, b);
+
+			for (size_t i = 0; i < _num; ++i, _c += 16)
+			{
+				if constexpr (!bConstA)
+				{
+					Mat4fMulLoadA(_a, a);
+					_a += 16;
+				}
+
+				if constexpr (!bConstB)
+				{
+					Mat4fMulLoadB(_b, b);
+					_b += 16;
+				}
+
+				Mat4fMul(a, b, _c);
+			}
+		}
+
+
+		/**
+		*	Double: compute 1 row of C per register.
+		*	B rows are loaded in registers, A elements are broadcast from memory.
+		*/
+		inline void Mat4dMulLoadB(const double* _b, __m256d (&_res)[4]) noexcept
+		{
+			_res[0] = _mm256_loadu_pd(_b);
+			_res[1] = _mm256_loadu_pd(_b + 4);
+			_res[2] = _mm256_loadu_pd(_b + 8);
+			_res[3] = _mm256_loadu_pd(_b + 12);
+		}
+
+		inline __m256d Mat4dMulRow(const double* _aRow, const __m256d (&_b)[4]) noexcept
+		{
+			return _mm256_add_pd(
+				Mat4Madd(_mm256_broadcast_sd(_aRow + 1), _b[1], _mm256_mul_pd(_mm256_broadcast_sd(_aRow), _b[0])),
+				Mat4Madd(_mm256_broadcast_sd(_aRow + 3), _b[3], _mm256_mul_pd(_mm256_broadcast_sd(_aRow + 2), _b[2]))
+			);
+		}
+
+		template <bool bConstA, bool bConstB>
+		void Mat4dMultiplyBatch_AVX(const double* _a, const double* _b, double* _c, size_t _num) noexcept
+		{
+			__m256d b[4];
+
+			if constexpr (bConstB)
+				Mat4dMulLoadB(_b, b);
+
+			for (size_t i = 0; i < _num; ++i, _c += 16)
+			{
+				if constexpr (!bConstB)
+				{
+					Mat4dMulLoadB(_b, b);
+					_b += 16;
+				}
+
+				// Compute every row before store: _c may alias _a.
+				const __m256d c0 = Mat4dMulRow(_a, b);
+				const __m256d c1 = Mat4dMulRow(_a + 4, b);
+				const __m256d c2 = Mat4dMulRow(_a + 8, b);
+				const __m256d c3 = Mat4dMulRow(_a + 12, b);
+
+				_mm256_storeu_pd(_c, c0);
+				_mm256_storeu_pd(_c + 4, c1);
+				_mm256_storeu_pd(_c + 8, c2);
+				_mm256_storeu_pd(_c + 12, c3);
+
+				if constexpr (!bConstA)
+					_a += 16;
+			}
+		}
+
+//}
+
+
+		template <typename T>
+		struct Mat4KernelsAVX;
+
+		template <>
+		struct Mat4KernelsAVX<float>
+		{
+			static constexpr auto transformPoints = &Mat4fTransformVec3_AVX<true>;
+			static constexpr auto transformDirections = &Mat4fTransformVec3_AVX<false>;
+			static constexpr auto transformVec4 = &Mat4fTransformVec4_AVX;
+			static constexpr auto multiply = &Mat4fMultiplyBatch_AVX<false, false>;
+			static constexpr auto multiplyConstA = &Mat4fMultiplyBatch_AVX<true, false>;
+			static constexpr auto multiplyConstB = &Mat4fMultiplyBatch_AVX<false, true>;
+
+			static constexpr auto aabb3DTransform = &AABB3DfTransformBatch_AVX<false>;
+			static constexpr auto aabb3DTransformConstMat = &AABB3DfTransformBatch_AVX<true>;
+		};
+
+		template <>
+		struct Mat4KernelsAVX<double>
+		{
+			static constexpr auto transformPoints = &Mat4dTransformVec3_AVX<true>;
+			static constexpr auto transformDirections = &Mat4dTransformVec3_AVX<false>;
+			static constexpr auto transformVec4 = &Mat4dTransformVec4_AVX;
+			static constexpr auto multiply = &Mat4dMultiplyBatch_AVX<false, false>;
+			static constexpr auto multiplyConstA = &Mat4dMultiplyBatch_AVX<true, false>;
+			static constexpr auto multiplyConstB = &Mat4dMultiplyBatch_AVX<false, true>;
+
+			static constexpr auto aabb3DTransform = &AABB3DdTransformBatch_AVX<false>;
+			static constexpr auto aabb3DTransformConstMat = &AABB3DdTransformBatch_AVX<true>;
+		};
+	}
+
+
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsAVX() noexcept
+	{
+		using M = Mat4KernelsAVX<T>;
+
+		static constexpr BatchKernels<T> kernels{
+			M::transformPoints,
+			M::transformDirections,
+			M::transformVec4,
+			M::multiply,
+			M::multiplyConstA,
+			M::multiplyConstB,
+
+			&Vec3StreamAdd<T>,
+			&Vec3StreamSub<T>,
+			&Vec3StreamAddBroadcast<T>,
+			&Vec3StreamScale<T>,
+			&Vec3StreamNormalize<T>,
+			&Vec3StreamDot<T>,
+			&Vec3StreamCross<T>,
+			&Vec3StreamDist<T>,
+			&Vec3StreamLerp<T>,
+
+			&TrTRSMatrixBatch<T>,
+
+			&QuatNLerp<T>,
+			&QuatSLerp<T>,
+			&QuatSLerpApprox<T>,
+
+			&QuatStreamNormalize<T>,
+			&QuatStreamDot<T>,
+			&QuatStreamMultiply<T>,
+			&QuatStreamRotate<false, T>,
+			&QuatStreamRotate<true, T>,
+
+			M::aabb3DTransform,
+			M::aabb3DTransformConstMat,
+		};
+
+		return kernels;
+	}
+
+	template const BatchKernels<float>& GetBatchKernelsAVX<float>() noexcept;
+	template const BatchKernels<double>& GetBatchKernelsAVX<double>() noexcept;
+}
+
+#endif
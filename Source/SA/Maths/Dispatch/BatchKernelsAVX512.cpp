@@ -0,0 +1,633 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include "BatchKernels.hpp"
+
+#if SA_MATHS_BATCH_KERNELS_AVX512
+
+/*
+*	AVX-512F kernels (AVX-512F flags with SA_MATHS_RUNTIME_DISPATCH).
+*	With SA_MATHS_RUNTIME_DISPATCH, this translation unit is the only one built with AVX-512 flags:
+*	only use intrinsics and plain arithmetic here, inline functions from other headers
+*	would be emitted with these flags and could be picked by the linker for the whole program.
+*/
+
+#include <cmath>
+#include <cstdint>
+
+#include <immintrin.h>
+
+namespace SA::Intl
+{
+	namespace
+	{
+		template <typename T>
+		struct Vec3StreamPack;
+
+		template <>
+		struct Vec3StreamPack<float>
+		{
+			using Reg = __m512;
+			static constexpr size_t Width = 16u;
+
+			static Reg Load(const float* _p) noexcept { return _mm512_load_ps(_p); }
+			static Reg LoadU(const float* _p) noexcept { return _mm512_loadu_ps(_p); }
+			static void Store(float* _p, Reg _r) noexcept { _mm512_store_ps(_p, _r); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm512_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm512_set1_ps(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm512_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm512_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm512_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm512_div_ps(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm512_sqrt_ps(_r); }
+			static float ScalarSqrt(float _v) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(_v))); }
+
+			/// AVX-512F has no float logic: integer xor / and on the bits.
+			static Reg XorSign(Reg _v, Reg _s) noexcept
+			{
+				const __m512i sign = _mm512_and_si512(_mm512_castps_si512(_s), _mm512_set1_epi32(static_cast<int>(0x80000000u)));
+
+				return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_v), sign));
+			}
+
+			/// 16 element registers (one matrix per lane) to 16 matrices: 4x4 transpose per row and 128-bit lane.
+			static void StoreMat4(float* _out, const Reg* _elems) noexcept
+			{
+				for (size_t r = 0; r < 4u; ++r)
+				{
+					const Reg t0 = _mm512_unpacklo_ps(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t1 = _mm512_unpackhi_ps(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t2 = _mm512_unpacklo_ps(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+					const Reg t3 = _mm512_unpackhi_ps(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+
+					// Matrix 4 * l + k in 128-bit lane l.
+					const Reg rows[4] = {
+						_mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)),
+						_mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+						_mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+						_mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)),
+					};
+
+					for (size_t k = 0; k < 4u; ++k)
+					{
+						_mm_storeu_ps(_out + k * 16 + r * 4, _mm512_castps512_ps128(rows[k]));
+						_mm_storeu_ps(_out + (k + 4) * 16 + r * 4, _mm512_extractf32x4_ps(rows[k], 1));
+						_mm_storeu_ps(_out + (k + 8) * 16 + r * 4, _mm512_extractf32x4_ps(rows[k], 2));
+						_mm_storeu_ps(_out + (k + 12) * 16 + r * 4, _mm512_extractf32x4_ps(rows[k], 3));
+					}
+				}
+			}
+		};
+
+		template <>
+		struct Vec3StreamPack<double>
+		{
+			using Reg = __m512d;
+			static constexpr size_t Width = 8u;
+
+			static Reg Load(const double* _p) noexcept { return _mm512_load_pd(_p); }
+			static Reg LoadU(const double* _p) noexcept { return _mm512_loadu_pd(_p); }
+			static void Store(double* _p, Reg _r) noexcept { _mm512_store_pd(_p, _r); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm512_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm512_set1_pd(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm512_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm512_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm512_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm512_div_pd(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm512_sqrt_pd(_r); }
+			static double ScalarSqrt(double _v) noexcept { return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(_v))); }
+
+			/// AVX-512F has no double logic: integer xor / and on the bits.
+			static Reg XorSign(Reg _v, Reg _s) noexcept
+			{
+				const __m512i sign = _mm512_and_si512(_mm512_castpd_si512(_s), _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ull)));
+
+				return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(_v), sign));
+			}
+
+			/// 16 element registers (one matrix per lane) to 8 matrices: 4x4 transpose per row and 256-bit half.
+			static void StoreMat4(double* _out, const Reg* _elems) noexcept
+			{
+				for (size_t r = 0; r < 4u; ++r)
+				{
+					const Reg t0 = _mm512_unpacklo_pd(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t1 = _mm512_unpackhi_pd(_elems[r * 4], _elems[r * 4 + 1]);
+					const Reg t2 = _mm512_unpacklo_pd(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+					const Reg t3 = _mm512_unpackhi_pd(_elems[r * 4 + 2], _elems[r * 4 + 3]);
+
+					for (int h = 0; h < 2; ++h)
+					{
+						const __m256d h0 = h ? _mm512_extractf64x4_pd(t0, 1) : _mm512_castpd512_pd256(t0);
+						const __m256d h1 = h ? _mm512_extractf64x4_pd(t1, 1) : _mm512_castpd512_pd256(t1);
+						const __m256d h2 = h ? _mm512_extractf64x4_pd(t2, 1) : _mm512_castpd512_pd256(t2);
+						const __m256d h3 = h ? _mm512_extractf64x4_pd(t3, 1) : _mm512_castpd512_pd256(t3);
+
+						double* const out = _out + h * 64;
+
+						_mm256_storeu_pd(out + r * 4, _mm256_permute2f128_pd(h0, h2, 0x20));
+						_mm256_storeu_pd(out + 16 + r * 4, _mm256_permute2f128_pd(h1, h3, 0x20));
+						_mm256_storeu_pd(out + 32 + r * 4, _mm256_permute2f128_pd(h0, h2, 0x31));
+						_mm256_storeu_pd(out + 48 + r * 4, _mm256_permute2f128_pd(h1, h3, 0x31));
+					}
+				}
+			}
+		};
+	}
+}
+
+#include "Vector3StreamKernels.inl"
+#include "TransformKernels.inl"
+#include "QuaternionKernels.inl"
+#include "AABB3DKernelsAVX.inl"
+
+namespace SA::Intl
+{
+	namespace
+	{
+		/**
+		*	Vec3 (de)interleave indices: 3 registers of packed [x y z] <=> X, Y, Z registers (one vector per lane).
+		*	Each output register is built with 2 permutex2var: pass A from registers 0-1, pass B completes from register 2.
+		*/
+		alignas(64) static constexpr int32_t vec3fDeinterleaveA[3][16] = {
+			{ 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0 },
+			{ 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0 },
+			{ 2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0 },
+		};
+
+		alignas(64) static constexpr int32_t vec3fDeinterleaveB[3][16] = {
+			{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29 },
+			{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30 },
+			{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31 },
+		};
+
+		/// Interleave: pass A from X-Y registers, pass B completes from Z register.
+		alignas(64) static constexpr int32_t vec3fInterleaveA[3][16] = {
+			{ 0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5 },
+			{ 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26 },
+			{ 0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0 },
+		};
+
+		alignas(64) static constexpr int32_t vec3fInterleaveB[3][16] = {
+			{ 0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15 },
+			{ 0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15 },
+			{ 26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31 },
+		};
+
+		/// \copydoc vec3fDeinterleaveA
+		alignas(64) static constexpr int64_t vec3dDeinterleaveA[3][8] = {
+			{ 0, 3, 6, 9, 12, 15, 0, 0 },
+			{ 1, 4, 7, 10, 13, 0, 0, 0 },
+			{ 2, 5, 8, 11, 14, 0, 0, 0 },
+		};
+
+		alignas(64) static constexpr int64_t vec3dDeinterleaveB[3][8] = {
+			{ 0, 1, 2, 3, 4, 5, 10, 13 },
+			{ 0, 1, 2, 3, 4, 8, 11, 14 },
+			{ 0, 1, 2, 3, 4, 9, 12, 15 },
+		};
+
+		/// \copydoc vec3fInterleaveA
+		alignas(64) static constexpr int64_t vec3dInterleaveA[3][8] = {
+			{ 0, 8, 0, 1, 9, 0, 2, 10 },
+			{ 0, 3, 11, 0, 4, 12, 0, 5 },
+			{ 13, 0, 6, 14, 0, 7, 15, 0 },
+		};
+
+		alignas(64) static constexpr int64_t vec3dInterleaveB[3][8] = {
+			{ 0, 1, 8, 3, 4, 9, 6, 7 },
+			{ 10, 1, 2, 11, 4, 5, 12, 7 },
+			{ 0, 13, 2, 3, 14, 5, 6, 15 },
+		};
+
+
+		/// Load mask of register _reg (of _width elements) for _num remaining elements.
+		inline uint32_t TailMask(size_t _num, size_t _reg, size_t _width) noexcept
+		{
+			const size_t start = _reg * _width;
+
+			if (_num <= start)
+				return 0u;
+
+			if (_num >= start + _width)
+				return (1u << _width) - 1u;
+
+			return (1u << (_num - start)) - 1u;
+		}
+
+//{ Float
+
+		/**
+		*	Transform 16 Vec3 per iteration.
+		*	Vectors are deinterleaved to X, Y, Z registers (one vector per lane) so each matrix element
+		*	is broadcast once for the whole array.
+		*	Remaining vectors use the same path with masked loads and stores.
+		*/
+		template <bool bTranslate>
+		void Mat4fTransformVec3_AVX512(const float* _mat, const Vec3<float>* _in, Vec3<float>* _out, size_t _num) noexcept
+		{
+			const __m512 m00 = _mm512_set1_ps(_mat[0]);
+			const __m512 m01 = _mm512_set1_ps(_mat[1]);
+			const __m512 m02 = _mm512_set1_ps(_mat[2]);
+			const __m512 m10 = _mm512_set1_ps(_mat[4]);
+			const __m512 m11 = _mm512_set1_ps(_mat[5]);
+			const __m512 m12 = _mm512_set1_ps(_mat[6]);
+			const __m512 m20 = _mm512_set1_ps(_mat[8]);
+			const __m512 m21 = _mm512_set1_ps(_mat[9]);
+			const __m512 m22 = _mm512_set1_ps(_mat[10]);
+
+			const __m512 t0 = _mm512_set1_ps(bTranslate ? _mat[3] : 0.0f);
+			const __m512 t1 = _mm512_set1_ps(bTranslate ? _mat[7] : 0.0f);
+			const __m512 t2 = _mm512_set1_ps(bTranslate ? _mat[11] : 0.0f);
+
+			__m512i deA[3];
+			__m512i deB[3];
+			__m512i inA[3];
+			__m512i inB[3];
+
+			for (int c = 0; c < 3; ++c)
+			{
+				deA[c] = _mm512_load_si512(vec3fDeinterleaveA[c]);
+				deB[c] = _mm512_load_si512(vec3fDeinterleaveB[c]);
+				inA[c] = _mm512_load_si512(vec3fInterleaveA[c]);
+				inB[c] = _mm512_load_si512(vec3fInterleaveB[c]);
+			}
+
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			for (size_t i = 0; i < _num; i += 16u, in += 48, out += 48)
+			{
+				// Full pack: all ones, else masked tail.
+				const size_t num = (_num - i) * 3u;
+				const __mmask16 mask[3] = {
+					static_cast<__mmask16>(TailMask(num, 0u, 16u)),
+					static_cast<__mmask16>(TailMask(num, 1u, 16u)),
+					static_cast<__mmask16>(TailMask(num, 2u, 16u)),
+				};
+
+				const __m512 l0 = _mm512_maskz_loadu_ps(mask[0], in);
+				const __m512 l1 = _mm512_maskz_loadu_ps(mask[1], in + 16);
+				const __m512 l2 = _mm512_maskz_loadu_ps(mask[2], in + 32);
+
+				const __m512 x = _mm512_permutex2var_ps(_mm512_permutex2var_ps(l0, deA[0], l1), deB[0], l2);
+				const __m512 y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(l0, deA[1], l1), deB[1], l2);
+				const __m512 z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(l0, deA[2], l1), deB[2], l2);
+
+				const __m512 rx = _mm512_fmadd_ps(m00, x, _mm512_fmadd_ps(m01, y, _mm512_fmadd_ps(m02, z, t0)));
+				const __m512 ry = _mm512_fmadd_ps(m10, x, _mm512_fmadd_ps(m11, y, _mm512_fmadd_ps(m12, z, t1)));
+				const __m512 rz = _mm512_fmadd_ps(m20, x, _mm512_fmadd_ps(m21, y, _mm512_fmadd_ps(m22, z, t2)));
+
+				for (int r = 0; r < 3; ++r)
+				{
+					const __m512 res = _mm512_permutex2var_ps(_mm512_permutex2var_ps(rx, inA[r], ry), inB[r], rz);
+					_mm512_mask_storeu_ps(out + r * 16, mask[r], res);
+				}
+			}
+		}
+
+		/**
+		*	Transform 4 Vec4 per iteration.
+		*	Matrix columns are loaded once and duplicated in every lane, each vector component is broadcast in-lane.
+		*/
+		void Mat4fTransformVec4_AVX512(const float* _mat, const Vec4<float>* _in, Vec4<float>* _out, size_t _num) noexcept
+		{
+			const __m512 c0 = _mm512_broadcast_f32x4(_mm_setr_ps(_mat[0], _mat[4], _mat[8], _mat[12]));
+			const __m512 c1 = _mm512_broadcast_f32x4(_mm_setr_ps(_mat[1], _mat[5], _mat[9], _mat[13]));
+			const __m512 c2 = _mm512_broadcast_f32x4(_mm_setr_ps(_mat[2], _mat[6], _mat[10], _mat[14]));
+			const __m512 c3 = _mm512_broadcast_f32x4(_mm_setr_ps(_mat[3], _mat[7], _mat[11], _mat[15]));
+
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			for (size_t i = 0; i < _num; i += 4u, in += 16, out += 16)
+			{
+				const __mmask16 mask = static_cast<__mmask16>(TailMask((_num - i) * 4u, 0u, 16u));
+
+				const __m512 v = _mm512_maskz_loadu_ps(mask, in);
+
+				__m512 res = _mm512_mul_ps(c0, _mm512_permute_ps(v, 0x00));
+				res = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, 0x55), res);
+				res = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, 0xAA), res);
+				res = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, 0xFF), res);
+
+				_mm512_mask_storeu_ps(out, mask, res);
+			}
+		}
+
+//}
+
+//{ Double
+
+		/// Transform 8 Vec3 per iteration. \copydetails Mat4fTransformVec3_AVX512
+		template <bool bTranslate>
+		void Mat4dTransformVec3_AVX512(const double* _mat, const Vec3<double>* _in, Vec3<double>* _out, size_t _num) noexcept
+		{
+			const __m512d m00 = _mm512_set1_pd(_mat[0]);
+			const __m512d m01 = _mm512_set1_pd(_mat[1]);
+			const __m512d m02 = _mm512_set1_pd(_mat[2]);
+			const __m512d m10 = _mm512_set1_pd(_mat[4]);
+			const __m512d m11 = _mm512_set1_pd(_mat[5]);
+			const __m512d m12 = _mm512_set1_pd(_mat[6]);
+			const __m512d m20 = _mm512_set1_pd(_mat[8]);
+			const __m512d m21 = _mm512_set1_pd(_mat[9]);
+			const __m512d m22 = _mm512_set1_pd(_mat[10]);
+
+			const __m512d t0 = _mm512_set1_pd(bTranslate ? _mat[3] : 0.0);
+			const __m512d t1 = _mm512_set1_pd(bTranslate ? _mat[7] : 0.0);
+			const __m512d t2 = _mm512_set1_pd(bTranslate ? _mat[11] : 0.0);
+
+			__m512i deA[3];
+			__m512i deB[3];
+			__m512i inA[3];
+			__m512i inB[3];
+
+			for (int c = 0; c < 3; ++c)
+			{
+				deA[c] = _mm512_load_si512(vec3dDeinterleaveA[c]);
+				deB[c] = _mm512_load_si512(vec3dDeinterleaveB[c]);
+				inA[c] = _mm512_load_si512(vec3dInterleaveA[c]);
+				inB[c] = _mm512_load_si512(vec3dInterleaveB[c]);
+			}
+
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			for (size_t i = 0; i < _num; i += 8u, in += 24, out += 24)
+			{
+				const size_t num = (_num - i) * 3u;
+				const __mmask8 mask[3] = {
+					static_cast<__mmask8>(TailMask(num, 0u, 8u)),
+					static_cast<__mmask8>(TailMask(num, 1u, 8u)),
+					static_cast<__mmask8>(TailMask(num, 2u, 8u)),
+				};
+
+				const __m512d l0 = _mm512_maskz_loadu_pd(mask[0], in);
+				const __m512d l1 = _mm512_maskz_loadu_pd(mask[1], in + 8);
+				const __m512d l2 = _mm512_maskz_loadu_pd(mask[2], in + 16);
+
+				const __m512d x = _mm512_permutex2var_pd(_mm512_permutex2var_pd(l0, deA[0], l1), deB[0], l2);
+				const __m512d y = _mm512_permutex2var_pd(_mm512_permutex2var_pd(l0, deA[1], l1), deB[1], l2);
+				const __m512d z = _mm512_permutex2var_pd(_mm512_permutex2var_pd(l0, deA[2], l1), deB[2], l2);
+
+				const __m512d rx = _mm512_fmadd_pd(m00, x, _mm512_fmadd_pd(m01, y, _mm512_fmadd_pd(m02, z, t0)));
+				const __m512d ry = _mm512_fmadd_pd(m10, x, _mm512_fmadd_pd(m11, y, _mm512_fmadd_pd(m12, z, t1)));
+				const __m512d rz = _mm512_fmadd_pd(m20, x, _mm512_fmadd_pd(m21, y, _mm512_fmadd_pd(m22, z, t2)));
+
+				for (int r = 0; r < 3; ++r)
+				{
+					const __m512d res = _mm512_permutex2var_pd(_mm512_permutex2var_pd(rx, inA[r], ry), inB[r], rz);
+					_mm512_mask_storeu_pd(out + r * 8, mask[r], res);
+				}
+			}
+		}
+
+		/// Transform 2 Vec4 per iteration. \copydetails Mat4fTransformVec4_AVX512
+		void Mat4dTransformVec4_AVX512(const double* _mat, const Vec4<double>* _in, Vec4<double>* _out, size_t _num) noexcept
+		{
+			const __m512d c0 = _mm512_broadcast_f64x4(_mm256_setr_pd(_mat[0], _mat[4], _mat[8], _mat[12]));
+			const __m512d c1 = _mm512_broadcast_f64x4(_mm256_setr_pd(_mat[1], _mat[5], _mat[9], _mat[13]));
+			const __m512d c2 = _mm512_broadcast_f64x4(_mm256_setr_pd(_mat[2], _mat[6], _mat[10], _mat[14]));
+			const __m512d c3 = _mm512_broadcast_f64x4(_mm256_setr_pd(_mat[3], _mat[7], _mat[11], _mat[15]));
+
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			for (size_t i = 0; i < _num; i += 2u, in += 8, out += 8)
+			{
+				const __mmask8 mask = static_cast<__mmask8>(TailMask((_num - i) * 4u, 0u, 8u));
+
+				const __m512d v = _mm512_maskz_loadu_pd(mask, in);
+
+				__m512d res = _mm512_mul_pd(c0, _mm512_permutex_pd(v, 0x00));
+				res = _mm512_fmadd_pd(c1, _mm512_permutex_pd(v, 0x55), res);
+				res = _mm512_fmadd_pd(c2, _mm512_permutex_pd(v, 0xAA), res);
+				res = _mm512_fmadd_pd(c3, _mm512_permutex_pd(v, 0xFF), res);
+
+				_mm512_mask_storeu_pd(out, mask, res);
+			}
+		}
+
+//}
+
+//{ Multiply
+
+		/**
+		*	Memory-order (row major) kernels: C = A * B.
+		*	Column major matrices use the same kernel with swapped operands: (A * B)^T = B^T * A^T.
+		*
+		*	Float: whole matrix per register.
+		*	A elements are broadcast in-lane (one row per 128 bits lane), B rows are duplicated in every lane.
+		*/
+		inline void Mat4fMulLoadA(const float* _a, __m512 (&_res)[4]) noexcept
+		{
+			const __m512 a = _mm512_loadu_ps(_a);
+
+			_res[0] = _mm512_permute_ps(a, 0x00);
+			_res[1] = _mm512_permute_ps(a, 0x55);
+			_res[2] = _mm512_permute_ps(a, 0xAA);
+			_res[3] = _mm512_permute_ps(a, 0xFF);
+		}
+
+		inline void Mat4fMulLoadB(const float* _b, __m512 (&_res)[4]) noexcept
+		{
+			_res[0] = _mm512_broadcast_f32x4(_mm_loadu_ps(_b));
+			_res[1] = _mm512_broadcast_f32x4(_mm_loadu_ps(_b + 4));
+			_res[2] = _mm512_broadcast_f32x4(_mm_loadu_ps(_b + 8));
+			_res[3] = _mm512_broadcast_f32x4(_mm_loadu_ps(_b + 12));
+		}
+
+		inline __m512 Mat4fMul(const __m512 (&_a)[4], const __m512 (&_b)[4]) noexcept
+		{
+			return _mm512_add_ps(
+				_mm512_fmadd_ps(_a[1], _b[1], _mm512_mul_ps(_a[0], _b[0])),
+				_mm512_fmadd_ps(_a[3], _b[3], _mm512_mul_ps(_a[2], _b[2]))
+			);
+		}
+
+		template <bool bConstA, bool bConstB>
+		void Mat4fMultiplyBatch_AVX512(const float* _a, const float* _b, float* _c, size_t _num) noexcept
+		{
+			__m512 a[4];
+			__m512 b[4];
+
+			if constexpr (bConstA)
+				Mat4fMulLoadA(_a, a);
+
+			if constexpr (bConstB)
+				Mat4fMulLoadB(_b, b);
+
+			for (size_t i = 0; i < _num; ++i, _c += 16)
+			{
+				if constexpr (!bConstA)
+				{
+					Mat4fMulLoadA(_a, a);
+					_a += 16;
+				}
+
+				if constexpr (!bConstB)
+				{
+					Mat4fMulLoadB(_b, b);
+					_b += 16;
+				}
+
+				_mm512_storeu_ps(_c, Mat4fMul(a, b));
+			}
+		}
+
+
+		/**
+		*	Double: compute 2 rows of C per register.
+		*	A elements are broadcast in-lane (one row per 256 bits lane), B rows are duplicated in both lanes.
+		*/
+		inline void Mat4dMulLoadA(const double* _a, __m512d (&_res)[8]) noexcept
+		{
+			const __m512d a01 = _mm512_loadu_pd(_a);
+			const __m512d a23 = _mm512_loadu_pd(_a + 8);
+
+			_res[0] = _mm512_permutex_pd(a01, 0x00);
+			_res[1] = _mm512_permutex_pd(a01, 0x55);
+			_res[2] = _mm512_permutex_pd(a01, 0xAA);
+			_res[3] = _mm512_permutex_pd(a01, 0xFF);
+
+			_res[4] = _mm512_permutex_pd(a23, 0x00);
+			_res[5] = _mm512_permutex_pd(a23, 0x55);
+			_res[6] = _mm512_permutex_pd(a23, 0xAA);
+			_res[7] = _mm512_permutex_pd(a23, 0xFF);
+		}
+
+		inline void Mat4dMulLoadB(const double* _b, __m512d (&_res)[4]) noexcept
+		{
+			_res[0] = _mm512_broadcast_f64x4(_mm256_loadu_pd(_b));
+			_res[1] = _mm512_broadcast_f64x4(_mm256_loadu_pd(_b + 4));
+			_res[2] = _mm512_broadcast_f64x4(_mm256_loadu_pd(_b + 8));
+			_res[3] = _mm512_broadcast_f64x4(_mm256_loadu_pd(_b + 12));
+		}
+
+		inline void Mat4dMul(const __m512d (&_a)[8], const __m512d (&_b)[4], double* _c) noexcept
+		{
+			// Row 0 and 1.
+			_mm512_storeu_pd(_c, _mm512_add_pd(
+				_mm512_fmadd_pd(_a[1], _b[1], _mm512_mul_pd(_a[0], _b[0])),
+				_mm512_fmadd_pd(_a[3], _b[3], _mm512_mul_pd(_a[2], _b[2]))
+			));
+
+			// Row 2 and 3.
+			_mm512_storeu_pd(_c + 8, _mm512_add_pd(
+				_mm512_fmadd_pd(_a[5], _b[1], _mm512_mul_pd(_a[4], _b[0])),
+				_mm512_fmadd_pd(_a[7], _b[3], _mm512_mul_pd(_a[6], _b[2]))
+			));
+		}
+
+		template <bool bConstA, bool bConstB>
+		void Mat4dMultiplyBatch_AVX512(const double* _a, const double* _b, double* _c, size_t _num) noexcept
+		{
+			__m512d a[8];
+			__m512d b[4];
+
+			if constexpr (bConstA)
+				Mat4dMulLoadA(_a, a);
+
+			if constexpr (bConstB)
+				Mat4dMulLoadB(_b, b);
+
+			for (size_t i = 0; i < _num; ++i, _c += 16)
+			{
+				// Operands are loaded in registers before store: _c may alias _a or _b.
+				if constexpr (!bConstA)
+				{
+					Mat4dMulLoadA(_a, a);
+					_a += 16;
+				}
+
+				if constexpr (!bConstB)
+				{
+					Mat4dMulLoadB(_b, b);
+					_b += 16;
+				}
+
+				Mat4dMul(a, b, _c);
+			}
+		}
+
+//}
+
+
+		template <typename T>
+		struct Mat4KernelsAVX512;
+
+		template <>
+		struct Mat4KernelsAVX512<float>
+		{
+			static constexpr auto transformPoints = &Mat4fTransformVec3_AVX512<true>;
+			static constexpr auto transformDirections = &Mat4fTransformVec3_AVX512<false>;
+			static constexpr auto transformVec4 = &Mat4fTransformVec4_AVX512;
+			static constexpr auto multiply = &Mat4fMultiplyBatch_AVX512<false, false>;
+			static constexpr auto multiplyConstA = &Mat4fMultiplyBatch_AVX512<true, false>;
+			static constexpr auto multiplyConstB = &Mat4fMultiplyBatch_AVX512<false, true>;
+
+			static constexpr auto aabb3DTransform = &AABB3DfTransformBatch_AVX<false>;
+			static constexpr auto aabb3DTransformConstMat = &AABB3DfTransformBatch_AVX<true>;
+		};
+
+		template <>
+		struct Mat4KernelsAVX512<double>
+		{
+			static constexpr auto transformPoints = &Mat4dTransformVec3_AVX512<true>;
+			static constexpr auto transformDirections = &Mat4dTransformVec3_AVX512<false>;
+			static constexpr auto transformVec4 = &Mat4dTransformVec4_AVX512;
+			static constexpr auto multiply = &Mat4dMultiplyBatch_AVX512<false, false>;
+			static constexpr auto multiplyConstA = &Mat4dMultiplyBatch_AVX512<true, false>;
+			static constexpr auto multiplyConstB = &Mat4dMultiplyBatch_AVX512<false, true>;
+
+			static constexpr auto aabb3DTransform = &AABB3DdTransformBatch_AVX<false>;
+			static constexpr auto aabb3DTransformConstMat = &AABB3DdTransformBatch_AVX<true>;
+		};
+	}
+
+
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsAVX512() noexcept
+	{
+		using M = Mat4KernelsAVX512<T>;
+
+		static constexpr BatchKernels<T> kernels{
+			M::transformPoints,
+			M::transformDirections,
+			M::transformVec4,
+			M::multiply,
+			M::multiplyConstA,
+			M::multiplyConstB,
+
+			&Vec3StreamAdd<T>,
+			&Vec3StreamSub<T>,
+			&Vec3StreamAddBroadcast<T>,
+			&Vec3StreamScale<T>,
+			&Vec3StreamNormalize<T>,
+			&Vec3StreamDot<T>,
+			&Vec3StreamCross<T>,
+			&Vec3StreamDist<T>,
+			&Vec3StreamLerp<T>,
+
+			&TrTRSMatrixBatch<T>,
+
+			&QuatNLerp<T>,
+			&QuatSLerp<T>,
+			&QuatSLerpApprox<T>,
+
+			&QuatStreamNormalize<T>,
+			&QuatStreamDot<T>,
+			&QuatStreamMultiply<T>,
+			&QuatStreamRotate<false, T>,
+			&QuatStreamRotate<true, T>,
+
+			M::aabb3DTransform,
+			M::aabb3DTransformConstMat,
+		};
+
+		return kernels;
+	}
+
+	template const BatchKernels<float>& GetBatchKernelsAVX512<float>() noexcept;
+	template const BatchKernels<double>& GetBatchKernelsAVX512<double>() noexcept;
+}
+
+#endif
@@ -0,0 +1,673 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include "BatchKernels.hpp"
+
+#if SA_MATHS_BATCH_KERNELS_SSE
+
+/*
+*	SSE4.1 kernels.
+*	With SA_MATHS_RUNTIME_DISPATCH, this translation unit is the only one built with SSE4.1 flags:
+*	only use intrinsics and plain arithmetic here, inline functions from other headers
+*	would be emitted with these flags and could be picked by the linker for the whole program.
+*/
+
+#include <cmath>
+
+#include <immintrin.h>
+
+namespace SA::Intl
+{
+	namespace
+	{
+		template <typename T>
+		struct Vec3StreamPack;
+
+		template <>
+		struct Vec3StreamPack<float>
+		{
+			using Reg = __m128;
+			static constexpr size_t Width = 4u;
+
+			static Reg Load(const float* _p) noexcept { return _mm_load_ps(_p); }
+			static Reg LoadU(const float* _p) noexcept { return _mm_loadu_ps(_p); }
+			static void Store(float* _p, Reg _r) noexcept { _mm_store_ps(_p, _r); }
+			static void StoreU(float* _p, Reg _r) noexcept { _mm_storeu_ps(_p, _r); }
+			static Reg Set1(float _v) noexcept { return _mm_set1_ps(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_ps(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_ps(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm_sqrt_ps(_r); }
+			static float ScalarSqrt(float _v) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(_v))); }
+			static Reg XorSign(Reg _v, Reg _s) noexcept { return _mm_xor_ps(_v, _mm_and_ps(_s, _mm_set1_ps(-0.0f))); }
+
+			/// 16 element registers (one matrix per lane) to 4 matrices: 4x4 transpose per row.
+			static void StoreMat4(float* _out, const Reg* _elems) noexcept
+			{
+				for (size_t r = 0; r < 4u; ++r)
+				{
+					Reg e0 = _elems[r * 4];
+					Reg e1 = _elems[r * 4 + 1];
+					Reg e2 = _elems[r * 4 + 2];
+					Reg e3 = _elems[r * 4 + 3];
+
+					_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+					_mm_storeu_ps(_out + r * 4, e0);
+					_mm_storeu_ps(_out + 16 + r * 4, e1);
+					_mm_storeu_ps(_out + 32 + r * 4, e2);
+					_mm_storeu_ps(_out + 48 + r * 4, e3);
+				}
+			}
+		};
+
+		template <>
+		struct Vec3StreamPack<double>
+		{
+			using Reg = __m128d;
+			static constexpr size_t Width = 2u;
+
+			static Reg Load(const double* _p) noexcept { return _mm_load_pd(_p); }
+			static Reg LoadU(const double* _p) noexcept { return _mm_loadu_pd(_p); }
+			static void Store(double* _p, Reg _r) noexcept { _mm_store_pd(_p, _r); }
+			static void StoreU(double* _p, Reg _r) noexcept { _mm_storeu_pd(_p, _r); }
+			static Reg Set1(double _v) noexcept { return _mm_set1_pd(_v); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_pd(_l, _r); }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _mm_div_pd(_l, _r); }
+			static Reg Sqrt(Reg _r) noexcept { return _mm_sqrt_pd(_r); }
+			static double ScalarSqrt(double _v) noexcept { return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(_v))); }
+			static Reg XorSign(Reg _v, Reg _s) noexcept { return _mm_xor_pd(_v, _mm_and_pd(_s, _mm_set1_pd(-0.0))); }
+
+			/// 16 element registers (one matrix per lane) to 2 matrices: 2x2 transpose per element pair.
+			static void StoreMat4(double* _out, const Reg* _elems) noexcept
+			{
+				for (size_t j = 0; j < 16u; j += 2u)
+				{
+					_mm_storeu_pd(_out + j, _mm_unpacklo_pd(_elems[j], _elems[j + 1]));
+					_mm_storeu_pd(_out + 16 + j, _mm_unpackhi_pd(_elems[j], _elems[j + 1]));
+				}
+			}
+		};
+	}
+}
+
+#include "Vector3StreamKernels.inl"
+#include "TransformKernels.inl"
+#include "QuaternionKernels.inl"
+
+namespace SA::Intl
+{
+	namespace
+	{
+//{ Float
+
+		/**
+		*	Transform 4 Vec3 per iteration.
+		*	Vectors are deinterleaved to X, Y, Z registers (one vector per lane) so each matrix element
+		*	is broadcast once for the whole array.
+		*/
+		template <bool bTranslate>
+		void Mat4fTransformVec3_SSE(const float* _mat, const Vec3<float>* _in, Vec3<float>* _out, size_t _num) noexcept
+		{
+			const __m128 m00 = _mm_set1_ps(_mat[0]);
+			const __m128 m01 = _mm_set1_ps(_mat[1]);
+			const __m128 m02 = _mm_set1_ps(_mat[2]);
+			const __m128 m10 = _mm_set1_ps(_mat[4]);
+			const __m128 m11 = _mm_set1_ps(_mat[5]);
+			const __m128 m12 = _mm_set1_ps(_mat[6]);
+			const __m128 m20 = _mm_set1_ps(_mat[8]);
+			const __m128 m21 = _mm_set1_ps(_mat[9]);
+			const __m128 m22 = _mm_set1_ps(_mat[10]);
+
+			const __m128 t0 = _mm_set1_ps(bTranslate ? _mat[3] : 0.0f);
+			const __m128 t1 = _mm_set1_ps(bTranslate ? _mat[7] : 0.0f);
+			const __m128 t2 = _mm_set1_ps(bTranslate ? _mat[11] : 0.0f);
+
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			size_t i = 0;
+
+			for (; i + 4u <= _num; i += 4u, in += 12, out += 12)
+			{
+				// Deinterleave: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3].
+				const __m128 l0 = _mm_loadu_ps(in);
+				const __m128 l1 = _mm_loadu_ps(in + 4);
+				const __m128 l2 = _mm_loadu_ps(in + 8);
+
+				const __m128 t = _mm_shuffle_ps(l1, l2, _MM_SHUFFLE(2, 1, 3, 2));
+				const __m128 u = _mm_shuffle_ps(l0, l1, _MM_SHUFFLE(1, 0, 2, 1));
+
+				const __m128 x = _mm_shuffle_ps(l0, t, _MM_SHUFFLE(2, 0, 3, 0));
+				const __m128 y = _mm_shuffle_ps(u, t, _MM_SHUFFLE(3, 1, 2, 0));
+				const __m128 z = _mm_shuffle_ps(u, l2, _MM_SHUFFLE(3, 0, 3, 1));
+
+				const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_add_ps(_mm_mul_ps(m02, z), t0));
+				const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_add_ps(_mm_mul_ps(m12, z), t1));
+				const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_add_ps(_mm_mul_ps(m22, z), t2));
+
+				// Interleave back.
+				_mm_storeu_ps(out, _mm_shuffle_ps(_mm_shuffle_ps(rx, ry, _MM_SHUFFLE(1, 0, 1, 0)), _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+				_mm_storeu_ps(out + 4, _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+				_mm_storeu_ps(out + 8, _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+			}
+
+			for (; i < _num; ++i, in += 3, out += 3)
+			{
+				const float x = in[0];
+				const float y = in[1];
+				const float z = in[2];
+
+				out[0] = _mat[0] * x + _mat[1] * y + _mat[2] * z + (bTranslate ? _mat[3] : 0.0f);
+				out[1] = _mat[4] * x + _mat[5] * y + _mat[6] * z + (bTranslate ? _mat[7] : 0.0f);
+				out[2] = _mat[8] * x + _mat[9] * y + _mat[10] * z + (bTranslate ? _mat[11] : 0.0f);
+			}
+		}
+
+		/// Transform 1 Vec4 per iteration: matrix columns are loaded once, vector components are broadcast.
+		void Mat4fTransformVec4_SSE(const float* _mat, const Vec4<float>* _in, Vec4<float>* _out, size_t _num) noexcept
+		{
+			const __m128 c0 = _mm_setr_ps(_mat[0], _mat[4], _mat[8], _mat[12]);
+			const __m128 c1 = _mm_setr_ps(_mat[1], _mat[5], _mat[9], _mat[13]);
+			const __m128 c2 = _mm_setr_ps(_mat[2], _mat[6], _mat[10], _mat[14]);
+			const __m128 c3 = _mm_setr_ps(_mat[3], _mat[7], _mat[11], _mat[15]);
+
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 4, out += 4)
+			{
+				const __m128 v = _mm_loadu_ps(in);
+
+				const __m128 r01 = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00)), _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55)));
+				const __m128 r23 = _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xAA)), _mm_mul_ps(c3, _mm_shuffle_ps(v, v, 0xFF)));
+
+				_mm_storeu_ps(out, _mm_add_ps(r01, r23));
+			}
+		}
+
+
+		/**
+		*	Memory-order (row major) kernel: C = A * B.
+		*	Compute 1 row of C per register: B rows are loaded in registers, A elements are broadcast from memory.
+		*/
+		template <bool bConstA, bool bConstB>
+		void Mat4fMultiplyBatch_SSE(const float* _a, const float* _b, float* _c, size_t _num) noexcept
+		{
+			__m128 b[4];
+
+			if constexpr (bConstB)
+			{
+				for (int j = 0; j < 4; ++j)
+					b[j] = _mm_loadu_ps(_b + j * 4);
+			}
+
+			for (size_t i = 0; i < _num; ++i, _c += 16)
+			{
+				if constexpr (!bConstB)
+				{
+					for (int j = 0; j < 4; ++j)
+						b[j] = _mm_loadu_ps(_b + j * 4);
+
+					_b += 16;
+				}
+
+				__m128 rows[4];
+
+				for (int r = 0; r < 4; ++r)
+				{
+					const float* const aRow = _a + r * 4;
+
+					rows[r] = _mm_add_ps(
+						_mm_add_ps(_mm_mul_ps(_mm_load1_ps(aRow), b[0]), _mm_mul_ps(_mm_load1_ps(aRow + 1), b[1])),
+						_mm_add_ps(_mm_mul_ps(_mm_load1_ps(aRow + 2), b[2]), _mm_mul_ps(_mm_load1_ps(aRow + 3), b[3]))
+					);
+				}
+
+				// Store after every row is computed: _c may alias _a.
+				_mm_storeu_ps(_c, rows[0]);
+				_mm_storeu_ps(_c + 4, rows[1]);
+				_mm_storeu_ps(_c + 8, rows[2]);
+				_mm_storeu_ps(_c + 12, rows[3]);
+
+				if constexpr (!bConstA)
+					_a += 16;
+			}
+		}
+
+//}
+
+//{ Double
+
+		/**
+		*	Transform 1 Vec3 per iteration.
+		*	Matrix columns are split in rows 0-1 and row 2 halves, vector components are broadcast.
+		*/
+		template <bool bTranslate>
+		void Mat4dTransformVec3_SSE(const double* _mat, const Vec3<double>* _in, Vec3<double>* _out, size_t _num) noexcept
+		{
+			const __m128d c0lo = _mm_setr_pd(_mat[0], _mat[4]);
+			const __m128d c1lo = _mm_setr_pd(_mat[1], _mat[5]);
+			const __m128d c2lo = _mm_setr_pd(_mat[2], _mat[6]);
+			const __m128d c3lo = bTranslate ? _mm_setr_pd(_mat[3], _mat[7]) : _mm_setzero_pd();
+
+			const __m128d c0hi = _mm_set_sd(_mat[8]);
+			const __m128d c1hi = _mm_set_sd(_mat[9]);
+			const __m128d c2hi = _mm_set_sd(_mat[10]);
+			const __m128d c3hi = _mm_set_sd(bTranslate ? _mat[11] : 0.0);
+
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 3, out += 3)
+			{
+				const __m128d x = _mm_load1_pd(in);
+				const __m128d y = _mm_load1_pd(in + 1);
+				const __m128d z = _mm_load1_pd(in + 2);
+
+				const __m128d lo = _mm_add_pd(_mm_add_pd(_mm_mul_pd(c0lo, x), _mm_mul_pd(c1lo, y)), _mm_add_pd(_mm_mul_pd(c2lo, z), c3lo));
+				const __m128d hi = _mm_add_sd(_mm_add_sd(_mm_mul_sd(c0hi, x), _mm_mul_sd(c1hi, y)), _mm_add_sd(_mm_mul_sd(c2hi, z), c3hi));
+
+				_mm_storeu_pd(out, lo);
+				_mm_store_sd(out + 2, hi);
+			}
+		}
+
+		/// Transform 1 Vec4 per iteration: matrix columns are split in rows 0-1 and rows 2-3 halves, vector components are broadcast.
+		void Mat4dTransformVec4_SSE(const double* _mat, const Vec4<double>* _in, Vec4<double>* _out, size_t _num) noexcept
+		{
+			const __m128d c0lo = _mm_setr_pd(_mat[0], _mat[4]);
+			const __m128d c1lo = _mm_setr_pd(_mat[1], _mat[5]);
+			const __m128d c2lo = _mm_setr_pd(_mat[2], _mat[6]);
+			const __m128d c3lo = _mm_setr_pd(_mat[3], _mat[7]);
+
+			const __m128d c0hi = _mm_setr_pd(_mat[8], _mat[12]);
+			const __m128d c1hi = _mm_setr_pd(_mat[9], _mat[13]);
+			const __m128d c2hi = _mm_setr_pd(_mat[10], _mat[14]);
+			const __m128d c3hi = _mm_setr_pd(_mat[11], _mat[15]);
+
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			for (size_t i = 0; i < _num; ++i, in += 4, out += 4)
+			{
+				const __m128d x = _mm_load1_pd(in);
+				const __m128d y = _mm_load1_pd(in + 1);
+				const __m128d z = _mm_load1_pd(in + 2);
+				const __m128d w = _mm_load1_pd(in + 3);
+
+				const __m128d lo = _mm_add_pd(_mm_add_pd(_mm_mul_pd(c0lo, x), _mm_mul_pd(c1lo, y)), _mm_add_pd(_mm_mul_pd(c2lo, z), _mm_mul_pd(c3lo, w)));
+				const __m128d hi = _mm_add_pd(_mm_add_pd(_mm_mul_pd(c0hi, x), _mm_mul_pd(c1hi, y)), _mm_add_pd(_mm_mul_pd(c2hi, z), _mm_mul_pd(c3hi, w)));
+
+				_mm_storeu_pd(out, lo);
+				_mm_storeu_pd(out + 2, hi);
+			}
+		}
+
+
+		/**
+		*	Memory-order (row major) kernel: C = A * B.
+		*	Compute 1 half row of C per register: B rows are loaded in registers, A elements are broadcast from memory.
+		*/
+		template <bool bConstA, bool bConstB>
+		void Mat4dMultiplyBatch_SSE(const double* _a, const double* _b, double* _c, size_t _num) noexcept
+		{
+			__m128d b[8];
+
+			if constexpr (bConstB)
+			{
+				for (int j = 0; j < 8; ++j)
+					b[j] = _mm_loadu_pd(_b + j * 2);
+			}
+
+			for (size_t i = 0; i < _num; ++i, _c += 16)
+			{
+				if constexpr (!bConstB)
+				{
+					for (int j = 0; j < 8; ++j)
+						b[j] = _mm_loadu_pd(_b + j * 2);
+
+					_b += 16;
+				}
+
+				__m128d rows[8];
+
+				for (int r = 0; r < 4; ++r)
+				{
+					const __m128d a0 = _mm_load1_pd(_a + r * 4);
+					const __m128d a1 = _mm_load1_pd(_a + r * 4 + 1);
+					const __m128d a2 = _mm_load1_pd(_a + r * 4 + 2);
+					const __m128d a3 = _mm_load1_pd(_a + r * 4 + 3);
+
+					rows[r * 2] = _mm_add_pd(_mm_add_pd(_mm_mul_pd(a0, b[0]), _mm_mul_pd(a1, b[2])), _mm_add_pd(_mm_mul_pd(a2, b[4]), _mm_mul_pd(a3, b[6])));
+					rows[r * 2 + 1] = _mm_add_pd(_mm_add_pd(_mm_mul_pd(a0, b[1]), _mm_mul_pd(a1, b[3])), _mm_add_pd(_mm_mul_pd(a2, b[5]), _mm_mul_pd(a3, b[7])));
+				}
+
+				// Store after every row is computed: _c may alias _a.
+				for (int j = 0; j < 8; ++j)
+					_mm_storeu_pd(_c + j * 2, rows[j]);
+
+				if constexpr (!bConstA)
+					_a += 16;
+			}
+		}
+
+//}
+
+//{ AABB3D
+
+		/// Float matrix columns (x, y, z, _) and absolute 3x3 columns.
+		struct AABB3DfMat_SSE
+		{
+			__m128 cols[4];
+			__m128 absCols[3];
+		};
+
+		template <bool bColumn>
+		inline void AABB3DfLoadMat_SSE(const float* _mat, AABB3DfMat_SSE& _res) noexcept
+		{
+			__m128 r0 = _mm_loadu_ps(_mat);
+			__m128 r1 = _mm_loadu_ps(_mat + 4);
+			__m128 r2 = _mm_loadu_ps(_mat + 8);
+			__m128 r3 = _mm_loadu_ps(_mat + 12);
+
+			// Row major: memory rows to columns.
+			if constexpr (!bColumn)
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+			_res.cols[0] = r0;
+			_res.cols[1] = r1;
+			_res.cols[2] = r2;
+			_res.cols[3] = r3;
+
+			_res.absCols[0] = _mm_andnot_ps(signMask, r0);
+			_res.absCols[1] = _mm_andnot_ps(signMask, r1);
+			_res.absCols[2] = _mm_andnot_ps(signMask, r2);
+		}
+
+		/**
+		*	Transform 1 box: center and extents (x, y, z, _) in one register.
+		*	Box is loaded and stored with 2 overlapping 4 float accesses (min.xyz max.x / min.z max.xyz)
+		*	to stay inside the 6 float box.
+		*/
+		inline void AABB3DfTransform_SSE(const AABB3DfMat_SSE& _mat, const float* _in, float* _out) noexcept
+		{
+			const __m128 half = _mm_set1_ps(0.5f);
+
+			const __m128 bMin = _mm_loadu_ps(_in);
+			const __m128 hi = _mm_loadu_ps(_in + 2);
+			const __m128 bMax = _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(3, 3, 2, 1));
+
+			const __m128 c = _mm_mul_ps(_mm_add_ps(bMin, bMax), half);
+			const __m128 e = _mm_mul_ps(_mm_sub_ps(bMax, bMin), half);
+
+			const __m128 oc = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mat.cols[0], _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(_mat.cols[1], _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1)))),
+				_mm_add_ps(_mm_mul_ps(_mat.cols[2], _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2))), _mat.cols[3])
+			);
+
+			const __m128 oe = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mat.absCols[0], _mm_shuffle_ps(e, e, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(_mat.absCols[1], _mm_shuffle_ps(e, e, _MM_SHUFFLE(1, 1, 1, 1)))),
+				_mm_mul_ps(_mat.absCols[2], _mm_shuffle_ps(e, e, _MM_SHUFFLE(2, 2, 2, 2)))
+			);
+
+			const __m128 oMin = _mm_sub_ps(oc, oe);
+			const __m128 oMax = _mm_add_ps(oc, oe);
+
+			// (min.z, max.x, max.y, max.z): overwrite the 4th float of the first store.
+			const __m128 oHi = _mm_move_ss(_mm_shuffle_ps(oMax, oMax, _MM_SHUFFLE(2, 1, 0, 0)), _mm_movehl_ps(oMin, oMin));
+
+			_mm_storeu_ps(_out, oMin);
+			_mm_storeu_ps(_out + 2, oHi);
+		}
+
+		template <bool bConstMat, bool bColumn>
+		void AABB3DfTransformMajor_SSE(const float* _mats, const AABB3D<float>* _in, AABB3D<float>* _out, size_t _num) noexcept
+		{
+			const float* in = reinterpret_cast<const float*>(_in);
+			float* out = reinterpret_cast<float*>(_out);
+
+			AABB3DfMat_SSE mat;
+
+			if constexpr (bConstMat)
+				AABB3DfLoadMat_SSE<bColumn>(_mats, mat);
+
+			for (size_t i = 0; i < _num; ++i, in += 6, out += 6)
+			{
+				if constexpr (!bConstMat)
+				{
+					AABB3DfLoadMat_SSE<bColumn>(_mats, mat);
+					_mats += 16;
+				}
+
+				AABB3DfTransform_SSE(mat, in, out);
+			}
+		}
+
+
+		/// Double matrix: (x, y) columns in registers, z row as 2 pairs.
+		struct AABB3DdMat_SSE
+		{
+			__m128d xyCols[4];
+			__m128d absXYCols[3];
+
+			__m128d zRow[2];
+			__m128d absZRow[2];
+		};
+
+		template <bool bColumn>
+		inline void AABB3DdLoadMat_SSE(const double* _mat, AABB3DdMat_SSE& _res) noexcept
+		{
+			if constexpr (bColumn)
+			{
+				for (int j = 0; j < 4; ++j)
+					_res.xyCols[j] = _mm_loadu_pd(_mat + j * 4);
+
+				_res.zRow[0] = _mm_loadh_pd(_mm_load_sd(_mat + 2), _mat + 6);
+				_res.zRow[1] = _mm_loadh_pd(_mm_load_sd(_mat + 10), _mat + 14);
+			}
+			else
+			{
+				const __m128d r0a = _mm_loadu_pd(_mat);
+				const __m128d r0b = _mm_loadu_pd(_mat + 2);
+				const __m128d r1a = _mm_loadu_pd(_mat + 4);
+				const __m128d r1b = _mm_loadu_pd(_mat + 6);
+
+				_res.xyCols[0] = _mm_unpacklo_pd(r0a, r1a);
+				_res.xyCols[1] = _mm_unpackhi_pd(r0a, r1a);
+				_res.xyCols[2] = _mm_unpacklo_pd(r0b, r1b);
+				_res.xyCols[3] = _mm_unpackhi_pd(r0b, r1b);
+
+				_res.zRow[0] = _mm_loadu_pd(_mat + 8);
+				_res.zRow[1] = _mm_loadu_pd(_mat + 10);
+			}
+
+			const __m128d signMask = _mm_set1_pd(-0.0);
+
+			for (int j = 0; j < 3; ++j)
+				_res.absXYCols[j] = _mm_andnot_pd(signMask, _res.xyCols[j]);
+
+			_res.absZRow[0] = _mm_andnot_pd(signMask, _res.zRow[0]);
+
+			// Translation is not part of the extents.
+			_res.absZRow[1] = _mm_move_sd(_mm_setzero_pd(), _mm_andnot_pd(signMask, _res.zRow[1]));
+		}
+
+		/// Transform 1 box: (x, y) computed by columns, z as a dot product with the z row.
+		inline void AABB3DdTransform_SSE(const AABB3DdMat_SSE& _mat, const double* _in, double* _out) noexcept
+		{
+			const __m128d half = _mm_set1_pd(0.5);
+
+			const __m128d minXY = _mm_loadu_pd(_in);
+			const __m128d maxXY = _mm_loadu_pd(_in + 3);
+
+			// (z, 0): the high lane stays 0 for the extents.
+			const __m128d minZ = _mm_load_sd(_in + 2);
+			const __m128d maxZ = _mm_load_sd(_in + 5);
+
+			const __m128d cXY = _mm_mul_pd(_mm_add_pd(minXY, maxXY), half);
+			const __m128d eXY = _mm_mul_pd(_mm_sub_pd(maxXY, minXY), half);
+
+			const __m128d cZ = _mm_mul_pd(_mm_add_pd(minZ, maxZ), half);
+			const __m128d eZ = _mm_mul_pd(_mm_sub_pd(maxZ, minZ), half);
+
+			const __m128d cx = _mm_unpacklo_pd(cXY, cXY);
+			const __m128d cy = _mm_unpackhi_pd(cXY, cXY);
+			const __m128d cz = _mm_unpacklo_pd(cZ, cZ);
+
+			const __m128d ex = _mm_unpacklo_pd(eXY, eXY);
+			const __m128d ey = _mm_unpackhi_pd(eXY, eXY);
+			const __m128d ez = _mm_unpacklo_pd(eZ, eZ);
+
+			const __m128d ocXY = _mm_add_pd(
+				_mm_add_pd(_mm_mul_pd(_mat.xyCols[0], cx), _mm_mul_pd(_mat.xyCols[1], cy)),
+				_mm_add_pd(_mm_mul_pd(_mat.xyCols[2], cz), _mat.xyCols[3])
+			);
+
+			const __m128d oeXY = _mm_add_pd(
+				_mm_add_pd(_mm_mul_pd(_mat.absXYCols[0], ex), _mm_mul_pd(_mat.absXYCols[1], ey)),
+				_mm_mul_pd(_mat.absXYCols[2], ez)
+			);
+
+			// (e20 * cx + e21 * cy) + (e22 * cz + e23 * 1).
+			const __m128d czOne = _mm_unpacklo_pd(cZ, _mm_set1_pd(1.0));
+			const __m128d ocZ2 = _mm_add_pd(_mm_mul_pd(_mat.zRow[0], cXY), _mm_mul_pd(_mat.zRow[1], czOne));
+			const __m128d oeZ2 = _mm_add_pd(_mm_mul_pd(_mat.absZRow[0], eXY), _mm_mul_pd(_mat.absZRow[1], eZ));
+
+			const __m128d ocZ = _mm_hadd_pd(ocZ2, ocZ2);
+			const __m128d oeZ = _mm_hadd_pd(oeZ2, oeZ2);
+
+			_mm_storeu_pd(_out, _mm_sub_pd(ocXY, oeXY));
+			_mm_store_sd(_out + 2, _mm_sub_sd(ocZ, oeZ));
+			_mm_storeu_pd(_out + 3, _mm_add_pd(ocXY, oeXY));
+			_mm_store_sd(_out + 5, _mm_add_sd(ocZ, oeZ));
+		}
+
+		template <bool bConstMat, bool bColumn>
+		void AABB3DdTransformMajor_SSE(const double* _mats, const AABB3D<double>* _in, AABB3D<double>* _out, size_t _num) noexcept
+		{
+			const double* in = reinterpret_cast<const double*>(_in);
+			double* out = reinterpret_cast<double*>(_out);
+
+			AABB3DdMat_SSE mat;
+
+			if constexpr (bConstMat)
+				AABB3DdLoadMat_SSE<bColumn>(_mats, mat);
+
+			for (size_t i = 0; i < _num; ++i, in += 6, out += 6)
+			{
+				if constexpr (!bConstMat)
+				{
+					AABB3DdLoadMat_SSE<bColumn>(_mats, mat);
+					_mats += 16;
+				}
+
+				AABB3DdTransform_SSE(mat, in, out);
+			}
+		}
+
+
+		template <bool bConstMat>
+		void AABB3DfTransformBatch_SSE(const float* _mats, const AABB3D<float>* _in, AABB3D<float>* _out, size_t _num, bool _bColumnMajor) noexcept
+		{
+			if (_bColumnMajor)
+				AABB3DfTransformMajor_SSE<bConstMat, true>(_mats, _in, _out, _num);
+			else
+				AABB3DfTransformMajor_SSE<bConstMat, false>(_mats, _in, _out, _num);
+		}
+
+		template <bool bConstMat>
+		void AABB3DdTransformBatch_SSE(const double* _mats, const AABB3D<double>* _in, AABB3D<double>* _out, size_t _num, bool _bColumnMajor) noexcept
+		{
+			if (_bColumnMajor)
+				AABB3DdTransformMajor_SSE<bConstMat, true>(_mats, _in, _out, _num);
+			else
+				AABB3DdTransformMajor_SSE<bConstMat, false>(_mats, _in, _out, _num);
+		}
+
+//}
+
+		template <typename T>
+		struct Mat4KernelsSSE;
+
+		template <>
+		struct Mat4KernelsSSE<float>
+		{
+			static constexpr auto transformPoints = &Mat4fTransformVec3_SSE<true>;
+			static constexpr auto transformDirections = &Mat4fTransformVec3_SSE<false>;
+			static constexpr auto transformVec4 = &Mat4fTransformVec4_SSE;
+			static constexpr auto multiply = &Mat4fMultiplyBatch_SSE<false, false>;
+			static constexpr auto multiplyConstA = &Mat4fMultiplyBatch_SSE<true, false>;
+			static constexpr auto multiplyConstB = &Mat4fMultiplyBatch_SSE<false, true>;
+
+			static constexpr auto aabb3DTransform = &AABB3DfTransformBatch_SSE<false>;
+			static constexpr auto aabb3DTransformConstMat = &AABB3DfTransformBatch_SSE<true>;
+		};
+
+		template <>
+		struct Mat4KernelsSSE<double>
+		{
+			static constexpr auto transformPoints = &Mat4dTransformVec3_SSE<true>;
+			static constexpr auto transformDirections = &Mat4dTransformVec3_SSE<false>;
+			static constexpr auto transformVec4 = &Mat4dTransformVec4_SSE;
+			static constexpr auto multiply = &Mat4dMultiplyBatch_SSE<false, false>;
+			static constexpr auto multiplyConstA = &Mat4dMultiplyBatch_SSE<true, false>;
+			static constexpr auto multiplyConstB = &Mat4dMultiplyBatch_SSE<false, true>;
+
+			static constexpr auto aabb3DTransform = &AABB3DdTransformBatch_SSE<false>;
+			static constexpr auto aabb3DTransformConstMat = &AABB3DdTransformBatch_SSE<true>;
+		};
+	}
+
+
+	template <typename T>
+	const BatchKernels<T>& GetBatchKernelsSSE() noexcept
+	{
+		using M = Mat4KernelsSSE<T>;
+
+		static constexpr BatchKernels<T> kernels{
+			M::transformPoints,
+			M::transformDirections,
+			M::transformVec4,
+			M::multiply,
+			M::multiplyConstA,
+			M::multiplyConstB,
+
+			&Vec3StreamAdd<T>,
+			&Vec3StreamSub<T>,
+			&Vec3StreamAddBroadcast<T>,
+			&Vec3StreamScale<T>,
+			&Vec3StreamNormalize<T>,
+			&Vec3StreamDot<T>,
+			&Vec3StreamCross<T>,
+			&Vec3StreamDist<T>,
+			&Vec3StreamLerp<T>,
+
+			&TrTRSMatrixBatch<T>,
+
+			&QuatNLerp<T>,
+			&QuatSLerp<T>,
+			&QuatSLerpApprox<T>,
+
+			&QuatStreamNormalize<T>,
+			&QuatStreamDot<T>,
+			&QuatStreamMultiply<T>,
+			&QuatStreamRotate<false, T>,
+			&QuatStreamRotate<true, T>,
+
+			M::aabb3DTransform,
+			M::aabb3DTransformConstMat,
+		};
+
+		return kernels;
+	}
+
+	template const BatchKernels<float>& GetBatchKernelsSSE<float>() noexcept;
+	template const BatchKernels<double>& GetBatchKernelsSSE<double>() noexcept;
+}
+
+#endif
@@ -0,0 +1,152 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Dispatch/CPUFeatures.hpp>
+
+#include <atomic>
+
+#include <SA/Maths/Debug.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+	#include <intrin.h>
+
+	#define SA_MATHS_CPUID_X86 1
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+	#include <cpuid.h>
+
+	#define SA_MATHS_CPUID_X86 1
+
+#endif
+
+namespace SA::Maths
+{
+	namespace
+	{
+#if SA_MATHS_CPUID_X86
+
+		void CPUID(uint32_t _leaf, uint32_t _subleaf, uint32_t (&_regs)[4]) noexcept
+		{
+	#if defined(_MSC_VER)
+
+			int regs[4];
+			__cpuidex(regs, static_cast<int>(_leaf), static_cast<int>(_subleaf));
+
+			for (int i = 0; i < 4; ++i)
+				_regs[i] = static_cast<uint32_t>(regs[i]);
+
+	#else
+
+			__cpuid_count(_leaf, _subleaf, _regs[0], _regs[1], _regs[2], _regs[3]);
+
+	#endif
+		}
+
+		/// Read extended control register (OS-enabled register states).
+		uint64_t XGetBV(uint32_t _index) noexcept
+		{
+	#if defined(_MSC_VER)
+
+			return _xgetbv(_index);
+
+	#else
+
+			uint32_t eax = 0u;
+			uint32_t edx = 0u;
+
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(_index));
+
+			return (static_cast<uint64_t>(edx) << 32) | eax;
+
+	#endif
+		}
+
+#endif
+
+		SIMDLevel DetectSIMDLevel() noexcept
+		{
+#if SA_MATHS_CPUID_X86
+
+			uint32_t regs[4]{};	// eax, ebx, ecx, edx.
+
+			CPUID(0u, 0u, regs);
+			const uint32_t maxLeaf = regs[0];
+
+			if (maxLeaf < 1u)
+				return SIMDLevel::Scalar;
+
+			CPUID(1u, 0u, regs);
+
+			const bool bSSE41 = regs[2] & (1u << 19);
+			const bool bFMA = regs[2] & (1u << 12);
+			const bool bOSXSAVE = regs[2] & (1u << 27);
+			const bool bAVX = regs[2] & (1u << 28);
+
+			if (!bSSE41)
+				return SIMDLevel::Scalar;
+
+			// AVX registers must be saved by the OS (XMM and YMM states).
+			if (!bAVX || !bOSXSAVE)
+				return SIMDLevel::SSE41;
+
+			const uint64_t xcr0 = XGetBV(0u);
+
+			if ((xcr0 & 0x6u) != 0x6u || maxLeaf < 7u)
+				return SIMDLevel::SSE41;
+
+			CPUID(7u, 0u, regs);
+
+			const bool bAVX2 = regs[1] & (1u << 5);
+			const bool bAVX512F = regs[1] & (1u << 16);
+
+			if (!bAVX2 || !bFMA)
+				return SIMDLevel::SSE41;
+
+			// AVX-512 registers must be saved by the OS (opmask, ZMM_Hi256 and Hi16_ZMM states).
+			if (bAVX512F && (xcr0 & 0xE6u) == 0xE6u)
+				return SIMDLevel::AVX512;
+
+			return SIMDLevel::AVX2;
+
+#else
+
+			return SIMDLevel::Scalar;
+
+#endif
+		}
+
+		std::atomic<SIMDLevel>& ActiveSIMDLevel() noexcept
+		{
+			static std::atomic<SIMDLevel> level{ GetHostSIMDLevel() };
+
+			return level;
+		}
+	}
+
+
+	SIMDLevel GetHostSIMDLevel() noexcept
+	{
+		static const SIMDLevel hostLevel = DetectSIMDLevel();
+
+		return hostLevel;
+	}
+
+	SIMDLevel GetSIMDLevel() noexcept
+	{
+		return ActiveSIMDLevel().load(std::memory_order_relaxed);
+	}
+
+	SIMDLevel SetSIMDLevel(SIMDLevel _level) noexcept
+	{
+		const SIMDLevel hostLevel = GetHostSIMDLevel();
+
+		SA_WARN(_level <= hostLevel, SA.Maths.Dispatch, L"Requested SIMD level not supported by host: clamped.");
+
+		const SIMDLevel level = _level <= hostLevel ? _level : hostLevel;
+
+		ActiveSIMDLevel().store(level, std::memory_order_relaxed);
+
+		return level;
+	}
+}
@@ -0,0 +1,537 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+/**
+*	Quaternion kernels, generic over the register wrapper.
+*
+*	Included by each BatchKernels<ISA>.cpp after Vector3StreamKernels.inl:
+*	same Vec3StreamPack<T> with LoadU / StoreU (external arrays), ScalarSqrt (scalar tails) and
+*	XorSign (_v with its sign flipped in lanes where _s is negative).
+*	Quaternions are given as Structure-Of-Arrays component pointers (w, x, y, z).
+*	QuatStream arrays are aligned and padded on QuatStream::Alignment (same as Vec3Stream):
+*	full packs use aligned load/store, remaining quaternions use the same lanes code on scalars.
+*/
+
+#include <type_traits>
+
+namespace SA::Intl
+{
+	namespace
+	{
+		template <typename T>
+		struct QuatLerpCoefficients;
+
+		template <>
+		struct QuatLerpCoefficients<float>
+		{
+			/// atan(t) = t + t^3 * P(t^2), |t| <= tan(pi / 8) (Cephes).
+			static constexpr float atanP[] = { 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f, -3.33329491539e-1f };
+
+			/// sin(x) / x = S(x^2), |x| <= pi / 2 (Taylor series, max error 4e-10).
+			static constexpr float sinc[] = {
+				1.0f / 6227020800.0f, -1.0f / 39916800.0f, 1.0f / 362880.0f, -1.0f / 5040.0f, 1.0f / 120.0f, -1.0f / 6.0f, 1.0f
+			};
+		};
+
+		template <>
+		struct QuatLerpCoefficients<double>
+		{
+			/// atan(t) = t + t^3 * P(t^2) / Q(t^2), |t| <= 0.66 (Cephes).
+			static constexpr double atanP[] = {
+				-8.750608600031904122785e-1, -1.615753718733365076637e1, -7.500855792314704667340e1,
+				-1.228866684490136173410e2, -6.485021904942025371773e1
+			};
+
+			static constexpr double atanQ[] = {
+				1.0, 2.485846490142306297962e1, 1.650270098316988542046e2, 4.328810604912902668951e2,
+				4.853903996359136964868e2, 1.945506571482613964425e2
+			};
+
+			/// sin(x) / x = S(x^2), |x| <= pi / 2 (Taylor series, max error 8e-19).
+			static constexpr double sinc[] = {
+				-1.0 / 25852016738884976640000.0, 1.0 / 51090942171709440000.0, -1.0 / 121645100408832000.0,
+				1.0 / 355687428096000.0, -1.0 / 1307674368000.0, 1.0 / 6227020800.0, -1.0 / 39916800.0,
+				1.0 / 362880.0, -1.0 / 5040.0, 1.0 / 120.0, -1.0 / 6.0, 1.0
+			};
+		};
+
+
+		/// Horner evaluation, highest degree coefficient first.
+		template <typename T, size_t N>
+		typename Vec3StreamPack<T>::Reg QuatPoly(typename Vec3StreamPack<T>::Reg _x, const T (&_coeffs)[N]) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			typename P::Reg res = P::Set1(_coeffs[0]);
+
+			for (size_t i = 1; i < N; ++i)
+				res = P::Add(P::Mul(res, _x), P::Set1(_coeffs[i]));
+
+			return res;
+		}
+
+		/// atan(_t) for 0 <= _t <= tan(pi / 8).
+		template <typename T>
+		typename Vec3StreamPack<T>::Reg QuatATanReduced(typename Vec3StreamPack<T>::Reg _t) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+			using C = QuatLerpCoefficients<T>;
+
+			const typename P::Reg z = P::Mul(_t, _t);
+			typename P::Reg poly = QuatPoly<T>(z, C::atanP);
+
+			if constexpr (std::is_same_v<T, double>)
+				poly = P::Div(poly, QuatPoly<T>(z, C::atanQ));
+
+			return P::Add(_t, P::Mul(P::Mul(_t, z), poly));
+		}
+
+		template <typename T>
+		typename Vec3StreamPack<T>::Reg QuatDot(const typename Vec3StreamPack<T>::Reg* _l, const typename Vec3StreamPack<T>::Reg* _r) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			return P::Add(P::Add(P::Mul(_l[0], _r[0]), P::Mul(_l[1], _r[1])), P::Add(P::Mul(_l[2], _r[2]), P::Mul(_l[3], _r[3])));
+		}
+
+
+		/**
+		*	Run _lanes(start, end, out) on Width quaternions per iteration.
+		*	Remaining quaternions are padded with identity in local arrays.
+		*/
+		template <typename T, typename LanesT>
+		void QuatLerpBatch(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, size_t _num, LanesT _lanes) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+			using Reg = typename P::Reg;
+
+			const T* const start[4] = { _sw, _sx, _sy, _sz };
+			const T* const end[4] = { _ew, _ex, _ey, _ez };
+			T* const out[4] = { _ow, _ox, _oy, _oz };
+
+			Reg s[4];
+			Reg e[4];
+			Reg o[4];
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				for (size_t c = 0; c < 4u; ++c)
+				{
+					s[c] = P::LoadU(start[c] + i);
+					e[c] = P::LoadU(end[c] + i);
+				}
+
+				_lanes(s, e, o);
+
+				// Store after every load: _out may alias _start or _end.
+				for (size_t c = 0; c < 4u; ++c)
+					P::StoreU(out[c] + i, o[c]);
+			}
+
+			if (i < _num)
+			{
+				const size_t rem = _num - i;
+
+				T sTail[4][P::Width];
+				T eTail[4][P::Width];
+				T oTail[4][P::Width];
+
+				for (size_t c = 0; c < 4u; ++c)
+				{
+					for (size_t l = 0; l < P::Width; ++l)
+					{
+						sTail[c][l] = l < rem ? start[c][i + l] : T(c == 0u);
+						eTail[c][l] = l < rem ? end[c][i + l] : T(c == 0u);
+					}
+
+					s[c] = P::LoadU(sTail[c]);
+					e[c] = P::LoadU(eTail[c]);
+				}
+
+				_lanes(s, e, o);
+
+				for (size_t c = 0; c < 4u; ++c)
+				{
+					P::StoreU(oTail[c], o[c]);
+
+					for (size_t l = 0; l < rem; ++l)
+						out[c][i + l] = oTail[c][l];
+				}
+			}
+		}
+
+
+		/// Shortest path normalized lerp.
+		template <typename T>
+		void QuatNLerp(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+			using Reg = typename P::Reg;
+
+			const Reg one = P::Set1(T(1));
+			const Reg alpha = P::Set1(_alpha);
+
+			QuatLerpBatch<T>(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _num,
+				[&](const Reg* _s, const Reg* _e, Reg* _o)
+			{
+				const Reg dot = QuatDot<T>(_s, _e);
+
+				Reg sqrLen = P::Set1(T(0));
+
+				for (size_t c = 0; c < 4u; ++c)
+				{
+					_o[c] = P::Add(_s[c], P::Mul(alpha, P::Sub(P::XorSign(_e[c], dot), _s[c])));
+					sqrLen = P::Add(sqrLen, P::Mul(_o[c], _o[c]));
+				}
+
+				const Reg invLen = P::Div(one, P::Sqrt(sqrLen));
+
+				for (size_t c = 0; c < 4u; ++c)
+					_o[c] = P::Mul(_o[c], invLen);
+			});
+		}
+
+		/**
+		*	Shortest path slerp without branch nor division by sin(angle).
+		*	angle = 4 * atan(|s - e| / (|s + e| + sqrt(|s - e|^2 + |s + e|^2))): half angle identity twice,
+		*	the atan input stays in [0, tan(pi / 8)] (angle <= pi / 2 on the shortest path).
+		*	sin(a * angle) / sin(angle) = a * sinc(a * angle) / sinc(angle): no singularity at angle == 0.
+		*/
+		template <typename T>
+		void QuatSLerp(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+			using Reg = typename P::Reg;
+			using C = QuatLerpCoefficients<T>;
+
+			const Reg one = P::Set1(T(1));
+			const Reg four = P::Set1(T(4));
+
+			const Reg alpha = P::Set1(_alpha);
+			const Reg sqrAlpha = P::Set1(_alpha * _alpha);
+			const Reg beta = P::Set1(T(1) - _alpha);
+			const Reg sqrBeta = P::Set1((T(1) - _alpha) * (T(1) - _alpha));
+
+			QuatLerpBatch<T>(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _num,
+				[&](const Reg* _s, const Reg* _e, Reg* _o)
+			{
+				const Reg dot = QuatDot<T>(_s, _e);
+
+				Reg e[4];
+				Reg sqrDiff = P::Set1(T(0));
+				Reg sqrSum = P::Set1(T(0));
+
+				for (size_t c = 0; c < 4u; ++c)
+				{
+					e[c] = P::XorSign(_e[c], dot);
+
+					const Reg diff = P::Sub(_s[c], e[c]);
+					const Reg sum = P::Add(_s[c], e[c]);
+
+					sqrDiff = P::Add(sqrDiff, P::Mul(diff, diff));
+					sqrSum = P::Add(sqrSum, P::Mul(sum, sum));
+				}
+
+				// |s + e| >= sqrt(2) on the shortest path.
+				const Reg tanQuarter = P::Div(P::Sqrt(sqrDiff), P::Add(P::Sqrt(sqrSum), P::Sqrt(P::Add(sqrDiff, sqrSum))));
+				const Reg angle = P::Mul(four, QuatATanReduced<T>(tanQuarter));
+				const Reg sqrAngle = P::Mul(angle, angle);
+
+				const Reg invSinc = P::Div(one, QuatPoly<T>(sqrAngle, C::sinc));
+
+				const Reg wStart = P::Mul(P::Mul(beta, QuatPoly<T>(P::Mul(sqrBeta, sqrAngle), C::sinc)), invSinc);
+				const Reg wEnd = P::Mul(P::Mul(alpha, QuatPoly<T>(P::Mul(sqrAlpha, sqrAngle), C::sinc)), invSinc);
+
+				for (size_t c = 0; c < 4u; ++c)
+					_o[c] = P::Add(P::Mul(wStart, _s[c]), P::Mul(wEnd, e[c]));
+			});
+		}
+
+		/**
+		*	Shortest path slerp polynomial approximation, no trigonometry.
+		*	Reference: D. Eberly, A Fast and Accurate Algorithm for Computing SLERP (2011).
+		*	sin(a * angle) / sin(angle) = a * (1 + b0 (x - 1) (1 + b1 (x - 1) (...))), x = cos(angle),
+		*	b(i) = (a^2 - (i + 1)^2) / ((i + 1) (2i + 3)): 8 terms, last term scaled to balance the truncation error.
+		*	b(i) only depend on _alpha: computed once per call.
+		*/
+		template <typename T>
+		void QuatSLerpApprox(const T* _sw, const T* _sx, const T* _sy, const T* _sz,
+			const T* _ew, const T* _ex, const T* _ey, const T* _ez,
+			T* _ow, T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+			using Reg = typename P::Reg;
+
+			constexpr size_t termNum = 8u;
+			constexpr T mu = T(1.85298109240830);
+
+			const T beta = T(1) - _alpha;
+
+			Reg bStart[termNum];
+			Reg bEnd[termNum];
+
+			for (size_t i = 0; i < termNum; ++i)
+			{
+				const T n = static_cast<T>(i + 1);
+				const T scale = i == termNum - 1 ? mu : T(1);
+
+				const T u = scale / (n * (T(2) * n + T(1)));
+				const T v = scale * n / (T(2) * n + T(1));
+
+				bStart[i] = P::Set1(u * beta * beta - v);
+				bEnd[i] = P::Set1(u * _alpha * _alpha - v);
+			}
+
+			const Reg one = P::Set1(T(1));
+			const Reg alpha = P::Set1(_alpha);
+			const Reg betaR = P::Set1(beta);
+
+			QuatLerpBatch<T>(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _num,
+				[&](const Reg* _s, const Reg* _e, Reg* _o)
+			{
+				const Reg dot = QuatDot<T>(_s, _e);
+
+				// |dot| - 1.
+				const Reg xm1 = P::Sub(P::XorSign(dot, dot), one);
+
+				Reg wStart = P::Add(one, P::Mul(bStart[termNum - 1], xm1));
+				Reg wEnd = P::Add(one, P::Mul(bEnd[termNum - 1], xm1));
+
+				for (size_t i = termNum - 1; i-- > 0;)
+				{
+					wStart = P::Add(one, P::Mul(P::Mul(bStart[i], xm1), wStart));
+					wEnd = P::Add(one, P::Mul(P::Mul(bEnd[i], xm1), wEnd));
+				}
+
+				wStart = P::Mul(wStart, betaR);
+				wEnd = P::Mul(wEnd, alpha);
+
+				for (size_t c = 0; c < 4u; ++c)
+					_o[c] = P::Add(P::Mul(wStart, _s[c]), P::Mul(wEnd, P::XorSign(_e[c], dot)));
+			});
+		}
+	
+
+		/// Scalar operations for stream kernels tail: same interface as Vec3StreamPack arithmetic.
+		template <typename T>
+		struct QuatScalarOps
+		{
+			using Reg = T;
+
+			static Reg Add(Reg _l, Reg _r) noexcept { return _l + _r; }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _l - _r; }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _l * _r; }
+			static Reg Div(Reg _l, Reg _r) noexcept { return _l / _r; }
+			static Reg Sqrt(Reg _r) noexcept { return Vec3StreamPack<T>::ScalarSqrt(_r); }
+		};
+
+
+		/// _o = _l * _r (Hamilton product, Quat::Rotate(const Quat&)). _o may alias _l or _r.
+		template <typename Ops>
+		void QuatMultiplyLanes(const typename Ops::Reg* _l, const typename Ops::Reg* _r, typename Ops::Reg* _o) noexcept
+		{
+			using O = Ops;
+
+			const typename O::Reg w = O::Sub(O::Sub(O::Mul(_l[0], _r[0]), O::Mul(_l[1], _r[1])), O::Add(O::Mul(_l[2], _r[2]), O::Mul(_l[3], _r[3])));
+			const typename O::Reg x = O::Add(O::Add(O::Mul(_l[0], _r[1]), O::Mul(_l[1], _r[0])), O::Sub(O::Mul(_l[2], _r[3]), O::Mul(_l[3], _r[2])));
+			const typename O::Reg y = O::Add(O::Sub(O::Mul(_l[0], _r[2]), O::Mul(_l[1], _r[3])), O::Add(O::Mul(_l[2], _r[0]), O::Mul(_l[3], _r[1])));
+			const typename O::Reg z = O::Add(O::Add(O::Mul(_l[0], _r[3]), O::Mul(_l[1], _r[2])), O::Sub(O::Mul(_l[3], _r[0]), O::Mul(_l[2], _r[1])));
+
+			_o[0] = w;
+			_o[1] = x;
+			_o[2] = y;
+			_o[3] = z;
+		}
+
+		/**
+		*	_o = _v rotated by _q (Quat::Rotate(const Vec3&)), or by its conjugate when bUnRotate.
+		*	A = 2 (u x v), v' = v +/- w A + u x A: 2 is applied with an addition, 15 multiplications.
+		*	_o may alias _v.
+		*/
+		template <bool bUnRotate, typename Ops>
+		void QuatRotateLanes(const typename Ops::Reg* _q, const typename Ops::Reg* _v, typename Ops::Reg* _o) noexcept
+		{
+			using O = Ops;
+			using Reg = typename O::Reg;
+
+			Reg ax = O::Sub(O::Mul(_q[2], _v[2]), O::Mul(_q[3], _v[1]));
+			Reg ay = O::Sub(O::Mul(_q[3], _v[0]), O::Mul(_q[1], _v[2]));
+			Reg az = O::Sub(O::Mul(_q[1], _v[1]), O::Mul(_q[2], _v[0]));
+
+			ax = O::Add(ax, ax);
+			ay = O::Add(ay, ay);
+			az = O::Add(az, az);
+
+			const Reg cx = O::Sub(O::Mul(_q[2], az), O::Mul(_q[3], ay));
+			const Reg cy = O::Sub(O::Mul(_q[3], ax), O::Mul(_q[1], az));
+			const Reg cz = O::Sub(O::Mul(_q[1], ay), O::Mul(_q[2], ax));
+
+			// Conjugate: A and u change sign, u x A does not.
+			if constexpr (bUnRotate)
+			{
+				_o[0] = O::Add(O::Sub(_v[0], O::Mul(_q[0], ax)), cx);
+				_o[1] = O::Add(O::Sub(_v[1], O::Mul(_q[0], ay)), cy);
+				_o[2] = O::Add(O::Sub(_v[2], O::Mul(_q[0], az)), cz);
+			}
+			else
+			{
+				_o[0] = O::Add(O::Add(_v[0], O::Mul(_q[0], ax)), cx);
+				_o[1] = O::Add(O::Add(_v[1], O::Mul(_q[0], ay)), cy);
+				_o[2] = O::Add(O::Add(_v[2], O::Mul(_q[0], az)), cz);
+			}
+		}
+
+
+		template <typename T>
+		void QuatStreamNormalize(T* _w, T* _x, T* _y, T* _z, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				const typename P::Reg w = P::Load(_w + i);
+				const typename P::Reg x = P::Load(_x + i);
+				const typename P::Reg y = P::Load(_y + i);
+				const typename P::Reg z = P::Load(_z + i);
+
+				const typename P::Reg len = P::Sqrt(P::Add(P::Add(P::Mul(w, w), P::Mul(x, x)), P::Add(P::Mul(y, y), P::Mul(z, z))));
+
+				P::Store(_w + i, P::Div(w, len));
+				P::Store(_x + i, P::Div(x, len));
+				P::Store(_y + i, P::Div(y, len));
+				P::Store(_z + i, P::Div(z, len));
+			}
+
+			for (; i < _num; ++i)
+			{
+				const T len = P::ScalarSqrt(_w[i] * _w[i] + _x[i] * _x[i] + _y[i] * _y[i] + _z[i] * _z[i]);
+
+				_w[i] /= len;
+				_x[i] /= len;
+				_y[i] /= len;
+				_z[i] /= len;
+			}
+		}
+
+		template <typename T>
+		void QuatStreamDot(const T* _lw, const T* _lx, const T* _ly, const T* _lz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz, T* _out, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				const typename P::Reg ww = P::Mul(P::Load(_lw + i), P::Load(_rw + i));
+				const typename P::Reg xx = P::Mul(P::Load(_lx + i), P::Load(_rx + i));
+				const typename P::Reg yy = P::Mul(P::Load(_ly + i), P::Load(_ry + i));
+				const typename P::Reg zz = P::Mul(P::Load(_lz + i), P::Load(_rz + i));
+
+				P::StoreU(_out + i, P::Add(P::Add(ww, xx), P::Add(yy, zz)));
+			}
+
+			for (; i < _num; ++i)
+				_out[i] = (_lw[i] * _rw[i] + _lx[i] * _rx[i]) + (_ly[i] * _ry[i] + _lz[i] * _rz[i]);
+		}
+
+		template <typename T>
+		void QuatStreamMultiply(const T* _lw, const T* _lx, const T* _ly, const T* _lz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz,
+			T* _ow, T* _ox, T* _oy, T* _oz, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			const T* const lhs[4] = { _lw, _lx, _ly, _lz };
+			const T* const rhs[4] = { _rw, _rx, _ry, _rz };
+			T* const out[4] = { _ow, _ox, _oy, _oz };
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				typename P::Reg l[4];
+				typename P::Reg r[4];
+
+				for (size_t c = 0; c < 4u; ++c)
+				{
+					l[c] = P::Load(lhs[c] + i);
+					r[c] = P::Load(rhs[c] + i);
+				}
+
+				QuatMultiplyLanes<P>(l, r, l);
+
+				for (size_t c = 0; c < 4u; ++c)
+					P::Store(out[c] + i, l[c]);
+			}
+
+			for (; i < _num; ++i)
+			{
+				T l[4];
+				T r[4];
+
+				for (size_t c = 0; c < 4u; ++c)
+				{
+					l[c] = lhs[c][i];
+					r[c] = rhs[c][i];
+				}
+
+				QuatMultiplyLanes<QuatScalarOps<T>>(l, r, l);
+
+				for (size_t c = 0; c < 4u; ++c)
+					out[c][i] = l[c];
+			}
+		}
+
+		template <bool bUnRotate, typename T>
+		void QuatStreamRotate(const T* _qw, const T* _qx, const T* _qy, const T* _qz,
+			const T* _vx, const T* _vy, const T* _vz,
+			T* _ox, T* _oy, T* _oz, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			const T* const quats[4] = { _qw, _qx, _qy, _qz };
+			const T* const vecs[3] = { _vx, _vy, _vz };
+			T* const out[3] = { _ox, _oy, _oz };
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				typename P::Reg q[4];
+				typename P::Reg v[3];
+
+				for (size_t c = 0; c < 4u; ++c)
+					q[c] = P::Load(quats[c] + i);
+
+				for (size_t c = 0; c < 3u; ++c)
+					v[c] = P::Load(vecs[c] + i);
+
+				QuatRotateLanes<bUnRotate, P>(q, v, v);
+
+				for (size_t c = 0; c < 3u; ++c)
+					P::Store(out[c] + i, v[c]);
+			}
+
+			for (; i < _num; ++i)
+			{
+				const T q[4] = { _qw[i], _qx[i], _qy[i], _qz[i] };
+				T v[3] = { _vx[i], _vy[i], _vz[i] };
+
+				QuatRotateLanes<bUnRotate, QuatScalarOps<T>>(q, v, v);
+
+				for (size_t c = 0; c < 3u; ++c)
+					out[c][i] = v[c];
+			}
+		}
+	}
+}
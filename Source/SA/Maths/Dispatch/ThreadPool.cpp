@@ -0,0 +1,71 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Dispatch/ThreadPool.hpp>
+
+namespace SA::Maths
+{
+	ThreadPool::ThreadPool(uint32_t _threadNum)
+	{
+		// hardware_concurrency() may return 0.
+		if (_threadNum <= 1u)
+			return;
+
+		mThreads.reserve(_threadNum - 1u);
+
+		for (uint32_t t = 1u; t < _threadNum; ++t)
+			mThreads.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStop = true;
+		}
+
+		mStartCondition.notify_all();
+
+		for (auto& thread : mThreads)
+			thread.join();
+	}
+
+
+	uint32_t ThreadPool::GetThreadNum() const noexcept
+	{
+		return static_cast<uint32_t>(mThreads.size()) + 1u;
+	}
+
+
+	void ThreadPool::Run()
+	{
+		for (uint32_t i = mNext.fetch_add(1u, std::memory_order_relaxed); i < mEnd; i = mNext.fetch_add(1u, std::memory_order_relaxed))
+			mJob(mJobData, i);
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		uint32_t generation = 0u;
+
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mStartCondition.wait(lock, [this, generation]() { return mStop || generation != mGeneration; });
+
+				if (mStop)
+					return;
+
+				generation = mGeneration;
+			}
+
+			Run();
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				if (--mRunningNum == 0u)
+					mEndCondition.notify_one();
+			}
+		}
+	}
+}
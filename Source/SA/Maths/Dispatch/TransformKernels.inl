@@ -0,0 +1,140 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+/**
+*	Transform kernels, generic over the register wrapper.
+*
+*	Included by each BatchKernels<ISA>.cpp after Vector3StreamKernels.inl:
+*	same Vec3StreamPack<T> with LoadU (unaligned input arrays) and
+*	StoreMat4 (16 element registers, one matrix per lane, to Width consecutive matrices).
+*/
+
+namespace SA::Intl
+{
+	namespace
+	{
+		/**
+		*	Same operations as TrTRSMatrixFunctor (MakeRotation, ApplyScaleToRotation, ApplyTranslation)
+		*	with one transform per lane.
+		*/
+		template <bool bColumn, typename T>
+		void TrTRSMatrixBatchMajor(const T* _px, const T* _py, const T* _pz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz,
+			const T* _sx, const T* _sy, const T* _sz,
+			T* _out, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+			using Reg = typename P::Reg;
+
+			// Element index in memory order.
+			constexpr auto Index = [](size_t _r, size_t _c) { return bColumn ? _c * 4 + _r : _r * 4 + _c; };
+
+			const Reg zero = P::Set1(T(0));
+			const Reg one = P::Set1(T(1));
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width, _out += 16 * P::Width)
+			{
+				const Reg w = P::LoadU(_rw + i);
+				const Reg x = P::LoadU(_rx + i);
+				const Reg y = P::LoadU(_ry + i);
+				const Reg z = P::LoadU(_rz + i);
+
+				const Reg x2 = P::Add(x, x);
+				const Reg y2 = P::Add(y, y);
+				const Reg z2 = P::Add(z, z);
+
+				const Reg XW2 = P::Mul(x2, w);
+				const Reg XX2 = P::Mul(x2, x);
+				const Reg XY2 = P::Mul(x2, y);
+				const Reg XZ2 = P::Mul(x2, z);
+
+				const Reg YW2 = P::Mul(y2, w);
+				const Reg YY2 = P::Mul(y2, y);
+				const Reg YZ2 = P::Mul(y2, z);
+
+				const Reg ZW2 = P::Mul(z2, w);
+				const Reg ZZ2 = P::Mul(z2, z);
+
+				const Reg sx = P::LoadU(_sx + i);
+				const Reg sy = P::LoadU(_sy + i);
+				const Reg sz = P::LoadU(_sz + i);
+
+				Reg elems[16];
+
+				elems[Index(0, 0)] = P::Mul(P::Sub(P::Sub(one, YY2), ZZ2), sx);
+				elems[Index(0, 1)] = P::Mul(P::Sub(XY2, ZW2), sy);
+				elems[Index(0, 2)] = P::Mul(P::Add(XZ2, YW2), sz);
+				elems[Index(0, 3)] = P::LoadU(_px + i);
+
+				elems[Index(1, 0)] = P::Mul(P::Add(XY2, ZW2), sx);
+				elems[Index(1, 1)] = P::Mul(P::Sub(P::Sub(one, XX2), ZZ2), sy);
+				elems[Index(1, 2)] = P::Mul(P::Sub(YZ2, XW2), sz);
+				elems[Index(1, 3)] = P::LoadU(_py + i);
+
+				elems[Index(2, 0)] = P::Mul(P::Sub(XZ2, YW2), sx);
+				elems[Index(2, 1)] = P::Mul(P::Add(YZ2, XW2), sy);
+				elems[Index(2, 2)] = P::Mul(P::Sub(P::Sub(one, XX2), YY2), sz);
+				elems[Index(2, 3)] = P::LoadU(_pz + i);
+
+				elems[Index(3, 0)] = zero;
+				elems[Index(3, 1)] = zero;
+				elems[Index(3, 2)] = zero;
+				elems[Index(3, 3)] = one;
+
+				P::StoreMat4(_out, elems);
+			}
+
+			for (; i < _num; ++i, _out += 16)
+			{
+				const T x2 = _rx[i] + _rx[i];
+				const T y2 = _ry[i] + _ry[i];
+				const T z2 = _rz[i] + _rz[i];
+
+				const T XW2 = x2 * _rw[i];
+				const T XX2 = x2 * _rx[i];
+				const T XY2 = x2 * _ry[i];
+				const T XZ2 = x2 * _rz[i];
+
+				const T YW2 = y2 * _rw[i];
+				const T YY2 = y2 * _ry[i];
+				const T YZ2 = y2 * _rz[i];
+
+				const T ZW2 = z2 * _rw[i];
+				const T ZZ2 = z2 * _rz[i];
+
+				_out[Index(0, 0)] = (T(1) - YY2 - ZZ2) * _sx[i];
+				_out[Index(0, 1)] = (XY2 - ZW2) * _sy[i];
+				_out[Index(0, 2)] = (XZ2 + YW2) * _sz[i];
+				_out[Index(0, 3)] = _px[i];
+
+				_out[Index(1, 0)] = (XY2 + ZW2) * _sx[i];
+				_out[Index(1, 1)] = (T(1) - XX2 - ZZ2) * _sy[i];
+				_out[Index(1, 2)] = (YZ2 - XW2) * _sz[i];
+				_out[Index(1, 3)] = _py[i];
+
+				_out[Index(2, 0)] = (XZ2 - YW2) * _sx[i];
+				_out[Index(2, 1)] = (YZ2 + XW2) * _sy[i];
+				_out[Index(2, 2)] = (T(1) - XX2 - YY2) * _sz[i];
+				_out[Index(2, 3)] = _pz[i];
+
+				_out[Index(3, 0)] = T(0);
+				_out[Index(3, 1)] = T(0);
+				_out[Index(3, 2)] = T(0);
+				_out[Index(3, 3)] = T(1);
+			}
+		}
+
+		template <typename T>
+		void TrTRSMatrixBatch(const T* _px, const T* _py, const T* _pz,
+			const T* _rw, const T* _rx, const T* _ry, const T* _rz,
+			const T* _sx, const T* _sy, const T* _sz,
+			T* _out, size_t _num, bool _bColumnMajor) noexcept
+		{
+			if (_bColumnMajor)
+				TrTRSMatrixBatchMajor<true>(_px, _py, _pz, _rw, _rx, _ry, _rz, _sx, _sy, _sz, _out, _num);
+			else
+				TrTRSMatrixBatchMajor<false>(_px, _py, _pz, _rw, _rx, _ry, _rz, _sx, _sy, _sz, _out, _num);
+		}
+	}
+}
@@ -0,0 +1,256 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+/**
+*	Vec3Stream kernels, generic over the register wrapper.
+*
+*	Included by each BatchKernels<ISA>.cpp after the definition of its own
+*	Vec3StreamPack<T> in SA::Intl anonymous namespace:
+*	Width, Reg, Load, Store, StoreU, Set1, Add, Sub, Mul, Div, Sqrt and ScalarSqrt.
+*
+*	Scalar tails use P::ScalarSqrt instead of std::sqrt: an inline std:: function would be
+*	emitted with the including translation unit ISA flags (see BatchKernelsAVX.cpp).
+*/
+
+namespace SA::Intl
+{
+	namespace
+	{
+		/*
+		*	Kernels.
+		*	Stream arrays are aligned and padded on Vec3Stream::Alignment:
+		*	full packs use aligned load/store, remaining vectors use scalar tail loop.
+		*	External output arrays (Dot, Dist) use unaligned store.
+		*/
+
+		template <typename T>
+		void Vec3StreamAdd(T* _x, T* _y, T* _z, const T* _rx, const T* _ry, const T* _rz, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				P::Store(_x + i, P::Add(P::Load(_x + i), P::Load(_rx + i)));
+				P::Store(_y + i, P::Add(P::Load(_y + i), P::Load(_ry + i)));
+				P::Store(_z + i, P::Add(P::Load(_z + i), P::Load(_rz + i)));
+			}
+
+			for (; i < _num; ++i)
+			{
+				_x[i] += _rx[i];
+				_y[i] += _ry[i];
+				_z[i] += _rz[i];
+			}
+		}
+
+		template <typename T>
+		void Vec3StreamSub(T* _x, T* _y, T* _z, const T* _rx, const T* _ry, const T* _rz, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				P::Store(_x + i, P::Sub(P::Load(_x + i), P::Load(_rx + i)));
+				P::Store(_y + i, P::Sub(P::Load(_y + i), P::Load(_ry + i)));
+				P::Store(_z + i, P::Sub(P::Load(_z + i), P::Load(_rz + i)));
+			}
+
+			for (; i < _num; ++i)
+			{
+				_x[i] -= _rx[i];
+				_y[i] -= _ry[i];
+				_z[i] -= _rz[i];
+			}
+		}
+
+		template <typename T>
+		void Vec3StreamAddBroadcast(T* _x, T* _y, T* _z, const Vec3<T>& _rhs, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			const typename P::Reg rx = P::Set1(_rhs.x);
+			const typename P::Reg ry = P::Set1(_rhs.y);
+			const typename P::Reg rz = P::Set1(_rhs.z);
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				P::Store(_x + i, P::Add(P::Load(_x + i), rx));
+				P::Store(_y + i, P::Add(P::Load(_y + i), ry));
+				P::Store(_z + i, P::Add(P::Load(_z + i), rz));
+			}
+
+			for (; i < _num; ++i)
+			{
+				_x[i] += _rhs.x;
+				_y[i] += _rhs.y;
+				_z[i] += _rhs.z;
+			}
+		}
+
+		template <typename T>
+		void Vec3StreamScale(T* _x, T* _y, T* _z, T _scale, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			const typename P::Reg scale = P::Set1(_scale);
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				P::Store(_x + i, P::Mul(P::Load(_x + i), scale));
+				P::Store(_y + i, P::Mul(P::Load(_y + i), scale));
+				P::Store(_z + i, P::Mul(P::Load(_z + i), scale));
+			}
+
+			for (; i < _num; ++i)
+			{
+				_x[i] *= _scale;
+				_y[i] *= _scale;
+				_z[i] *= _scale;
+			}
+		}
+
+		template <typename T>
+		void Vec3StreamNormalize(T* _x, T* _y, T* _z, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				const typename P::Reg x = P::Load(_x + i);
+				const typename P::Reg y = P::Load(_y + i);
+				const typename P::Reg z = P::Load(_z + i);
+
+				const typename P::Reg len = P::Sqrt(P::Add(P::Add(P::Mul(x, x), P::Mul(y, y)), P::Mul(z, z)));
+
+				P::Store(_x + i, P::Div(x, len));
+				P::Store(_y + i, P::Div(y, len));
+				P::Store(_z + i, P::Div(z, len));
+			}
+
+			for (; i < _num; ++i)
+			{
+				const T len = P::ScalarSqrt(_x[i] * _x[i] + _y[i] * _y[i] + _z[i] * _z[i]);
+
+				_x[i] /= len;
+				_y[i] /= len;
+				_z[i] /= len;
+			}
+		}
+
+		template <typename T>
+		void Vec3StreamDot(const T* _lx, const T* _ly, const T* _lz,
+			const T* _rx, const T* _ry, const T* _rz, T* _out, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				const typename P::Reg xx = P::Mul(P::Load(_lx + i), P::Load(_rx + i));
+				const typename P::Reg yy = P::Mul(P::Load(_ly + i), P::Load(_ry + i));
+				const typename P::Reg zz = P::Mul(P::Load(_lz + i), P::Load(_rz + i));
+
+				P::StoreU(_out + i, P::Add(P::Add(xx, yy), zz));
+			}
+
+			for (; i < _num; ++i)
+				_out[i] = _lx[i] * _rx[i] + _ly[i] * _ry[i] + _lz[i] * _rz[i];
+		}
+
+		template <typename T>
+		void Vec3StreamCross(const T* _lx, const T* _ly, const T* _lz,
+			const T* _rx, const T* _ry, const T* _rz,
+			T* _ox, T* _oy, T* _oz, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				const typename P::Reg lx = P::Load(_lx + i);
+				const typename P::Reg ly = P::Load(_ly + i);
+				const typename P::Reg lz = P::Load(_lz + i);
+
+				const typename P::Reg rx = P::Load(_rx + i);
+				const typename P::Reg ry = P::Load(_ry + i);
+				const typename P::Reg rz = P::Load(_rz + i);
+
+				P::Store(_ox + i, P::Sub(P::Mul(ly, rz), P::Mul(lz, ry)));
+				P::Store(_oy + i, P::Sub(P::Mul(lz, rx), P::Mul(lx, rz)));
+				P::Store(_oz + i, P::Sub(P::Mul(lx, ry), P::Mul(ly, rx)));
+			}
+
+			for (; i < _num; ++i)
+			{
+				_ox[i] = _ly[i] * _rz[i] - _lz[i] * _ry[i];
+				_oy[i] = _lz[i] * _rx[i] - _lx[i] * _rz[i];
+				_oz[i] = _lx[i] * _ry[i] - _ly[i] * _rx[i];
+			}
+		}
+
+		template <typename T>
+		void Vec3StreamDist(const T* _sx, const T* _sy, const T* _sz,
+			const T* _ex, const T* _ey, const T* _ez, T* _out, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				const typename P::Reg dx = P::Sub(P::Load(_ex + i), P::Load(_sx + i));
+				const typename P::Reg dy = P::Sub(P::Load(_ey + i), P::Load(_sy + i));
+				const typename P::Reg dz = P::Sub(P::Load(_ez + i), P::Load(_sz + i));
+
+				P::StoreU(_out + i, P::Sqrt(P::Add(P::Add(P::Mul(dx, dx), P::Mul(dy, dy)), P::Mul(dz, dz))));
+			}
+
+			for (; i < _num; ++i)
+			{
+				const T dx = _ex[i] - _sx[i];
+				const T dy = _ey[i] - _sy[i];
+				const T dz = _ez[i] - _sz[i];
+
+				_out[i] = P::ScalarSqrt(dx * dx + dy * dy + dz * dz);
+			}
+		}
+
+		template <typename T>
+		void Vec3StreamLerp(const T* _sx, const T* _sy, const T* _sz,
+			const T* _ex, const T* _ey, const T* _ez,
+			T* _ox, T* _oy, T* _oz, T _alpha, size_t _num) noexcept
+		{
+			using P = Vec3StreamPack<T>;
+
+			const typename P::Reg alphaP = P::Set1(_alpha);
+			const typename P::Reg oneMinusAlphaP = P::Set1(T(1) - _alpha);
+
+			size_t i = 0;
+
+			for (; i + P::Width <= _num; i += P::Width)
+			{
+				P::Store(_ox + i, P::Add(P::Mul(oneMinusAlphaP, P::Load(_sx + i)), P::Mul(alphaP, P::Load(_ex + i))));
+				P::Store(_oy + i, P::Add(P::Mul(oneMinusAlphaP, P::Load(_sy + i)), P::Mul(alphaP, P::Load(_ey + i))));
+				P::Store(_oz + i, P::Add(P::Mul(oneMinusAlphaP, P::Load(_sz + i)), P::Mul(alphaP, P::Load(_ez + i))));
+			}
+
+			for (; i < _num; ++i)
+			{
+				_ox[i] = (T(1) - _alpha) * _sx[i] + _alpha * _ex[i];
+				_oy[i] = (T(1) - _alpha) * _sy[i] + _alpha * _ey[i];
+				_oz[i] = (T(1) - _alpha) * _sz[i] + _alpha * _ez[i];
+			}
+		}
+	}
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Geometry/AABB3D.hpp>
+
+#include "../Dispatch/BatchKernels.hpp"
+
+namespace SA
+{
+#if SA_MATHS_AABB3D_TRANSFORM_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+//{ Float
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const RMat4f& _mat, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<float>().aabb3DTransformConstMat(_mat.Data(), _in, _out, _num, false);
+	}
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const RMat4f* _mats, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<float>().aabb3DTransform(reinterpret_cast<const float*>(_mats), _in, _out, _num, false);
+	}
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const CMat4f& _mat, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<float>().aabb3DTransformConstMat(_mat.Data(), _in, _out, _num, true);
+	}
+
+	template <>
+	template <>
+	void AABB3Df::TransformBatch(const CMat4f* _mats, const AABB3Df* _in, AABB3Df* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<float>().aabb3DTransform(reinterpret_cast<const float*>(_mats), _in, _out, _num, true);
+	}
+
+//}
+
+
+//{ Double
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const RMat4d& _mat, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<double>().aabb3DTransformConstMat(_mat.Data(), _in, _out, _num, false);
+	}
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const RMat4d* _mats, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<double>().aabb3DTransform(reinterpret_cast<const double*>(_mats), _in, _out, _num, false);
+	}
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const CMat4d& _mat, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<double>().aabb3DTransformConstMat(_mat.Data(), _in, _out, _num, true);
+	}
+
+	template <>
+	template <>
+	void AABB3Dd::TransformBatch(const CMat4d* _mats, const AABB3Dd* _in, AABB3Dd* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<double>().aabb3DTransform(reinterpret_cast<const double*>(_mats), _in, _out, _num, true);
+	}
+
+//}
+
+#endif
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Geometry/AABB3DPack.hpp>
+
+namespace SA
+{
+#if SA_MATHS_AABB3D_PACK_SIMD && SA_INTRISC_SSE
+
+	template <>
+	uint32_t AABB3DPack4f::OverlapMask(const AABB3D<float>& _query) const noexcept
+	{
+		const __m128 x = _mm_and_ps(
+			_mm_cmple_ps(_mm_load_ps(minX), _mm_set1_ps(_query.max.x)),
+			_mm_cmpge_ps(_mm_load_ps(maxX), _mm_set1_ps(_query.min.x))
+		);
+
+		const __m128 y = _mm_and_ps(
+			_mm_cmple_ps(_mm_load_ps(minY), _mm_set1_ps(_query.max.y)),
+			_mm_cmpge_ps(_mm_load_ps(maxY), _mm_set1_ps(_query.min.y))
+		);
+
+		const __m128 z = _mm_and_ps(
+			_mm_cmple_ps(_mm_load_ps(minZ), _mm_set1_ps(_query.max.z)),
+			_mm_cmpge_ps(_mm_load_ps(maxZ), _mm_set1_ps(_query.min.z))
+		);
+
+		return static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(_mm_and_ps(x, y), z)));
+	}
+
+#endif
+
+
+#if SA_MATHS_AABB3D_PACK_SIMD && SA_INTRISC_AVX
+
+//{ Float
+
+	template <>
+	uint32_t AABB3DPack8f::OverlapMask(const AABB3D<float>& _query) const noexcept
+	{
+		const __m256 x = _mm256_and_ps(
+			_mm256_cmp_ps(_mm256_load_ps(minX), _mm256_set1_ps(_query.max.x), _CMP_LE_OQ),
+			_mm256_cmp_ps(_mm256_load_ps(maxX), _mm256_set1_ps(_query.min.x), _CMP_GE_OQ)
+		);
+
+		const __m256 y = _mm256_and_ps(
+			_mm256_cmp_ps(_mm256_load_ps(minY), _mm256_set1_ps(_query.max.y), _CMP_LE_OQ),
+			_mm256_cmp_ps(_mm256_load_ps(maxY), _mm256_set1_ps(_query.min.y), _CMP_GE_OQ)
+		);
+
+		const __m256 z = _mm256_and_ps(
+			_mm256_cmp_ps(_mm256_load_ps(minZ), _mm256_set1_ps(_query.max.z), _CMP_LE_OQ),
+			_mm256_cmp_ps(_mm256_load_ps(maxZ), _mm256_set1_ps(_query.min.z), _CMP_GE_OQ)
+		);
+
+		return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(_mm256_and_ps(x, y), z)));
+	}
+
+//}
+
+
+//{ Double
+
+	namespace Intl
+	{
+		/// Overlap mask of 4 double lanes.
+		inline uint32_t AABB3DPackOverlapMask4d(const double* _minX, const double* _minY, const double* _minZ,
+			const double* _maxX, const double* _maxY, const double* _maxZ,
+			const AABB3D<double>& _query) noexcept
+		{
+			const __m256d x = _mm256_and_pd(
+				_mm256_cmp_pd(_mm256_load_pd(_minX), _mm256_set1_pd(_query.max.x), _CMP_LE_OQ),
+				_mm256_cmp_pd(_mm256_load_pd(_maxX), _mm256_set1_pd(_query.min.x), _CMP_GE_OQ)
+			);
+
+			const __m256d y = _mm256_and_pd(
+				_mm256_cmp_pd(_mm256_load_pd(_minY), _mm256_set1_pd(_query.max.y), _CMP_LE_OQ),
+				_mm256_cmp_pd(_mm256_load_pd(_maxY), _mm256_set1_pd(_query.min.y), _CMP_GE_OQ)
+			);
+
+			const __m256d z = _mm256_and_pd(
+				_mm256_cmp_pd(_mm256_load_pd(_minZ), _mm256_set1_pd(_query.max.z), _CMP_LE_OQ),
+				_mm256_cmp_pd(_mm256_load_pd(_maxZ), _mm256_set1_pd(_query.min.z), _CMP_GE_OQ)
+			);
+
+			return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_and_pd(_mm256_and_pd(x, y), z)));
+		}
+	}
+
+	template <>
+	uint32_t AABB3DPack4d::OverlapMask(const AABB3D<double>& _query) const noexcept
+	{
+		return Intl::AABB3DPackOverlapMask4d(minX, minY, minZ, maxX, maxY, maxZ, _query);
+	}
+
+	template <>
+	uint32_t AABB3DPack8d::OverlapMask(const AABB3D<double>& _query) const noexcept
+	{
+		const uint32_t low = Intl::AABB3DPackOverlapMask4d(minX, minY, minZ, maxX, maxY, maxZ, _query);
+
+		const uint32_t high = Intl::AABB3DPackOverlapMask4d(minX + 4, minY + 4, minZ + 4,
+			maxX + 4, maxY + 4, maxZ + 4, _query);
+
+		return low | (high << 4);
+	}
+
+//}
+
+#endif
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Geometry/Frustum.hpp>
+
+namespace SA
+{
+#if SA_MATHS_FRUSTUM_SIMD && SA_INTRISC_SSE
+
+	// One object at a time, 6 planes (+ 2 always-inside padding planes) per register(s).
+	// Operations order matches the generic implementation: same results.
+
+	template <>
+	void Frustumf::ClassifyAABBs(const AABB3D<float>* _boxes, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept
+	{
+		for (uint32_t w = 0u; w < (_num + 31u) / 32u; ++w)
+		{
+			_visible[w] = 0u;
+			_intersect[w] = 0u;
+		}
+
+	#if SA_INTRISC_AVX
+
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 zero = _mm256_setzero_ps();
+
+		const __m256 nx = _mm256_load_ps(mPlaneNx);
+		const __m256 ny = _mm256_load_ps(mPlaneNy);
+		const __m256 nz = _mm256_load_ps(mPlaneNz);
+		const __m256 d = _mm256_load_ps(mPlaneD);
+
+		const __m256 absNx = _mm256_andnot_ps(signMask, nx);
+		const __m256 absNy = _mm256_andnot_ps(signMask, ny);
+		const __m256 absNz = _mm256_andnot_ps(signMask, nz);
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			const AABB3D<float>& box = _boxes[i];
+
+			const __m256 cx = _mm256_set1_ps((box.min.x + box.max.x) * 0.5f);
+			const __m256 cy = _mm256_set1_ps((box.min.y + box.max.y) * 0.5f);
+			const __m256 cz = _mm256_set1_ps((box.min.z + box.max.z) * 0.5f);
+
+			const __m256 ex = _mm256_set1_ps((box.max.x - box.min.x) * 0.5f);
+			const __m256 ey = _mm256_set1_ps((box.max.y - box.min.y) * 0.5f);
+			const __m256 ez = _mm256_set1_ps((box.max.z - box.min.z) * 0.5f);
+
+			const __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, cx), _mm256_mul_ps(ny, cy)), _mm256_mul_ps(nz, cz)), d);
+			const __m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(absNx, ex), _mm256_mul_ps(absNy, ey)), _mm256_mul_ps(absNz, ez));
+
+			const bool bVisible = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(dist, radius), zero, _CMP_GE_OQ)) == 0xFF;
+			const bool bInside = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_sub_ps(dist, radius), zero, _CMP_GE_OQ)) == 0xFF;
+
+			_visible[i / 32u] |= uint32_t(bVisible) << (i % 32u);
+			_intersect[i / 32u] |= uint32_t(!bInside) << (i % 32u);
+		}
+
+	#else
+
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 zero = _mm_setzero_ps();
+
+		const __m128 nx0 = _mm_load_ps(mPlaneNx);
+		const __m128 ny0 = _mm_load_ps(mPlaneNy);
+		const __m128 nz0 = _mm_load_ps(mPlaneNz);
+		const __m128 d0 = _mm_load_ps(mPlaneD);
+
+		const __m128 nx1 = _mm_load_ps(mPlaneNx + 4);
+		const __m128 ny1 = _mm_load_ps(mPlaneNy + 4);
+		const __m128 nz1 = _mm_load_ps(mPlaneNz + 4);
+		const __m128 d1 = _mm_load_ps(mPlaneD + 4);
+
+		const __m128 absNx0 = _mm_andnot_ps(signMask, nx0);
+		const __m128 absNy0 = _mm_andnot_ps(signMask, ny0);
+		const __m128 absNz0 = _mm_andnot_ps(signMask, nz0);
+
+		const __m128 absNx1 = _mm_andnot_ps(signMask, nx1);
+		const __m128 absNy1 = _mm_andnot_ps(signMask, ny1);
+		const __m128 absNz1 = _mm_andnot_ps(signMask, nz1);
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			const AABB3D<float>& box = _boxes[i];
+
+			const __m128 cx = _mm_set1_ps((box.min.x + box.max.x) * 0.5f);
+			const __m128 cy = _mm_set1_ps((box.min.y + box.max.y) * 0.5f);
+			const __m128 cz = _mm_set1_ps((box.min.z + box.max.z) * 0.5f);
+
+			const __m128 ex = _mm_set1_ps((box.max.x - box.min.x) * 0.5f);
+			const __m128 ey = _mm_set1_ps((box.max.y - box.min.y) * 0.5f);
+			const __m128 ez = _mm_set1_ps((box.max.z - box.min.z) * 0.5f);
+
+			const __m128 dist0 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx0, cx), _mm_mul_ps(ny0, cy)), _mm_mul_ps(nz0, cz)), d0);
+			const __m128 dist1 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx1, cx), _mm_mul_ps(ny1, cy)), _mm_mul_ps(nz1, cz)), d1);
+
+			const __m128 radius0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNx0, ex), _mm_mul_ps(absNy0, ey)), _mm_mul_ps(absNz0, ez));
+			const __m128 radius1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNx1, ex), _mm_mul_ps(absNy1, ey)), _mm_mul_ps(absNz1, ez));
+
+			const __m128 visible = _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(dist0, radius0), zero), _mm_cmpge_ps(_mm_add_ps(dist1, radius1), zero));
+			const __m128 inside = _mm_and_ps(_mm_cmpge_ps(_mm_sub_ps(dist0, radius0), zero), _mm_cmpge_ps(_mm_sub_ps(dist1, radius1), zero));
+
+			_visible[i / 32u] |= uint32_t(_mm_movemask_ps(visible) == 0xF) << (i % 32u);
+			_intersect[i / 32u] |= uint32_t(_mm_movemask_ps(inside) != 0xF) << (i % 32u);
+		}
+
+	#endif
+	}
+
+	template <>
+	void Frustumf::ClassifySpheres(const Vec4<float>* _spheres, uint32_t _num, uint32_t* _visible, uint32_t* _intersect) const noexcept
+	{
+		for (uint32_t w = 0u; w < (_num + 31u) / 32u; ++w)
+		{
+			_visible[w] = 0u;
+			_intersect[w] = 0u;
+		}
+
+	#if SA_INTRISC_AVX
+
+		const __m256 zero = _mm256_setzero_ps();
+
+		const __m256 nx = _mm256_load_ps(mPlaneNx);
+		const __m256 ny = _mm256_load_ps(mPlaneNy);
+		const __m256 nz = _mm256_load_ps(mPlaneNz);
+		const __m256 d = _mm256_load_ps(mPlaneD);
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			const Vec4<float>& sphere = _spheres[i];
+
+			const __m256 radius = _mm256_set1_ps(sphere.w);
+
+			const __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+				_mm256_mul_ps(nx, _mm256_set1_ps(sphere.x)),
+				_mm256_mul_ps(ny, _mm256_set1_ps(sphere.y))),
+				_mm256_mul_ps(nz, _mm256_set1_ps(sphere.z))), d);
+
+			const bool bVisible = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_add_ps(dist, radius), zero, _CMP_GE_OQ)) == 0xFF;
+			const bool bInside = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_sub_ps(dist, radius), zero, _CMP_GE_OQ)) == 0xFF;
+
+			_visible[i / 32u] |= uint32_t(bVisible) << (i % 32u);
+			_intersect[i / 32u] |= uint32_t(!bInside) << (i % 32u);
+		}
+
+	#else
+
+		const __m128 zero = _mm_setzero_ps();
+
+		const __m128 nx0 = _mm_load_ps(mPlaneNx);
+		const __m128 ny0 = _mm_load_ps(mPlaneNy);
+		const __m128 nz0 = _mm_load_ps(mPlaneNz);
+		const __m128 d0 = _mm_load_ps(mPlaneD);
+
+		const __m128 nx1 = _mm_load_ps(mPlaneNx + 4);
+		const __m128 ny1 = _mm_load_ps(mPlaneNy + 4);
+		const __m128 nz1 = _mm_load_ps(mPlaneNz + 4);
+		const __m128 d1 = _mm_load_ps(mPlaneD + 4);
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			const Vec4<float>& sphere = _spheres[i];
+
+			const __m128 x = _mm_set1_ps(sphere.x);
+			const __m128 y = _mm_set1_ps(sphere.y);
+			const __m128 z = _mm_set1_ps(sphere.z);
+			const __m128 radius = _mm_set1_ps(sphere.w);
+
+			const __m128 dist0 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx0, x), _mm_mul_ps(ny0, y)), _mm_mul_ps(nz0, z)), d0);
+			const __m128 dist1 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx1, x), _mm_mul_ps(ny1, y)), _mm_mul_ps(nz1, z)), d1);
+
+			const __m128 visible = _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(dist0, radius), zero), _mm_cmpge_ps(_mm_add_ps(dist1, radius), zero));
+			const __m128 inside = _mm_and_ps(_mm_cmpge_ps(_mm_sub_ps(dist0, radius), zero), _mm_cmpge_ps(_mm_sub_ps(dist1, radius), zero));
+
+			_visible[i / 32u] |= uint32_t(_mm_movemask_ps(visible) == 0xF) << (i % 32u);
+			_intersect[i / 32u] |= uint32_t(_mm_movemask_ps(inside) != 0xF) << (i % 32u);
+		}
+
+	#endif
+	}
+
+#endif
+}
@@ -0,0 +1,255 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Geometry/OBB3DPack.hpp>
+
+#if SA_MATHS_OBB3D_PACK_SIMD && SA_INTRISC_SSE
+
+namespace SA::Intl
+{
+	namespace
+	{
+		/**
+		*	SAT of one query box against every lane, generic over the register wrapper.
+		*	Same operations and order as OBB3DPack::OverlapMask generic implementation (Intl::OBBSeparated).
+		*/
+		template <typename P>
+		uint32_t OBBPackOverlapMask(const typename P::Reg (&_R)[3][3], const typename P::Reg (&_t)[3],
+			const typename P::Reg (&_ea)[3], const typename P::Reg (&_eb)[3]) noexcept
+		{
+			using Reg = typename P::Reg;
+
+			const Reg epsilon = P::Set1(obbParallelEpsilon<typename P::Type>);
+
+			Reg absR[3][3];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				for (uint32_t j = 0u; j < 3u; ++j)
+					absR[i][j] = P::Add(P::Abs(_R[i][j]), epsilon);
+			}
+
+			Reg separated = P::Zero();
+
+			// A axes.
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				const Reg rb = P::Add(P::Add(P::Mul(_eb[0], absR[i][0]), P::Mul(_eb[1], absR[i][1])), P::Mul(_eb[2], absR[i][2]));
+
+				separated = P::Or(separated, P::CmpGT(P::Abs(_t[i]), P::Add(_ea[i], rb)));
+			}
+
+			// B axes.
+			for (uint32_t j = 0u; j < 3u; ++j)
+			{
+				const Reg ra = P::Add(P::Add(P::Mul(_ea[0], absR[0][j]), P::Mul(_ea[1], absR[1][j])), P::Mul(_ea[2], absR[2][j]));
+				const Reg dist = P::Add(P::Add(P::Mul(_t[0], _R[0][j]), P::Mul(_t[1], _R[1][j])), P::Mul(_t[2], _R[2][j]));
+
+				separated = P::Or(separated, P::CmpGT(P::Abs(dist), P::Add(ra, _eb[j])));
+			}
+
+			// A.axes[i] x B.axes[j].
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				const uint32_t i1 = (i + 1u) % 3u;
+				const uint32_t i2 = (i + 2u) % 3u;
+
+				for (uint32_t j = 0u; j < 3u; ++j)
+				{
+					const uint32_t j1 = (j + 1u) % 3u;
+					const uint32_t j2 = (j + 2u) % 3u;
+
+					const Reg ra = P::Add(P::Mul(_ea[i1], absR[i2][j]), P::Mul(_ea[i2], absR[i1][j]));
+					const Reg rb = P::Add(P::Mul(_eb[j1], absR[i][j2]), P::Mul(_eb[j2], absR[i][j1]));
+					const Reg dist = P::Sub(P::Mul(_t[i2], _R[i1][j]), P::Mul(_t[i1], _R[i2][j]));
+
+					separated = P::Or(separated, P::CmpGT(P::Abs(dist), P::Add(ra, rb)));
+				}
+			}
+
+			constexpr uint32_t laneMask = (1u << P::Width) - 1u;
+
+			return ~P::MoveMask(separated) & laneMask;
+		}
+
+		/// Lane boxes as A, _query as B.
+		template <typename P, uint32_t N>
+		uint32_t OBBPackOverlapMask(const OBB3DPack<typename P::Type, N>& _pack, const OBB3D<typename P::Type>& _query) noexcept
+		{
+			using Reg = typename P::Reg;
+
+			const Reg dx = P::Sub(P::Set1(_query.center.x), P::Load(_pack.center[0]));
+			const Reg dy = P::Sub(P::Set1(_query.center.y), P::Load(_pack.center[1]));
+			const Reg dz = P::Sub(P::Set1(_query.center.z), P::Load(_pack.center[2]));
+
+			Reg R[3][3];
+			Reg t[3];
+			Reg ea[3];
+			Reg eb[3];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				const Reg ax = P::Load(_pack.axes[i][0]);
+				const Reg ay = P::Load(_pack.axes[i][1]);
+				const Reg az = P::Load(_pack.axes[i][2]);
+
+				for (uint32_t j = 0u; j < 3u; ++j)
+				{
+					const Vec3<typename P::Type>& axisB = _query.axes[j];
+
+					R[i][j] = P::Add(P::Add(P::Mul(ax, P::Set1(axisB.x)), P::Mul(ay, P::Set1(axisB.y))), P::Mul(az, P::Set1(axisB.z)));
+				}
+
+				t[i] = P::Add(P::Add(P::Mul(dx, ax), P::Mul(dy, ay)), P::Mul(dz, az));
+
+				ea[i] = P::Load(_pack.extents[i]);
+				eb[i] = P::Set1(_query.extents[i]);
+			}
+
+			return OBBPackOverlapMask<P>(R, t, ea, eb);
+		}
+
+		/// Lane boxes as A, _query as B (world axes).
+		template <typename P, uint32_t N>
+		uint32_t OBBPackOverlapMask(const OBB3DPack<typename P::Type, N>& _pack, const AABB3D<typename P::Type>& _query) noexcept
+		{
+			using T = typename P::Type;
+			using Reg = typename P::Reg;
+
+			const Vec3<T> boxCenter = (_query.min + _query.max) * T(0.5);
+			const Vec3<T> boxExtents = (_query.max - _query.min) * T(0.5);
+
+			const Reg dx = P::Sub(P::Set1(boxCenter.x), P::Load(_pack.center[0]));
+			const Reg dy = P::Sub(P::Set1(boxCenter.y), P::Load(_pack.center[1]));
+			const Reg dz = P::Sub(P::Set1(boxCenter.z), P::Load(_pack.center[2]));
+
+			Reg R[3][3];
+			Reg t[3];
+			Reg ea[3];
+			Reg eb[3];
+
+			for (uint32_t i = 0u; i < 3u; ++i)
+			{
+				R[i][0] = P::Load(_pack.axes[i][0]);
+				R[i][1] = P::Load(_pack.axes[i][1]);
+				R[i][2] = P::Load(_pack.axes[i][2]);
+
+				t[i] = P::Add(P::Add(P::Mul(dx, R[i][0]), P::Mul(dy, R[i][1])), P::Mul(dz, R[i][2]));
+
+				ea[i] = P::Load(_pack.extents[i]);
+				eb[i] = P::Set1(boxExtents[i]);
+			}
+
+			return OBBPackOverlapMask<P>(R, t, ea, eb);
+		}
+
+
+		struct OBBPack4f
+		{
+			using Type = float;
+			using Reg = __m128;
+			static constexpr uint32_t Width = 4u;
+
+			static Reg Load(const float* _p) noexcept { return _mm_load_ps(_p); }
+			static Reg Set1(float _v) noexcept { return _mm_set1_ps(_v); }
+			static Reg Zero() noexcept { return _mm_setzero_ps(); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm_mul_ps(_l, _r); }
+			static Reg Abs(Reg _r) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), _r); }
+			static Reg Or(Reg _l, Reg _r) noexcept { return _mm_or_ps(_l, _r); }
+			static Reg CmpGT(Reg _l, Reg _r) noexcept { return _mm_cmpgt_ps(_l, _r); }
+			static uint32_t MoveMask(Reg _r) noexcept { return static_cast<uint32_t>(_mm_movemask_ps(_r)); }
+		};
+
+#if SA_INTRISC_AVX
+
+		struct OBBPack8f
+		{
+			using Type = float;
+			using Reg = __m256;
+			static constexpr uint32_t Width = 8u;
+
+			static Reg Load(const float* _p) noexcept { return _mm256_load_ps(_p); }
+			static Reg Set1(float _v) noexcept { return _mm256_set1_ps(_v); }
+			static Reg Zero() noexcept { return _mm256_setzero_ps(); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_ps(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_ps(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_ps(_l, _r); }
+			static Reg Abs(Reg _r) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _r); }
+			static Reg Or(Reg _l, Reg _r) noexcept { return _mm256_or_ps(_l, _r); }
+			static Reg CmpGT(Reg _l, Reg _r) noexcept { return _mm256_cmp_ps(_l, _r, _CMP_GT_OQ); }
+			static uint32_t MoveMask(Reg _r) noexcept { return static_cast<uint32_t>(_mm256_movemask_ps(_r)); }
+		};
+
+		struct OBBPack4d
+		{
+			using Type = double;
+			using Reg = __m256d;
+			static constexpr uint32_t Width = 4u;
+
+			static Reg Load(const double* _p) noexcept { return _mm256_load_pd(_p); }
+			static Reg Set1(double _v) noexcept { return _mm256_set1_pd(_v); }
+			static Reg Zero() noexcept { return _mm256_setzero_pd(); }
+			static Reg Add(Reg _l, Reg _r) noexcept { return _mm256_add_pd(_l, _r); }
+			static Reg Sub(Reg _l, Reg _r) noexcept { return _mm256_sub_pd(_l, _r); }
+			static Reg Mul(Reg _l, Reg _r) noexcept { return _mm256_mul_pd(_l, _r); }
+			static Reg Abs(Reg _r) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), _r); }
+			static Reg Or(Reg _l, Reg _r) noexcept { return _mm256_or_pd(_l, _r); }
+			static Reg CmpGT(Reg _l, Reg _r) noexcept { return _mm256_cmp_pd(_l, _r, _CMP_GT_OQ); }
+			static uint32_t MoveMask(Reg _r) noexcept { return static_cast<uint32_t>(_mm256_movemask_pd(_r)); }
+		};
+
+#endif
+	}
+}
+
+#endif
+
+
+namespace SA
+{
+#if SA_MATHS_OBB3D_PACK_SIMD && SA_INTRISC_SSE
+
+	template <>
+	uint32_t OBB3DPack4f::OverlapMask(const OBB3D<float>& _query) const noexcept
+	{
+		return Intl::OBBPackOverlapMask<Intl::OBBPack4f>(*this, _query);
+	}
+
+	template <>
+	uint32_t OBB3DPack4f::OverlapMask(const AABB3D<float>& _query) const noexcept
+	{
+		return Intl::OBBPackOverlapMask<Intl::OBBPack4f>(*this, _query);
+	}
+
+#endif
+
+
+#if SA_MATHS_OBB3D_PACK_SIMD && SA_INTRISC_AVX
+
+	template <>
+	uint32_t OBB3DPack8f::OverlapMask(const OBB3D<float>& _query) const noexcept
+	{
+		return Intl::OBBPackOverlapMask<Intl::OBBPack8f>(*this, _query);
+	}
+
+	template <>
+	uint32_t OBB3DPack8f::OverlapMask(const AABB3D<float>& _query) const noexcept
+	{
+		return Intl::OBBPackOverlapMask<Intl::OBBPack8f>(*this, _query);
+	}
+
+	template <>
+	uint32_t OBB3DPack4d::OverlapMask(const OBB3D<double>& _query) const noexcept
+	{
+		return Intl::OBBPackOverlapMask<Intl::OBBPack4d>(*this, _query);
+	}
+
+	template <>
+	uint32_t OBB3DPack4d::OverlapMask(const AABB3D<double>& _query) const noexcept
+	{
+		return Intl::OBBPackOverlapMask<Intl::OBBPack4d>(*this, _query);
+	}
+
+#endif
+}
@@ -0,0 +1,321 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Geometry/Ray3Pack.hpp>
+
+namespace SA
+{
+#if SA_MATHS_RAY3_PACK_SIMD && SA_INTRISC_SSE
+
+	// std::min(a, b) == _mm_min_ps(b, a) and std::max(a, b) == _mm_max_ps(b, a), NaN included:
+	// operands are swapped to keep the scalar Ray3 semantic.
+
+	template <>
+	uint32_t Ray3Pack4f::IntersectAABBMask(const AABB3D<float>& _box, float _maxDist, float* _tEntries) const noexcept
+	{
+		const __m128 ox = _mm_load_ps(originX);
+		const __m128 oy = _mm_load_ps(originY);
+		const __m128 oz = _mm_load_ps(originZ);
+
+		const __m128 ix = _mm_load_ps(invDirX);
+		const __m128 iy = _mm_load_ps(invDirY);
+		const __m128 iz = _mm_load_ps(invDirZ);
+
+		const __m128 tx1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(_box.min.x), ox), ix);
+		const __m128 tx2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(_box.max.x), ox), ix);
+
+		__m128 tMin = _mm_min_ps(tx2, tx1);
+		__m128 tMax = _mm_max_ps(tx2, tx1);
+
+		const __m128 ty1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(_box.min.y), oy), iy);
+		const __m128 ty2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(_box.max.y), oy), iy);
+
+		tMin = _mm_max_ps(_mm_min_ps(ty2, ty1), tMin);
+		tMax = _mm_min_ps(_mm_max_ps(ty2, ty1), tMax);
+
+		const __m128 tz1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(_box.min.z), oz), iz);
+		const __m128 tz2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(_box.max.z), oz), iz);
+
+		tMin = _mm_max_ps(_mm_min_ps(tz2, tz1), tMin);
+		tMax = _mm_min_ps(_mm_max_ps(tz2, tz1), tMax);
+
+		const __m128 tEntry = _mm_max_ps(_mm_setzero_ps(), tMin);
+
+		if (_tEntries)
+			_mm_storeu_ps(_tEntries, tEntry);
+
+		const __m128 hit = _mm_and_ps(_mm_cmpge_ps(tMax, tEntry), _mm_cmple_ps(tEntry, _mm_set1_ps(_maxDist)));
+
+		return static_cast<uint32_t>(_mm_movemask_ps(hit));
+	}
+
+	template <>
+	uint32_t Ray3Pack4f::IntersectTriangleMask(const Vec3<float>& _v0, const Vec3<float>& _v1, const Vec3<float>& _v2,
+		float _maxDist, float* _t) const noexcept
+	{
+		const Vec3<float> edge1 = _v1 - _v0;
+		const Vec3<float> edge2 = _v2 - _v0;
+
+		const __m128 e1x = _mm_set1_ps(edge1.x);
+		const __m128 e1y = _mm_set1_ps(edge1.y);
+		const __m128 e1z = _mm_set1_ps(edge1.z);
+
+		const __m128 e2x = _mm_set1_ps(edge2.x);
+		const __m128 e2y = _mm_set1_ps(edge2.y);
+		const __m128 e2z = _mm_set1_ps(edge2.z);
+
+		const __m128 dx = _mm_load_ps(dirX);
+		const __m128 dy = _mm_load_ps(dirY);
+		const __m128 dz = _mm_load_ps(dirZ);
+
+		// p = dir x edge2
+		const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+		const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+		const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+
+		const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+		const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+		const __m128 sx = _mm_sub_ps(_mm_load_ps(originX), _mm_set1_ps(_v0.x));
+		const __m128 sy = _mm_sub_ps(_mm_load_ps(originY), _mm_set1_ps(_v0.y));
+		const __m128 sz = _mm_sub_ps(_mm_load_ps(originZ), _mm_set1_ps(_v0.z));
+
+		const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), invDet);
+
+		// q = s x edge1
+		const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+		const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+		const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+
+		const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+		const __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+
+		if (_t)
+			_mm_storeu_ps(_t, t);
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		const __m128 absDet = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+
+		__m128 hit = _mm_cmpge_ps(absDet, _mm_set1_ps(std::numeric_limits<float>::epsilon()));
+		hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+		hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+		hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(t, zero), _mm_cmple_ps(t, _mm_set1_ps(_maxDist))));
+
+		return static_cast<uint32_t>(_mm_movemask_ps(hit));
+	}
+
+#endif
+
+
+#if SA_MATHS_RAY3_PACK_SIMD && SA_INTRISC_AVX
+
+//{ Float
+
+	template <>
+	uint32_t Ray3Pack8f::IntersectAABBMask(const AABB3D<float>& _box, float _maxDist, float* _tEntries) const noexcept
+	{
+		const __m256 ox = _mm256_load_ps(originX);
+		const __m256 oy = _mm256_load_ps(originY);
+		const __m256 oz = _mm256_load_ps(originZ);
+
+		const __m256 ix = _mm256_load_ps(invDirX);
+		const __m256 iy = _mm256_load_ps(invDirY);
+		const __m256 iz = _mm256_load_ps(invDirZ);
+
+		const __m256 tx1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(_box.min.x), ox), ix);
+		const __m256 tx2 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(_box.max.x), ox), ix);
+
+		__m256 tMin = _mm256_min_ps(tx2, tx1);
+		__m256 tMax = _mm256_max_ps(tx2, tx1);
+
+		const __m256 ty1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(_box.min.y), oy), iy);
+		const __m256 ty2 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(_box.max.y), oy), iy);
+
+		tMin = _mm256_max_ps(_mm256_min_ps(ty2, ty1), tMin);
+		tMax = _mm256_min_ps(_mm256_max_ps(ty2, ty1), tMax);
+
+		const __m256 tz1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(_box.min.z), oz), iz);
+		const __m256 tz2 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(_box.max.z), oz), iz);
+
+		tMin = _mm256_max_ps(_mm256_min_ps(tz2, tz1), tMin);
+		tMax = _mm256_min_ps(_mm256_max_ps(tz2, tz1), tMax);
+
+		const __m256 tEntry = _mm256_max_ps(_mm256_setzero_ps(), tMin);
+
+		if (_tEntries)
+			_mm256_storeu_ps(_tEntries, tEntry);
+
+		const __m256 hit = _mm256_and_ps(
+			_mm256_cmp_ps(tMax, tEntry, _CMP_GE_OQ),
+			_mm256_cmp_ps(tEntry, _mm256_set1_ps(_maxDist), _CMP_LE_OQ)
+		);
+
+		return static_cast<uint32_t>(_mm256_movemask_ps(hit));
+	}
+
+	template <>
+	uint32_t Ray3Pack8f::IntersectTriangleMask(const Vec3<float>& _v0, const Vec3<float>& _v1, const Vec3<float>& _v2,
+		float _maxDist, float* _t) const noexcept
+	{
+		const Vec3<float> edge1 = _v1 - _v0;
+		const Vec3<float> edge2 = _v2 - _v0;
+
+		const __m256 e1x = _mm256_set1_ps(edge1.x);
+		const __m256 e1y = _mm256_set1_ps(edge1.y);
+		const __m256 e1z = _mm256_set1_ps(edge1.z);
+
+		const __m256 e2x = _mm256_set1_ps(edge2.x);
+		const __m256 e2y = _mm256_set1_ps(edge2.y);
+		const __m256 e2z = _mm256_set1_ps(edge2.z);
+
+		const __m256 dx = _mm256_load_ps(dirX);
+		const __m256 dy = _mm256_load_ps(dirY);
+		const __m256 dz = _mm256_load_ps(dirZ);
+
+		// p = dir x edge2
+		const __m256 px = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+		const __m256 py = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+		const __m256 pz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+
+		const __m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+		const __m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+
+		const __m256 sx = _mm256_sub_ps(_mm256_load_ps(originX), _mm256_set1_ps(_v0.x));
+		const __m256 sy = _mm256_sub_ps(_mm256_load_ps(originY), _mm256_set1_ps(_v0.y));
+		const __m256 sz = _mm256_sub_ps(_mm256_load_ps(originZ), _mm256_set1_ps(_v0.z));
+
+		const __m256 u = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(sx, px), _mm256_mul_ps(sy, py)), _mm256_mul_ps(sz, pz)), invDet);
+
+		// q = s x edge1
+		const __m256 qx = _mm256_sub_ps(_mm256_mul_ps(sy, e1z), _mm256_mul_ps(sz, e1y));
+		const __m256 qy = _mm256_sub_ps(_mm256_mul_ps(sz, e1x), _mm256_mul_ps(sx, e1z));
+		const __m256 qz = _mm256_sub_ps(_mm256_mul_ps(sx, e1y), _mm256_mul_ps(sy, e1x));
+
+		const __m256 v = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, qx), _mm256_mul_ps(dy, qy)), _mm256_mul_ps(dz, qz)), invDet);
+		const __m256 t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), invDet);
+
+		if (_t)
+			_mm256_storeu_ps(_t, t);
+
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+
+		const __m256 absDet = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), det);
+
+		__m256 hit = _mm256_cmp_ps(absDet, _mm256_set1_ps(std::numeric_limits<float>::epsilon()), _CMP_GE_OQ);
+		hit = _mm256_and_ps(hit, _mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GE_OQ), _mm256_cmp_ps(u, one, _CMP_LE_OQ)));
+		hit = _mm256_and_ps(hit, _mm256_and_ps(_mm256_cmp_ps(v, zero, _CMP_GE_OQ), _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ)));
+		hit = _mm256_and_ps(hit, _mm256_and_ps(_mm256_cmp_ps(t, zero, _CMP_GE_OQ), _mm256_cmp_ps(t, _mm256_set1_ps(_maxDist), _CMP_LE_OQ)));
+
+		return static_cast<uint32_t>(_mm256_movemask_ps(hit));
+	}
+
+//}
+
+
+//{ Double
+
+	template <>
+	uint32_t Ray3Pack4d::IntersectAABBMask(const AABB3D<double>& _box, double _maxDist, double* _tEntries) const noexcept
+	{
+		const __m256d ox = _mm256_load_pd(originX);
+		const __m256d oy = _mm256_load_pd(originY);
+		const __m256d oz = _mm256_load_pd(originZ);
+
+		const __m256d ix = _mm256_load_pd(invDirX);
+		const __m256d iy = _mm256_load_pd(invDirY);
+		const __m256d iz = _mm256_load_pd(invDirZ);
+
+		const __m256d tx1 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(_box.min.x), ox), ix);
+		const __m256d tx2 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(_box.max.x), ox), ix);
+
+		__m256d tMin = _mm256_min_pd(tx2, tx1);
+		__m256d tMax = _mm256_max_pd(tx2, tx1);
+
+		const __m256d ty1 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(_box.min.y), oy), iy);
+		const __m256d ty2 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(_box.max.y), oy), iy);
+
+		tMin = _mm256_max_pd(_mm256_min_pd(ty2, ty1), tMin);
+		tMax = _mm256_min_pd(_mm256_max_pd(ty2, ty1), tMax);
+
+		const __m256d tz1 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(_box.min.z), oz), iz);
+		const __m256d tz2 = _mm256_mul_pd(_mm256_sub_pd(_mm256_set1_pd(_box.max.z), oz), iz);
+
+		tMin = _mm256_max_pd(_mm256_min_pd(tz2, tz1), tMin);
+		tMax = _mm256_min_pd(_mm256_max_pd(tz2, tz1), tMax);
+
+		const __m256d tEntry = _mm256_max_pd(_mm256_setzero_pd(), tMin);
+
+		if (_tEntries)
+			_mm256_storeu_pd(_tEntries, tEntry);
+
+		const __m256d hit = _mm256_and_pd(
+			_mm256_cmp_pd(tMax, tEntry, _CMP_GE_OQ),
+			_mm256_cmp_pd(tEntry, _mm256_set1_pd(_maxDist), _CMP_LE_OQ)
+		);
+
+		return static_cast<uint32_t>(_mm256_movemask_pd(hit));
+	}
+
+	template <>
+	uint32_t Ray3Pack4d::IntersectTriangleMask(const Vec3<double>& _v0, const Vec3<double>& _v1, const Vec3<double>& _v2,
+		double _maxDist, double* _t) const noexcept
+	{
+		const Vec3<double> edge1 = _v1 - _v0;
+		const Vec3<double> edge2 = _v2 - _v0;
+
+		const __m256d e1x = _mm256_set1_pd(edge1.x);
+		const __m256d e1y = _mm256_set1_pd(edge1.y);
+		const __m256d e1z = _mm256_set1_pd(edge1.z);
+
+		const __m256d e2x = _mm256_set1_pd(edge2.x);
+		const __m256d e2y = _mm256_set1_pd(edge2.y);
+		const __m256d e2z = _mm256_set1_pd(edge2.z);
+
+		const __m256d dx = _mm256_load_pd(dirX);
+		const __m256d dy = _mm256_load_pd(dirY);
+		const __m256d dz = _mm256_load_pd(dirZ);
+
+		// p = dir x edge2
+		const __m256d px = _mm256_sub_pd(_mm256_mul_pd(dy, e2z), _mm256_mul_pd(dz, e2y));
+		const __m256d py = _mm256_sub_pd(_mm256_mul_pd(dz, e2x), _mm256_mul_pd(dx, e2z));
+		const __m256d pz = _mm256_sub_pd(_mm256_mul_pd(dx, e2y), _mm256_mul_pd(dy, e2x));
+
+		const __m256d det = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(e1x, px), _mm256_mul_pd(e1y, py)), _mm256_mul_pd(e1z, pz));
+		const __m256d invDet = _mm256_div_pd(_mm256_set1_pd(1.0), det);
+
+		const __m256d sx = _mm256_sub_pd(_mm256_load_pd(originX), _mm256_set1_pd(_v0.x));
+		const __m256d sy = _mm256_sub_pd(_mm256_load_pd(originY), _mm256_set1_pd(_v0.y));
+		const __m256d sz = _mm256_sub_pd(_mm256_load_pd(originZ), _mm256_set1_pd(_v0.z));
+
+		const __m256d u = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(sx, px), _mm256_mul_pd(sy, py)), _mm256_mul_pd(sz, pz)), invDet);
+
+		// q = s x edge1
+		const __m256d qx = _mm256_sub_pd(_mm256_mul_pd(sy, e1z), _mm256_mul_pd(sz, e1y));
+		const __m256d qy = _mm256_sub_pd(_mm256_mul_pd(sz, e1x), _mm256_mul_pd(sx, e1z));
+		const __m256d qz = _mm256_sub_pd(_mm256_mul_pd(sx, e1y), _mm256_mul_pd(sy, e1x));
+
+		const __m256d v = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, qx), _mm256_mul_pd(dy, qy)), _mm256_mul_pd(dz, qz)), invDet);
+		const __m256d t = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(e2x, qx), _mm256_mul_pd(e2y, qy)), _mm256_mul_pd(e2z, qz)), invDet);
+
+		if (_t)
+			_mm256_storeu_pd(_t, t);
+
+		const __m256d zero = _mm256_setzero_pd();
+		const __m256d one = _mm256_set1_pd(1.0);
+
+		const __m256d absDet = _mm256_andnot_pd(_mm256_set1_pd(-0.0), det);
+
+		__m256d hit = _mm256_cmp_pd(absDet, _mm256_set1_pd(std::numeric_limits<double>::epsilon()), _CMP_GE_OQ);
+		hit = _mm256_and_pd(hit, _mm256_and_pd(_mm256_cmp_pd(u, zero, _CMP_GE_OQ), _mm256_cmp_pd(u, one, _CMP_LE_OQ)));
+		hit = _mm256_and_pd(hit, _mm256_and_pd(_mm256_cmp_pd(v, zero, _CMP_GE_OQ), _mm256_cmp_pd(_mm256_add_pd(u, v), one, _CMP_LE_OQ)));
+		hit = _mm256_and_pd(hit, _mm256_and_pd(_mm256_cmp_pd(t, zero, _CMP_GE_OQ), _mm256_cmp_pd(t, _mm256_set1_pd(_maxDist), _CMP_LE_OQ)));
+
+		return static_cast<uint32_t>(_mm256_movemask_pd(hit));
+	}
+
+//}
+
+#endif
+}
@@ -0,0 +1,121 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Geometry/SpherePack.hpp>
+
+namespace SA
+{
+#if SA_MATHS_SPHERE_PACK_SIMD && SA_INTRISC_SSE
+
+	template <>
+	uint32_t SpherePack4f::OverlapMask(const Sphere<float>& _query) const noexcept
+	{
+		const __m128 dx = _mm_sub_ps(_mm_set1_ps(_query.center.x), _mm_load_ps(centerX));
+		const __m128 dy = _mm_sub_ps(_mm_set1_ps(_query.center.y), _mm_load_ps(centerY));
+		const __m128 dz = _mm_sub_ps(_mm_set1_ps(_query.center.z), _mm_load_ps(centerZ));
+
+		const __m128 sqrDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+		const __m128 radiusSum = _mm_add_ps(_mm_load_ps(radius), _mm_set1_ps(_query.radius));
+
+		return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(sqrDist, _mm_mul_ps(radiusSum, radiusSum))));
+	}
+
+	template <>
+	uint32_t SpherePack4f::OverlapMask(const AABB3D<float>& _query) const noexcept
+	{
+		const __m128 cx = _mm_load_ps(centerX);
+		const __m128 cy = _mm_load_ps(centerY);
+		const __m128 cz = _mm_load_ps(centerZ);
+
+		// Closest box point: clamp(center, min, max).
+		const __m128 dx = _mm_sub_ps(cx, _mm_min_ps(_mm_max_ps(cx, _mm_set1_ps(_query.min.x)), _mm_set1_ps(_query.max.x)));
+		const __m128 dy = _mm_sub_ps(cy, _mm_min_ps(_mm_max_ps(cy, _mm_set1_ps(_query.min.y)), _mm_set1_ps(_query.max.y)));
+		const __m128 dz = _mm_sub_ps(cz, _mm_min_ps(_mm_max_ps(cz, _mm_set1_ps(_query.min.z)), _mm_set1_ps(_query.max.z)));
+
+		const __m128 sqrDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+		const __m128 r = _mm_load_ps(radius);
+
+		return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(sqrDist, _mm_mul_ps(r, r))));
+	}
+
+#endif
+
+
+#if SA_MATHS_SPHERE_PACK_SIMD && SA_INTRISC_AVX
+
+//{ Float
+
+	template <>
+	uint32_t SpherePack8f::OverlapMask(const Sphere<float>& _query) const noexcept
+	{
+		const __m256 dx = _mm256_sub_ps(_mm256_set1_ps(_query.center.x), _mm256_load_ps(centerX));
+		const __m256 dy = _mm256_sub_ps(_mm256_set1_ps(_query.center.y), _mm256_load_ps(centerY));
+		const __m256 dz = _mm256_sub_ps(_mm256_set1_ps(_query.center.z), _mm256_load_ps(centerZ));
+
+		const __m256 sqrDist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+
+		const __m256 radiusSum = _mm256_add_ps(_mm256_load_ps(radius), _mm256_set1_ps(_query.radius));
+
+		return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(sqrDist, _mm256_mul_ps(radiusSum, radiusSum), _CMP_LE_OQ)));
+	}
+
+	template <>
+	uint32_t SpherePack8f::OverlapMask(const AABB3D<float>& _query) const noexcept
+	{
+		const __m256 cx = _mm256_load_ps(centerX);
+		const __m256 cy = _mm256_load_ps(centerY);
+		const __m256 cz = _mm256_load_ps(centerZ);
+
+		const __m256 dx = _mm256_sub_ps(cx, _mm256_min_ps(_mm256_max_ps(cx, _mm256_set1_ps(_query.min.x)), _mm256_set1_ps(_query.max.x)));
+		const __m256 dy = _mm256_sub_ps(cy, _mm256_min_ps(_mm256_max_ps(cy, _mm256_set1_ps(_query.min.y)), _mm256_set1_ps(_query.max.y)));
+		const __m256 dz = _mm256_sub_ps(cz, _mm256_min_ps(_mm256_max_ps(cz, _mm256_set1_ps(_query.min.z)), _mm256_set1_ps(_query.max.z)));
+
+		const __m256 sqrDist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+
+		const __m256 r = _mm256_load_ps(radius);
+
+		return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(sqrDist, _mm256_mul_ps(r, r), _CMP_LE_OQ)));
+	}
+
+//}
+
+
+//{ Double
+
+	template <>
+	uint32_t SpherePack4d::OverlapMask(const Sphere<double>& _query) const noexcept
+	{
+		const __m256d dx = _mm256_sub_pd(_mm256_set1_pd(_query.center.x), _mm256_load_pd(centerX));
+		const __m256d dy = _mm256_sub_pd(_mm256_set1_pd(_query.center.y), _mm256_load_pd(centerY));
+		const __m256d dz = _mm256_sub_pd(_mm256_set1_pd(_query.center.z), _mm256_load_pd(centerZ));
+
+		const __m256d sqrDist = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+
+		const __m256d radiusSum = _mm256_add_pd(_mm256_load_pd(radius), _mm256_set1_pd(_query.radius));
+
+		return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(sqrDist, _mm256_mul_pd(radiusSum, radiusSum), _CMP_LE_OQ)));
+	}
+
+	template <>
+	uint32_t SpherePack4d::OverlapMask(const AABB3D<double>& _query) const noexcept
+	{
+		const __m256d cx = _mm256_load_pd(centerX);
+		const __m256d cy = _mm256_load_pd(centerY);
+		const __m256d cz = _mm256_load_pd(centerZ);
+
+		const __m256d dx = _mm256_sub_pd(cx, _mm256_min_pd(_mm256_max_pd(cx, _mm256_set1_pd(_query.min.x)), _mm256_set1_pd(_query.max.x)));
+		const __m256d dy = _mm256_sub_pd(cy, _mm256_min_pd(_mm256_max_pd(cy, _mm256_set1_pd(_query.min.y)), _mm256_set1_pd(_query.max.y)));
+		const __m256d dz = _mm256_sub_pd(cz, _mm256_min_pd(_mm256_max_pd(cz, _mm256_set1_pd(_query.min.z)), _mm256_set1_pd(_query.max.z)));
+
+		const __m256d sqrDist = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+
+		const __m256d r = _mm256_load_pd(radius);
+
+		return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(sqrDist, _mm256_mul_pd(r, r), _CMP_LE_OQ)));
+	}
+
+//}
+
+#endif
+}
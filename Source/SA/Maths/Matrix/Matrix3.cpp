@@ -375,7 +375,50 @@ namespace SA
 
 #endif
 
-#if SA_MATHS_MATRIX3_SIMD && SA_INTRISC_SSE // SIMD float
+#if SA_MATHS_MATRIX3_SIMD && SA_INTRISC_AVX // SIMD float
+
+	namespace Intl
+	{
+		/// _a * _b + _c: fused (single rounding) with SA_INTRISC_FMA.
+		inline __m256 Mat3fMadd(__m256 _a, __m256 _b, __m256 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmadd_ps(_a, _b, _c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+		}
+
+		/// _a * _b - _c: fused (single rounding) with SA_INTRISC_FMA.
+		inline __m256 Mat3fMsub(__m256 _a, __m256 _b, __m256 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmsub_ps(_a, _b, _c);
+#else
+			return _mm256_sub_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+		}
+
+		/// \copydoc Mat3fMadd
+		inline __m128 Mat3fMadd(__m128 _a, __m128 _b, __m128 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm_fmadd_ps(_a, _b, _c);
+#else
+			return _mm_add_ps(_mm_mul_ps(_a, _b), _c);
+#endif
+		}
+
+		/// \copydoc Mat3fMsub
+		inline __m128 Mat3fMsub(__m128 _a, __m128 _b, __m128 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm_fmsub_ps(_a, _b, _c);
+#else
+			return _mm_sub_ps(_mm_mul_ps(_a, _b), _c);
+#endif
+		}
+	}
 
 //{ Row Major
 
@@ -391,6 +434,22 @@ namespace SA
 			(-) e22 * e10 * e01
 		*/
 
+#if SA_INTRISC_FMA
+
+		// Factorized: e00 * (e11 * e22 - e12 * e21) + e01 * (e12 * e20 - e10 * e22) + e02 * (e10 * e21 - e11 * e20).
+		const __m128 minors = Intl::Mat3fMsub(
+			_mm_set_ps(0.0f, e10, e12, e11),
+			_mm_set_ps(0.0f, e21, e20, e22),
+			_mm_mul_ps(_mm_set_ps(0.0f, e11, e10, e12), _mm_set_ps(0.0f, e20, e22, e21))
+		);
+
+		float fres[4];
+		_mm_store_ps(fres, _mm_mul_ps(_mm_set_ps(0.0f, e02, e01, e00), minors));
+
+		return fres[0] + fres[1] + fres[2];
+
+#else
+
 		const __m256 p1 = _mm256_set_ps(0.0f, 0.0f, -e22, -e21, -e20, e02, e01, e00);
 		const __m256 p2 = _mm256_set_ps(0.0f, 0.0f, e10, e12, e11, e10, e12, e11);
 		const __m256 p3 = _mm256_set_ps(0.0f, 0.0f, e01, e00, e02, e21, e20, e22);
@@ -399,6 +458,8 @@ namespace SA
 		_mm256_store_ps(fres, _mm256_mul_ps(_mm256_mul_ps(p1, p2), p3));
 
 		return fres[0] + fres[1] + fres[2] + fres[3] + fres[4] + fres[5];
+
+#endif
 	}
 
 	template <>
@@ -433,7 +494,7 @@ namespace SA
 		const __m256 p3 = _mm256_set_ps(e00, e20, e00, e20, e10, e11, e01, e21);
 		const __m256 p4 = _mm256_set_ps(e21, e11, e12, e02, e22, e02, e22, e12);
 
-		_mm256_store_ps(&res.e00, _mm256_mul_ps(invDetP, _mm256_sub_ps(_mm256_mul_ps(p1, p2), _mm256_mul_ps(p3, p4))));
+		_mm256_store_ps(&res.e00, _mm256_mul_ps(invDetP, Intl::Mat3fMsub(p1, p2, _mm256_mul_ps(p3, p4))));
 
 		// Last elem.
 		res.e22 = invDet * (e00 * e11 - e10 * e01);
@@ -473,7 +534,7 @@ namespace SA
 		const __m256 p3 = _mm256_set_ps(_rot.x, -_rot.y, -_rot.x, _rot.z, _rot.z, _rot.y, -_rot.z, _rot.z);
 		const __m256 p4 = _mm256_set_ps(_rot.w, _rot.w, _rot.w, _rot.z, _rot.w, _rot.w, _rot.w, _rot.z);
 
-		_mm256_store_ps(&res.e00, _mm256_mul_ps(pDbl, _mm256_add_ps(_mm256_mul_ps(p1, p2), _mm256_mul_ps(p3, p4))));
+		_mm256_store_ps(&res.e00, _mm256_mul_ps(pDbl, Intl::Mat3fMadd(p3, p4, _mm256_mul_ps(p1, p2))));
 
 		// Apply 1.0f - value.
 		res.e00 = 1.0f - res.e00;
@@ -563,14 +624,13 @@ namespace SA
 
 		const __m256 p3 = _mm256_set_ps(e21, e21, e11, e11, e11, e01, e01, e01);
 		const __m256 p4 = _mm256_set_ps(_rhs.e11, _rhs.e10, _rhs.e12, _rhs.e11, _rhs.e10, _rhs.e12, _rhs.e11, _rhs.e10);
-		const __m256 p34 = _mm256_mul_ps(p3, p4);
+		const __m256 p1234 = Intl::Mat3fMadd(p3, p4, p12);
 
 
 		const __m256 p5 = _mm256_set_ps(e22, e22, e12, e12, e12, e02, e02, e02);
 		const __m256 p6 = _mm256_set_ps(_rhs.e21, _rhs.e20, _rhs.e22, _rhs.e21, _rhs.e20, _rhs.e22, _rhs.e21, _rhs.e20);
-		const __m256 p56 = _mm256_mul_ps(p5, p6);
 
-		_mm256_store_ps(&res.e00, _mm256_add_ps(_mm256_add_ps(p12, p34), p56));
+		_mm256_store_ps(&res.e00, Intl::Mat3fMadd(p5, p6, p1234));
 
 		// Last elem.
 		res.e22 = e20 * _rhs.e02 + e21 * _rhs.e12 + e22 * _rhs.e22;
@@ -582,6 +642,20 @@ namespace SA
 	template <>
 	Vec3<float> RMat3f::operator*(const Vec3<float>& _rhs) const noexcept
 	{
+#if SA_INTRISC_FMA
+
+		// x * column 0 + y * column 1 + z * column 2.
+		const __m128 res = Intl::Mat3fMadd(_mm_set_ps(0.0f, e22, e12, e02), _mm_set1_ps(_rhs.z),
+			Intl::Mat3fMadd(_mm_set_ps(0.0f, e21, e11, e01), _mm_set1_ps(_rhs.y),
+				_mm_mul_ps(_mm_set_ps(0.0f, e20, e10, e00), _mm_set1_ps(_rhs.x))));
+
+		float fres[4];
+		_mm_store_ps(fres, res);
+
+		return Vec3f(fres[0], fres[1], fres[2]);
+
+#else
+
 		// Compute first 8 elems.
 		const __m256 p0 = _mm256_load_ps(&e00);
 
@@ -595,6 +669,8 @@ namespace SA
 			fres[3] + fres[4] + fres[5],
 			fres[6] + fres[7] + e22 * _rhs.z
 		);
+
+#endif
 	}
 
 
@@ -701,6 +777,22 @@ namespace SA
 			(-) e22 * e10 * e01
 		*/
 
+#if SA_INTRISC_FMA
+
+		// Factorized: e00 * (e11 * e22 - e12 * e21) + e01 * (e12 * e20 - e10 * e22) + e02 * (e10 * e21 - e11 * e20).
+		const __m128 minors = Intl::Mat3fMsub(
+			_mm_set_ps(0.0f, e10, e12, e11),
+			_mm_set_ps(0.0f, e21, e20, e22),
+			_mm_mul_ps(_mm_set_ps(0.0f, e11, e10, e12), _mm_set_ps(0.0f, e20, e22, e21))
+		);
+
+		float fres[4];
+		_mm_store_ps(fres, _mm_mul_ps(_mm_set_ps(0.0f, e02, e01, e00), minors));
+
+		return fres[0] + fres[1] + fres[2];
+
+#else
+
 		const __m256 p1 = _mm256_set_ps(0.0f, 0.0f, -e22, -e21, -e20, e02, e01, e00);
 		const __m256 p2 = _mm256_set_ps(0.0f, 0.0f, e10, e12, e11, e10, e12, e11);
 		const __m256 p3 = _mm256_set_ps(0.0f, 0.0f, e01, e00, e02, e21, e20, e22);
@@ -709,6 +801,8 @@ namespace SA
 		_mm256_store_ps(fres, _mm256_mul_ps(_mm256_mul_ps(p1, p2), p3));
 
 		return fres[0] + fres[1] + fres[2] + fres[3] + fres[4] + fres[5];
+
+#endif
 	}
 
 	template <>
@@ -743,7 +837,7 @@ namespace SA
 		const __m256 p3 = _mm256_set_ps(e00, e11, e00, e20, e01, e20, e10, e21);
 		const __m256 p4 = _mm256_set_ps(e12, e02, e21, e02, e22, e11, e22, e12);
 
-		_mm256_store_ps(&res.e00, _mm256_mul_ps(invDetP, _mm256_sub_ps(_mm256_mul_ps(p1, p2), _mm256_mul_ps(p3, p4))));
+		_mm256_store_ps(&res.e00, _mm256_mul_ps(invDetP, Intl::Mat3fMsub(p1, p2, _mm256_mul_ps(p3, p4))));
 
 		// Last elem.
 		res.e22 = invDet * (e00 * e11 - e10 * e01);
@@ -783,7 +877,7 @@ namespace SA
 		const __m256 p3 = _mm256_set_ps(-_rot.x, _rot.y, _rot.x, _rot.z, -_rot.z, -_rot.y, _rot.z, _rot.z);
 		const __m256 p4 = _mm256_set_ps(_rot.w, _rot.w, _rot.w, _rot.z, _rot.w, _rot.w, _rot.w, _rot.z);
 
-		_mm256_store_ps(&res.e00, _mm256_mul_ps(pDbl, _mm256_add_ps(_mm256_mul_ps(p1, p2), _mm256_mul_ps(p3, p4))));
+		_mm256_store_ps(&res.e00, _mm256_mul_ps(pDbl, Intl::Mat3fMadd(p3, p4, _mm256_mul_ps(p1, p2))));
 
 		// Apply 1.0f - value.
 		res.e00 = 1.0f - res.e00;
@@ -873,14 +967,13 @@ namespace SA
 
 		const __m256 p3 = _mm256_set_ps(e11, e01, e21, e11, e01, e21, e11, e01);
 		const __m256 p4 = _mm256_set_ps(_rhs.e12, _rhs.e12, _rhs.e11, _rhs.e11, _rhs.e11, _rhs.e10, _rhs.e10, _rhs.e10);
-		const __m256 p34 = _mm256_mul_ps(p3, p4);
+		const __m256 p1234 = Intl::Mat3fMadd(p3, p4, p12);
 
 
 		const __m256 p5 = _mm256_set_ps(e12, e02, e22, e12, e02, e22, e12, e02);
 		const __m256 p6 = _mm256_set_ps(_rhs.e22, _rhs.e22, _rhs.e21, _rhs.e21, _rhs.e21, _rhs.e20, _rhs.e20, _rhs.e20);
-		const __m256 p56 = _mm256_mul_ps(p5, p6);
 
-		_mm256_store_ps(&res.e00, _mm256_add_ps(_mm256_add_ps(p12, p34), p56));
+		_mm256_store_ps(&res.e00, Intl::Mat3fMadd(p5, p6, p1234));
 
 		// Last elem.
 		res.e22 = e20 * _rhs.e02 + e21 * _rhs.e12 + e22 * _rhs.e22;
@@ -892,6 +985,20 @@ namespace SA
 	template <>
 	Vec3<float> CMat3f::operator*(const Vec3<float>& _rhs) const noexcept
 	{
+#if SA_INTRISC_FMA
+
+		// x * column 0 + y * column 1 + z * column 2.
+		const __m128 res = Intl::Mat3fMadd(_mm_set_ps(0.0f, e22, e12, e02), _mm_set1_ps(_rhs.z),
+			Intl::Mat3fMadd(_mm_set_ps(0.0f, e21, e11, e01), _mm_set1_ps(_rhs.y),
+				_mm_mul_ps(_mm_set_ps(0.0f, e20, e10, e00), _mm_set1_ps(_rhs.x))));
+
+		float fres[4];
+		_mm_store_ps(fres, res);
+
+		return Vec3f(fres[0], fres[1], fres[2]);
+
+#else
+
 		// Compute first 8 elems.
 		const __m256 p0 = _mm256_set_ps(e21, e20, e12, e11, e10, e02, e01, e00);
 
@@ -905,6 +1012,8 @@ namespace SA
 			fres[3] + fres[4] + fres[5],
 			fres[6] + fres[7] + e22 * _rhs.z
 		);
+
+#endif
 	}
 
 
@@ -6,6 +6,8 @@
 #include <Space/Vector4.hpp>
 #include <Space/Quaternion.hpp>
 
+#include "../Dispatch/BatchKernels.hpp"
+
 namespace SA
 {
 #if SA_MATHS_MATRIX4_SIMD && SA_INTRISC_AVX // SIMD int32
@@ -403,72 +405,801 @@ namespace SA
 	template <>
 	CMat4i& CMat4i::operator*=(int32_t _scale) noexcept
 	{
-		int32_t* const data = Data();
-
-		const __m256i sPack = _mm256_set1_epi32(_scale);
+		int32_t* const data = Data();
+
+		const __m256i sPack = _mm256_set1_epi32(_scale);
+
+		// Mult row 0 and 1.
+		reinterpret_cast<__m256i&>(data[0]) = _mm256_mullo_epi32(reinterpret_cast<const __m256i&>(data[0]), sPack);
+
+		// Mult row 2 and 3.
+		reinterpret_cast<__m256i&>(data[8]) = _mm256_mullo_epi32(reinterpret_cast<const __m256i&>(data[8]), sPack);
+
+		return *this;
+	}
+
+#if SA_INTRISC_SVML
+
+	template <>
+	template <>
+	CMat4i& CMat4i::operator/=(int32_t _scale)
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		int32_t* const data = Data();
+
+		const __m256i sPack = _mm256_set1_epi32(_scale);
+
+		// Div row 0 and 1.
+		reinterpret_cast<__m256i&>(data[0]) = _mm256_div_epi32(reinterpret_cast<const __m256i&>(data[0]), sPack);
+
+		// Div row 2 and 3.
+		reinterpret_cast<__m256i&>(data[8]) = _mm256_div_epi32(reinterpret_cast<const __m256i&>(data[8]), sPack);
+
+		return *this;
+	}
+
+#endif
+
+	template <>
+	CMat4i& CMat4i::operator+=(const CMat4i& _rhs) noexcept
+	{
+		int32_t* const ldata = Data();
+		const int32_t* const rdata = _rhs.Data();
+
+		// Add row 0 and 1.
+		reinterpret_cast<__m256i&>(ldata[0]) =
+			_mm256_add_epi32(reinterpret_cast<const __m256i&>(ldata[0]), reinterpret_cast<const __m256i&>(rdata[0]));
+
+		// Add row 2 and 3.
+		reinterpret_cast<__m256i&>(ldata[8]) =
+			_mm256_add_epi32(reinterpret_cast<const __m256i&>(ldata[8]), reinterpret_cast<const __m256i&>(rdata[8]));
+
+		return *this;
+	}
+
+	template <>
+	CMat4i& CMat4i::operator-=(const CMat4i& _rhs) noexcept
+	{
+		int32_t* const ldata = Data();
+		const int32_t* const rdata = _rhs.Data();
+
+		// Sub row 0 and 1.
+		reinterpret_cast<__m256i&>(ldata[0]) =
+			_mm256_sub_epi32(reinterpret_cast<const __m256i&>(ldata[0]), reinterpret_cast<const __m256i&>(rdata[0]));
+
+		// Sub row 2 and 3.
+		reinterpret_cast<__m256i&>(ldata[8]) =
+			_mm256_sub_epi32(reinterpret_cast<const __m256i&>(ldata[8]), reinterpret_cast<const __m256i&>(rdata[8]));
+
+		return *this;
+	}
+
+//}
+
+#endif
+
+#if SA_MATHS_MATRIX4_SIMD && SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512 // SIMD AVX-512
+
+	namespace Intl
+	{
+		/*
+		*	Memory-order kernels: float matrix in one zmm register, double matrix in two (rows 0-1 and rows 2-3).
+		*	Element-wise operations, transpose and inverse are major agnostic: inv(M^T) = inv(M)^T.
+		*	Multiply uses row major order: column major matrices swap operands, (A * B)^T = B^T * A^T.
+		*/
+
+		/**
+		*	Inverse from 2x2 minors (memory element indices).
+		*	s0..s5: minors of rows 0-1, c0..c5: minors of rows 2-3 (lanes 12-15 unused).
+		*	minor = P * Q - R * T.
+		*/
+		alignas(64) static constexpr int32_t mat4InvMinorP[16] = { 0, 0, 0, 1, 1, 2, 8, 8, 8, 9, 9, 10, 0, 0, 0, 0 };
+		alignas(64) static constexpr int32_t mat4InvMinorQ[16] = { 5, 6, 7, 6, 7, 7, 13, 14, 15, 14, 15, 15, 0, 0, 0, 0 };
+		alignas(64) static constexpr int32_t mat4InvMinorR[16] = { 4, 4, 4, 5, 5, 6, 12, 12, 12, 13, 13, 14, 0, 0, 0, 0 };
+		alignas(64) static constexpr int32_t mat4InvMinorT[16] = { 1, 2, 3, 2, 3, 3, 9, 10, 11, 10, 11, 11, 0, 0, 0, 0 };
+
+		/// Cofactors: sign * (E1 * M1 - E2 * M2 + E3 * M3), E: matrix element indices, M: minor indices.
+		alignas(64) static constexpr int32_t mat4InvCofE1[16] = { 5, 1, 13, 9, 4, 0, 12, 8, 4, 0, 12, 8, 4, 0, 12, 8 };
+		alignas(64) static constexpr int32_t mat4InvCofE2[16] = { 6, 2, 14, 10, 6, 2, 14, 10, 5, 1, 13, 9, 5, 1, 13, 9 };
+		alignas(64) static constexpr int32_t mat4InvCofE3[16] = { 7, 3, 15, 11, 7, 3, 15, 11, 7, 3, 15, 11, 6, 2, 14, 10 };
+		alignas(64) static constexpr int32_t mat4InvCofM1[16] = { 11, 11, 5, 5, 11, 11, 5, 5, 10, 10, 4, 4, 9, 9, 3, 3 };
+		alignas(64) static constexpr int32_t mat4InvCofM2[16] = { 10, 10, 4, 4, 8, 8, 2, 2, 8, 8, 2, 2, 7, 7, 1, 1 };
+		alignas(64) static constexpr int32_t mat4InvCofM3[16] = { 9, 9, 3, 3, 7, 7, 1, 1, 6, 6, 0, 0, 6, 6, 0, 0 };
+
+		/// Transpose: memory element indices.
+		alignas(64) static constexpr int32_t mat4Transpose[16] = { 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 };
+
+
+		template <typename T>
+		T Mat4Det_AVX512(const T (&_minors)[16]) noexcept
+		{
+			// s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0.
+			return _minors[0] * _minors[11] - _minors[1] * _minors[10] + _minors[2] * _minors[9] +
+				_minors[3] * _minors[8] - _minors[4] * _minors[7] + _minors[5] * _minors[6];
+		}
+
+//{ Float
+
+		inline __m512i Mat4fIndex_AVX512(const int32_t (&_indices)[16]) noexcept
+		{
+			return _mm512_load_si512(_indices);
+		}
+
+		inline __m512 Mat4fMul_AVX512(const float* _a, const float* _b) noexcept
+		{
+			// A elements broadcast in-lane (one row per 128 bits lane), B rows duplicated in every lane.
+			const __m512 a = _mm512_loadu_ps(_a);
+
+			__m512 res = _mm512_mul_ps(_mm512_permute_ps(a, 0x00), _mm512_broadcast_f32x4(_mm_loadu_ps(_b)));
+			res = _mm512_fmadd_ps(_mm512_permute_ps(a, 0x55), _mm512_broadcast_f32x4(_mm_loadu_ps(_b + 4)), res);
+			res = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xAA), _mm512_broadcast_f32x4(_mm_loadu_ps(_b + 8)), res);
+			res = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xFF), _mm512_broadcast_f32x4(_mm_loadu_ps(_b + 12)), res);
+
+			return res;
+		}
+
+		inline void Mat4fTranspose_AVX512(float* _data) noexcept
+		{
+			_mm512_storeu_ps(_data, _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4Transpose), _mm512_loadu_ps(_data)));
+		}
+
+		inline void Mat4fInverse_AVX512(const float* _in, float* _out) noexcept
+		{
+			const __m512 m = _mm512_loadu_ps(_in);
+
+			const __m512 minors = _mm512_fmsub_ps(
+				_mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvMinorP), m),
+				_mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvMinorQ), m),
+				_mm512_mul_ps(_mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvMinorR), m), _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvMinorT), m))
+			);
+
+			alignas(64) float fMinors[16];
+			_mm512_store_ps(fMinors, minors);
+
+			const float det = Mat4Det_AVX512(fMinors);
+
+			SA_ASSERT((NotEquals0, det), SA.Maths.Mat4, L"Determinant must be != 0 to compute inverse matrix");
+
+			const float invDet = 1.0f / det;
+
+			const __m512 e1 = _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvCofE1), m);
+			const __m512 e2 = _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvCofE2), m);
+			const __m512 e3 = _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvCofE3), m);
+
+			const __m512 m1 = _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvCofM1), minors);
+			const __m512 m2 = _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvCofM2), minors);
+			const __m512 m3 = _mm512_permutexvar_ps(Mat4fIndex_AVX512(mat4InvCofM3), minors);
+
+			const __m512 cof = _mm512_fmadd_ps(e3, m3, _mm512_fmsub_ps(e1, m1, _mm512_mul_ps(e2, m2)));
+
+			// Cofactor signs (checkerboard) and 1 / det.
+			const __m512 scale = _mm512_setr_ps(
+				invDet, -invDet, invDet, -invDet,
+				-invDet, invDet, -invDet, invDet,
+				invDet, -invDet, invDet, -invDet,
+				-invDet, invDet, -invDet, invDet
+			);
+
+			_mm512_storeu_ps(_out, _mm512_mul_ps(cof, scale));
+		}
+
+//}
+
+//{ Double
+
+		/// 2x8 double indices: low half of the table for lo register, high half for hi register.
+		inline void Mat4dIndex_AVX512(const int32_t (&_indices)[16], __m512i& _lo, __m512i& _hi) noexcept
+		{
+			_lo = _mm512_cvtepi32_epi64(_mm256_load_si256(reinterpret_cast<const __m256i*>(_indices)));
+			_hi = _mm512_cvtepi32_epi64(_mm256_load_si256(reinterpret_cast<const __m256i*>(_indices + 8)));
+		}
+
+		/// Permute 16 doubles stored in 2 registers.
+		inline void Mat4dPermute_AVX512(const int32_t (&_indices)[16], __m512d _lo, __m512d _hi, __m512d& _resLo, __m512d& _resHi) noexcept
+		{
+			__m512i iLo;
+			__m512i iHi;
+			Mat4dIndex_AVX512(_indices, iLo, iHi);
+
+			_resLo = _mm512_permutex2var_pd(_lo, iLo, _hi);
+			_resHi = _mm512_permutex2var_pd(_lo, iHi, _hi);
+		}
+
+		inline __m512d Mat4dMulRows_AVX512(__m512d _aRows, const __m512d (&_b)[4]) noexcept
+		{
+			// A elements broadcast in-lane (one row per 256 bits lane), B rows duplicated in both lanes.
+			__m512d res = _mm512_mul_pd(_mm512_permutex_pd(_aRows, 0x00), _b[0]);
+			res = _mm512_fmadd_pd(_mm512_permutex_pd(_aRows, 0x55), _b[1], res);
+			res = _mm512_fmadd_pd(_mm512_permutex_pd(_aRows, 0xAA), _b[2], res);
+			res = _mm512_fmadd_pd(_mm512_permutex_pd(_aRows, 0xFF), _b[3], res);
+
+			return res;
+		}
+
+		inline void Mat4dMul_AVX512(const double* _a, const double* _b, double* _c) noexcept
+		{
+			const __m512d b[4] = {
+				_mm512_broadcast_f64x4(_mm256_loadu_pd(_b)),
+				_mm512_broadcast_f64x4(_mm256_loadu_pd(_b + 4)),
+				_mm512_broadcast_f64x4(_mm256_loadu_pd(_b + 8)),
+				_mm512_broadcast_f64x4(_mm256_loadu_pd(_b + 12)),
+			};
+
+			const __m512d c01 = Mat4dMulRows_AVX512(_mm512_loadu_pd(_a), b);
+			const __m512d c23 = Mat4dMulRows_AVX512(_mm512_loadu_pd(_a + 8), b);
+
+			// Store after compute: _c may alias _a or _b.
+			_mm512_storeu_pd(_c, c01);
+			_mm512_storeu_pd(_c + 8, c23);
+		}
+
+		inline void Mat4dTranspose_AVX512(double* _data) noexcept
+		{
+			__m512d lo;
+			__m512d hi;
+			Mat4dPermute_AVX512(mat4Transpose, _mm512_loadu_pd(_data), _mm512_loadu_pd(_data + 8), lo, hi);
+
+			_mm512_storeu_pd(_data, lo);
+			_mm512_storeu_pd(_data + 8, hi);
+		}
+
+		inline void Mat4dInverse_AVX512(const double* _in, double* _out) noexcept
+		{
+			const __m512d mLo = _mm512_loadu_pd(_in);
+			const __m512d mHi = _mm512_loadu_pd(_in + 8);
+
+			__m512d p[2], q[2], r[2], t[2];
+			Mat4dPermute_AVX512(mat4InvMinorP, mLo, mHi, p[0], p[1]);
+			Mat4dPermute_AVX512(mat4InvMinorQ, mLo, mHi, q[0], q[1]);
+			Mat4dPermute_AVX512(mat4InvMinorR, mLo, mHi, r[0], r[1]);
+			Mat4dPermute_AVX512(mat4InvMinorT, mLo, mHi, t[0], t[1]);
+
+			const __m512d minorsLo = _mm512_fmsub_pd(p[0], q[0], _mm512_mul_pd(r[0], t[0]));
+			const __m512d minorsHi = _mm512_fmsub_pd(p[1], q[1], _mm512_mul_pd(r[1], t[1]));
+
+			alignas(64) double dMinors[16];
+			_mm512_store_pd(dMinors, minorsLo);
+			_mm512_store_pd(dMinors + 8, minorsHi);
+
+			const double det = Mat4Det_AVX512(dMinors);
+
+			SA_ASSERT((NotEquals0, det), SA.Maths.Mat4, L"Determinant must be != 0 to compute inverse matrix");
+
+			const double invDet = 1.0 / det;
+
+			// Both halves have the same cofactor signs: rows 0-1 and rows 2-3.
+			const __m512d scale = _mm512_setr_pd(invDet, -invDet, invDet, -invDet, -invDet, invDet, -invDet, invDet);
+
+			__m512d e1[2], e2[2], e3[2], m1[2], m2[2], m3[2];
+			Mat4dPermute_AVX512(mat4InvCofE1, mLo, mHi, e1[0], e1[1]);
+			Mat4dPermute_AVX512(mat4InvCofE2, mLo, mHi, e2[0], e2[1]);
+			Mat4dPermute_AVX512(mat4InvCofE3, mLo, mHi, e3[0], e3[1]);
+			Mat4dPermute_AVX512(mat4InvCofM1, minorsLo, minorsHi, m1[0], m1[1]);
+			Mat4dPermute_AVX512(mat4InvCofM2, minorsLo, minorsHi, m2[0], m2[1]);
+			Mat4dPermute_AVX512(mat4InvCofM3, minorsLo, minorsHi, m3[0], m3[1]);
+
+			for (int i = 0; i < 2; ++i)
+			{
+				const __m512d cof = _mm512_fmadd_pd(e3[i], m3[i], _mm512_fmsub_pd(e1[i], m1[i], _mm512_mul_pd(e2[i], m2[i])));
+
+				_mm512_storeu_pd(_out + i * 8, _mm512_mul_pd(cof, scale));
+			}
+		}
+
+//}
+	}
+
+//{ Float
+
+	template <>
+	RMat4f RMat4f::GetInversed() const
+	{
+		Mat4 res;
+
+		Intl::Mat4fInverse_AVX512(Data(), res.Data());
+
+		return res;
+	}
+
+	template <>
+	RMat4f& RMat4f::Transpose() noexcept
+	{
+		Intl::Mat4fTranspose_AVX512(Data());
+
+		return *this;
+	}
+
+
+	template <>
+	template <>
+	RMat4f RMat4f::operator*(float _scale) const noexcept
+	{
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_mul_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return res;
+	}
+
+	template <>
+	template <>
+	RMat4f RMat4f::operator/(float _scale) const
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_div_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return res;
+	}
+
+	template <>
+	RMat4f RMat4f::operator+(const RMat4f& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_add_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return res;
+	}
+
+	template <>
+	RMat4f RMat4f::operator-(const RMat4f& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_sub_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return res;
+	}
+
+	template <>
+	RMat4f RMat4f::operator*(const RMat4f& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), Intl::Mat4fMul_AVX512(Data(), _rhs.Data()));
+
+		return res;
+	}
+
+
+	template <>
+	template <>
+	RMat4f& RMat4f::operator*=(float _scale) noexcept
+	{
+		_mm512_storeu_ps(Data(), _mm512_mul_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return *this;
+	}
+
+	template <>
+	template <>
+	RMat4f& RMat4f::operator/=(float _scale)
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		_mm512_storeu_ps(Data(), _mm512_div_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return *this;
+	}
+
+	template <>
+	RMat4f& RMat4f::operator+=(const RMat4f& _rhs) noexcept
+	{
+		_mm512_storeu_ps(Data(), _mm512_add_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return *this;
+	}
+
+	template <>
+	RMat4f& RMat4f::operator-=(const RMat4f& _rhs) noexcept
+	{
+		_mm512_storeu_ps(Data(), _mm512_sub_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return *this;
+	}
+
+
+	template <>
+	CMat4f CMat4f::GetInversed() const
+	{
+		Mat4 res;
+
+		Intl::Mat4fInverse_AVX512(Data(), res.Data());
+
+		return res;
+	}
+
+	template <>
+	CMat4f& CMat4f::Transpose() noexcept
+	{
+		Intl::Mat4fTranspose_AVX512(Data());
+
+		return *this;
+	}
+
+
+	template <>
+	template <>
+	CMat4f CMat4f::operator*(float _scale) const noexcept
+	{
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_mul_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return res;
+	}
+
+	template <>
+	template <>
+	CMat4f CMat4f::operator/(float _scale) const
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_div_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return res;
+	}
+
+	template <>
+	CMat4f CMat4f::operator+(const CMat4f& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_add_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return res;
+	}
+
+	template <>
+	CMat4f CMat4f::operator-(const CMat4f& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		_mm512_storeu_ps(res.Data(), _mm512_sub_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return res;
+	}
+
+	template <>
+	CMat4f CMat4f::operator*(const CMat4f& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		// Column major: swap operands.
+		_mm512_storeu_ps(res.Data(), Intl::Mat4fMul_AVX512(_rhs.Data(), Data()));
+
+		return res;
+	}
+
+
+	template <>
+	template <>
+	CMat4f& CMat4f::operator*=(float _scale) noexcept
+	{
+		_mm512_storeu_ps(Data(), _mm512_mul_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return *this;
+	}
+
+	template <>
+	template <>
+	CMat4f& CMat4f::operator/=(float _scale)
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		_mm512_storeu_ps(Data(), _mm512_div_ps(_mm512_loadu_ps(Data()), _mm512_set1_ps(_scale)));
+
+		return *this;
+	}
+
+	template <>
+	CMat4f& CMat4f::operator+=(const CMat4f& _rhs) noexcept
+	{
+		_mm512_storeu_ps(Data(), _mm512_add_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return *this;
+	}
+
+	template <>
+	CMat4f& CMat4f::operator-=(const CMat4f& _rhs) noexcept
+	{
+		_mm512_storeu_ps(Data(), _mm512_sub_ps(_mm512_loadu_ps(Data()), _mm512_loadu_ps(_rhs.Data())));
+
+		return *this;
+	}
+
+//}
+
+//{ Double
+
+	template <>
+	RMat4d RMat4d::GetInversed() const
+	{
+		Mat4 res;
+
+		Intl::Mat4dInverse_AVX512(Data(), res.Data());
+
+		return res;
+	}
+
+	template <>
+	RMat4d& RMat4d::Transpose() noexcept
+	{
+		Intl::Mat4dTranspose_AVX512(Data());
+
+		return *this;
+	}
+
+
+	template <>
+	template <>
+	RMat4d RMat4d::operator*(double _scale) const noexcept
+	{
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		const __m512d sPack = _mm512_set1_pd(_scale);
+
+		_mm512_storeu_pd(dres, _mm512_mul_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(dres + 8, _mm512_mul_pd(_mm512_loadu_pd(data + 8), sPack));
+
+		return res;
+	}
+
+	template <>
+	template <>
+	RMat4d RMat4d::operator/(double _scale) const
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		const __m512d sPack = _mm512_set1_pd(_scale);
+
+		_mm512_storeu_pd(dres, _mm512_div_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(dres + 8, _mm512_div_pd(_mm512_loadu_pd(data + 8), sPack));
+
+		return res;
+	}
+
+	template <>
+	RMat4d RMat4d::operator+(const RMat4d& _rhs) const noexcept
+	{
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		_mm512_storeu_pd(dres, _mm512_add_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(dres + 8, _mm512_add_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
+
+		return res;
+	}
+
+	template <>
+	RMat4d RMat4d::operator-(const RMat4d& _rhs) const noexcept
+	{
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		_mm512_storeu_pd(dres, _mm512_sub_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(dres + 8, _mm512_sub_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
+
+		return res;
+	}
+
+	template <>
+	RMat4d RMat4d::operator*(const RMat4d& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		Intl::Mat4dMul_AVX512(Data(), _rhs.Data(), res.Data());
+
+		return res;
+	}
+
+
+	template <>
+	template <>
+	RMat4d& RMat4d::operator*=(double _scale) noexcept
+	{
+		double* const data = Data();
+
+		const __m512d sPack = _mm512_set1_pd(_scale);
+
+		_mm512_storeu_pd(data, _mm512_mul_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(data + 8, _mm512_mul_pd(_mm512_loadu_pd(data + 8), sPack));
+
+		return *this;
+	}
+
+	template <>
+	template <>
+	RMat4d& RMat4d::operator/=(double _scale)
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		double* const data = Data();
+
+		const __m512d sPack = _mm512_set1_pd(_scale);
+
+		_mm512_storeu_pd(data, _mm512_div_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(data + 8, _mm512_div_pd(_mm512_loadu_pd(data + 8), sPack));
+
+		return *this;
+	}
+
+	template <>
+	RMat4d& RMat4d::operator+=(const RMat4d& _rhs) noexcept
+	{
+		double* const data = Data();
+
+		_mm512_storeu_pd(data, _mm512_add_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(data + 8, _mm512_add_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
+
+		return *this;
+	}
+
+	template <>
+	RMat4d& RMat4d::operator-=(const RMat4d& _rhs) noexcept
+	{
+		double* const data = Data();
+
+		_mm512_storeu_pd(data, _mm512_sub_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(data + 8, _mm512_sub_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
+
+		return *this;
+	}
+
+
+	template <>
+	CMat4d CMat4d::GetInversed() const
+	{
+		Mat4 res;
+
+		Intl::Mat4dInverse_AVX512(Data(), res.Data());
+
+		return res;
+	}
+
+	template <>
+	CMat4d& CMat4d::Transpose() noexcept
+	{
+		Intl::Mat4dTranspose_AVX512(Data());
+
+		return *this;
+	}
+
+
+	template <>
+	template <>
+	CMat4d CMat4d::operator*(double _scale) const noexcept
+	{
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		const __m512d sPack = _mm512_set1_pd(_scale);
+
+		_mm512_storeu_pd(dres, _mm512_mul_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(dres + 8, _mm512_mul_pd(_mm512_loadu_pd(data + 8), sPack));
+
+		return res;
+	}
+
+	template <>
+	template <>
+	CMat4d CMat4d::operator/(double _scale) const
+	{
+		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
+
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		const __m512d sPack = _mm512_set1_pd(_scale);
+
+		_mm512_storeu_pd(dres, _mm512_div_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(dres + 8, _mm512_div_pd(_mm512_loadu_pd(data + 8), sPack));
+
+		return res;
+	}
+
+	template <>
+	CMat4d CMat4d::operator+(const CMat4d& _rhs) const noexcept
+	{
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		_mm512_storeu_pd(dres, _mm512_add_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(dres + 8, _mm512_add_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
+
+		return res;
+	}
+
+	template <>
+	CMat4d CMat4d::operator-(const CMat4d& _rhs) const noexcept
+	{
+		Mat4 res;
+		double* const dres = res.Data();
+		const double* const data = Data();
+
+		_mm512_storeu_pd(dres, _mm512_sub_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(dres + 8, _mm512_sub_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
+
+		return res;
+	}
+
+	template <>
+	CMat4d CMat4d::operator*(const CMat4d& _rhs) const noexcept
+	{
+		Mat4 res;
+
+		// Column major: swap operands.
+		Intl::Mat4dMul_AVX512(_rhs.Data(), Data(), res.Data());
+
+		return res;
+	}
+
+
+	template <>
+	template <>
+	CMat4d& CMat4d::operator*=(double _scale) noexcept
+	{
+		double* const data = Data();
 
-		// Mult row 0 and 1.
-		reinterpret_cast<__m256i&>(data[0]) = _mm256_mullo_epi32(reinterpret_cast<const __m256i&>(data[0]), sPack);
+		const __m512d sPack = _mm512_set1_pd(_scale);
 
-		// Mult row 2 and 3.
-		reinterpret_cast<__m256i&>(data[8]) = _mm256_mullo_epi32(reinterpret_cast<const __m256i&>(data[8]), sPack);
+		_mm512_storeu_pd(data, _mm512_mul_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(data + 8, _mm512_mul_pd(_mm512_loadu_pd(data + 8), sPack));
 
 		return *this;
 	}
 
-#if SA_INTRISC_SVML
-
 	template <>
 	template <>
-	CMat4i& CMat4i::operator/=(int32_t _scale)
+	CMat4d& CMat4d::operator/=(double _scale)
 	{
 		SA_ASSERT((NotEquals0, _scale), SA.Maths.Mat4, L"Unscale matrix by 0 (division by 0)!");
 
-		int32_t* const data = Data();
-
-		const __m256i sPack = _mm256_set1_epi32(_scale);
+		double* const data = Data();
 
-		// Div row 0 and 1.
-		reinterpret_cast<__m256i&>(data[0]) = _mm256_div_epi32(reinterpret_cast<const __m256i&>(data[0]), sPack);
+		const __m512d sPack = _mm512_set1_pd(_scale);
 
-		// Div row 2 and 3.
-		reinterpret_cast<__m256i&>(data[8]) = _mm256_div_epi32(reinterpret_cast<const __m256i&>(data[8]), sPack);
+		_mm512_storeu_pd(data, _mm512_div_pd(_mm512_loadu_pd(data), sPack));
+		_mm512_storeu_pd(data + 8, _mm512_div_pd(_mm512_loadu_pd(data + 8), sPack));
 
 		return *this;
 	}
 
-#endif
-
 	template <>
-	CMat4i& CMat4i::operator+=(const CMat4i& _rhs) noexcept
+	CMat4d& CMat4d::operator+=(const CMat4d& _rhs) noexcept
 	{
-		int32_t* const ldata = Data();
-		const int32_t* const rdata = _rhs.Data();
-
-		// Add row 0 and 1.
-		reinterpret_cast<__m256i&>(ldata[0]) =
-			_mm256_add_epi32(reinterpret_cast<const __m256i&>(ldata[0]), reinterpret_cast<const __m256i&>(rdata[0]));
+		double* const data = Data();
 
-		// Add row 2 and 3.
-		reinterpret_cast<__m256i&>(ldata[8]) =
-			_mm256_add_epi32(reinterpret_cast<const __m256i&>(ldata[8]), reinterpret_cast<const __m256i&>(rdata[8]));
+		_mm512_storeu_pd(data, _mm512_add_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(data + 8, _mm512_add_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
 
 		return *this;
 	}
 
 	template <>
-	CMat4i& CMat4i::operator-=(const CMat4i& _rhs) noexcept
+	CMat4d& CMat4d::operator-=(const CMat4d& _rhs) noexcept
 	{
-		int32_t* const ldata = Data();
-		const int32_t* const rdata = _rhs.Data();
-
-		// Sub row 0 and 1.
-		reinterpret_cast<__m256i&>(ldata[0]) =
-			_mm256_sub_epi32(reinterpret_cast<const __m256i&>(ldata[0]), reinterpret_cast<const __m256i&>(rdata[0]));
+		double* const data = Data();
 
-		// Sub row 2 and 3.
-		reinterpret_cast<__m256i&>(ldata[8]) =
-			_mm256_sub_epi32(reinterpret_cast<const __m256i&>(ldata[8]), reinterpret_cast<const __m256i&>(rdata[8]));
+		_mm512_storeu_pd(data, _mm512_sub_pd(_mm512_loadu_pd(data), _mm512_loadu_pd(_rhs.Data())));
+		_mm512_storeu_pd(data + 8, _mm512_sub_pd(_mm512_loadu_pd(data + 8), _mm512_loadu_pd(_rhs.Data() + 8)));
 
 		return *this;
 	}
@@ -477,7 +1208,117 @@ namespace SA
 
 #endif
 
-#if SA_MATHS_MATRIX4_SIMD && SA_INTRISC_SSE // SIMD float
+#if SA_MATHS_MATRIX4_SIMD && SA_INTRISC_AVX // SIMD float
+
+	namespace Intl
+	{
+		/// _a * _b + _c: fused (single rounding) with SA_INTRISC_FMA.
+		inline __m256 Mat4fMadd(__m256 _a, __m256 _b, __m256 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmadd_ps(_a, _b, _c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+		}
+
+		/// _a * _b - _c: fused (single rounding) with SA_INTRISC_FMA.
+		inline __m256 Mat4fMsub(__m256 _a, __m256 _b, __m256 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm256_fmsub_ps(_a, _b, _c);
+#else
+			return _mm256_sub_ps(_mm256_mul_ps(_a, _b), _c);
+#endif
+		}
+
+		/// \copydoc Mat4fMadd
+		inline __m128 Mat4fMadd(__m128 _a, __m128 _b, __m128 _c) noexcept
+		{
+#if SA_INTRISC_FMA
+			return _mm_fmadd_ps(_a, _b, _c);
+#else
+			return _mm_add_ps(_mm_mul_ps(_a, _b), _c);
+#endif
+		}
+
+#if SA_INTRISC_FMA && !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512)
+
+		/**
+		*	Inverse from 2x2 minors (memory element indices): each minor and cofactor is a single fused operation.
+		*	Major agnostic: inv(M^T) = inv(M)^T.
+		*/
+		inline void Mat4fInverse_FMA(const float* _m, float* _out)
+		{
+			// s0..s5: minors of rows 0-1, c0..c5: minors of rows 2-3.
+			const __m256 sMinors = Mat4fMsub(
+				_mm256_setr_ps(_m[0], _m[0], _m[0], _m[1], _m[1], _m[2], 0.0f, 0.0f),
+				_mm256_setr_ps(_m[5], _m[6], _m[7], _m[6], _m[7], _m[7], 0.0f, 0.0f),
+				_mm256_mul_ps(
+					_mm256_setr_ps(_m[4], _m[4], _m[4], _m[5], _m[5], _m[6], 0.0f, 0.0f),
+					_mm256_setr_ps(_m[1], _m[2], _m[3], _m[2], _m[3], _m[3], 0.0f, 0.0f))
+			);
+
+			const __m256 cMinors = Mat4fMsub(
+				_mm256_setr_ps(_m[8], _m[8], _m[8], _m[9], _m[9], _m[10], 0.0f, 0.0f),
+				_mm256_setr_ps(_m[13], _m[14], _m[15], _m[14], _m[15], _m[15], 0.0f, 0.0f),
+				_mm256_mul_ps(
+					_mm256_setr_ps(_m[12], _m[12], _m[12], _m[13], _m[13], _m[14], 0.0f, 0.0f),
+					_mm256_setr_ps(_m[9], _m[10], _m[11], _m[10], _m[11], _m[11], 0.0f, 0.0f))
+			);
+
+			// Lanes 6-7 of s overwritten by c0-c1: fMinors[0-5] = s0..s5, fMinors[6-11] = c0..c5.
+			alignas(32) float fMinors[14];
+			_mm256_store_ps(fMinors, sMinors);
+			_mm256_storeu_ps(fMinors + 6, cMinors);
+
+			// s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0.
+			float fDet[8];
+			_mm256_storeu_ps(fDet, _mm256_mul_ps(sMinors,
+				_mm256_setr_ps(fMinors[11], -fMinors[10], fMinors[9], fMinors[8], -fMinors[7], fMinors[6], 0.0f, 0.0f)));
+
+			const float det = fDet[0] + fDet[1] + fDet[2] + fDet[3] + fDet[4] + fDet[5];
+
+			SA_ASSERT((NotEquals0, det), SA.Maths.Mat4, L"Determinant must be != 0 to compute inverse matrix");
+
+			const float invDet = 1.0f / det;
+
+			// Cofactor signs (checkerboard, identical for both packs) and 1 / det.
+			const __m256 scale = _mm256_setr_ps(invDet, -invDet, invDet, -invDet, -invDet, invDet, -invDet, invDet);
+
+			// Rows 0 and 1.
+			{
+				const __m256 e1 = _mm256_setr_ps(_m[5], _m[1], _m[13], _m[9], _m[4], _m[0], _m[12], _m[8]);
+				const __m256 e2 = _mm256_setr_ps(_m[6], _m[2], _m[14], _m[10], _m[6], _m[2], _m[14], _m[10]);
+				const __m256 e3 = _mm256_setr_ps(_m[7], _m[3], _m[15], _m[11], _m[7], _m[3], _m[15], _m[11]);
+
+				const __m256 m1 = _mm256_setr_ps(fMinors[11], fMinors[11], fMinors[5], fMinors[5], fMinors[11], fMinors[11], fMinors[5], fMinors[5]);
+				const __m256 m2 = _mm256_setr_ps(fMinors[10], fMinors[10], fMinors[4], fMinors[4], fMinors[8], fMinors[8], fMinors[2], fMinors[2]);
+				const __m256 m3 = _mm256_setr_ps(fMinors[9], fMinors[9], fMinors[3], fMinors[3], fMinors[7], fMinors[7], fMinors[1], fMinors[1]);
+
+				const __m256 cof = Mat4fMadd(e3, m3, Mat4fMsub(e1, m1, _mm256_mul_ps(e2, m2)));
+
+				_mm256_store_ps(_out, _mm256_mul_ps(cof, scale));
+			}
+
+			// Rows 2 and 3.
+			{
+				const __m256 e1 = _mm256_setr_ps(_m[4], _m[0], _m[12], _m[8], _m[4], _m[0], _m[12], _m[8]);
+				const __m256 e2 = _mm256_setr_ps(_m[5], _m[1], _m[13], _m[9], _m[5], _m[1], _m[13], _m[9]);
+				const __m256 e3 = _mm256_setr_ps(_m[7], _m[3], _m[15], _m[11], _m[6], _m[2], _m[14], _m[10]);
+
+				const __m256 m1 = _mm256_setr_ps(fMinors[10], fMinors[10], fMinors[4], fMinors[4], fMinors[9], fMinors[9], fMinors[3], fMinors[3]);
+				const __m256 m2 = _mm256_setr_ps(fMinors[8], fMinors[8], fMinors[2], fMinors[2], fMinors[7], fMinors[7], fMinors[1], fMinors[1]);
+				const __m256 m3 = _mm256_setr_ps(fMinors[6], fMinors[6], fMinors[0], fMinors[0], fMinors[6], fMinors[6], fMinors[0], fMinors[0]);
+
+				const __m256 cof = Mat4fMadd(e3, m3, Mat4fMsub(e1, m1, _mm256_mul_ps(e2, m2)));
+
+				_mm256_store_ps(_out + 8, _mm256_mul_ps(cof, scale));
+			}
+		}
+
+#endif
+	}
 
 //{ Row Major
 
@@ -508,7 +1349,7 @@ namespace SA
 		const __m256 p4 = _mm256_set_ps(e03, e13, e03, e03, e23, e13, e13, e23);
 		const __m256 p5 = _mm256_set_ps(e32, e32, e22, e32, e32, e22, e32, e32);
 
-		const __m256 p12345 = _mm256_mul_ps(p0, _mm256_mul_ps(p1, _mm256_sub_ps(_mm256_mul_ps(p2, p3), _mm256_mul_ps(p4, p5))));
+		const __m256 p12345 = _mm256_mul_ps(p0, _mm256_mul_ps(p1, Intl::Mat4fMsub(p2, p3, _mm256_mul_ps(p4, p5))));
 
 
 		const __m256 p0_1 = _mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, -e30, e30, -e30, e20);
@@ -518,18 +1359,30 @@ namespace SA
 		const __m256 p9 = _mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, e03, e03, e13, e03);
 		const __m256 p10 = _mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, e12, e22, e22, e12);
 
-		const __m256 p678910 = _mm256_mul_ps(p0_1, _mm256_mul_ps(p6, _mm256_sub_ps(_mm256_mul_ps(p7, p8), _mm256_mul_ps(p9, p10))));
+		const __m256 pTotal = Intl::Mat4fMadd(p0_1, _mm256_mul_ps(p6, Intl::Mat4fMsub(p7, p8, _mm256_mul_ps(p9, p10))), p12345);
 
 
 		float fres[8];
-		_mm256_store_ps(fres, _mm256_add_ps(p12345, p678910));
+		_mm256_store_ps(fres, pTotal);
 
 		return fres[0] + fres[1] + fres[2] + fres[3] + fres[4] + fres[5] + fres[6] + fres[7];
 	}
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	RMat4f RMat4f::GetInversed() const
 	{
+#if SA_INTRISC_FMA
+
+		Mat4 res;
+
+		Intl::Mat4fInverse_FMA(Data(), res.Data());
+
+		return res;
+
+#else
+
 		Mat4 res;
 		float* const data = res.Data();
 		const float det = Determinant();
@@ -889,8 +1742,12 @@ namespace SA
 		_mm256_store_ps(&data[8], _mm256_mul_ps(invDetP, row23));
 
 		return res;
+
+#endif
 	}
 
+#endif
+
 	
 	template <>
 	RMat4f RMat4f::MakeRotation(const Quat<float>& _rot) noexcept
@@ -921,7 +1778,7 @@ namespace SA
 		const __m256 p3 = _mm256_set_ps(_rot.x, -_rot.y, -_rot.x, _rot.z, _rot.z, _rot.y, -_rot.z, _rot.z);
 		const __m256 p4 = _mm256_set_ps(_rot.w, _rot.w, _rot.w, _rot.z, _rot.w, _rot.w, _rot.w, _rot.z);
 
-		const __m256 p1234 = _mm256_mul_ps(pDbl, _mm256_add_ps(_mm256_mul_ps(p1, p2), _mm256_mul_ps(p3, p4)));
+		const __m256 p1234 = _mm256_mul_ps(pDbl, Intl::Mat4fMadd(p3, p4, _mm256_mul_ps(p1, p2)));
 		
 		float f1234[8];
 		_mm256_store_ps(f1234, p1234);
@@ -945,6 +1802,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	RMat4f RMat4f::operator*(float _scale) const noexcept
@@ -1042,23 +1901,38 @@ namespace SA
 
 		// Row 0 and 1.
 		_mm256_store_ps(&data[0], _mm256_add_ps(
-			_mm256_add_ps(_mm256_mul_ps(lp00, rp0), _mm256_mul_ps(lp10, rp1)),
-			_mm256_add_ps(_mm256_mul_ps(lp20, rp2), _mm256_mul_ps(lp30, rp3))
+			Intl::Mat4fMadd(lp10, rp1, _mm256_mul_ps(lp00, rp0)),
+			Intl::Mat4fMadd(lp30, rp3, _mm256_mul_ps(lp20, rp2))
 		));
 
 		// Row 2 and 3.
 		_mm256_store_ps(&data[8], _mm256_add_ps(
-			_mm256_add_ps(_mm256_mul_ps(lp01, rp0), _mm256_mul_ps(lp11, rp1)),
-			_mm256_add_ps(_mm256_mul_ps(lp21, rp2), _mm256_mul_ps(lp31, rp3))
+			Intl::Mat4fMadd(lp11, rp1, _mm256_mul_ps(lp01, rp0)),
+			Intl::Mat4fMadd(lp31, rp3, _mm256_mul_ps(lp21, rp2))
 		));
 
 		return res;
 	}
 
+#endif
 
 	template <>
 	Vec3<float> RMat4f::operator*(const Vec3<float>& _rhs) const noexcept
 	{
+#if SA_INTRISC_FMA
+
+		// x * column 0 + y * column 1 + z * column 2.
+		const __m128 res = Intl::Mat4fMadd(_mm_set_ps(0.0f, e22, e12, e02), _mm_set1_ps(_rhs.z),
+			Intl::Mat4fMadd(_mm_set_ps(0.0f, e21, e11, e01), _mm_set1_ps(_rhs.y),
+				_mm_mul_ps(_mm_set_ps(0.0f, e20, e10, e00), _mm_set1_ps(_rhs.x))));
+
+		float fres[4];
+		_mm_store_ps(fres, res);
+
+		return Vec3f(fres[0], fres[1], fres[2]);
+
+#else
+
 		// Compute first 8 elems.
 		const __m256 p0 = _mm256_set_ps(e12, e02, e21, e11, e01, e20, e10, e00);
 		const __m256 pScale = _mm256_set_ps(_rhs.z, _rhs.z, _rhs.y, _rhs.y, _rhs.y, _rhs.x, _rhs.x, _rhs.x);
@@ -1071,6 +1945,8 @@ namespace SA
 			fres[1] + fres[4] + fres[7],
 			fres[2] + fres[5] + e22 * _rhs.z
 		);
+
+#endif
 	}
 
 	template <>
@@ -1080,9 +1956,7 @@ namespace SA
 		const __m256 pScaleZW = _mm256_set_ps(_rhs.w, _rhs.w, _rhs.w, _rhs.w, _rhs.z, _rhs.z, _rhs.z, _rhs.z);
 
 		const __m256 p01 = _mm256_mul_ps(_mm256_set_ps(e31, e21, e11, e01, e30, e20, e10, e00), pScaleXY);
-		const __m256 p23 = _mm256_mul_ps(_mm256_set_ps(e33, e23, e13, e03, e32, e22, e12, e02), pScaleZW);
-
-		const __m256 pTotal = _mm256_add_ps(p01, p23);
+		const __m256 pTotal = Intl::Mat4fMadd(_mm256_set_ps(e33, e23, e13, e03, e32, e22, e12, e02), pScaleZW, p01);
 		const __m128 pTotalL = _mm256_extractf128_ps(pTotal, 0);
 		const __m128 pTotalH = _mm256_extractf128_ps(pTotal, 1);
 
@@ -1094,6 +1968,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	RMat4f& RMat4f::operator*=(float _scale) noexcept
@@ -1168,6 +2044,8 @@ namespace SA
 		return *this;
 	}
 
+#endif
+
 
 	template <>
 	RMat4f operator/(float _lhs, const RMat4f& _rhs)
@@ -1236,7 +2114,7 @@ namespace SA
 		const __m256 p4 = _mm256_set_ps(e03, e13, e03, e03, e23, e13, e13, e23);
 		const __m256 p5 = _mm256_set_ps(e32, e32, e22, e32, e32, e22, e32, e32);
 
-		const __m256 p12345 = _mm256_mul_ps(p0, _mm256_mul_ps(p1, _mm256_sub_ps(_mm256_mul_ps(p2, p3), _mm256_mul_ps(p4, p5))));
+		const __m256 p12345 = _mm256_mul_ps(p0, _mm256_mul_ps(p1, Intl::Mat4fMsub(p2, p3, _mm256_mul_ps(p4, p5))));
 
 
 		const __m256 p0_1 = _mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, -e30, e30, -e30, e20);
@@ -1246,18 +2124,30 @@ namespace SA
 		const __m256 p9 = _mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, e03, e03, e13, e03);
 		const __m256 p10 = _mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, e12, e22, e22, e12);
 
-		const __m256 p678910 = _mm256_mul_ps(p0_1, _mm256_mul_ps(p6, _mm256_sub_ps(_mm256_mul_ps(p7, p8), _mm256_mul_ps(p9, p10))));
+		const __m256 pTotal = Intl::Mat4fMadd(p0_1, _mm256_mul_ps(p6, Intl::Mat4fMsub(p7, p8, _mm256_mul_ps(p9, p10))), p12345);
 
 
 		float fres[8];
-		_mm256_store_ps(fres, _mm256_add_ps(p12345, p678910));
+		_mm256_store_ps(fres, pTotal);
 
 		return fres[0] + fres[1] + fres[2] + fres[3] + fres[4] + fres[5] + fres[6] + fres[7];
 	}
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	CMat4f CMat4f::GetInversed() const
 	{
+#if SA_INTRISC_FMA
+
+		Mat4 res;
+
+		Intl::Mat4fInverse_FMA(Data(), res.Data());
+
+		return res;
+
+#else
+
 		// TODO: better column major implementation.
 
 		// Transpose to row.
@@ -1265,8 +2155,11 @@ namespace SA
 
 		// Inverse row major and transpose to column.
 		return rMat.GetInversed();
+
+#endif
 	}
 
+#endif
 
 	template <>
 	CMat4f CMat4f::MakeRotation(const Quat<float>& _rot) noexcept
@@ -1297,7 +2190,7 @@ namespace SA
 		const __m256 p3 = _mm256_set_ps(_rot.x, -_rot.y, -_rot.x, _rot.z, _rot.z, _rot.y, -_rot.z, _rot.z);
 		const __m256 p4 = _mm256_set_ps(_rot.w, _rot.w, _rot.w, _rot.z, _rot.w, _rot.w, _rot.w, _rot.z);
 
-		const __m256 p1234 = _mm256_mul_ps(pDbl, _mm256_add_ps(_mm256_mul_ps(p1, p2), _mm256_mul_ps(p3, p4)));
+		const __m256 p1234 = _mm256_mul_ps(pDbl, Intl::Mat4fMadd(p3, p4, _mm256_mul_ps(p1, p2)));
 		
 		float f1234[8];
 		_mm256_store_ps(f1234, p1234);
@@ -1320,6 +2213,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	CMat4f CMat4f::operator*(float _scale) const noexcept
@@ -1416,23 +2311,38 @@ namespace SA
 
 		// Row 0 and 1.
 		_mm256_store_ps(&data[0], _mm256_add_ps(
-			_mm256_add_ps(_mm256_mul_ps(rp00, lp0), _mm256_mul_ps(rp10, lp1)),
-			_mm256_add_ps(_mm256_mul_ps(rp20, lp2), _mm256_mul_ps(rp30, lp3))
+			Intl::Mat4fMadd(rp10, lp1, _mm256_mul_ps(rp00, lp0)),
+			Intl::Mat4fMadd(rp30, lp3, _mm256_mul_ps(rp20, lp2))
 		));
 
 		// Row 2 and 3.
 		_mm256_store_ps(&data[8], _mm256_add_ps(
-			_mm256_add_ps(_mm256_mul_ps(rp01, lp0), _mm256_mul_ps(rp11, lp1)),
-			_mm256_add_ps(_mm256_mul_ps(rp21, lp2), _mm256_mul_ps(rp31, lp3))
+			Intl::Mat4fMadd(rp11, lp1, _mm256_mul_ps(rp01, lp0)),
+			Intl::Mat4fMadd(rp31, lp3, _mm256_mul_ps(rp21, lp2))
 		));
 
 		return res;
 	}
 
+#endif
 
 	template <>
 	Vec3<float> CMat4f::operator*(const Vec3<float>& _rhs) const noexcept
 	{
+#if SA_INTRISC_FMA
+
+		// x * column 0 + y * column 1 + z * column 2.
+		const __m128 res = Intl::Mat4fMadd(_mm_set_ps(0.0f, e22, e12, e02), _mm_set1_ps(_rhs.z),
+			Intl::Mat4fMadd(_mm_set_ps(0.0f, e21, e11, e01), _mm_set1_ps(_rhs.y),
+				_mm_mul_ps(_mm_set_ps(0.0f, e20, e10, e00), _mm_set1_ps(_rhs.x))));
+
+		float fres[4];
+		_mm_store_ps(fres, res);
+
+		return Vec3f(fres[0], fres[1], fres[2]);
+
+#else
+
 		// Compute first 8 elems.
 		const __m256 p0 = _mm256_set_ps(e12, e02, e21, e11, e01, e20, e10, e00);
 		const __m256 pScale = _mm256_set_ps(_rhs.z, _rhs.z, _rhs.y, _rhs.y, _rhs.y, _rhs.x, _rhs.x, _rhs.x);
@@ -1445,6 +2355,8 @@ namespace SA
 			fres[1] + fres[4] + fres[7],
 			fres[2] + fres[5] + e22 * _rhs.z
 		);
+
+#endif
 	}
 
 	template <>
@@ -1454,9 +2366,7 @@ namespace SA
 		const __m256 pScaleZW = _mm256_set_ps(_rhs.w, _rhs.w, _rhs.w, _rhs.w, _rhs.z, _rhs.z, _rhs.z, _rhs.z);
 
 		const __m256 p01 = _mm256_mul_ps(_mm256_set_ps(e31, e21, e11, e01, e30, e20, e10, e00), pScaleXY);
-		const __m256 p23 = _mm256_mul_ps(_mm256_set_ps(e33, e23, e13, e03, e32, e22, e12, e02), pScaleZW);
-
-		const __m256 pTotal = _mm256_add_ps(p01, p23);
+		const __m256 pTotal = Intl::Mat4fMadd(_mm256_set_ps(e33, e23, e13, e03, e32, e22, e12, e02), pScaleZW, p01);
 		const __m128 pTotalL = _mm256_extractf128_ps(pTotal, 0);
 		const __m128 pTotalH = _mm256_extractf128_ps(pTotal, 1);
 
@@ -1468,6 +2378,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	CMat4f& CMat4f::operator*=(float _scale) noexcept
@@ -1542,6 +2454,8 @@ namespace SA
 		return *this;
 	}
 
+#endif
+
 
 	template <>
 	CMat4f operator/(float _lhs, const CMat4f& _rhs)
@@ -1630,6 +2544,8 @@ namespace SA
 		return dTotal[0] - dTotal[1] + dTotal[2] - dTotal[3];
 	}
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	RMat4d RMat4d::GetInversed() const
 	{
@@ -2059,6 +2975,7 @@ namespace SA
 		return res;
 	}
 
+#endif
 
 	template <>
 	RMat4d RMat4d::MakeRotation(const Quat<double>& _rot) noexcept
@@ -2124,6 +3041,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	RMat4d RMat4d::operator*(double _scale) const noexcept
@@ -2263,6 +3182,7 @@ namespace SA
 		return res;
 	}
 
+#endif
 
 	template <>
 	Vec3<double> RMat4d::operator*(const Vec3<double>& _rhs) const noexcept
@@ -2295,6 +3215,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	RMat4d& RMat4d::operator*=(double _scale) noexcept
@@ -2399,6 +3321,8 @@ namespace SA
 		return *this;
 	}
 
+#endif
+
 
 	template <>
 	RMat4d operator/(double _lhs, const RMat4d& _rhs)
@@ -2488,6 +3412,8 @@ namespace SA
 		return dTotal[0] - dTotal[1] + dTotal[2] - dTotal[3];
 	}
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	CMat4d CMat4d::GetInversed() const
 	{
@@ -2500,6 +3426,7 @@ namespace SA
 		return rMat.GetInversed();
 	}
 
+#endif
 
 	template <>
 	CMat4d CMat4d::MakeRotation(const Quat<double>& _rot) noexcept
@@ -2565,6 +3492,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	CMat4d CMat4d::operator*(double _scale) const noexcept
@@ -2704,7 +3633,7 @@ namespace SA
 		return res;
 	}
 
-
+#endif
 
 	template <>
 	Vec3<double> CMat4d::operator*(const Vec3<double>& _rhs) const noexcept
@@ -2737,6 +3666,8 @@ namespace SA
 	}
 
 
+#if !(SA_MATHS_MATRIX4_AVX512 && SA_MATHS_INTRISC_AVX512) // See SIMD AVX-512.
+
 	template <>
 	template <>
 	CMat4d& CMat4d::operator*=(double _scale) noexcept
@@ -2841,6 +3772,8 @@ namespace SA
 		return *this;
 	}
 
+#endif
+
 
 	template <>
 	CMat4d operator/(double _lhs, const CMat4d& _rhs)
@@ -2885,5 +3818,191 @@ namespace SA
 
 //}
 
+#endif
+
+#if SA_MATHS_MATRIX4_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH) // SIMD batch
+
+//{ Float
+
+	template <>
+	void RMat4f::TransformPoints(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<float>().mat4TransformPoints(Data(), _in, _out, _num);
+	}
+
+	template <>
+	void RMat4f::TransformDirections(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<float>().mat4TransformDirections(Data(), _in, _out, _num);
+	}
+
+	template <>
+	void RMat4f::TransformVec4(const Vec4<float>* _in, Vec4<float>* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<float>().mat4TransformVec4(Data(), _in, _out, _num);
+	}
+
+
+	template <>
+	void RMat4f::MultiplyBatch(const RMat4f* _lhs, const RMat4f* _rhs, RMat4f* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<float>().mat4Multiply(reinterpret_cast<const float*>(_lhs), reinterpret_cast<const float*>(_rhs), reinterpret_cast<float*>(_out), _num);
+	}
+
+	template <>
+	void RMat4f::MultiplyBatch(const RMat4f& _lhs, const RMat4f* _rhs, RMat4f* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<float>().mat4MultiplyConstA(_lhs.Data(), reinterpret_cast<const float*>(_rhs), reinterpret_cast<float*>(_out), _num);
+	}
+
+	template <>
+	void RMat4f::MultiplyBatch(const RMat4f* _lhs, const RMat4f& _rhs, RMat4f* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<float>().mat4MultiplyConstB(reinterpret_cast<const float*>(_lhs), _rhs.Data(), reinterpret_cast<float*>(_out), _num);
+	}
+
+
+	template <>
+	void CMat4f::TransformPoints(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept
+	{
+		// Kernels use memory-order (row major) matrix.
+		const RMat4f rowMat = *this;
+
+		Intl::GetBatchKernels<float>().mat4TransformPoints(rowMat.Data(), _in, _out, _num);
+	}
+
+	template <>
+	void CMat4f::TransformDirections(const Vec3<float>* _in, Vec3<float>* _out, size_t _num) const noexcept
+	{
+		// Kernels use memory-order (row major) matrix.
+		const RMat4f rowMat = *this;
+
+		Intl::GetBatchKernels<float>().mat4TransformDirections(rowMat.Data(), _in, _out, _num);
+	}
+
+	template <>
+	void CMat4f::TransformVec4(const Vec4<float>* _in, Vec4<float>* _out, size_t _num) const noexcept
+	{
+		// Kernels use memory-order (row major) matrix.
+		const RMat4f rowMat = *this;
+
+		Intl::GetBatchKernels<float>().mat4TransformVec4(rowMat.Data(), _in, _out, _num);
+	}
+
+
+	template <>
+	void CMat4f::MultiplyBatch(const CMat4f* _lhs, const CMat4f* _rhs, CMat4f* _out, size_t _num) noexcept
+	{
+		// Column major: swap operands.
+		Intl::GetBatchKernels<float>().mat4Multiply(reinterpret_cast<const float*>(_rhs), reinterpret_cast<const float*>(_lhs), reinterpret_cast<float*>(_out), _num);
+	}
+
+	template <>
+	void CMat4f::MultiplyBatch(const CMat4f& _lhs, const CMat4f* _rhs, CMat4f* _out, size_t _num) noexcept
+	{
+		// Column major: swap operands.
+		Intl::GetBatchKernels<float>().mat4MultiplyConstB(reinterpret_cast<const float*>(_rhs), _lhs.Data(), reinterpret_cast<float*>(_out), _num);
+	}
+
+	template <>
+	void CMat4f::MultiplyBatch(const CMat4f* _lhs, const CMat4f& _rhs, CMat4f* _out, size_t _num) noexcept
+	{
+		// Column major: swap operands.
+		Intl::GetBatchKernels<float>().mat4MultiplyConstA(_rhs.Data(), reinterpret_cast<const float*>(_lhs), reinterpret_cast<float*>(_out), _num);
+	}
+
+//}
+
+//{ Double
+
+	template <>
+	void RMat4d::TransformPoints(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<double>().mat4TransformPoints(Data(), _in, _out, _num);
+	}
+
+	template <>
+	void RMat4d::TransformDirections(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<double>().mat4TransformDirections(Data(), _in, _out, _num);
+	}
+
+	template <>
+	void RMat4d::TransformVec4(const Vec4<double>* _in, Vec4<double>* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<double>().mat4TransformVec4(Data(), _in, _out, _num);
+	}
+
+
+	template <>
+	void RMat4d::MultiplyBatch(const RMat4d* _lhs, const RMat4d* _rhs, RMat4d* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<double>().mat4Multiply(reinterpret_cast<const double*>(_lhs), reinterpret_cast<const double*>(_rhs), reinterpret_cast<double*>(_out), _num);
+	}
+
+	template <>
+	void RMat4d::MultiplyBatch(const RMat4d& _lhs, const RMat4d* _rhs, RMat4d* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<double>().mat4MultiplyConstA(_lhs.Data(), reinterpret_cast<const double*>(_rhs), reinterpret_cast<double*>(_out), _num);
+	}
+
+	template <>
+	void RMat4d::MultiplyBatch(const RMat4d* _lhs, const RMat4d& _rhs, RMat4d* _out, size_t _num) noexcept
+	{
+		Intl::GetBatchKernels<double>().mat4MultiplyConstB(reinterpret_cast<const double*>(_lhs), _rhs.Data(), reinterpret_cast<double*>(_out), _num);
+	}
+
+
+	template <>
+	void CMat4d::TransformPoints(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept
+	{
+		// Kernels use memory-order (row major) matrix.
+		const RMat4d rowMat = *this;
+
+		Intl::GetBatchKernels<double>().mat4TransformPoints(rowMat.Data(), _in, _out, _num);
+	}
+
+	template <>
+	void CMat4d::TransformDirections(const Vec3<double>* _in, Vec3<double>* _out, size_t _num) const noexcept
+	{
+		// Kernels use memory-order (row major) matrix.
+		const RMat4d rowMat = *this;
+
+		Intl::GetBatchKernels<double>().mat4TransformDirections(rowMat.Data(), _in, _out, _num);
+	}
+
+	template <>
+	void CMat4d::TransformVec4(const Vec4<double>* _in, Vec4<double>* _out, size_t _num) const noexcept
+	{
+		// Kernels use memory-order (row major) matrix.
+		const RMat4d rowMat = *this;
+
+		Intl::GetBatchKernels<double>().mat4TransformVec4(rowMat.Data(), _in, _out, _num);
+	}
+
+
+	template <>
+	void CMat4d::MultiplyBatch(const CMat4d* _lhs, const CMat4d* _rhs, CMat4d* _out, size_t _num) noexcept
+	{
+		// Column major: swap operands.
+		Intl::GetBatchKernels<double>().mat4Multiply(reinterpret_cast<const double*>(_rhs), reinterpret_cast<const double*>(_lhs), reinterpret_cast<double*>(_out), _num);
+	}
+
+	template <>
+	void CMat4d::MultiplyBatch(const CMat4d& _lhs, const CMat4d* _rhs, CMat4d* _out, size_t _num) noexcept
+	{
+		// Column major: swap operands.
+		Intl::GetBatchKernels<double>().mat4MultiplyConstB(reinterpret_cast<const double*>(_rhs), _lhs.Data(), reinterpret_cast<double*>(_out), _num);
+	}
+
+	template <>
+	void CMat4d::MultiplyBatch(const CMat4d* _lhs, const CMat4d& _rhs, CMat4d* _out, size_t _num) noexcept
+	{
+		// Column major: swap operands.
+		Intl::GetBatchKernels<double>().mat4MultiplyConstA(_rhs.Data(), reinterpret_cast<const double*>(_lhs), reinterpret_cast<double*>(_out), _num);
+	}
+
+//}
+
 #endif
 }
@@ -4,6 +4,8 @@
 
 #include <Space/Vector3.hpp>
 
+#include "../Dispatch/BatchKernels.hpp"
+
 namespace SA
 {
 #if SA_MATHS_QUATERNION_SIMD && SA_INTRISC_SSE // SIMD float.
@@ -91,6 +93,8 @@ namespace SA
 	}
 
 
+#if SA_INTRISC_AVX // 256 bits packs.
+
 	template <>
 	Vec3<Degf> Quatf::ToEuler() const noexcept
 	{
@@ -157,6 +161,8 @@ namespace SA
 		return result;
 	}
 
+#endif
+
 	template <>
 	Quatf Quatf::FromEuler(const Vec3<Degf>& _angles) noexcept
 	{
@@ -632,5 +638,68 @@ namespace SA
 		return res;
 	}
 
+#endif
+
+#if SA_MATHS_QUATERNION_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+	namespace Intl
+	{
+//{ Float
+
+		template <>
+		void QuatNLerpBatch<float>(const float* _sw, const float* _sx, const float* _sy, const float* _sz,
+			const float* _ew, const float* _ex, const float* _ey, const float* _ez,
+			float* _ow, float* _ox, float* _oy, float* _oz, float _alpha, size_t _num) noexcept
+		{
+			GetBatchKernels<float>().quatNLerp(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _alpha, _num);
+		}
+
+		template <>
+		void QuatSLerpBatch<float, Maths::SLerpPrecision::Exact>(const float* _sw, const float* _sx, const float* _sy, const float* _sz,
+			const float* _ew, const float* _ex, const float* _ey, const float* _ez,
+			float* _ow, float* _ox, float* _oy, float* _oz, float _alpha, size_t _num) noexcept
+		{
+			GetBatchKernels<float>().quatSLerp(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _alpha, _num);
+		}
+
+		template <>
+		void QuatSLerpBatch<float, Maths::SLerpPrecision::Approx>(const float* _sw, const float* _sx, const float* _sy, const float* _sz,
+			const float* _ew, const float* _ex, const float* _ey, const float* _ez,
+			float* _ow, float* _ox, float* _oy, float* _oz, float _alpha, size_t _num) noexcept
+		{
+			GetBatchKernels<float>().quatSLerpApprox(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _alpha, _num);
+		}
+
+//}
+
+//{ Double
+
+		template <>
+		void QuatNLerpBatch<double>(const double* _sw, const double* _sx, const double* _sy, const double* _sz,
+			const double* _ew, const double* _ex, const double* _ey, const double* _ez,
+			double* _ow, double* _ox, double* _oy, double* _oz, double _alpha, size_t _num) noexcept
+		{
+			GetBatchKernels<double>().quatNLerp(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _alpha, _num);
+		}
+
+		template <>
+		void QuatSLerpBatch<double, Maths::SLerpPrecision::Exact>(const double* _sw, const double* _sx, const double* _sy, const double* _sz,
+			const double* _ew, const double* _ex, const double* _ey, const double* _ez,
+			double* _ow, double* _ox, double* _oy, double* _oz, double _alpha, size_t _num) noexcept
+		{
+			GetBatchKernels<double>().quatSLerp(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _alpha, _num);
+		}
+
+		template <>
+		void QuatSLerpBatch<double, Maths::SLerpPrecision::Approx>(const double* _sw, const double* _sx, const double* _sy, const double* _sz,
+			const double* _ew, const double* _ex, const double* _ey, const double* _ez,
+			double* _ow, double* _ox, double* _oy, double* _oz, double _alpha, size_t _num) noexcept
+		{
+			GetBatchKernels<double>().quatSLerpApprox(_sw, _sx, _sy, _sz, _ew, _ex, _ey, _ez, _ow, _ox, _oy, _oz, _alpha, _num);
+		}
+
+//}
+	}
+
 #endif
 }
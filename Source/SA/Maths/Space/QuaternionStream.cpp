@@ -0,0 +1,142 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Space/QuaternionStream.hpp>
+
+#include "../Dispatch/BatchKernels.hpp"
+
+namespace SA
+{
+#if SA_MATHS_QUATERNION_STREAM_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+//{ Float
+
+	template <>
+	QuatStreamf& QuatStreamf::Normalize()
+	{
+		Intl::GetBatchKernels<float>().quatStreamNormalize(W(), X(), Y(), Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	QuatStreamf& QuatStreamf::Inverse() noexcept
+	{
+		// Inverse of normalized quaternion is conjugate: scale imaginary part by -1.
+		Intl::GetBatchKernels<float>().vec3StreamScale(X(), Y(), Z(), float(-1), mSize);
+
+		return *this;
+	}
+
+
+	template <>
+	void QuatStreamf::Rotate(const Vec3Streamf& _vecs, Vec3Streamf& _out) const
+	{
+		SA_ASSERT((Equals, mSize, _vecs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(mSize);
+
+		Intl::GetBatchKernels<float>().quatStreamRotate(W(), X(), Y(), Z(), _vecs.X(), _vecs.Y(), _vecs.Z(),
+			_out.X(), _out.Y(), _out.Z(), mSize);
+	}
+
+	template <>
+	void QuatStreamf::UnRotate(const Vec3Streamf& _vecs, Vec3Streamf& _out) const
+	{
+		SA_ASSERT((Equals, mSize, _vecs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(mSize);
+
+		Intl::GetBatchKernels<float>().quatStreamUnRotate(W(), X(), Y(), Z(), _vecs.X(), _vecs.Y(), _vecs.Z(),
+			_out.X(), _out.Y(), _out.Z(), mSize);
+	}
+
+
+	template <>
+	void QuatStreamf::Dot(const QuatStreamf& _lhs, const QuatStreamf& _rhs, float* _out) noexcept
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<float>().quatStreamDot(_lhs.W(), _lhs.X(), _lhs.Y(), _lhs.Z(),
+			_rhs.W(), _rhs.X(), _rhs.Y(), _rhs.Z(), _out, _lhs.Size());
+	}
+
+	template <>
+	void QuatStreamf::Multiply(const QuatStreamf& _lhs, const QuatStreamf& _rhs, QuatStreamf& _out)
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(_lhs.Size());
+
+		Intl::GetBatchKernels<float>().quatStreamMultiply(_lhs.W(), _lhs.X(), _lhs.Y(), _lhs.Z(),
+			_rhs.W(), _rhs.X(), _rhs.Y(), _rhs.Z(), _out.W(), _out.X(), _out.Y(), _out.Z(), _lhs.Size());
+	}
+
+//}
+
+//{ Double
+
+	template <>
+	QuatStreamd& QuatStreamd::Normalize()
+	{
+		Intl::GetBatchKernels<double>().quatStreamNormalize(W(), X(), Y(), Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	QuatStreamd& QuatStreamd::Inverse() noexcept
+	{
+		// Inverse of normalized quaternion is conjugate: scale imaginary part by -1.
+		Intl::GetBatchKernels<double>().vec3StreamScale(X(), Y(), Z(), double(-1), mSize);
+
+		return *this;
+	}
+
+
+	template <>
+	void QuatStreamd::Rotate(const Vec3Streamd& _vecs, Vec3Streamd& _out) const
+	{
+		SA_ASSERT((Equals, mSize, _vecs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(mSize);
+
+		Intl::GetBatchKernels<double>().quatStreamRotate(W(), X(), Y(), Z(), _vecs.X(), _vecs.Y(), _vecs.Z(),
+			_out.X(), _out.Y(), _out.Z(), mSize);
+	}
+
+	template <>
+	void QuatStreamd::UnRotate(const Vec3Streamd& _vecs, Vec3Streamd& _out) const
+	{
+		SA_ASSERT((Equals, mSize, _vecs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(mSize);
+
+		Intl::GetBatchKernels<double>().quatStreamUnRotate(W(), X(), Y(), Z(), _vecs.X(), _vecs.Y(), _vecs.Z(),
+			_out.X(), _out.Y(), _out.Z(), mSize);
+	}
+
+
+	template <>
+	void QuatStreamd::Dot(const QuatStreamd& _lhs, const QuatStreamd& _rhs, double* _out) noexcept
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<double>().quatStreamDot(_lhs.W(), _lhs.X(), _lhs.Y(), _lhs.Z(),
+			_rhs.W(), _rhs.X(), _rhs.Y(), _rhs.Z(), _out, _lhs.Size());
+	}
+
+	template <>
+	void QuatStreamd::Multiply(const QuatStreamd& _lhs, const QuatStreamd& _rhs, QuatStreamd& _out)
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.QuatStream, L"Stream size mismatch!");
+
+		_out.Resize(_lhs.Size());
+
+		Intl::GetBatchKernels<double>().quatStreamMultiply(_lhs.W(), _lhs.X(), _lhs.Y(), _lhs.Z(),
+			_rhs.W(), _rhs.X(), _rhs.Y(), _rhs.Z(), _out.W(), _out.X(), _out.Y(), _out.Z(), _lhs.Size());
+	}
+
+//}
+
+#endif
+}
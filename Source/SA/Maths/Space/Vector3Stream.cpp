@@ -0,0 +1,258 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Space/Vector3Stream.hpp>
+
+#include "../Dispatch/BatchKernels.hpp"
+
+namespace SA
+{
+#if SA_MATHS_VECTOR3_STREAM_SIMD && SA_INTRISC_SSE
+
+//{ Float
+
+	template <>
+	void Vec3Streamf::Gather(const Vec3<float>* _vecs, size_t _num)
+	{
+		Clear();
+		Reserve(_num);
+		mSize = _num;
+
+		const float* in = _vecs->Data();
+
+		size_t i = 0;
+
+		// Deinterleave 4 vectors: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3].
+		for (; i + 4u <= _num; i += 4u, in += 12)
+		{
+			const __m128 a = _mm_loadu_ps(in);
+			const __m128 b = _mm_loadu_ps(in + 4);
+			const __m128 c = _mm_loadu_ps(in + 8);
+
+			const __m128 t = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));	// b2 b3 c1 c2
+			const __m128 u = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));	// a1 a2 b0 b1
+
+			_mm_store_ps(X() + i, _mm_shuffle_ps(a, t, _MM_SHUFFLE(2, 0, 3, 0)));
+			_mm_store_ps(Y() + i, _mm_shuffle_ps(u, t, _MM_SHUFFLE(3, 1, 2, 0)));
+			_mm_store_ps(Z() + i, _mm_shuffle_ps(u, c, _MM_SHUFFLE(3, 0, 3, 1)));
+		}
+
+		for (; i < _num; ++i)
+		{
+			X()[i] = _vecs[i].x;
+			Y()[i] = _vecs[i].y;
+			Z()[i] = _vecs[i].z;
+		}
+	}
+
+	template <>
+	void Vec3Streamf::Scatter(Vec3<float>* _out) const
+	{
+		float* out = _out->Data();
+
+		size_t i = 0;
+
+		// Interleave 4 vectors: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3].
+		for (; i + 4u <= mSize; i += 4u, out += 12)
+		{
+			const __m128 x = _mm_load_ps(X() + i);
+			const __m128 y = _mm_load_ps(Y() + i);
+			const __m128 z = _mm_load_ps(Z() + i);
+
+			const __m128 xy01 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 0, 1, 0));	// x0 x1 y0 y1
+			const __m128 z0x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));	// z0 z0 x1 x1
+			const __m128 y1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));	// y1 y1 z1 z1
+			const __m128 x2y2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));	// x2 x2 y2 y2
+			const __m128 z2x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));	// z2 z2 x3 x3
+			const __m128 y3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));	// y3 y3 z3 z3
+
+			_mm_storeu_ps(out, _mm_shuffle_ps(xy01, z0x1, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(out + 4, _mm_shuffle_ps(y1z1, x2y2, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(out + 8, _mm_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+
+		for (; i < mSize; ++i)
+			_out[i] = Vec3<float>(X()[i], Y()[i], Z()[i]);
+	}
+
+//}
+
+#endif
+
+#if SA_MATHS_VECTOR3_STREAM_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+//{ Float
+
+	template <>
+	Vec3Streamf& Vec3Streamf::Normalize()
+	{
+		Intl::GetBatchKernels<float>().vec3StreamNormalize(X(), Y(), Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	void Vec3Streamf::Dot(const Vec3Streamf& _lhs, const Vec3Streamf& _rhs, float* _out) noexcept
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<float>().vec3StreamDot(_lhs.X(), _lhs.Y(), _lhs.Z(), _rhs.X(), _rhs.Y(), _rhs.Z(), _out, _lhs.Size());
+	}
+
+	template <>
+	void Vec3Streamf::Cross(const Vec3Streamf& _lhs, const Vec3Streamf& _rhs, Vec3Streamf& _out)
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		_out.Resize(_lhs.Size());
+
+		Intl::GetBatchKernels<float>().vec3StreamCross(_lhs.X(), _lhs.Y(), _lhs.Z(), _rhs.X(), _rhs.Y(), _rhs.Z(),
+			_out.X(), _out.Y(), _out.Z(), _lhs.Size());
+	}
+
+	template <>
+	void Vec3Streamf::Dist(const Vec3Streamf& _start, const Vec3Streamf& _end, float* _out)
+	{
+		SA_ASSERT((Equals, _start.Size(), _end.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<float>().vec3StreamDist(_start.X(), _start.Y(), _start.Z(), _end.X(), _end.Y(), _end.Z(), _out, _start.Size());
+	}
+
+	template <>
+	void Vec3Streamf::LerpUnclamped(const Vec3Streamf& _start, const Vec3Streamf& _end, float _alpha, Vec3Streamf& _out)
+	{
+		SA_ASSERT((Equals, _start.Size(), _end.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		_out.Resize(_start.Size());
+
+		Intl::GetBatchKernels<float>().vec3StreamLerp(_start.X(), _start.Y(), _start.Z(), _end.X(), _end.Y(), _end.Z(),
+			_out.X(), _out.Y(), _out.Z(), _alpha, _start.Size());
+	}
+
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator+=(const Vec3Streamf& _rhs) noexcept
+	{
+		SA_ASSERT((Equals, mSize, _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<float>().vec3StreamAdd(X(), Y(), Z(), _rhs.X(), _rhs.Y(), _rhs.Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator-=(const Vec3Streamf& _rhs) noexcept
+	{
+		SA_ASSERT((Equals, mSize, _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<float>().vec3StreamSub(X(), Y(), Z(), _rhs.X(), _rhs.Y(), _rhs.Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator+=(const Vec3<float>& _rhs) noexcept
+	{
+		Intl::GetBatchKernels<float>().vec3StreamAddBroadcast(X(), Y(), Z(), _rhs, mSize);
+
+		return *this;
+	}
+
+	template <>
+	Vec3Streamf& Vec3Streamf::operator*=(float _scale) noexcept
+	{
+		Intl::GetBatchKernels<float>().vec3StreamScale(X(), Y(), Z(), _scale, mSize);
+
+		return *this;
+	}
+
+//}
+
+//{ Double
+
+	template <>
+	Vec3Streamd& Vec3Streamd::Normalize()
+	{
+		Intl::GetBatchKernels<double>().vec3StreamNormalize(X(), Y(), Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	void Vec3Streamd::Dot(const Vec3Streamd& _lhs, const Vec3Streamd& _rhs, double* _out) noexcept
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<double>().vec3StreamDot(_lhs.X(), _lhs.Y(), _lhs.Z(), _rhs.X(), _rhs.Y(), _rhs.Z(), _out, _lhs.Size());
+	}
+
+	template <>
+	void Vec3Streamd::Cross(const Vec3Streamd& _lhs, const Vec3Streamd& _rhs, Vec3Streamd& _out)
+	{
+		SA_ASSERT((Equals, _lhs.Size(), _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		_out.Resize(_lhs.Size());
+
+		Intl::GetBatchKernels<double>().vec3StreamCross(_lhs.X(), _lhs.Y(), _lhs.Z(), _rhs.X(), _rhs.Y(), _rhs.Z(),
+			_out.X(), _out.Y(), _out.Z(), _lhs.Size());
+	}
+
+	template <>
+	void Vec3Streamd::Dist(const Vec3Streamd& _start, const Vec3Streamd& _end, double* _out)
+	{
+		SA_ASSERT((Equals, _start.Size(), _end.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<double>().vec3StreamDist(_start.X(), _start.Y(), _start.Z(), _end.X(), _end.Y(), _end.Z(), _out, _start.Size());
+	}
+
+	template <>
+	void Vec3Streamd::LerpUnclamped(const Vec3Streamd& _start, const Vec3Streamd& _end, float _alpha, Vec3Streamd& _out)
+	{
+		SA_ASSERT((Equals, _start.Size(), _end.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		_out.Resize(_start.Size());
+
+		Intl::GetBatchKernels<double>().vec3StreamLerp(_start.X(), _start.Y(), _start.Z(), _end.X(), _end.Y(), _end.Z(),
+			_out.X(), _out.Y(), _out.Z(), static_cast<double>(_alpha), _start.Size());
+	}
+
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator+=(const Vec3Streamd& _rhs) noexcept
+	{
+		SA_ASSERT((Equals, mSize, _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<double>().vec3StreamAdd(X(), Y(), Z(), _rhs.X(), _rhs.Y(), _rhs.Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator-=(const Vec3Streamd& _rhs) noexcept
+	{
+		SA_ASSERT((Equals, mSize, _rhs.Size()), SA.Maths.Vec3Stream, L"Stream size mismatch!");
+
+		Intl::GetBatchKernels<double>().vec3StreamSub(X(), Y(), Z(), _rhs.X(), _rhs.Y(), _rhs.Z(), mSize);
+
+		return *this;
+	}
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator+=(const Vec3<double>& _rhs) noexcept
+	{
+		Intl::GetBatchKernels<double>().vec3StreamAddBroadcast(X(), Y(), Z(), _rhs, mSize);
+
+		return *this;
+	}
+
+	template <>
+	Vec3Streamd& Vec3Streamd::operator*=(double _scale) noexcept
+	{
+		Intl::GetBatchKernels<double>().vec3StreamScale(X(), Y(), Z(), _scale, mSize);
+
+		return *this;
+	}
+
+//}
+
+#endif
+}
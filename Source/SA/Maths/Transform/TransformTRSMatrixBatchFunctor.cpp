@@ -0,0 +1,61 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <Transform/Functors/TransformTRSMatrixBatchFunctor.hpp>
+
+#include "../Dispatch/BatchKernels.hpp"
+
+namespace SA
+{
+#if SA_MATHS_TRANSFORM_BATCH_SIMD && (SA_INTRISC_SSE || SA_MATHS_RUNTIME_DISPATCH)
+
+//{ Float
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const float* _px, const float* _py, const float* _pz,
+		const float* _rw, const float* _rx, const float* _ry, const float* _rz,
+		const float* _sx, const float* _sy, const float* _sz,
+		RMat4f* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<float>().trTRSMatrix(_px, _py, _pz, _rw, _rx, _ry, _rz, _sx, _sy, _sz,
+			reinterpret_cast<float*>(_out), _num, false);
+	}
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const float* _px, const float* _py, const float* _pz,
+		const float* _rw, const float* _rx, const float* _ry, const float* _rz,
+		const float* _sx, const float* _sy, const float* _sz,
+		CMat4f* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<float>().trTRSMatrix(_px, _py, _pz, _rw, _rx, _ry, _rz, _sx, _sy, _sz,
+			reinterpret_cast<float*>(_out), _num, true);
+	}
+
+//}
+
+
+//{ Double
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const double* _px, const double* _py, const double* _pz,
+		const double* _rw, const double* _rx, const double* _ry, const double* _rz,
+		const double* _sx, const double* _sy, const double* _sz,
+		RMat4d* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<double>().trTRSMatrix(_px, _py, _pz, _rw, _rx, _ry, _rz, _sx, _sy, _sz,
+			reinterpret_cast<double*>(_out), _num, false);
+	}
+
+	template <>
+	void TrTRSMatrixBatchFunctor::operator()(const double* _px, const double* _py, const double* _pz,
+		const double* _rw, const double* _rx, const double* _ry, const double* _rz,
+		const double* _sx, const double* _sy, const double* _sz,
+		CMat4d* _out, size_t _num) const noexcept
+	{
+		Intl::GetBatchKernels<double>().trTRSMatrix(_px, _py, _pz, _rw, _rx, _ry, _rz, _sx, _sy, _sz,
+			reinterpret_cast<double*>(_out), _num, true);
+	}
+
+//}
+
+#endif
+}
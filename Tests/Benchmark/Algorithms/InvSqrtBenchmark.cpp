@@ -1,6 +1,7 @@
 // Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
 
 #include <cmath>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -11,6 +12,10 @@
 #endif
 
 
+#include <SA/Maths/Algorithms/InvSqrt.hpp>
+#include <SA/Maths/Space/Vector3.hpp>
+#include <SA/Maths/Space/Quaternion.hpp>
+
 #include "../Tools/Random.hpp"
 
 #define SA_MATHS_BENCHMARK_INV_SQRT (0 || SA_CI)
@@ -160,6 +165,140 @@ namespace SA::Benchmark
 
 #endif
 
+
+//{ Maths
+
+	using Maths::InvSqrtPrecision;
+
+	template <typename T>
+	struct InvSqrtInputs
+	{
+		static constexpr uint32_t num = 4096u;
+
+		std::vector<T> in;
+		std::vector<T> out;
+
+		InvSqrtInputs() : in(num), out(num)
+		{
+			for (uint32_t i = 0u; i < num; ++i)
+				in[i] = Rand<T>(T(0.01), T(1000));
+		}
+	};
+
+
+	/// One call per input: Exact is 1 / std::sqrt.
+	template <typename T, InvSqrtPrecision precision>
+	static void BM_InvSqrt_Maths(benchmark::State& _state)
+	{
+		InvSqrtInputs<T> inputs;
+
+		for (auto _ : _state)
+		{
+			for (uint32_t i = 0u; i < InvSqrtInputs<T>::num; ++i)
+				inputs.out[i] = Maths::InvSqrt<T, precision>(inputs.in[i]);
+
+			benchmark::DoNotOptimize(inputs.out.data());
+			benchmark::ClobberMemory();
+		}
+
+		_state.SetItemsProcessed(_state.iterations() * InvSqrtInputs<T>::num);
+	}
+
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Maths, float, InvSqrtPrecision::Exact);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Maths, float, InvSqrtPrecision::Newton);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Maths, float, InvSqrtPrecision::Raw);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Maths, double, InvSqrtPrecision::Exact);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Maths, double, InvSqrtPrecision::Newton);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Maths, double, InvSqrtPrecision::Raw);
+
+
+	template <typename T, InvSqrtPrecision precision>
+	static void BM_InvSqrtBatch_Maths(benchmark::State& _state)
+	{
+		InvSqrtInputs<T> inputs;
+
+		for (auto _ : _state)
+		{
+			Maths::InvSqrtBatch<T, precision>(inputs.in.data(), inputs.out.data(), InvSqrtInputs<T>::num);
+
+			benchmark::DoNotOptimize(inputs.out.data());
+			benchmark::ClobberMemory();
+		}
+
+		_state.SetItemsProcessed(_state.iterations() * InvSqrtInputs<T>::num);
+	}
+
+	BENCHMARK_TEMPLATE(BM_InvSqrtBatch_Maths, float, InvSqrtPrecision::Exact);
+	BENCHMARK_TEMPLATE(BM_InvSqrtBatch_Maths, float, InvSqrtPrecision::Newton);
+	BENCHMARK_TEMPLATE(BM_InvSqrtBatch_Maths, float, InvSqrtPrecision::Raw);
+	BENCHMARK_TEMPLATE(BM_InvSqrtBatch_Maths, double, InvSqrtPrecision::Exact);
+	BENCHMARK_TEMPLATE(BM_InvSqrtBatch_Maths, double, InvSqrtPrecision::Newton);
+	BENCHMARK_TEMPLATE(BM_InvSqrtBatch_Maths, double, InvSqrtPrecision::Raw);
+
+
+	/// Vec3::Normalize (divide by Length) against the InvSqrt fast path.
+	template <typename T, bool bFast>
+	static void BM_InvSqrt_Vec3Normalize(benchmark::State& _state)
+	{
+		std::vector<Vec3<T>> vecs(InvSqrtInputs<T>::num);
+
+		for (auto& vec : vecs)
+			vec = Vec3<T>(Rand<T>(), Rand<T>(), Rand<T>());
+
+		for (auto _ : _state)
+		{
+			for (auto& vec : vecs)
+			{
+				if constexpr (bFast)
+					vec.template Normalize<InvSqrtPrecision::Newton>() *= T(2);
+				else
+					vec.Normalize() *= T(2);
+			}
+
+			benchmark::DoNotOptimize(vecs.data());
+			benchmark::ClobberMemory();
+		}
+
+		_state.SetItemsProcessed(_state.iterations() * InvSqrtInputs<T>::num);
+	}
+
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Vec3Normalize, float, false);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Vec3Normalize, float, true);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Vec3Normalize, double, false);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_Vec3Normalize, double, true);
+
+
+	template <typename T, bool bFast>
+	static void BM_InvSqrt_QuatNormalize(benchmark::State& _state)
+	{
+		std::vector<Quat<T>> quats(InvSqrtInputs<T>::num);
+
+		for (auto& quat : quats)
+			quat = Quat<T>(Rand<T>(), Rand<T>(), Rand<T>(), Rand<T>());
+
+		for (auto _ : _state)
+		{
+			for (auto& quat : quats)
+			{
+				if constexpr (bFast)
+					quat.template Normalize<InvSqrtPrecision::Newton>() *= T(2);
+				else
+					quat.Normalize() *= T(2);
+			}
+
+			benchmark::DoNotOptimize(quats.data());
+			benchmark::ClobberMemory();
+		}
+
+		_state.SetItemsProcessed(_state.iterations() * InvSqrtInputs<T>::num);
+	}
+
+	BENCHMARK_TEMPLATE(BM_InvSqrt_QuatNormalize, float, false);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_QuatNormalize, float, true);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_QuatNormalize, double, false);
+	BENCHMARK_TEMPLATE(BM_InvSqrt_QuatNormalize, double, true);
+
+//}
 }
 
 #endif
@@ -0,0 +1,243 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Algorithms/Cos.hpp>
+#include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/Tan.hpp>
+#include <SA/Maths/Algorithms/Exp.hpp>
+#include <SA/Maths/Algorithms/Log.hpp>
+
+#include "../Tools/Random.hpp"
+
+/**
+*   std:: loop against batch entry points (SIMD lanes when SA_MATHS_TRANSCENDENTAL_SIMD).
+*   Max errors are checked in TranscendentalTests.cpp.
+*/
+
+namespace SA::Benchmark
+{
+    template <typename T>
+    struct TranscInputs
+    {
+        static constexpr uint32_t num = 4096u;
+
+        std::vector<T> in;
+        std::vector<T> in2;
+        std::vector<T> out;
+
+        TranscInputs(T _min, T _max) : in(num), in2(num), out(num)
+        {
+            for (uint32_t i = 0u; i < num; ++i)
+            {
+                in[i] = Rand<T>(_min, _max);
+                in2[i] = Rand<T>(_min, _max);
+            }
+        }
+    };
+
+    template <typename T, typename FuncT>
+    void TranscRun(benchmark::State& _state, TranscInputs<T>& _inputs, FuncT _func)
+    {
+        for (auto _ : _state)
+        {
+            _func(_inputs);
+
+            benchmark::DoNotOptimize(_inputs.out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * TranscInputs<T>::num);
+    }
+
+
+//{ ACos
+
+    template <typename T>
+    static void Transc_ACos_STD(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-1), T(1));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            for (uint32_t i = 0u; i < TranscInputs<T>::num; ++i)
+                _in.out[i] = std::acos(_in.in[i]);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ACos_STD, float);
+    BENCHMARK_TEMPLATE(Transc_ACos_STD, double);
+
+    template <typename T>
+    static void Transc_ACosBatch(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-1), T(1));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            Maths::ACosBatch(_in.in.data(), _in.out.data(), TranscInputs<T>::num);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ACosBatch, float);
+    BENCHMARK_TEMPLATE(Transc_ACosBatch, double);
+
+//}
+
+
+//{ ASin
+
+    template <typename T>
+    static void Transc_ASin_STD(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-1), T(1));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            for (uint32_t i = 0u; i < TranscInputs<T>::num; ++i)
+                _in.out[i] = std::asin(_in.in[i]);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ASin_STD, float);
+    BENCHMARK_TEMPLATE(Transc_ASin_STD, double);
+
+    template <typename T>
+    static void Transc_ASinBatch(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-1), T(1));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            Maths::ASinBatch(_in.in.data(), _in.out.data(), TranscInputs<T>::num);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ASinBatch, float);
+    BENCHMARK_TEMPLATE(Transc_ASinBatch, double);
+
+//}
+
+
+//{ ATan
+
+    template <typename T>
+    static void Transc_ATan_STD(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-10), T(10));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            for (uint32_t i = 0u; i < TranscInputs<T>::num; ++i)
+                _in.out[i] = std::atan(_in.in[i]);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ATan_STD, float);
+    BENCHMARK_TEMPLATE(Transc_ATan_STD, double);
+
+    template <typename T>
+    static void Transc_ATanBatch(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-10), T(10));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            Maths::ATanBatch(_in.in.data(), _in.out.data(), TranscInputs<T>::num);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ATanBatch, float);
+    BENCHMARK_TEMPLATE(Transc_ATanBatch, double);
+
+
+    template <typename T>
+    static void Transc_ATan2_STD(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-10), T(10));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            for (uint32_t i = 0u; i < TranscInputs<T>::num; ++i)
+                _in.out[i] = std::atan2(_in.in[i], _in.in2[i]);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ATan2_STD, float);
+    BENCHMARK_TEMPLATE(Transc_ATan2_STD, double);
+
+    template <typename T>
+    static void Transc_ATan2Batch(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-10), T(10));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            Maths::ATan2Batch(_in.in.data(), _in.in2.data(), _in.out.data(), TranscInputs<T>::num);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ATan2Batch, float);
+    BENCHMARK_TEMPLATE(Transc_ATan2Batch, double);
+
+//}
+
+
+//{ Exp
+
+    template <typename T>
+    static void Transc_Exp_STD(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-80), T(80));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            for (uint32_t i = 0u; i < TranscInputs<T>::num; ++i)
+                _in.out[i] = std::exp(_in.in[i]);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_Exp_STD, float);
+    BENCHMARK_TEMPLATE(Transc_Exp_STD, double);
+
+    template <typename T>
+    static void Transc_ExpBatch(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(-80), T(80));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            Maths::ExpBatch(_in.in.data(), _in.out.data(), TranscInputs<T>::num);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_ExpBatch, float);
+    BENCHMARK_TEMPLATE(Transc_ExpBatch, double);
+
+//}
+
+
+//{ Log
+
+    template <typename T>
+    static void Transc_Log_STD(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(1e-3), T(1e3));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            for (uint32_t i = 0u; i < TranscInputs<T>::num; ++i)
+                _in.out[i] = std::log(_in.in[i]);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_Log_STD, float);
+    BENCHMARK_TEMPLATE(Transc_Log_STD, double);
+
+    template <typename T>
+    static void Transc_LogBatch(benchmark::State& _state)
+    {
+        TranscInputs<T> inputs(T(1e-3), T(1e3));
+
+        TranscRun<T>(_state, inputs, [](TranscInputs<T>& _in)
+        {
+            Maths::LogBatch(_in.in.data(), _in.out.data(), TranscInputs<T>::num);
+        });
+    }
+    BENCHMARK_TEMPLATE(Transc_LogBatch, float);
+    BENCHMARK_TEMPLATE(Transc_LogBatch, double);
+
+//}
+}
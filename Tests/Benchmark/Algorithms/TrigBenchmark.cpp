@@ -0,0 +1,197 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/Cos.hpp>
+#include <SA/Maths/Algorithms/Tan.hpp>
+#include <SA/Maths/Algorithms/SinCos.hpp>
+
+#include "../Tools/Random.hpp"
+
+/**
+*   Accuracy / speed table of polynomial trigonometry (TrigPrecision.hpp).
+*   Each benchmark reports 'maxErr': max absolute error of sin and cos against std (double) on |x| <= 1e4.
+*/
+
+namespace SA::Benchmark
+{
+    using Maths::TrigPrecision;
+
+    template <typename T>
+    struct TrigInputs
+    {
+        static constexpr uint32_t num = 4096u;
+
+        std::vector<T> in;
+        std::vector<T> out;
+
+        TrigInputs() : in(num), out(num)
+        {
+            for (uint32_t i = 0u; i < num; ++i)
+                in[i] = Rand<T>(-T(1e4), T(1e4));
+        }
+    };
+
+    /// Max absolute error of sin and cos of _precision against std on a fixed sweep.
+    template <typename T, TrigPrecision precision>
+    double TrigMaxError()
+    {
+        double maxErr = 0.0;
+
+        for (uint32_t i = 0u; i <= 2000000u; ++i)
+        {
+            const T x = static_cast<T>(-1e4 + 2e4 * i / 2000000.0);
+            const double xd = static_cast<double>(x);
+
+            maxErr = std::max(maxErr, std::abs(static_cast<double>(Maths::Sin<precision>(Rad<T>(x))) - std::sin(xd)));
+            maxErr = std::max(maxErr, std::abs(static_cast<double>(Maths::Cos<precision>(Rad<T>(x))) - std::cos(xd)));
+        }
+
+        return maxErr;
+    }
+
+
+    /// Reference: std::sin / std::cos.
+    template <typename T>
+    static void Trig_SinCos_STD(benchmark::State& _state)
+    {
+        TrigInputs<T> inputs;
+
+        for (auto _ : _state)
+        {
+            for (uint32_t i = 0u; i < TrigInputs<T>::num; ++i)
+                inputs.out[i] = std::sin(inputs.in[i]) + std::cos(inputs.in[i]);
+
+            benchmark::DoNotOptimize(inputs.out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * TrigInputs<T>::num);
+    }
+    BENCHMARK_TEMPLATE(Trig_SinCos_STD, float);
+    BENCHMARK_TEMPLATE(Trig_SinCos_STD, double);
+
+
+    /// Scalar polynomial, one call per input.
+    template <typename T, TrigPrecision precision>
+    static void Trig_SinCos(benchmark::State& _state)
+    {
+        TrigInputs<T> inputs;
+
+        for (auto _ : _state)
+        {
+            for (uint32_t i = 0u; i < TrigInputs<T>::num; ++i)
+                inputs.out[i] = Maths::Sin<precision>(Rad<T>(inputs.in[i])) + Maths::Cos<precision>(Rad<T>(inputs.in[i]));
+
+            benchmark::DoNotOptimize(inputs.out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * TrigInputs<T>::num);
+        _state.counters["maxErr"] = TrigMaxError<T, precision>();
+    }
+    BENCHMARK_TEMPLATE(Trig_SinCos, float, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_SinCos, float, TrigPrecision::Medium);
+    BENCHMARK_TEMPLATE(Trig_SinCos, float, TrigPrecision::High);
+    BENCHMARK_TEMPLATE(Trig_SinCos, double, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_SinCos, double, TrigPrecision::Medium);
+    BENCHMARK_TEMPLATE(Trig_SinCos, double, TrigPrecision::High);
+
+
+    /// Batch (SIMD lanes when SA_MATHS_TRIGONOMETRY_SIMD).
+    template <typename T, TrigPrecision precision>
+    static void Trig_SinCosBatch(benchmark::State& _state)
+    {
+        TrigInputs<T> inputs;
+        std::vector<T> cosOut(TrigInputs<T>::num);
+
+        for (auto _ : _state)
+        {
+            Maths::SinBatch<precision>(inputs.in.data(), inputs.out.data(), TrigInputs<T>::num);
+            Maths::CosBatch<precision>(inputs.in.data(), cosOut.data(), TrigInputs<T>::num);
+
+            benchmark::DoNotOptimize(inputs.out.data());
+            benchmark::DoNotOptimize(cosOut.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * TrigInputs<T>::num);
+    }
+    BENCHMARK_TEMPLATE(Trig_SinCosBatch, float, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_SinCosBatch, float, TrigPrecision::Medium);
+    BENCHMARK_TEMPLATE(Trig_SinCosBatch, float, TrigPrecision::High);
+    BENCHMARK_TEMPLATE(Trig_SinCosBatch, double, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_SinCosBatch, double, TrigPrecision::Medium);
+    BENCHMARK_TEMPLATE(Trig_SinCosBatch, double, TrigPrecision::High);
+
+
+    /// SinCosBatch: single reduction for both outputs.
+    template <typename T, TrigPrecision precision>
+    static void Trig_SinCosSharedBatch(benchmark::State& _state)
+    {
+        TrigInputs<T> inputs;
+        std::vector<T> cosOut(TrigInputs<T>::num);
+
+        for (auto _ : _state)
+        {
+            Maths::SinCosBatch<precision>(inputs.in.data(), inputs.out.data(), cosOut.data(), TrigInputs<T>::num);
+
+            benchmark::DoNotOptimize(inputs.out.data());
+            benchmark::DoNotOptimize(cosOut.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * TrigInputs<T>::num);
+    }
+    BENCHMARK_TEMPLATE(Trig_SinCosSharedBatch, float, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_SinCosSharedBatch, float, TrigPrecision::High);
+    BENCHMARK_TEMPLATE(Trig_SinCosSharedBatch, double, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_SinCosSharedBatch, double, TrigPrecision::High);
+
+
+    /// Reference: std::tan.
+    template <typename T>
+    static void Trig_Tan_STD(benchmark::State& _state)
+    {
+        TrigInputs<T> inputs;
+
+        for (auto _ : _state)
+        {
+            for (uint32_t i = 0u; i < TrigInputs<T>::num; ++i)
+                inputs.out[i] = std::tan(inputs.in[i]);
+
+            benchmark::DoNotOptimize(inputs.out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * TrigInputs<T>::num);
+    }
+    BENCHMARK_TEMPLATE(Trig_Tan_STD, float);
+    BENCHMARK_TEMPLATE(Trig_Tan_STD, double);
+
+
+    template <typename T, TrigPrecision precision>
+    static void Trig_TanBatch(benchmark::State& _state)
+    {
+        TrigInputs<T> inputs;
+
+        for (auto _ : _state)
+        {
+            Maths::TanBatch<precision>(inputs.in.data(), inputs.out.data(), TrigInputs<T>::num);
+
+            benchmark::DoNotOptimize(inputs.out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * TrigInputs<T>::num);
+    }
+    BENCHMARK_TEMPLATE(Trig_TanBatch, float, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_TanBatch, float, TrigPrecision::High);
+    BENCHMARK_TEMPLATE(Trig_TanBatch, double, TrigPrecision::Low);
+    BENCHMARK_TEMPLATE(Trig_TanBatch, double, TrigPrecision::High);
+}
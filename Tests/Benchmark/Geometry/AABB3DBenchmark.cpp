@@ -0,0 +1,138 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/AABB3D.hpp>
+#include <SA/Maths/Space/Vector4.hpp>
+#include <SA/Maths/Transform/Transform.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /// Local bounds of objects to world bounds: one box and one TRS matrix per object.
+    template <typename T>
+    struct BoundsScene
+    {
+        static constexpr uint32_t objNum = 1024u;
+
+        std::vector<AABB3D<T>> boxes;
+        std::vector<Mat4<T>> mats;
+
+        BoundsScene()
+        {
+            boxes.resize(objNum);
+            mats.resize(objNum);
+
+            for (uint32_t i = 0u; i < objNum; ++i)
+            {
+                const Vec3<T> center(Rand<T>(-T(5), T(5)), Rand<T>(-T(5), T(5)), Rand<T>(-T(5), T(5)));
+                const Vec3<T> extents(Rand<T>(T(0.1), T(4)), Rand<T>(T(0.1), T(4)), Rand<T>(T(0.1), T(4)));
+
+                boxes[i] = AABB3D<T>(center - extents, center + extents);
+
+                const Vec3<T> axis = Vec3<T>(Rand<T>(-T(1), T(1)), Rand<T>(-T(1), T(1)), Rand<T>(T(1), T(2))).GetNormalized();
+
+                const TrPRS<T> tr{ Vec3<T>(Rand<T>(-T(100), T(100)), Rand<T>(-T(100), T(100)), Rand<T>(-T(100), T(100))),
+                    Quat<T>(Deg<T>(Rand<T>(T(0), T(360))), axis),
+                    Vec3<T>(Rand<T>(T(0.5), T(2)), Rand<T>(T(0.5), T(2)), Rand<T>(T(0.5), T(2))) };
+
+                mats[i] = tr.Matrix();
+            }
+        }
+    };
+
+
+    /// Reference: transform the 8 corners and compute their bounds.
+    template <typename T>
+    static void AABB3D_TransformCorners(benchmark::State& _state)
+    {
+        BoundsScene<T> scene;
+        std::vector<AABB3D<T>> out(BoundsScene<T>::objNum);
+
+        for (auto _ : _state)
+        {
+            for (uint32_t i = 0u; i < BoundsScene<T>::objNum; ++i)
+            {
+                const AABB3D<T>& box = scene.boxes[i];
+                const Mat4<T>& mat = scene.mats[i];
+
+                Vec3<T> bMin(std::numeric_limits<T>::max());
+                Vec3<T> bMax(std::numeric_limits<T>::lowest());
+
+                for (uint32_t c = 0u; c < 8u; ++c)
+                {
+                    const Vec3<T> corner(c & 1u ? box.max.x : box.min.x, c & 2u ? box.max.y : box.min.y, c & 4u ? box.max.z : box.min.z);
+                    const Vec3<T> p = Vec3<T>(mat * Vec4<T>(corner, T(1)));
+
+                    for (uint32_t k = 0u; k < 3u; ++k)
+                    {
+                        bMin[k] = std::min(bMin[k], p[k]);
+                        bMax[k] = std::max(bMax[k], p[k]);
+                    }
+                }
+
+                out[i].min = bMin;
+                out[i].max = bMax;
+            }
+
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * BoundsScene<T>::objNum);
+    }
+    BENCHMARK_TEMPLATE(AABB3D_TransformCorners, float);
+    BENCHMARK_TEMPLATE(AABB3D_TransformCorners, double);
+
+
+    /// Arvo method, one call per box.
+    template <typename T>
+    static void AABB3D_Transform(benchmark::State& _state)
+    {
+        BoundsScene<T> scene;
+        std::vector<AABB3D<T>> out(BoundsScene<T>::objNum);
+
+        for (auto _ : _state)
+        {
+            for (uint32_t i = 0u; i < BoundsScene<T>::objNum; ++i)
+                out[i] = scene.boxes[i].Transform(scene.mats[i]);
+
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * BoundsScene<T>::objNum);
+    }
+    BENCHMARK_TEMPLATE(AABB3D_Transform, float);
+    BENCHMARK_TEMPLATE(AABB3D_Transform, double);
+
+
+    /// Arvo method batch: one matrix per box (bConstMat false) or a single matrix.
+    template <typename T, bool bConstMat>
+    static void AABB3D_TransformBatch(benchmark::State& _state)
+    {
+        BoundsScene<T> scene;
+        std::vector<AABB3D<T>> out(BoundsScene<T>::objNum);
+
+        for (auto _ : _state)
+        {
+            if constexpr (bConstMat)
+                AABB3D<T>::TransformBatch(scene.mats[0], scene.boxes.data(), out.data(), BoundsScene<T>::objNum);
+            else
+                AABB3D<T>::TransformBatch(scene.mats.data(), scene.boxes.data(), out.data(), BoundsScene<T>::objNum);
+
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * BoundsScene<T>::objNum);
+    }
+    BENCHMARK_TEMPLATE(AABB3D_TransformBatch, float, false);
+    BENCHMARK_TEMPLATE(AABB3D_TransformBatch, float, true);
+    BENCHMARK_TEMPLATE(AABB3D_TransformBatch, double, false);
+    BENCHMARK_TEMPLATE(AABB3D_TransformBatch, double, true);
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/AABB3DPack.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    template <typename T>
+    static std::vector<AABB3D<T>> AABB3DPack_RandomBoxes(size_t _num)
+    {
+        std::vector<AABB3D<T>> boxes(_num);
+
+        for (auto& box : boxes)
+        {
+            box.min = Vec3<T>(Rand<T>(-50, 50), Rand<T>(-50, 50), Rand<T>(-50, 50));
+            box.max = box.min + Vec3<T>(Rand<T>(T(0.1), T(10)), Rand<T>(T(0.1), T(10)), Rand<T>(T(0.1), T(10)));
+        }
+
+        return boxes;
+    }
+
+    /// Items are box / box tests: 64 queries against range(0) boxes per iteration.
+    template <typename T>
+    static void AABB3D_IsColliding(benchmark::State& _state)
+    {
+        const auto boxes = AABB3DPack_RandomBoxes<T>(_state.range(0));
+        const auto queries = AABB3DPack_RandomBoxes<T>(64);
+
+        uint32_t hitNum = 0u;
+
+        for (auto _ : _state)
+        {
+            for (const auto& query : queries)
+            {
+                for (const auto& box : boxes)
+                    hitNum += box.IsColliding(query);
+            }
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0) * queries.size());
+    }
+
+    BENCHMARK_TEMPLATE(AABB3D_IsColliding, float)->Arg(4096);
+    BENCHMARK_TEMPLATE(AABB3D_IsColliding, double)->Arg(4096);
+
+
+    template <typename T, uint32_t N>
+    static void AABB3DPack_OverlapMask(benchmark::State& _state)
+    {
+        const auto boxes = AABB3DPack_RandomBoxes<T>(_state.range(0));
+        const auto queries = AABB3DPack_RandomBoxes<T>(64);
+
+        std::vector<AABB3DPack<T, N>> packs;
+
+        for (size_t i = 0; i < boxes.size(); i += N)
+            packs.emplace_back(boxes.data() + i, static_cast<uint32_t>(std::min<size_t>(N, boxes.size() - i)));
+
+        uint32_t hitMasks = 0u;
+
+        for (auto _ : _state)
+        {
+            for (const auto& query : queries)
+            {
+                for (const auto& pack : packs)
+                    hitMasks += pack.OverlapMask(query);
+            }
+
+            benchmark::DoNotOptimize(hitMasks);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0) * queries.size());
+    }
+
+    BENCHMARK_TEMPLATE(AABB3DPack_OverlapMask, float, 4)->Arg(4096);
+    BENCHMARK_TEMPLATE(AABB3DPack_OverlapMask, float, 8)->Arg(4096);
+    BENCHMARK_TEMPLATE(AABB3DPack_OverlapMask, double, 4)->Arg(4096);
+    BENCHMARK_TEMPLATE(AABB3DPack_OverlapMask, double, 8)->Arg(4096);
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/BVH3D.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /// Random boxes in a cube scaled so density stays constant with _num.
+    template <typename T>
+    static std::vector<AABB3D<T>> AABB3D_RandomArray(size_t _num, T _world)
+    {
+        std::vector<AABB3D<T>> boxes(_num);
+
+        for (auto& box : boxes)
+        {
+            box.min = Vec3<T>(Rand<T>(-_world, _world), Rand<T>(-_world, _world), Rand<T>(-_world, _world));
+            box.max = box.min + Vec3<T>(Rand<T>(T(0.1), T(2)), Rand<T>(T(0.1), T(2)), Rand<T>(T(0.1), T(2)));
+        }
+
+        return boxes;
+    }
+
+    template <typename T>
+    static T WorldSize(size_t _num)
+    {
+        return T(std::cbrt(double(_num))) * T(2);
+    }
+
+
+    template <typename T>
+    static void BVH3D_Build(benchmark::State& _state)
+    {
+        const auto boxes = AABB3D_RandomArray<T>(_state.range(0), WorldSize<T>(_state.range(0)));
+
+        BVH3D<T> bvh;
+
+        for (auto _ : _state)
+        {
+            bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+            benchmark::DoNotOptimize(bvh.GetNodes().data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(BVH3D_Build, float)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+
+    /// 1024 overlap queries per iteration.
+    template <typename T>
+    static void BVH3D_QueryOverlap(benchmark::State& _state)
+    {
+        const T world = WorldSize<T>(_state.range(0));
+        const auto boxes = AABB3D_RandomArray<T>(_state.range(0), world);
+        const auto queries = AABB3D_RandomArray<T>(1024, world);
+
+        BVH3D<T> bvh;
+        bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+        uint32_t hitNum = 0u;
+
+        for (auto _ : _state)
+        {
+            for (const auto& query : queries)
+                bvh.QueryOverlap(query, [&hitNum](uint32_t) { ++hitNum; });
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * queries.size());
+    }
+
+    BENCHMARK_TEMPLATE(BVH3D_QueryOverlap, float)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+
+    /// Reference: same queries against every box.
+    template <typename T>
+    static void BVH3D_BruteOverlap(benchmark::State& _state)
+    {
+        const T world = WorldSize<T>(_state.range(0));
+        const auto boxes = AABB3D_RandomArray<T>(_state.range(0), world);
+        const auto queries = AABB3D_RandomArray<T>(1024, world);
+
+        uint32_t hitNum = 0u;
+
+        for (auto _ : _state)
+        {
+            for (const auto& query : queries)
+            {
+                for (const auto& box : boxes)
+                {
+                    hitNum += box.IsCollidingX(query) && box.IsCollidingY(query) && box.IsCollidingZ(query);
+                }
+            }
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * queries.size());
+    }
+
+    BENCHMARK_TEMPLATE(BVH3D_BruteOverlap, float)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+
+    /// 1024 closest-hit raycasts per iteration.
+    template <typename T>
+    static void BVH3D_RaycastClosest(benchmark::State& _state)
+    {
+        const T world = WorldSize<T>(_state.range(0));
+        const auto boxes = AABB3D_RandomArray<T>(_state.range(0), world);
+
+        std::vector<Vec3<T>> origins(1024);
+        std::vector<Vec3<T>> dirs(1024);
+
+        for (size_t i = 0; i < origins.size(); ++i)
+        {
+            origins[i] = Vec3<T>(Rand<T>(-world, world), Rand<T>(-world, world), Rand<T>(-world, world));
+            dirs[i] = Vec3<T>(Rand<T>(-1, 1), Rand<T>(-1, 1), Rand<T>(-1, 1)).GetNormalized();
+        }
+
+        BVH3D<T> bvh;
+        bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+        uint32_t hitNum = 0u;
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < origins.size(); ++i)
+            {
+                T tEntry;
+                hitNum += bvh.RaycastClosest(origins[i], dirs[i], world * T(4), tEntry) != ~uint32_t(0);
+            }
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * origins.size());
+    }
+
+    BENCHMARK_TEMPLATE(BVH3D_RaycastClosest, float)->Arg(10000)->Arg(100000)->Arg(1000000);
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/BVH3D.hpp>
+#include <SA/Maths/Geometry/DynamicBVH3D.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /**
+    *   One iteration = one frame: every object moves by its velocity (direction flips every 32 frames to stay in world).
+    *   Items are object updates. Predicted displacement passed to the tree is 4 frames of motion.
+    */
+    template <typename T>
+    struct MovingBoxes
+    {
+        std::vector<AABB3D<T>> boxes;
+        std::vector<Vec3<T>> velocities;
+
+        T sign = T(1);
+        uint32_t frame = 0u;
+
+        MovingBoxes(size_t _num)
+        {
+            const T world = T(std::cbrt(double(_num))) * T(2);
+
+            boxes.resize(_num);
+            velocities.resize(_num);
+
+            for (size_t i = 0; i < _num; ++i)
+            {
+                boxes[i].min = Vec3<T>(Rand<T>(-world, world), Rand<T>(-world, world), Rand<T>(-world, world));
+                boxes[i].max = boxes[i].min + Vec3<T>(Rand<T>(T(0.1), T(2)), Rand<T>(T(0.1), T(2)), Rand<T>(T(0.1), T(2)));
+
+                velocities[i] = Vec3<T>(Rand<T>(-T(0.05), T(0.05)), Rand<T>(-T(0.05), T(0.05)), Rand<T>(-T(0.05), T(0.05)));
+            }
+        }
+
+        Vec3<T> Step(size_t _index)
+        {
+            const Vec3<T> d = velocities[_index] * sign;
+
+            boxes[_index].min += d;
+            boxes[_index].max += d;
+
+            return d * T(4);
+        }
+
+        void EndFrame()
+        {
+            if (++frame % 32u == 0u)
+                sign = -sign;
+        }
+    };
+
+
+    template <typename T>
+    static void DynamicBVH3D_Move(benchmark::State& _state)
+    {
+        MovingBoxes<T> scene(_state.range(0));
+
+        DynamicBVH3D<T> tree(T(0.1));
+        std::vector<uint32_t> proxies(scene.boxes.size());
+
+        for (size_t i = 0; i < scene.boxes.size(); ++i)
+            proxies[i] = tree.Insert(scene.boxes[i]);
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < scene.boxes.size(); ++i)
+            {
+                const Vec3<T> d = scene.Step(i);
+                tree.Move(proxies[i], scene.boxes[i], d);
+            }
+
+            scene.EndFrame();
+
+            benchmark::DoNotOptimize(tree.GetNodes().data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+        _state.counters["AreaRatio"] = double(tree.ComputeAreaRatio());
+    }
+
+    BENCHMARK_TEMPLATE(DynamicBVH3D_Move, float)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+
+    /// In place refit with a rotation budget of 1/16 of the nodes per frame.
+    template <typename T>
+    static void DynamicBVH3D_RefitOptimize(benchmark::State& _state)
+    {
+        MovingBoxes<T> scene(_state.range(0));
+
+        DynamicBVH3D<T> tree(T(0.1));
+        std::vector<uint32_t> proxies(scene.boxes.size());
+
+        for (size_t i = 0; i < scene.boxes.size(); ++i)
+            proxies[i] = tree.Insert(scene.boxes[i]);
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < scene.boxes.size(); ++i)
+            {
+                const Vec3<T> d = scene.Step(i);
+                tree.Refit(proxies[i], scene.boxes[i], d);
+            }
+
+            tree.Optimize(static_cast<uint32_t>(scene.boxes.size() / 16));
+
+            scene.EndFrame();
+
+            benchmark::DoNotOptimize(tree.GetNodes().data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+        _state.counters["AreaRatio"] = double(tree.ComputeAreaRatio());
+    }
+
+    BENCHMARK_TEMPLATE(DynamicBVH3D_RefitOptimize, float)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+
+    /// Reference: full static BVH rebuild every frame.
+    template <typename T>
+    static void DynamicBVH3D_FullRebuild(benchmark::State& _state)
+    {
+        MovingBoxes<T> scene(_state.range(0));
+
+        BVH3D<T> bvh;
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < scene.boxes.size(); ++i)
+                scene.Step(i);
+
+            bvh.Build(scene.boxes.data(), static_cast<uint32_t>(scene.boxes.size()));
+
+            scene.EndFrame();
+
+            benchmark::DoNotOptimize(bvh.GetNodes().data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(DynamicBVH3D_FullRebuild, float)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,115 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/Frustum.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /// Camera at the origin looking at +Z: objects spread around (~15% visible).
+    template <typename T>
+    struct FrustumScene
+    {
+        static constexpr uint32_t objNum = 200000u;
+
+        Frustum<T> frustum;
+
+        std::vector<AABB3D<T>> boxes;
+        std::vector<Vec4<T>> spheres;
+
+        std::vector<uint32_t> visibility;
+
+        FrustumScene() :
+            frustum(Mat4<T>::MakePerspective(T(60), T(16) / T(9), T(0.1), T(500)) *
+                Mat4<T>::MakeLookAt(Vec3<T>(0, 0, 0), Vec3<T>(0, 0, 1), Vec3<T>(0, 1, 0)))
+        {
+            boxes.resize(objNum);
+            spheres.resize(objNum);
+            visibility.resize((objNum + 31u) / 32u);
+
+            for (uint32_t i = 0u; i < objNum; ++i)
+            {
+                const Vec3<T> center(Rand<T>(-T(500), T(500)), Rand<T>(-T(200), T(200)), Rand<T>(-T(500), T(500)));
+                const T size = Rand<T>(T(0.5), T(10));
+
+                boxes[i].min = center - Vec3<T>(size);
+                boxes[i].max = center + Vec3<T>(size);
+
+                spheres[i] = Vec4<T>(center, size);
+            }
+        }
+    };
+
+
+    /// Items: culled boxes.
+    template <typename T, FrustumCull mode>
+    static void Frustum_CullAABBs(benchmark::State& _state)
+    {
+        FrustumScene<T> scene;
+
+        for (auto _ : _state)
+        {
+            scene.frustum.CullAABBs(scene.boxes.data(), FrustumScene<T>::objNum, scene.visibility.data(), mode);
+
+            benchmark::DoNotOptimize(scene.visibility.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * FrustumScene<T>::objNum);
+    }
+
+    BENCHMARK_TEMPLATE(Frustum_CullAABBs, float, FrustumCull::Conservative);
+    BENCHMARK_TEMPLATE(Frustum_CullAABBs, float, FrustumCull::Exact);
+    BENCHMARK_TEMPLATE(Frustum_CullAABBs, double, FrustumCull::Conservative);
+    BENCHMARK_TEMPLATE(Frustum_CullAABBs, double, FrustumCull::Exact);
+
+
+    /// Items: culled spheres.
+    template <typename T, FrustumCull mode>
+    static void Frustum_CullSpheres(benchmark::State& _state)
+    {
+        FrustumScene<T> scene;
+
+        for (auto _ : _state)
+        {
+            scene.frustum.CullSpheres(scene.spheres.data(), FrustumScene<T>::objNum, scene.visibility.data(), mode);
+
+            benchmark::DoNotOptimize(scene.visibility.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * FrustumScene<T>::objNum);
+    }
+
+    BENCHMARK_TEMPLATE(Frustum_CullSpheres, float, FrustumCull::Conservative);
+    BENCHMARK_TEMPLATE(Frustum_CullSpheres, float, FrustumCull::Exact);
+    BENCHMARK_TEMPLATE(Frustum_CullSpheres, double, FrustumCull::Conservative);
+    BENCHMARK_TEMPLATE(Frustum_CullSpheres, double, FrustumCull::Exact);
+
+
+    /// Items: culled boxes (one IsVisible call per box, reference).
+    template <typename T>
+    static void Frustum_IsVisibleAABB(benchmark::State& _state)
+    {
+        FrustumScene<T> scene;
+
+        for (auto _ : _state)
+        {
+            uint32_t visibleNum = 0u;
+
+            for (const auto& box : scene.boxes)
+                visibleNum += scene.frustum.IsVisible(box, FrustumCull::Conservative);
+
+            benchmark::DoNotOptimize(visibleNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * FrustumScene<T>::objNum);
+    }
+
+    BENCHMARK_TEMPLATE(Frustum_IsVisibleAABB, float);
+    BENCHMARK_TEMPLATE(Frustum_IsVisibleAABB, double);
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/OBB3DPack.hpp>
+#include <SA/Maths/Geometry/SpherePack.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /// Narrowphase scene: volumes in a small area (~40% overlapping pairs).
+    template <typename T>
+    struct VolumeScene
+    {
+        static constexpr uint32_t objNum = 1024u;
+        static constexpr uint32_t queryNum = 64u;
+
+        std::vector<OBB3D<T>> boxes;
+        std::vector<OBB3D<T>> obbQueries;
+        std::vector<AABB3D<T>> aabbQueries;
+
+        std::vector<Sphere<T>> spheres;
+
+        static OBB3D<T> MakeBox()
+        {
+            const Vec3<T> axis = Vec3<T>(Rand<T>(-T(1), T(1)), Rand<T>(-T(1), T(1)), Rand<T>(T(1), T(2))).GetNormalized();
+
+            return OBB3D<T>(Vec3<T>(Rand<T>(-T(10), T(10)), Rand<T>(-T(10), T(10)), Rand<T>(-T(10), T(10))),
+                Quat<T>(Deg<T>(Rand<T>(T(0), T(360))), axis),
+                Vec3<T>(Rand<T>(T(0.5), T(4)), Rand<T>(T(0.5), T(4)), Rand<T>(T(0.5), T(4))));
+        }
+
+        VolumeScene()
+        {
+            boxes.resize(objNum);
+            spheres.resize(objNum);
+
+            for (uint32_t i = 0u; i < objNum; ++i)
+            {
+                boxes[i] = MakeBox();
+                spheres[i] = Sphere<T>(boxes[i].center, boxes[i].extents.x);
+            }
+
+            obbQueries.resize(queryNum);
+            aabbQueries.resize(queryNum);
+
+            for (uint32_t i = 0u; i < queryNum; ++i)
+            {
+                obbQueries[i] = MakeBox();
+                aabbQueries[i] = obbQueries[i].ComputeAABB();
+            }
+        }
+
+        template <typename PackT, typename VolumeT>
+        static std::vector<PackT> MakePacks(const std::vector<VolumeT>& _volumes)
+        {
+            std::vector<PackT> packs;
+
+            for (uint32_t i = 0u; i < objNum; i += PackT::Width)
+                packs.emplace_back(_volumes.data() + i, PackT::Width);
+
+            return packs;
+        }
+    };
+
+
+    /// Items: volume pair tests.
+    template <typename T, bool bAABBQuery>
+    static void OBB_Scalar(benchmark::State& _state)
+    {
+        VolumeScene<T> scene;
+
+        for (auto _ : _state)
+        {
+            uint32_t hitNum = 0u;
+
+            for (uint32_t q = 0u; q < VolumeScene<T>::queryNum; ++q)
+            {
+                for (const auto& box : scene.boxes)
+                {
+                    if constexpr (bAABBQuery)
+                        hitNum += box.IsColliding(scene.aabbQueries[q]);
+                    else
+                        hitNum += box.IsColliding(scene.obbQueries[q]);
+                }
+            }
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * VolumeScene<T>::objNum * VolumeScene<T>::queryNum);
+    }
+
+    BENCHMARK_TEMPLATE(OBB_Scalar, float, false);
+    BENCHMARK_TEMPLATE(OBB_Scalar, float, true);
+    BENCHMARK_TEMPLATE(OBB_Scalar, double, false);
+
+
+    template <typename T, uint32_t N, bool bAABBQuery>
+    static void OBB_Pack(benchmark::State& _state)
+    {
+        VolumeScene<T> scene;
+        const auto packs = VolumeScene<T>::template MakePacks<OBB3DPack<T, N>>(scene.boxes);
+
+        for (auto _ : _state)
+        {
+            uint32_t hitMask = 0u;
+
+            for (uint32_t q = 0u; q < VolumeScene<T>::queryNum; ++q)
+            {
+                for (const auto& pack : packs)
+                {
+                    if constexpr (bAABBQuery)
+                        hitMask ^= pack.OverlapMask(scene.aabbQueries[q]);
+                    else
+                        hitMask ^= pack.OverlapMask(scene.obbQueries[q]);
+                }
+            }
+
+            benchmark::DoNotOptimize(hitMask);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * VolumeScene<T>::objNum * VolumeScene<T>::queryNum);
+    }
+
+    BENCHMARK_TEMPLATE(OBB_Pack, float, 4u, false);
+    BENCHMARK_TEMPLATE(OBB_Pack, float, 8u, false);
+    BENCHMARK_TEMPLATE(OBB_Pack, float, 8u, true);
+    BENCHMARK_TEMPLATE(OBB_Pack, double, 4u, false);
+
+
+    /// Items: sphere / box tests.
+    template <typename T>
+    static void Sphere_AABB_Scalar(benchmark::State& _state)
+    {
+        VolumeScene<T> scene;
+
+        for (auto _ : _state)
+        {
+            uint32_t hitNum = 0u;
+
+            for (const auto& query : scene.aabbQueries)
+            {
+                for (const auto& sphere : scene.spheres)
+                    hitNum += sphere.IsColliding(query);
+            }
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * VolumeScene<T>::objNum * VolumeScene<T>::queryNum);
+    }
+
+    BENCHMARK_TEMPLATE(Sphere_AABB_Scalar, float);
+    BENCHMARK_TEMPLATE(Sphere_AABB_Scalar, double);
+
+
+    template <typename T, uint32_t N>
+    static void Sphere_AABB_Pack(benchmark::State& _state)
+    {
+        VolumeScene<T> scene;
+        const auto packs = VolumeScene<T>::template MakePacks<SpherePack<T, N>>(scene.spheres);
+
+        for (auto _ : _state)
+        {
+            uint32_t hitMask = 0u;
+
+            for (const auto& query : scene.aabbQueries)
+            {
+                for (const auto& pack : packs)
+                    hitMask ^= pack.OverlapMask(query);
+            }
+
+            benchmark::DoNotOptimize(hitMask);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * VolumeScene<T>::objNum * VolumeScene<T>::queryNum);
+    }
+
+    BENCHMARK_TEMPLATE(Sphere_AABB_Pack, float, 4u);
+    BENCHMARK_TEMPLATE(Sphere_AABB_Pack, float, 8u);
+    BENCHMARK_TEMPLATE(Sphere_AABB_Pack, double, 4u);
+}
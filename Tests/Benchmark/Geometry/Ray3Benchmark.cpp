@@ -0,0 +1,182 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/Ray3Pack.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /// Rays aimed at the primitives area (~50% hit rate on boxes).
+    template <typename T>
+    struct RayScene
+    {
+        static constexpr uint32_t rayNum = 4096u;
+        static constexpr uint32_t primNum = 64u;
+
+        std::vector<Ray3<T>> rays;
+
+        std::vector<AABB3D<T>> boxes;
+        std::vector<Vec3<T>> vertices;
+
+        RayScene()
+        {
+            rays.resize(rayNum);
+
+            for (auto& ray : rays)
+            {
+                const Vec3<T> origin(Rand<T>(-T(50), T(50)), Rand<T>(-T(50), T(50)), Rand<T>(-T(50), T(50)));
+                const Vec3<T> target(Rand<T>(-T(5), T(5)), Rand<T>(-T(5), T(5)), Rand<T>(-T(5), T(5)));
+
+                ray = Ray3<T>(origin, target - origin);
+            }
+
+            boxes.resize(primNum);
+            vertices.resize(primNum * 3u);
+
+            for (uint32_t i = 0u; i < primNum; ++i)
+            {
+                boxes[i].min = Vec3<T>(Rand<T>(-T(5), T(2)), Rand<T>(-T(5), T(2)), Rand<T>(-T(5), T(2)));
+                boxes[i].max = boxes[i].min + Vec3<T>(Rand<T>(T(1), T(3)), Rand<T>(T(1), T(3)), Rand<T>(T(1), T(3)));
+
+                vertices[i * 3u] = Vec3<T>(Rand<T>(-T(5), T(5)), Rand<T>(-T(5), T(5)), Rand<T>(-T(5), T(5)));
+                vertices[i * 3u + 1u] = vertices[i * 3u] + Vec3<T>(Rand<T>(-T(4), T(4)), Rand<T>(-T(4), T(4)), Rand<T>(-T(4), T(4)));
+                vertices[i * 3u + 2u] = vertices[i * 3u] + Vec3<T>(Rand<T>(-T(4), T(4)), Rand<T>(-T(4), T(4)), Rand<T>(-T(4), T(4)));
+            }
+        }
+
+        template <uint32_t N>
+        std::vector<Ray3Pack<T, N>> MakePacks() const
+        {
+            std::vector<Ray3Pack<T, N>> packs;
+
+            for (uint32_t i = 0u; i < rayNum; i += N)
+                packs.emplace_back(rays.data() + i, N);
+
+            return packs;
+        }
+    };
+
+
+    /// Items: ray / box tests.
+    template <typename T>
+    static void Ray_AABB_Scalar(benchmark::State& _state)
+    {
+        RayScene<T> scene;
+
+        for (auto _ : _state)
+        {
+            uint32_t hitNum = 0u;
+
+            for (const auto& box : scene.boxes)
+            {
+                for (const auto& ray : scene.rays)
+                {
+                    T tEntry;
+                    hitNum += ray.IntersectAABB(box, T(1000), tEntry);
+                }
+            }
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * RayScene<T>::rayNum * RayScene<T>::primNum);
+    }
+
+    BENCHMARK_TEMPLATE(Ray_AABB_Scalar, float);
+    BENCHMARK_TEMPLATE(Ray_AABB_Scalar, double);
+
+
+    template <typename T, uint32_t N>
+    static void Ray_AABB_Pack(benchmark::State& _state)
+    {
+        RayScene<T> scene;
+        const auto packs = scene.template MakePacks<N>();
+
+        for (auto _ : _state)
+        {
+            uint32_t hitMask = 0u;
+
+            for (const auto& box : scene.boxes)
+            {
+                for (const auto& pack : packs)
+                    hitMask ^= pack.IntersectAABBMask(box, T(1000));
+            }
+
+            benchmark::DoNotOptimize(hitMask);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * RayScene<T>::rayNum * RayScene<T>::primNum);
+    }
+
+    BENCHMARK_TEMPLATE(Ray_AABB_Pack, float, 4u);
+    BENCHMARK_TEMPLATE(Ray_AABB_Pack, float, 8u);
+    BENCHMARK_TEMPLATE(Ray_AABB_Pack, double, 4u);
+
+
+    /// Items: ray / triangle tests.
+    template <typename T>
+    static void Ray_Triangle_Scalar(benchmark::State& _state)
+    {
+        RayScene<T> scene;
+
+        for (auto _ : _state)
+        {
+            uint32_t hitNum = 0u;
+
+            for (uint32_t i = 0u; i < RayScene<T>::primNum; ++i)
+            {
+                const Vec3<T>& v0 = scene.vertices[i * 3u];
+                const Vec3<T>& v1 = scene.vertices[i * 3u + 1u];
+                const Vec3<T>& v2 = scene.vertices[i * 3u + 2u];
+
+                for (const auto& ray : scene.rays)
+                {
+                    T t, u, v;
+                    hitNum += ray.IntersectTriangle(v0, v1, v2, T(1000), t, u, v);
+                }
+            }
+
+            benchmark::DoNotOptimize(hitNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * RayScene<T>::rayNum * RayScene<T>::primNum);
+    }
+
+    BENCHMARK_TEMPLATE(Ray_Triangle_Scalar, float);
+    BENCHMARK_TEMPLATE(Ray_Triangle_Scalar, double);
+
+
+    template <typename T, uint32_t N>
+    static void Ray_Triangle_Pack(benchmark::State& _state)
+    {
+        RayScene<T> scene;
+        const auto packs = scene.template MakePacks<N>();
+
+        for (auto _ : _state)
+        {
+            uint32_t hitMask = 0u;
+
+            for (uint32_t i = 0u; i < RayScene<T>::primNum; ++i)
+            {
+                const Vec3<T>& v0 = scene.vertices[i * 3u];
+                const Vec3<T>& v1 = scene.vertices[i * 3u + 1u];
+                const Vec3<T>& v2 = scene.vertices[i * 3u + 2u];
+
+                for (const auto& pack : packs)
+                    hitMask ^= pack.IntersectTriangleMask(v0, v1, v2, T(1000));
+            }
+
+            benchmark::DoNotOptimize(hitMask);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * RayScene<T>::rayNum * RayScene<T>::primNum);
+    }
+
+    BENCHMARK_TEMPLATE(Ray_Triangle_Pack, float, 4u);
+    BENCHMARK_TEMPLATE(Ray_Triangle_Pack, float, 8u);
+    BENCHMARK_TEMPLATE(Ray_Triangle_Pack, double, 4u);
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/SpatialHashGrid.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /// Particles with constant density: ~30 neighbors in radius.
+    template <typename T>
+    struct ParticleScene
+    {
+        static constexpr T radius = T(1);
+
+        std::vector<Vec3<T>> points;
+
+        ParticleScene(size_t _num)
+        {
+            // 4/3 pi r^3 * density = 30 -> density ~7.2 particles per unit volume.
+            const T world = T(std::cbrt(double(_num) / 7.2)) * T(0.5);
+
+            points.resize(_num);
+
+            for (auto& point : points)
+                point = Vec3<T>(Rand<T>(-world, world), Rand<T>(-world, world), Rand<T>(-world, world));
+        }
+    };
+
+
+    template <typename T>
+    static void HashGrid_Build(benchmark::State& _state)
+    {
+        ParticleScene<T> scene(_state.range(0));
+
+        SpatialHashGrid<AABB3D<T>> grid(ParticleScene<T>::radius);
+
+        for (auto _ : _state)
+        {
+            grid.Build(scene.points.data(), static_cast<uint32_t>(scene.points.size()));
+
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+        _state.counters["Cells"] = double(grid.GetCellNum());
+    }
+
+    BENCHMARK_TEMPLATE(HashGrid_Build, float)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+
+    /// One iteration = neighbor search of every particle (build included).
+    template <typename T>
+    static void HashGrid_Neighbors(benchmark::State& _state)
+    {
+        ParticleScene<T> scene(_state.range(0));
+
+        SpatialHashGrid<AABB3D<T>> grid(ParticleScene<T>::radius);
+
+        uint64_t neighborNum = 0u;
+
+        for (auto _ : _state)
+        {
+            grid.Build(scene.points.data(), static_cast<uint32_t>(scene.points.size()));
+
+            neighborNum = 0u;
+
+            for (const auto& point : scene.points)
+                grid.QueryRadius(point, ParticleScene<T>::radius, [&neighborNum](uint32_t) { ++neighborNum; });
+
+            benchmark::DoNotOptimize(neighborNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+        _state.counters["AvgNeighbors"] = double(neighborNum) / double(_state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(HashGrid_Neighbors, float)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+
+    /// O(n^2) reference.
+    template <typename T>
+    static void HashGrid_BruteNeighbors(benchmark::State& _state)
+    {
+        ParticleScene<T> scene(_state.range(0));
+
+        const T sqrRadius = ParticleScene<T>::radius * ParticleScene<T>::radius;
+
+        uint64_t neighborNum = 0u;
+
+        for (auto _ : _state)
+        {
+            neighborNum = 0u;
+
+            for (const auto& point : scene.points)
+            {
+                for (const auto& other : scene.points)
+                    neighborNum += (point - other).SqrLength() <= sqrRadius;
+            }
+
+            benchmark::DoNotOptimize(neighborNum);
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+        _state.counters["AvgNeighbors"] = double(neighborNum) / double(_state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(HashGrid_BruteNeighbors, float)->Arg(10000)->Unit(benchmark::kMillisecond);
+}
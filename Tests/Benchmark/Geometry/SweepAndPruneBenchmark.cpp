@@ -0,0 +1,156 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Geometry/SweepAndPrune.hpp>
+#include <SA/Maths/Dispatch/ThreadPool.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    /// Random boxes with constant density and small per-frame velocities (coherent scene).
+    template <typename T>
+    struct SAPScene
+    {
+        std::vector<AABB3D<T>> boxes;
+        std::vector<Vec3<T>> velocities;
+
+        uint32_t frame = 0u;
+
+        SAPScene(size_t _num)
+        {
+            const T world = T(std::cbrt(double(_num))) * T(2);
+
+            boxes.resize(_num);
+            velocities.resize(_num);
+
+            for (size_t i = 0; i < _num; ++i)
+            {
+                boxes[i].min = Vec3<T>(Rand<T>(-world, world), Rand<T>(-world, world), Rand<T>(-world, world));
+                boxes[i].max = boxes[i].min + Vec3<T>(Rand<T>(T(0.1), T(2)), Rand<T>(T(0.1), T(2)), Rand<T>(T(0.1), T(2)));
+
+                velocities[i] = Vec3<T>(Rand<T>(-T(0.05), T(0.05)), Rand<T>(-T(0.05), T(0.05)), Rand<T>(-T(0.05), T(0.05)));
+            }
+        }
+
+        void Step()
+        {
+            // Direction flips every 32 frames to stay in world.
+            const T sign = (frame++ / 32u) % 2u ? T(-1) : T(1);
+
+            for (size_t i = 0; i < boxes.size(); ++i)
+            {
+                boxes[i].min += velocities[i] * sign;
+                boxes[i].max += velocities[i] * sign;
+            }
+        }
+    };
+
+
+    template <typename T>
+    static void SAP_Build(benchmark::State& _state)
+    {
+        SAPScene<T> scene(_state.range(0));
+
+        SweepAndPrune<AABB3D<T>> sap;
+
+        for (auto _ : _state)
+        {
+            sap.Build(scene.boxes.data(), static_cast<uint32_t>(scene.boxes.size()));
+
+            benchmark::DoNotOptimize(sap.GetPairs().data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+        _state.counters["Pairs"] = double(sap.GetPairs().size());
+    }
+
+    BENCHMARK_TEMPLATE(SAP_Build, float)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+
+    /// One iteration = one frame (scene step included).
+    template <typename T>
+    static void SAP_Update(benchmark::State& _state)
+    {
+        SAPScene<T> scene(_state.range(0));
+
+        SweepAndPrune<AABB3D<T>> sap;
+        sap.Build(scene.boxes.data(), static_cast<uint32_t>(scene.boxes.size()));
+
+        for (auto _ : _state)
+        {
+            scene.Step();
+            sap.Update(scene.boxes.data());
+
+            benchmark::DoNotOptimize(sap.GetPairs().data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+        _state.counters["Swaps"] = double(sap.GetSwapNum());
+    }
+
+    BENCHMARK_TEMPLATE(SAP_Update, float)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+
+    template <typename T>
+    static void SAP_UpdateParallel(benchmark::State& _state)
+    {
+        SAPScene<T> scene(_state.range(0));
+
+        SweepAndPrune<AABB3D<T>> sap;
+        sap.Build(scene.boxes.data(), static_cast<uint32_t>(scene.boxes.size()));
+
+        // Threads are created once, outside of the measured loop.
+        Maths::ThreadPool pool(static_cast<uint32_t>(_state.range(1)));
+
+        for (auto _ : _state)
+        {
+            scene.Step();
+            sap.UpdateParallel(scene.boxes.data(), pool, pool.GetThreadNum());
+
+            benchmark::DoNotOptimize(sap.GetPairs().data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(SAP_UpdateParallel, float)->ArgsProduct({ { 100000 }, { 2, 4, 8 } })->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+    /// Reference: every pair tested with IsColliding.
+    template <typename T>
+    static void SAP_BruteForce(benchmark::State& _state)
+    {
+        SAPScene<T> scene(_state.range(0));
+
+        std::vector<std::pair<uint32_t, uint32_t>> pairs;
+
+        for (auto _ : _state)
+        {
+            scene.Step();
+
+            pairs.clear();
+
+            const auto& boxes = scene.boxes;
+
+            for (uint32_t i = 0; i < boxes.size(); ++i)
+            {
+                for (uint32_t j = i + 1u; j < boxes.size(); ++j)
+                {
+                    if (boxes[i].IsColliding(boxes[j]))
+                        pairs.emplace_back(i, j);
+                }
+            }
+
+            benchmark::DoNotOptimize(pairs.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(SAP_BruteForce, float)->Arg(10000)->Unit(benchmark::kMillisecond);
+}
@@ -1,11 +1,16 @@
 // Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
 
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include "Matrix4Benchmark.hpp"
 #include "../Space/Vector3Benchmark.hpp"
 #include "../Space/QuaternionBenchmark.hpp"
 
+#include <SA/Maths/Space/Vector4.hpp>
+#include <SA/Maths/Dispatch/CPUFeatures.hpp>
+
 #if SA_MATHS_MATRIX4_SIMD || SA_CI
 
 namespace SA::Benchmark
@@ -38,6 +43,19 @@ namespace SA::Benchmark
     BENCHMARK_TEMPLATE(Mat4_GetInversed, double);
 
 
+    template <typename T>
+    static void Mat4_MakePerspective(benchmark::State& _state)
+    {
+        Mat4<T> mres;
+
+        for (auto _ : _state)
+            benchmark::DoNotOptimize(mres += Mat4<T>::MakePerspective(Rand<T>(T(30), T(120)), Rand<T>(T(1), T(2))));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_MakePerspective, float);
+    BENCHMARK_TEMPLATE(Mat4_MakePerspective, double);
+
+
     template <typename T>
     static void Mat4_MakeRotation(benchmark::State& _state)
     {
@@ -94,6 +112,37 @@ namespace SA::Benchmark
     BENCHMARK_TEMPLATE(Mat4_OpMult, double);
 
 
+    template <typename T>
+    static void Mat4_Transpose(benchmark::State& _state)
+    {
+        Mat4<T> mres = RMat4;
+
+        for (auto _ : _state)
+            benchmark::DoNotOptimize(mres.Transpose());
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_Transpose, int32_t);
+    BENCHMARK_TEMPLATE(Mat4_Transpose, float);
+    BENCHMARK_TEMPLATE(Mat4_Transpose, double);
+
+
+    template <typename T>
+    static void Mat4_ColumnOps(benchmark::State& _state)
+    {
+        using CMat4 = Mat4<T, MatrixMajor::Column>;
+
+        const CMat4 m1 = Mat4_Random<T, MatrixMajor::Column>();
+        const CMat4 m2 = Mat4_Random<T, MatrixMajor::Column>();
+        CMat4 mres;
+
+        for (auto _ : _state)
+            benchmark::DoNotOptimize(mres += (m1 * m2 - m1 * Rand<T>()).GetInversed());
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_ColumnOps, float);
+    BENCHMARK_TEMPLATE(Mat4_ColumnOps, double);
+
+
     template <typename T>
     static void Mat4_OpMultVec3(benchmark::State& _state)
     {
@@ -109,3 +158,265 @@ namespace SA::Benchmark
 }
 
 #endif
+
+#if SA_MATHS_MATRIX4_BATCH_SIMD || SA_CI
+
+namespace SA::Benchmark
+{
+    template <typename T>
+    static std::vector<Vec3<T>> Mat4_RandomVec3Array(size_t _num)
+    {
+        std::vector<Vec3<T>> vecs(_num);
+
+        for (auto& vec : vecs)
+            vec = RVec3;
+
+        return vecs;
+    }
+
+
+    template <typename T>
+    static void Mat4_LoopMultVec3(benchmark::State& _state)
+    {
+        const Mat4<T> mat = RMat4;
+        const std::vector<Vec3<T>> in = Mat4_RandomVec3Array<T>(_state.range(0));
+        std::vector<Vec3<T>> out(in.size());
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < in.size(); ++i)
+                out[i] = mat * in[i];
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_LoopMultVec3, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_LoopMultVec3, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void Mat4_TransformDirections(benchmark::State& _state)
+    {
+        const Mat4<T> mat = RMat4;
+        const std::vector<Vec3<T>> in = Mat4_RandomVec3Array<T>(_state.range(0));
+        std::vector<Vec3<T>> out(in.size());
+
+        for (auto _ : _state)
+        {
+            mat.TransformDirections(in.data(), out.data(), in.size());
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_TransformDirections, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_TransformDirections, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void Mat4_TransformPoints(benchmark::State& _state)
+    {
+        const Mat4<T> mat = RMat4;
+        const std::vector<Vec3<T>> in = Mat4_RandomVec3Array<T>(_state.range(0));
+        std::vector<Vec3<T>> out(in.size());
+
+        for (auto _ : _state)
+        {
+            mat.TransformPoints(in.data(), out.data(), in.size());
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_TransformPoints, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_TransformPoints, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void Mat4_TransformVec4(benchmark::State& _state)
+    {
+        const Mat4<T> mat = RMat4;
+        std::vector<Vec4<T>> in(_state.range(0));
+        std::vector<Vec4<T>> out(in.size());
+
+        for (auto& vec : in)
+            vec = Vec4<T>(RVec3, T(1));
+
+        for (auto _ : _state)
+        {
+            mat.TransformVec4(in.data(), out.data(), in.size());
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_TransformVec4, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_TransformVec4, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T, MatrixMajor major>
+    static std::vector<Mat4<T, major>> Mat4_RandomArray(size_t _num)
+    {
+        std::vector<Mat4<T, major>> mats(_num);
+
+        for (auto& mat : mats)
+            mat = Mat4_Random<T, major>();
+
+        return mats;
+    }
+
+
+    template <typename T, MatrixMajor major>
+    static void Mat4_LoopMult(benchmark::State& _state)
+    {
+        const std::vector<Mat4<T, major>> lhs = Mat4_RandomArray<T, major>(_state.range(0));
+        const std::vector<Mat4<T, major>> rhs = Mat4_RandomArray<T, major>(_state.range(0));
+        std::vector<Mat4<T, major>> out(lhs.size());
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < lhs.size(); ++i)
+                out[i] = lhs[i] * rhs[i];
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_LoopMult, float, MatrixMajor::Row)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_LoopMult, float, MatrixMajor::Column)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_LoopMult, double, MatrixMajor::Row)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_LoopMult, double, MatrixMajor::Column)->Arg(1024)->Arg(65536);
+
+
+    template <typename T, MatrixMajor major>
+    static void Mat4_MultiplyBatch(benchmark::State& _state)
+    {
+        const std::vector<Mat4<T, major>> lhs = Mat4_RandomArray<T, major>(_state.range(0));
+        const std::vector<Mat4<T, major>> rhs = Mat4_RandomArray<T, major>(_state.range(0));
+        std::vector<Mat4<T, major>> out(lhs.size());
+
+        for (auto _ : _state)
+        {
+            Mat4<T, major>::MultiplyBatch(lhs.data(), rhs.data(), out.data(), lhs.size());
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatch, float, MatrixMajor::Row)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatch, float, MatrixMajor::Column)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatch, double, MatrixMajor::Row)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatch, double, MatrixMajor::Column)->Arg(1024)->Arg(65536);
+
+
+    template <typename T, MatrixMajor major>
+    static void Mat4_MultiplyBatchParent(benchmark::State& _state)
+    {
+        const Mat4<T, major> parent = Mat4_Random<T, major>();
+        const std::vector<Mat4<T, major>> locals = Mat4_RandomArray<T, major>(_state.range(0));
+        std::vector<Mat4<T, major>> out(locals.size());
+
+        for (auto _ : _state)
+        {
+            Mat4<T, major>::MultiplyBatch(parent, locals.data(), out.data(), locals.size());
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatchParent, float, MatrixMajor::Row)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatchParent, float, MatrixMajor::Column)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatchParent, double, MatrixMajor::Row)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatchParent, double, MatrixMajor::Column)->Arg(1024)->Arg(65536);
+
+
+#if SA_MATHS_RUNTIME_DISPATCH
+
+    /// Compare batch kernels of every SIMD level: range(1) is Maths::SIMDLevel.
+    static bool Mat4_SetSIMDLevel(benchmark::State& _state)
+    {
+        const Maths::SIMDLevel level = static_cast<Maths::SIMDLevel>(_state.range(1));
+
+        if (Maths::SetSIMDLevel(level) != level)
+        {
+            _state.SkipWithError("SIMD level not supported by host.");
+            return false;
+        }
+
+        _state.SetLabel(level == Maths::SIMDLevel::AVX512 ? "AVX-512" :
+            level == Maths::SIMDLevel::AVX2 ? "AVX2" :
+            level == Maths::SIMDLevel::SSE41 ? "SSE4.1" : "Scalar");
+
+        return true;
+    }
+
+    template <typename T>
+    static void Mat4_TransformPointsLevel(benchmark::State& _state)
+    {
+        const Mat4<T> mat = RMat4;
+        const std::vector<Vec3<T>> in = Mat4_RandomVec3Array<T>(_state.range(0));
+        std::vector<Vec3<T>> out(in.size());
+
+        if (!Mat4_SetSIMDLevel(_state))
+            return;
+
+        for (auto _ : _state)
+        {
+            mat.TransformPoints(in.data(), out.data(), in.size());
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+
+        Maths::SetSIMDLevel(Maths::GetHostSIMDLevel());
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_TransformPointsLevel, float)->ArgsProduct({ { 65536 }, { 0, 1, 2, 3 } });
+    BENCHMARK_TEMPLATE(Mat4_TransformPointsLevel, double)->ArgsProduct({ { 65536 }, { 0, 1, 2, 3 } });
+
+
+    template <typename T>
+    static void Mat4_MultiplyBatchLevel(benchmark::State& _state)
+    {
+        const std::vector<Mat4<T>> lhs = Mat4_RandomArray<T, MatrixMajor::Default>(_state.range(0));
+        const std::vector<Mat4<T>> rhs = Mat4_RandomArray<T, MatrixMajor::Default>(_state.range(0));
+        std::vector<Mat4<T>> out(lhs.size());
+
+        if (!Mat4_SetSIMDLevel(_state))
+            return;
+
+        for (auto _ : _state)
+        {
+            Mat4<T>::MultiplyBatch(lhs.data(), rhs.data(), out.data(), lhs.size());
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+
+        Maths::SetSIMDLevel(Maths::GetHostSIMDLevel());
+    }
+
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatchLevel, float)->ArgsProduct({ { 65536 }, { 0, 1, 2, 3 } });
+    BENCHMARK_TEMPLATE(Mat4_MultiplyBatchLevel, double)->ArgsProduct({ { 65536 }, { 0, 1, 2, 3 } });
+
+#endif
+}
+
+#endif
@@ -1,5 +1,7 @@
 // Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
 
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include "QuaternionBenchmark.hpp"
@@ -89,6 +91,32 @@ namespace SA::Benchmark
     BENCHMARK_TEMPLATE(Quat_FromEuler, double);
 
 
+    template <typename T>
+    static void Quat_FromAxisAngle(benchmark::State& _state)
+    {
+        Quat<T> qres;
+
+        for (auto _ : _state)
+            benchmark::DoNotOptimize(qres += Quat<T>(Deg<T>(Rand<T>(T(0), T(360))), Vec3<T>::Up));
+    }
+
+    BENCHMARK_TEMPLATE(Quat_FromAxisAngle, float);
+    BENCHMARK_TEMPLATE(Quat_FromAxisAngle, double);
+
+
+    template <typename T>
+    static void Quat_SLerpUnclamped(benchmark::State& _state)
+    {
+        Quat<T> qres;
+
+        for (auto _ : _state)
+            benchmark::DoNotOptimize(qres += Quat<T>::SLerpUnclamped(RQuat.GetNormalized(), RQuat.GetNormalized(), Rand<float>(0.0f, 1.0f)));
+    }
+
+    BENCHMARK_TEMPLATE(Quat_SLerpUnclamped, float);
+    BENCHMARK_TEMPLATE(Quat_SLerpUnclamped, double);
+
+
     template <typename T>
     static void Quat_OperatorPlus(benchmark::State& _state)
     {
@@ -116,3 +144,118 @@ namespace SA::Benchmark
 }
 
 #endif
+
+
+#if SA_MATHS_QUATERNION_BATCH_SIMD || SA_CI
+
+namespace SA::Benchmark
+{
+    /**
+    *   Quat::SLerp loop against SoA batches (SIMD lanes when SA_MATHS_QUATERNION_BATCH_SIMD).
+    *   Max errors are checked in QuaternionTests.cpp (LerpBatch).
+    */
+    template <typename T>
+    struct QuatBatchInputs
+    {
+        std::vector<Quat<T>> start;
+        std::vector<Quat<T>> end;
+        std::vector<Quat<T>> out;
+
+        // Structure-Of-Arrays copies.
+        std::vector<T> sw, sx, sy, sz;
+        std::vector<T> ew, ex, ey, ez;
+        std::vector<T> ow, ox, oy, oz;
+
+        QuatBatchInputs(size_t _num) :
+            start(_num), end(_num), out(_num),
+            sw(_num), sx(_num), sy(_num), sz(_num),
+            ew(_num), ex(_num), ey(_num), ez(_num),
+            ow(_num), ox(_num), oy(_num), oz(_num)
+        {
+            for (size_t i = 0; i < _num; ++i)
+            {
+                start[i] = Quat<T>(Rand<T>(-1, 1), Rand<T>(-1, 1), Rand<T>(-1, 1), Rand<T>(-1, 1)).GetNormalized();
+                end[i] = Quat<T>(Rand<T>(-1, 1), Rand<T>(-1, 1), Rand<T>(-1, 1), Rand<T>(-1, 1)).GetNormalized();
+
+                sw[i] = start[i].w;
+                sx[i] = start[i].x;
+                sy[i] = start[i].y;
+                sz[i] = start[i].z;
+
+                ew[i] = end[i].w;
+                ex[i] = end[i].x;
+                ey[i] = end[i].y;
+                ez[i] = end[i].z;
+            }
+        }
+    };
+
+
+    template <typename T>
+    static void QuatAoS_SLerp(benchmark::State& _state)
+    {
+        QuatBatchInputs<T> inputs(_state.range(0));
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < inputs.out.size(); ++i)
+                inputs.out[i] = Quat<T>::SLerp(inputs.start[i], inputs.end[i], 0.3f);
+
+            benchmark::DoNotOptimize(inputs.out.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(QuatAoS_SLerp, float)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatAoS_SLerp, double)->Arg(65536);
+
+
+    template <typename T, typename FuncT>
+    static void QuatBatch_Run(benchmark::State& _state, FuncT _func)
+    {
+        QuatBatchInputs<T> inputs(_state.range(0));
+
+        for (auto _ : _state)
+        {
+            _func(inputs.sw.data(), inputs.sx.data(), inputs.sy.data(), inputs.sz.data(),
+                inputs.ew.data(), inputs.ex.data(), inputs.ey.data(), inputs.ez.data(),
+                inputs.ow.data(), inputs.ox.data(), inputs.oy.data(), inputs.oz.data(), 0.3f, inputs.ow.size());
+
+            benchmark::DoNotOptimize(inputs.ow.data());
+            benchmark::ClobberMemory();
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    template <typename T>
+    static void QuatBatch_NLerp(benchmark::State& _state)
+    {
+        QuatBatch_Run<T>(_state, &Quat<T>::NLerpBatch);
+    }
+
+    BENCHMARK_TEMPLATE(QuatBatch_NLerp, float)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatBatch_NLerp, double)->Arg(65536);
+
+    template <typename T>
+    static void QuatBatch_SLerp(benchmark::State& _state)
+    {
+        QuatBatch_Run<T>(_state, &Quat<T>::template SLerpBatch<Maths::SLerpPrecision::Exact>);
+    }
+
+    BENCHMARK_TEMPLATE(QuatBatch_SLerp, float)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatBatch_SLerp, double)->Arg(65536);
+
+    template <typename T>
+    static void QuatBatch_SLerpApprox(benchmark::State& _state)
+    {
+        QuatBatch_Run<T>(_state, &Quat<T>::template SLerpBatch<Maths::SLerpPrecision::Approx>);
+    }
+
+    BENCHMARK_TEMPLATE(QuatBatch_SLerpApprox, float)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatBatch_SLerpApprox, double)->Arg(65536);
+}
+
+#endif
@@ -0,0 +1,151 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Space/QuaternionStream.hpp>
+
+#include "QuaternionBenchmark.hpp"
+#include "Vector3Benchmark.hpp"
+
+#if SA_MATHS_QUATERNION_STREAM_SIMD || SA_CI
+
+namespace SA::Benchmark
+{
+    template <typename T>
+    static std::vector<Quat<T>> Quat_RandomArray(size_t _num)
+    {
+        std::vector<Quat<T>> quats(_num);
+
+        for (auto& quat : quats)
+            quat = RQuat.GetNormalized();
+
+        return quats;
+    }
+
+    template <typename T>
+    static std::vector<Vec3<T>> Vec3_RandomArray(size_t _num)
+    {
+        std::vector<Vec3<T>> vecs(_num);
+
+        for (auto& vec : vecs)
+            vec = RVec3;
+
+        return vecs;
+    }
+
+
+    template <typename T>
+    static void QuatAoS_RotateVec3(benchmark::State& _state)
+    {
+        const std::vector<Quat<T>> quats = Quat_RandomArray<T>(_state.range(0));
+        const std::vector<Vec3<T>> vecs = Vec3_RandomArray<T>(_state.range(0));
+        std::vector<Vec3<T>> out(_state.range(0));
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < out.size(); ++i)
+                out[i] = quats[i].Rotate(vecs[i]);
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(QuatAoS_RotateVec3, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatAoS_RotateVec3, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void QuatStream_RotateVec3(benchmark::State& _state)
+    {
+        const std::vector<Quat<T>> quats = Quat_RandomArray<T>(_state.range(0));
+        const std::vector<Vec3<T>> vecs = Vec3_RandomArray<T>(_state.range(0));
+
+        const QuatStream<T> qStream(quats.data(), quats.size());
+        const Vec3Stream<T> vStream(vecs.data(), vecs.size());
+        Vec3Stream<T> out(vecs.size());
+
+        for (auto _ : _state)
+        {
+            qStream.Rotate(vStream, out);
+
+            benchmark::DoNotOptimize(out.X());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(QuatStream_RotateVec3, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatStream_RotateVec3, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void QuatAoS_Multiply(benchmark::State& _state)
+    {
+        const std::vector<Quat<T>> lhs = Quat_RandomArray<T>(_state.range(0));
+        const std::vector<Quat<T>> rhs = Quat_RandomArray<T>(_state.range(0));
+        std::vector<Quat<T>> out(_state.range(0));
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < out.size(); ++i)
+                out[i] = lhs[i] * rhs[i];
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(QuatAoS_Multiply, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatAoS_Multiply, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void QuatStream_Multiply(benchmark::State& _state)
+    {
+        const std::vector<Quat<T>> lQuats = Quat_RandomArray<T>(_state.range(0));
+        const std::vector<Quat<T>> rQuats = Quat_RandomArray<T>(_state.range(0));
+
+        const QuatStream<T> lhs(lQuats.data(), lQuats.size());
+        const QuatStream<T> rhs(rQuats.data(), rQuats.size());
+        QuatStream<T> out(lQuats.size());
+
+        for (auto _ : _state)
+        {
+            QuatStream<T>::Multiply(lhs, rhs, out);
+
+            benchmark::DoNotOptimize(out.W());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(QuatStream_Multiply, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatStream_Multiply, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void QuatStream_Normalize(benchmark::State& _state)
+    {
+        const std::vector<Quat<T>> quats = Quat_RandomArray<T>(_state.range(0));
+        QuatStream<T> stream(quats.data(), quats.size());
+
+        for (auto _ : _state)
+        {
+            stream.Normalize();
+
+            benchmark::DoNotOptimize(stream.W());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(QuatStream_Normalize, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(QuatStream_Normalize, double)->Arg(1024)->Arg(65536);
+}
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Space/Vector3Stream.hpp>
+
+#include "Vector3Benchmark.hpp"
+
+#if SA_MATHS_VECTOR3_STREAM_SIMD || SA_CI
+
+namespace SA::Benchmark
+{
+    template <typename T>
+    static std::vector<Vec3<T>> Vec3_RandomArray(size_t _num)
+    {
+        std::vector<Vec3<T>> vecs(_num);
+
+        for (auto& vec : vecs)
+            vec = RVec3;
+
+        return vecs;
+    }
+
+
+    template <typename T>
+    static void Vec3AoS_Normalize(benchmark::State& _state)
+    {
+        std::vector<Vec3<T>> vecs = Vec3_RandomArray<T>(_state.range(0));
+
+        for (auto _ : _state)
+        {
+            for (auto& vec : vecs)
+                vec.Normalize();
+
+            benchmark::DoNotOptimize(vecs.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Vec3AoS_Normalize, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Vec3AoS_Normalize, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void Vec3Stream_Normalize(benchmark::State& _state)
+    {
+        const std::vector<Vec3<T>> vecs = Vec3_RandomArray<T>(_state.range(0));
+        Vec3Stream<T> stream(vecs.data(), vecs.size());
+
+        for (auto _ : _state)
+        {
+            stream.Normalize();
+
+            benchmark::DoNotOptimize(stream.X());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Vec3Stream_Normalize, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Vec3Stream_Normalize, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void Vec3AoS_Cross(benchmark::State& _state)
+    {
+        const std::vector<Vec3<T>> lhs = Vec3_RandomArray<T>(_state.range(0));
+        const std::vector<Vec3<T>> rhs = Vec3_RandomArray<T>(_state.range(0));
+        std::vector<Vec3<T>> out(_state.range(0));
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < out.size(); ++i)
+                out[i] = Vec3<T>::Cross(lhs[i], rhs[i]);
+
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Vec3AoS_Cross, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Vec3AoS_Cross, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void Vec3Stream_Cross(benchmark::State& _state)
+    {
+        const std::vector<Vec3<T>> lVecs = Vec3_RandomArray<T>(_state.range(0));
+        const std::vector<Vec3<T>> rVecs = Vec3_RandomArray<T>(_state.range(0));
+
+        const Vec3Stream<T> lhs(lVecs.data(), lVecs.size());
+        const Vec3Stream<T> rhs(rVecs.data(), rVecs.size());
+        Vec3Stream<T> out(lVecs.size());
+
+        for (auto _ : _state)
+        {
+            Vec3Stream<T>::Cross(lhs, rhs, out);
+
+            benchmark::DoNotOptimize(out.X());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Vec3Stream_Cross, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Vec3Stream_Cross, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void Vec3Stream_GatherScatter(benchmark::State& _state)
+    {
+        std::vector<Vec3<T>> vecs = Vec3_RandomArray<T>(_state.range(0));
+        Vec3Stream<T> stream;
+
+        for (auto _ : _state)
+        {
+            stream.Gather(vecs.data(), vecs.size());
+            stream.Scatter(vecs.data());
+
+            benchmark::DoNotOptimize(vecs.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Vec3Stream_GatherScatter, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(Vec3Stream_GatherScatter, double)->Arg(1024)->Arg(65536);
+}
+
+#endif
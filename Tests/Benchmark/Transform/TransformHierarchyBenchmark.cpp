@@ -0,0 +1,140 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Transform/TransformHierarchy.hpp>
+#include <SA/Maths/Dispatch/ThreadPool.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    template <typename T>
+    static TrPRS<T> TrPRS_Random()
+    {
+        return TrPRS<T>{
+            Vec3<T>(Rand<T>(-10, 10), Rand<T>(-10, 10), Rand<T>(-10, 10)),
+            Quat<T>(Deg<T>(Rand<T>(0, 360)), Vec3<T>(Rand<T>(), Rand<T>(), Rand<T>()).GetNormalized()),
+            Vec3<T>(Rand<T>(T(0.5), T(2)), Rand<T>(T(0.5), T(2)), Rand<T>(T(0.5), T(2)))
+        };
+    }
+
+    /// Scene-like hierarchy: 1 root every 64 nodes, other nodes attached to a random previous node.
+    template <typename T>
+    static TrHierarchy<T> TrHierarchy_Random(uint32_t _num)
+    {
+        TrHierarchy<T> hierarchy;
+        hierarchy.Reserve(_num);
+
+        for (uint32_t i = 0; i < _num; ++i)
+            hierarchy.Add(TrPRS_Random<T>(), i % 64 == 0 ? TrHierarchy<T>::NoParent : rand() % i);
+
+        return hierarchy;
+    }
+
+
+    /// Reference: each node walks its parent chain (no hierarchy system).
+    template <typename T>
+    static void TrHierarchy_ParentWalk(benchmark::State& _state)
+    {
+        const uint32_t num = static_cast<uint32_t>(_state.range(0));
+        const TrHierarchy<T> hierarchy = TrHierarchy_Random<T>(num);
+
+        std::vector<Mat4<T>> matrices(num);
+
+        for (auto _ : _state)
+        {
+            for (uint32_t i = 0; i < num; ++i)
+            {
+                TrPRS<T> world = hierarchy.GetLocal(i);
+
+                for (auto parent = hierarchy.GetParent(i); parent != TrHierarchy<T>::NoParent; parent = hierarchy.GetParent(parent))
+                    world = hierarchy.GetLocal(parent) * world;
+
+                matrices[i] = world.Matrix();
+            }
+
+            benchmark::DoNotOptimize(matrices.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * num);
+    }
+
+    BENCHMARK_TEMPLATE(TrHierarchy_ParentWalk, float)->Arg(10000)->Arg(100000);
+
+
+    template <typename T>
+    static void TrHierarchy_UpdateAll(benchmark::State& _state)
+    {
+        const uint32_t num = static_cast<uint32_t>(_state.range(0));
+        TrHierarchy<T> hierarchy = TrHierarchy_Random<T>(num);
+
+        for (auto _ : _state)
+        {
+            // Roots dirty: whole hierarchy is updated.
+            for (uint32_t i = 0; i < num; i += 64)
+                hierarchy.SetDirty(i);
+
+            benchmark::DoNotOptimize(hierarchy.Update());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * num);
+    }
+
+    BENCHMARK_TEMPLATE(TrHierarchy_UpdateAll, float)->Arg(10000)->Arg(100000);
+    BENCHMARK_TEMPLATE(TrHierarchy_UpdateAll, double)->Arg(10000)->Arg(100000);
+
+
+    template <typename T>
+    static void TrHierarchy_UpdateDirty(benchmark::State& _state)
+    {
+        const uint32_t num = static_cast<uint32_t>(_state.range(0));
+        TrHierarchy<T> hierarchy = TrHierarchy_Random<T>(num);
+        hierarchy.Update();
+
+        // 1% of nodes modified each frame.
+        std::vector<uint32_t> modified(num / 100);
+
+        for (auto& index : modified)
+            index = rand() % num;
+
+        for (auto _ : _state)
+        {
+            for (auto index : modified)
+                hierarchy.SetLocal(index, hierarchy.GetLocal(index));
+
+            benchmark::DoNotOptimize(hierarchy.Update());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * num);
+    }
+
+    BENCHMARK_TEMPLATE(TrHierarchy_UpdateDirty, float)->Arg(10000)->Arg(100000);
+
+
+    /// Thread scaling: all nodes updated, range(1) threads (1 = serial Update).
+    template <typename T>
+    static void TrHierarchy_UpdateParallel(benchmark::State& _state)
+    {
+        const uint32_t num = static_cast<uint32_t>(_state.range(0));
+        const uint32_t threadNum = static_cast<uint32_t>(_state.range(1));
+        TrHierarchy<T> hierarchy = TrHierarchy_Random<T>(num);
+
+        // Threads are created once, outside of the measured loop.
+        Maths::ThreadPool pool(threadNum);
+
+        for (auto _ : _state)
+        {
+            for (uint32_t i = 0; i < num; i += 64)
+                hierarchy.SetDirty(i);
+
+            benchmark::DoNotOptimize(hierarchy.UpdateParallel(pool, pool.GetThreadNum()));
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * num);
+    }
+
+    BENCHMARK_TEMPLATE(TrHierarchy_UpdateParallel, float)->ArgsProduct({ { 500000 }, { 1, 2, 4, 8, 16, 32 } })->UseRealTime();
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2023 Sapphire's Suite. All Rights Reserved.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <SA/Maths/Transform/Transform.hpp>
+#include <SA/Maths/Transform/Functors/TransformTRSMatrixBatchFunctor.hpp>
+
+#include "../Tools/Random.hpp"
+
+namespace SA::Benchmark
+{
+    template <typename T>
+    static std::vector<TrPRS<T>> TrPRS_RandomArray(size_t _num)
+    {
+        std::vector<TrPRS<T>> trs(_num);
+
+        for (auto& tr : trs)
+        {
+            tr.position = Vec3<T>(Rand<T>(-10, 10), Rand<T>(-10, 10), Rand<T>(-10, 10));
+            tr.rotation = Quat<T>(Deg<T>(Rand<T>(0, 360)), Vec3<T>(Rand<T>(), Rand<T>(), Rand<T>()).GetNormalized());
+            tr.scale = Vec3<T>(Rand<T>(T(0.5), T(2)), Rand<T>(T(0.5), T(2)), Rand<T>(T(0.5), T(2)));
+        }
+
+        return trs;
+    }
+
+
+    /// Reference: one TrTRSMatrixFunctor call per transform.
+    template <typename T>
+    static void TrPRS_Matrix(benchmark::State& _state)
+    {
+        const std::vector<TrPRS<T>> trs = TrPRS_RandomArray<T>(_state.range(0));
+        std::vector<Mat4<T>> mats(trs.size());
+
+        for (auto _ : _state)
+        {
+            for (size_t i = 0; i < trs.size(); ++i)
+                mats[i] = trs[i].Matrix();
+
+            benchmark::DoNotOptimize(mats.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(TrPRS_Matrix, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(TrPRS_Matrix, double)->Arg(1024)->Arg(65536);
+
+
+    template <typename T>
+    static void TrPRS_MatrixBatch(benchmark::State& _state)
+    {
+        const std::vector<TrPRS<T>> trs = TrPRS_RandomArray<T>(_state.range(0));
+
+        // Structure-Of-Arrays inputs.
+        std::vector<Vec3<T>> positions(trs.size());
+        std::vector<Vec3<T>> scales(trs.size());
+        std::vector<T> rw(trs.size()), rx(trs.size()), ry(trs.size()), rz(trs.size());
+
+        for (size_t i = 0; i < trs.size(); ++i)
+        {
+            positions[i] = trs[i].position;
+            scales[i] = trs[i].scale;
+            rw[i] = trs[i].rotation.w;
+            rx[i] = trs[i].rotation.x;
+            ry[i] = trs[i].rotation.y;
+            rz[i] = trs[i].rotation.z;
+        }
+
+        const Vec3Stream<T> posStream(positions.data(), positions.size());
+        const Vec3Stream<T> scaleStream(scales.data(), scales.size());
+
+        std::vector<Mat4<T>> mats(trs.size());
+
+        for (auto _ : _state)
+        {
+            TrTRSMatrixBatchFunctor()(posStream, rw.data(), rx.data(), ry.data(), rz.data(), scaleStream, mats.data());
+
+            benchmark::DoNotOptimize(mats.data());
+        }
+
+        _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(TrPRS_MatrixBatch, float)->Arg(1024)->Arg(65536);
+    BENCHMARK_TEMPLATE(TrPRS_MatrixBatch, double)->Arg(1024)->Arg(65536);
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <array>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <SA/Maths/Angle/Degree.hpp>
+#include <SA/Maths/Algorithms/Sqrt.hpp>
+#include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/Cos.hpp>
+#include <SA/Maths/Algorithms/Tan.hpp>
+#include <SA/Maths/Algorithms/SinCos.hpp>
+#include <SA/Maths/Space/Vector3.hpp>
+#include <SA/Maths/Space/Quaternion.hpp>
+#include <SA/Maths/Matrix/Matrix4.hpp>
+
+namespace SA::UT::ConstEval
+{
+	using Maths::TrigPrecision;
+
+	template <typename T>
+	class ConstEvalTest : public testing::Test
+	{
+	};
+
+	using TestTypes = testing::Types<float, double>;
+	TYPED_TEST_SUITE(ConstEvalTest, TestTypes);
+
+
+	/// 1 ulp of _ref in T.
+	template <typename T>
+	T Ulp(T _ref)
+	{
+		return std::nextafter(std::abs(_ref), std::numeric_limits<T>::infinity()) - std::abs(_ref);
+	}
+
+
+	TYPED_TEST(ConstEvalTest, Sqrt)
+	{
+		using T = TypeParam;
+
+		// Same implementation as constant evaluation.
+		for (int32_t i = -300; i <= 300; ++i)
+		{
+			const T x = static_cast<T>(std::pow(10.0, i * 0.1) * 1.2345);
+
+			if (x == T(0) || std::isinf(x))
+				continue;
+
+			EXPECT_LE(std::abs(Intl::ConstexprSqrt(x) - std::sqrt(x)), Ulp(std::sqrt(x))) << "x: " << x;
+		}
+
+		EXPECT_EQ(Intl::ConstexprSqrt(T(0)), T(0));
+		EXPECT_TRUE(std::isnan(Intl::ConstexprSqrt(T(-1))));
+		EXPECT_EQ(Intl::ConstexprSqrt(std::numeric_limits<T>::infinity()), std::numeric_limits<T>::infinity());
+
+#if SA_MATHS_CONSTEXPR_MATHS
+
+		static_assert(Maths::Sqrt(T(4)) == T(2));
+		static_assert(Maths::Sqrt(T(0.25)) == T(0.5));
+
+		constexpr T sqrt2 = Maths::Sqrt(T(2));
+		EXPECT_LE(std::abs(sqrt2 - std::sqrt(T(2))), Ulp(std::sqrt(T(2))));
+
+#endif
+	}
+
+	TYPED_TEST(ConstEvalTest, Trigonometry)
+	{
+		using T = TypeParam;
+
+		// Constant evaluation: High precision in double.
+		for (int32_t i = -3600; i <= 3600; ++i)
+		{
+			const double x = i * 0.01;
+
+			EXPECT_NEAR(Intl::TrigSin<TrigPrecision::High>(x), std::sin(x), 2e-16) << "x: " << x;
+			EXPECT_NEAR(Intl::TrigCos<TrigPrecision::High>(x), std::cos(x), 2e-16) << "x: " << x;
+		}
+
+#if SA_MATHS_CONSTEXPR_MATHS
+
+		static_assert(Maths::Sin(Rad<T>(T(0))) == T(0));
+		static_assert(Maths::Cos(Rad<T>(T(0))) == T(1));
+		static_assert(Maths::Tan(Rad<T>(T(0))) == T(0));
+
+		constexpr T sin = Maths::Sin(Rad<T>(T(0.7)));
+		constexpr T cos = Maths::Cos(Rad<T>(T(0.7)));
+		constexpr T tan = Maths::Tan(Rad<T>(T(0.7)));
+
+		EXPECT_NEAR(sin, std::sin(T(0.7)), Ulp(std::sin(T(0.7))));
+		EXPECT_NEAR(cos, std::cos(T(0.7)), Ulp(std::cos(T(0.7))));
+		EXPECT_NEAR(tan, std::tan(T(0.7)), Ulp(std::tan(T(0.7))));
+
+		constexpr Maths::SinCosResult<T> sinCos = Maths::SinCos(Rad<T>(T(0.7)));
+
+		EXPECT_EQ(sinCos.sin, sin);
+		EXPECT_EQ(sinCos.cos, cos);
+
+		// Polynomial overloads are constexpr too.
+		constexpr T sinLow = Maths::Sin<TrigPrecision::Low>(Rad<T>(T(0.7)));
+		EXPECT_EQ(sinLow, Maths::Sin<TrigPrecision::Low>(Rad<T>(T(0.7))));
+
+		// Baked lookup table.
+		constexpr std::array<T, 64> table = []()
+		{
+			std::array<T, 64> res{};
+
+			for (size_t i = 0; i < res.size(); ++i)
+				res[i] = Maths::Sin(Rad<T>(static_cast<T>(i) * Maths::Pi<T> / T(32)));
+
+			return res;
+		}();
+
+		for (size_t i = 0; i < table.size(); ++i)
+		{
+			const T ref = std::sin(static_cast<T>(i) * Maths::Pi<T> / T(32));
+			EXPECT_NEAR(table[i], ref, Ulp(T(1))) << "i: " << i;
+		}
+
+#endif
+	}
+
+	TYPED_TEST(ConstEvalTest, QuatMat4)
+	{
+#if SA_MATHS_CONSTEXPR_MATHS
+
+		using T = TypeParam;
+
+		constexpr Quat<T> rot(Deg<T>(T(90)), Vec3<T>(T(0), T(1), T(0)));
+		const Quat<T> rotRuntime(Deg<T>(T(90)), Vec3<T>(T(0), T(1), T(0)));
+
+		EXPECT_NEAR(rot.w, rotRuntime.w, Ulp(T(1)));
+		EXPECT_NEAR(rot.x, rotRuntime.x, Ulp(T(1)));
+		EXPECT_NEAR(rot.y, rotRuntime.y, Ulp(T(1)));
+		EXPECT_NEAR(rot.z, rotRuntime.z, Ulp(T(1)));
+
+		constexpr Mat4<T> proj = Mat4<T>::MakePerspective(T(60), T(16) / T(9), T(0.1), T(100));
+		const Mat4<T> projRuntime = Mat4<T>::MakePerspective(T(60), T(16) / T(9), T(0.1), T(100));
+
+		EXPECT_NEAR(proj.e00, projRuntime.e00, T(2) * Ulp(projRuntime.e00));
+		EXPECT_NEAR(proj.e11, projRuntime.e11, T(2) * Ulp(projRuntime.e11));
+		EXPECT_EQ(proj.e22, projRuntime.e22);
+		EXPECT_EQ(proj.e23, projRuntime.e23);
+		EXPECT_EQ(proj.e32, projRuntime.e32);
+
+#endif
+	}
+}
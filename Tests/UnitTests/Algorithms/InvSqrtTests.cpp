@@ -0,0 +1,77 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <SA/Maths/Algorithms/InvSqrt.hpp>
+
+namespace SA::UT::InvSqrt
+{
+	using Maths::InvSqrtPrecision;
+
+	template <typename T>
+	class InvSqrtTest : public testing::Test
+	{
+	};
+
+	using TestTypes = testing::Types<float, double>;
+	TYPED_TEST_SUITE(InvSqrtTest, TestTypes);
+
+
+	/// Max relative error of each precision (see InvSqrtPrecision).
+	template <InvSqrtPrecision precision>
+	constexpr double invSqrtTolerance = precision == InvSqrtPrecision::Exact ? 2.5e-7 :
+		precision == InvSqrtPrecision::Newton ? 5e-6 : 2e-3;
+
+	/// Log-distributed samples in [1e-20, 1e20] (odd count: exercise batch tail).
+	template <typename T>
+	std::vector<T> InvSqrtSamples()
+	{
+		std::vector<T> res;
+
+		for (int32_t i = -2000; i <= 2000; ++i)
+			res.push_back(static_cast<T>(std::pow(10.0, i * 0.01) * (1.0 + 0.37 * ((i * 7919) % 101) / 101.0)));
+
+		return res;
+	}
+
+	template <typename T, InvSqrtPrecision precision>
+	void InvSqrtCheck()
+	{
+		const std::vector<T> in = InvSqrtSamples<T>();
+		std::vector<T> out(in.size());
+
+		Maths::InvSqrtBatch<T, precision>(in.data(), out.data(), in.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+		{
+			const double ref = 1.0 / std::sqrt(static_cast<double>(in[i]));
+
+			const double scalar = static_cast<double>(Maths::InvSqrt<T, precision>(in[i]));
+			EXPECT_NEAR(scalar / ref, 1.0, invSqrtTolerance<precision>) << "x: " << in[i];
+
+			EXPECT_NEAR(static_cast<double>(out[i]) / ref, 1.0, invSqrtTolerance<precision>) << "x: " << in[i];
+		}
+
+		// In place.
+		std::vector<T> inPlace = in;
+		Maths::InvSqrtBatch<T, precision>(inPlace.data(), inPlace.data(), inPlace.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+			EXPECT_EQ(inPlace[i], out[i]);
+	}
+
+	TYPED_TEST(InvSqrtTest, Precision)
+	{
+		using T = TypeParam;
+
+		EXPECT_EQ(Maths::InvSqrt(T(4)), T(0.5));
+		EXPECT_EQ(Maths::InvSqrt<T>(T(0.25)), T(2));
+
+		InvSqrtCheck<T, InvSqrtPrecision::Exact>();
+		InvSqrtCheck<T, InvSqrtPrecision::Newton>();
+		InvSqrtCheck<T, InvSqrtPrecision::Raw>();
+	}
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <SA/Maths/Angle/Degree.hpp>
+#include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/Cos.hpp>
+#include <SA/Maths/Algorithms/SinCos.hpp>
+
+namespace SA::UT::SinCos
+{
+	using Maths::TrigPrecision;
+
+	template <typename T>
+	class SinCosTest : public testing::Test
+	{
+	};
+
+	using TestTypes = testing::Types<float, double>;
+	TYPED_TEST_SUITE(SinCosTest, TestTypes);
+
+
+	TYPED_TEST(SinCosTest, Std)
+	{
+		using T = TypeParam;
+
+		for (int32_t i = -720; i <= 720; i += 15)
+		{
+			const Rad<T> angle = Deg<T>(static_cast<T>(i));
+			const Maths::SinCosResult<T> res = Maths::SinCos(angle);
+
+			// Same results as separate calls.
+			EXPECT_EQ(res.sin, Maths::Sin(angle));
+			EXPECT_EQ(res.cos, Maths::Cos(angle));
+		}
+
+		const auto [sin, cos] = Maths::SinCos<T>(Deg<T>(T(40)));
+
+		EXPECT_NEAR(sin, T(0.64278760968653933), std::numeric_limits<T>::epsilon());
+		EXPECT_NEAR(cos, T(0.76604444311897801), std::numeric_limits<T>::epsilon());
+	}
+
+	template <typename T, TrigPrecision precision>
+	void SinCosPrecisionCheck()
+	{
+		std::vector<T> in;
+
+		for (int32_t i = -5000; i <= 5001; ++i)
+			in.push_back(static_cast<T>(i) * T(0.01));
+
+		for (T x : in)
+		{
+			const Maths::SinCosResult<T> res = Maths::SinCos<precision>(Rad<T>(x));
+
+			// Shared reduction: exactly the same as separate polynomial calls.
+			EXPECT_EQ(res.sin, Maths::Sin<precision>(Rad<T>(x))) << "x: " << x;
+			EXPECT_EQ(res.cos, Maths::Cos<precision>(Rad<T>(x))) << "x: " << x;
+		}
+
+		// Batch: SIMD may use fma, allow a few ulp.
+		const T tol = T(8) * std::numeric_limits<T>::epsilon();
+
+		std::vector<T> sinOut(in.size());
+		std::vector<T> cosOut(in.size());
+
+		Maths::SinCosBatch<precision>(in.data(), sinOut.data(), cosOut.data(), in.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+		{
+			EXPECT_NEAR(sinOut[i], Maths::Sin<precision>(Rad<T>(in[i])), tol) << "x: " << in[i];
+			EXPECT_NEAR(cosOut[i], Maths::Cos<precision>(Rad<T>(in[i])), tol) << "x: " << in[i];
+		}
+
+		// In place sine.
+		std::vector<T> inPlace = in;
+		Maths::SinCosBatch<precision>(inPlace.data(), inPlace.data(), cosOut.data(), inPlace.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+		{
+			EXPECT_NEAR(inPlace[i], Maths::Sin<precision>(Rad<T>(in[i])), tol) << "x: " << in[i];
+			EXPECT_NEAR(cosOut[i], Maths::Cos<precision>(Rad<T>(in[i])), tol) << "x: " << in[i];
+		}
+	}
+
+	TYPED_TEST(SinCosTest, Precision)
+	{
+		using T = TypeParam;
+
+		SinCosPrecisionCheck<T, TrigPrecision::Low>();
+		SinCosPrecisionCheck<T, TrigPrecision::Medium>();
+		SinCosPrecisionCheck<T, TrigPrecision::High>();
+	}
+}
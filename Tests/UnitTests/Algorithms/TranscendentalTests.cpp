@@ -0,0 +1,187 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <SA/Maths/Algorithms/Cos.hpp>
+#include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/Tan.hpp>
+#include <SA/Maths/Algorithms/Exp.hpp>
+#include <SA/Maths/Algorithms/Log.hpp>
+
+namespace SA::UT::Transcendental
+{
+	template <typename T>
+	class TranscendentalTest : public testing::Test
+	{
+	};
+
+	using TestTypes = testing::Types<float, double>;
+	TYPED_TEST_SUITE(TranscendentalTest, TestTypes);
+
+
+	/// Distance in ulp of T between _val and the long double reference _ref.
+	template <typename T>
+	double UlpError(T _val, long double _ref)
+	{
+		const long double absRef = std::fabs(_ref);
+		const int exp = absRef == 0.0l ? std::numeric_limits<T>::min_exponent :
+			std::max(std::ilogb(static_cast<T>(absRef)) + 1, std::numeric_limits<T>::min_exponent);
+
+		const long double ulp = std::ldexp(1.0l, exp - std::numeric_limits<T>::digits);
+
+		return static_cast<double>(std::fabs(static_cast<long double>(_val) - _ref) / ulp);
+	}
+
+	/// Uniform samples in [_min, _max] (odd count: exercise batch tail).
+	template <typename T>
+	std::vector<T> Samples(double _min, double _max, size_t _num = 100001)
+	{
+		std::vector<T> res(_num);
+
+		for (size_t i = 0; i < _num; ++i)
+			res[i] = static_cast<T>(_min + (_max - _min) * static_cast<double>(i) / static_cast<double>(_num - 1));
+
+		return res;
+	}
+
+	template <typename T, typename BatchT, typename RefT>
+	void UlpCheck(BatchT _batch, RefT _ref, const std::vector<T>& _in, double _maxUlp)
+	{
+		std::vector<T> out(_in.size());
+		_batch(_in.data(), out.data(), _in.size());
+
+		for (size_t i = 0; i < _in.size(); ++i)
+			EXPECT_LE(UlpError(out[i], _ref(static_cast<long double>(_in[i]))), _maxUlp) << "x: " << _in[i];
+
+		// In place.
+		std::vector<T> inPlace = _in;
+		_batch(inPlace.data(), inPlace.data(), inPlace.size());
+
+		for (size_t i = 0; i < _in.size(); ++i)
+			EXPECT_EQ(inPlace[i], out[i]);
+	}
+
+
+	TYPED_TEST(TranscendentalTest, ACos)
+	{
+		using T = TypeParam;
+
+		UlpCheck<T>(Maths::ACosBatch<T>, [](long double _x) { return std::acos(_x); }, Samples<T>(-1.0, 1.0), 4.0);
+	}
+
+	TYPED_TEST(TranscendentalTest, ASin)
+	{
+		using T = TypeParam;
+
+		UlpCheck<T>(Maths::ASinBatch<T>, [](long double _x) { return std::asin(_x); }, Samples<T>(-1.0, 1.0), 4.0);
+	}
+
+	TYPED_TEST(TranscendentalTest, ATan)
+	{
+		using T = TypeParam;
+
+		UlpCheck<T>(Maths::ATanBatch<T>, [](long double _x) { return std::atan(_x); }, Samples<T>(-2.0, 2.0), 3.0);
+		UlpCheck<T>(Maths::ATanBatch<T>, [](long double _x) { return std::atan(_x); }, Samples<T>(-1e6, 1e6), 3.0);
+	}
+
+	TYPED_TEST(TranscendentalTest, ATan2)
+	{
+		using T = TypeParam;
+
+		const std::vector<T> values = Samples<T>(-10.0, 10.0, 201);
+
+		std::vector<T> y;
+		std::vector<T> x;
+
+		for (T yVal : values)
+		{
+			for (T xVal : values)
+			{
+				y.push_back(yVal);
+				x.push_back(xVal);
+			}
+		}
+
+		// Odd count: exercise batch tail.
+		y.push_back(T(1));
+		x.push_back(T(-3));
+
+		std::vector<T> out(y.size());
+		Maths::ATan2Batch<T>(y.data(), x.data(), out.data(), out.size());
+
+		for (size_t i = 0; i < out.size(); ++i)
+		{
+			const long double ref = std::atan2(static_cast<long double>(y[i]), static_cast<long double>(x[i]));
+			EXPECT_LE(UlpError(out[i], ref), 3.0) << "y: " << y[i] << " x: " << x[i];
+		}
+
+		// Quadrants and axes.
+		const T in[] = { T(0), T(1), T(-1), T(0), T(2), T(-2), T(0) };
+		const T inX[] = { T(1), T(0), T(0), T(-1), T(-2), T(-2), T(0) };
+		T res[7];
+
+		Maths::ATan2Batch<T>(in, inX, res, 7);
+
+		for (size_t i = 0; i < 7; ++i)
+			EXPECT_EQ(res[i], Maths::ATan2(in[i], inX[i]).Handle()) << "y: " << in[i] << " x: " << inX[i];
+	}
+
+	TYPED_TEST(TranscendentalTest, Exp)
+	{
+		using T = TypeParam;
+
+		const double maxUlp = std::is_same_v<T, float> ? 1.0 : 2.0;
+		const double range = std::is_same_v<T, float> ? 87.0 : 708.0;
+
+		UlpCheck<T>(Maths::ExpBatch<T>, [](long double _x) { return std::exp(_x); }, Samples<T>(-5.0, 5.0), maxUlp);
+		UlpCheck<T>(Maths::ExpBatch<T>, [](long double _x) { return std::exp(_x); }, Samples<T>(-range, range), maxUlp);
+
+		// Overflow, underflow and NaN.
+		const T in[] = { T(0), T(1000), T(-1000), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity() };
+		T res[5];
+
+		Maths::ExpBatch<T>(in, res, 5);
+
+		EXPECT_EQ(res[0], T(1));
+		EXPECT_EQ(res[1], std::numeric_limits<T>::infinity());
+		EXPECT_EQ(res[2], T(0));
+		EXPECT_EQ(res[3], std::numeric_limits<T>::infinity());
+		EXPECT_EQ(res[4], T(0));
+
+		const T nan = std::numeric_limits<T>::quiet_NaN();
+		Maths::ExpBatch<T>(&nan, res, 1);
+		EXPECT_TRUE(std::isnan(res[0]));
+	}
+
+	TYPED_TEST(TranscendentalTest, Log)
+	{
+		using T = TypeParam;
+
+		UlpCheck<T>(Maths::LogBatch<T>, [](long double _x) { return std::log(_x); }, Samples<T>(0.25, 4.0), 1.0);
+		UlpCheck<T>(Maths::LogBatch<T>, [](long double _x) { return std::log(_x); }, Samples<T>(1e-3, 1e6), 1.0);
+
+		// Denormals.
+		std::vector<T> denorm;
+
+		for (int32_t i = 1; i < 20; ++i)
+			denorm.push_back(std::numeric_limits<T>::denorm_min() * static_cast<T>(i * 12345));
+
+		UlpCheck<T>(Maths::LogBatch<T>, [](long double _x) { return std::log(_x); }, denorm, 1.0);
+
+		// Special values.
+		const T in[] = { T(1), T(0), T(-1), std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN() };
+		T res[5];
+
+		Maths::LogBatch<T>(in, res, 5);
+
+		EXPECT_EQ(res[0], T(0));
+		EXPECT_EQ(res[1], -std::numeric_limits<T>::infinity());
+		EXPECT_TRUE(std::isnan(res[2]));
+		EXPECT_EQ(res[3], std::numeric_limits<T>::infinity());
+		EXPECT_TRUE(std::isnan(res[4]));
+	}
+}
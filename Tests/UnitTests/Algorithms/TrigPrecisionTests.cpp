@@ -0,0 +1,147 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <SA/Maths/Algorithms/Sin.hpp>
+#include <SA/Maths/Algorithms/Cos.hpp>
+#include <SA/Maths/Algorithms/Tan.hpp>
+
+namespace SA::UT::TrigPrecision
+{
+	using Maths::TrigPrecision;
+
+	template <typename T>
+	class TrigPrecisionTest : public testing::Test
+	{
+	};
+
+	using TestTypes = testing::Types<float, double>;
+	TYPED_TEST_SUITE(TrigPrecisionTest, TestTypes);
+
+
+	/// Expected max absolute error of sin / cos on |x| <= 100 (with margin).
+	template <typename T, TrigPrecision precision>
+	constexpr T trigTolerance = precision == TrigPrecision::Low ? T(3e-3) :
+		precision == TrigPrecision::Medium ? T(2e-5) :
+		std::is_same_v<T, float> ? T(2e-6) : T(1e-13);
+
+	/// Uniform samples in [-_range, _range] (odd count: exercise batch tail).
+	template <typename T>
+	std::vector<T> TrigSamples(T _range, size_t _num = 4001u)
+	{
+		std::vector<T> res(_num);
+
+		for (size_t i = 0; i < _num; ++i)
+			res[i] = -_range + T(2) * _range * T(i) / T(_num - 1);
+
+		return res;
+	}
+
+	template <typename T, TrigPrecision precision>
+	void TrigSinCosCheck(T _range)
+	{
+		const T tol = trigTolerance<T, precision>;
+
+		for (T x : TrigSamples(_range))
+		{
+			// Reference in double (large float inputs).
+			const double xd = static_cast<double>(x);
+
+			EXPECT_NEAR(Maths::Sin<precision>(Rad<T>(x)), std::sin(xd), tol) << "x: " << x;
+			EXPECT_NEAR(Maths::Cos<precision>(Rad<T>(x)), std::cos(xd), tol) << "x: " << x;
+		}
+	}
+
+	TYPED_TEST(TrigPrecisionTest, SinCos)
+	{
+		using T = TypeParam;
+
+		EXPECT_EQ(Maths::Sin<TrigPrecision::High>(Rad<T>(T(0))), T(0));
+		EXPECT_EQ(Maths::Cos<TrigPrecision::High>(Rad<T>(T(0))), T(1));
+
+		TrigSinCosCheck<T, TrigPrecision::Low>(T(100));
+		TrigSinCosCheck<T, TrigPrecision::Medium>(T(100));
+		TrigSinCosCheck<T, TrigPrecision::High>(T(100));
+
+		// Quadrant signs.
+		EXPECT_NEAR(Maths::Sin<TrigPrecision::High>(Rad<T>(-Maths::PiOv2<T>)), T(-1), (trigTolerance<T, TrigPrecision::High>));
+		EXPECT_NEAR(Maths::Cos<TrigPrecision::High>(Rad<T>(Maths::Pi<T>)), T(-1), (trigTolerance<T, TrigPrecision::High>));
+		EXPECT_NEAR(Maths::Cos<TrigPrecision::Low>(Rad<T>(T(3) * Maths::PiOv2<T>)), T(0), (trigTolerance<T, TrigPrecision::Low>));
+	}
+
+	template <typename T, TrigPrecision precision>
+	void TrigTanCheck()
+	{
+		const T tol = trigTolerance<T, precision>;
+
+		for (T x : TrigSamples(T(100)))
+		{
+			const double ref = std::tan(static_cast<double>(x));
+
+			// Away from poles: relative error.
+			if (std::abs(ref) > 10.0)
+				continue;
+
+			EXPECT_NEAR(Maths::Tan<precision>(Rad<T>(x)), ref, T(4) * tol * std::max(1.0, ref * ref)) << "x: " << x;
+		}
+	}
+
+	TYPED_TEST(TrigPrecisionTest, Tan)
+	{
+		using T = TypeParam;
+
+		EXPECT_EQ(Maths::Tan<TrigPrecision::High>(Rad<T>(T(0))), T(0));
+
+		TrigTanCheck<T, TrigPrecision::Low>();
+		TrigTanCheck<T, TrigPrecision::Medium>();
+		TrigTanCheck<T, TrigPrecision::High>();
+	}
+
+
+	template <typename T, TrigPrecision precision>
+	void TrigBatchCheck()
+	{
+		// SIMD version may use fma: allow a few ulp of difference with scalar.
+		const T tol = T(8) * std::numeric_limits<T>::epsilon();
+
+		const std::vector<T> in = TrigSamples(T(50), 1003u);
+		std::vector<T> out(in.size());
+
+		Maths::SinBatch<precision>(in.data(), out.data(), in.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+			EXPECT_NEAR(out[i], Maths::Sin<precision>(Rad<T>(in[i])), tol) << "x: " << in[i];
+
+		Maths::CosBatch<precision>(in.data(), out.data(), in.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+			EXPECT_NEAR(out[i], Maths::Cos<precision>(Rad<T>(in[i])), tol) << "x: " << in[i];
+
+		Maths::TanBatch<precision>(in.data(), out.data(), in.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+		{
+			const T ref = Maths::Tan<precision>(Rad<T>(in[i]));
+			EXPECT_NEAR(out[i], ref, tol * std::max(T(1), ref * ref)) << "x: " << in[i];
+		}
+
+		// In place.
+		std::vector<T> inPlace = in;
+		Maths::SinBatch<precision>(inPlace.data(), inPlace.data(), inPlace.size());
+
+		for (size_t i = 0; i < in.size(); ++i)
+			EXPECT_NEAR(inPlace[i], Maths::Sin<precision>(Rad<T>(in[i])), tol) << "x: " << in[i];
+	}
+
+	TYPED_TEST(TrigPrecisionTest, Batch)
+	{
+		using T = TypeParam;
+
+		TrigBatchCheck<T, TrigPrecision::Low>();
+		TrigBatchCheck<T, TrigPrecision::Medium>();
+		TrigBatchCheck<T, TrigPrecision::High>();
+	}
+}
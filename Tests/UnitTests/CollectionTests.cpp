@@ -6,6 +6,7 @@
 
 #include <SA/Collections/Algorithms>
 #include <SA/Collections/Angle>
+#include <SA/Collections/Dispatch>
 #include <SA/Collections/Maths>
 #include <SA/Collections/Matrix>
 #include <SA/Collections/Space>
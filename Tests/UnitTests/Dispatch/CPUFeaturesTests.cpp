@@ -0,0 +1,301 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <vector>
+#include <algorithm>
+
+#include <SA/Maths/Dispatch/CPUFeatures.hpp>
+#include <SA/Maths/Matrix/Matrix4.hpp>
+#include <SA/Maths/Space/Quaternion.hpp>
+#include <SA/Maths/Space/Vector3Stream.hpp>
+#include <SA/Maths/Transform/Functors/TransformTRSMatrixBatchFunctor.hpp>
+#include <SA/Maths/Geometry/AABB3D.hpp>
+
+#include "../Matrix/Matrix4Tests.hpp"
+#include "../Space/Vector3Tests.hpp"
+#include "../Space/Vector4Tests.hpp"
+
+namespace SA::UT::CPUFeatures
+{
+	TEST(CPUFeatures, Level)
+	{
+		const Maths::SIMDLevel hostLevel = Maths::GetHostSIMDLevel();
+
+		// Detected once.
+		EXPECT_EQ(Maths::GetHostSIMDLevel(), hostLevel);
+
+		// Default is host level.
+		EXPECT_EQ(Maths::GetSIMDLevel(), hostLevel);
+
+		EXPECT_EQ(Maths::SetSIMDLevel(Maths::SIMDLevel::Scalar), Maths::SIMDLevel::Scalar);
+		EXPECT_EQ(Maths::GetSIMDLevel(), Maths::SIMDLevel::Scalar);
+
+		// Clamped to host level.
+		EXPECT_EQ(Maths::SetSIMDLevel(Maths::SIMDLevel::AVX512), hostLevel);
+		EXPECT_EQ(Maths::GetSIMDLevel(), hostLevel);
+	}
+
+
+	template <typename T>
+	class CPUFeaturesTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(CPUFeaturesTest, TestTypes);
+
+	template <typename T>
+	using RMat4 = Mat4<T, MatrixMajor::Row>;
+
+	template <typename T>
+	using CMat4 = Mat4<T, MatrixMajor::Column>;
+
+	/// Every level up to host level, Scalar first (reference).
+	static std::vector<Maths::SIMDLevel> GetLevels()
+	{
+		std::vector<Maths::SIMDLevel> levels;
+
+		for (uint8_t i = 0u; i <= static_cast<uint8_t>(Maths::GetHostSIMDLevel()); ++i)
+			levels.push_back(static_cast<Maths::SIMDLevel>(i));
+
+		return levels;
+	}
+
+	TYPED_TEST(CPUFeaturesTest, Mat4Batch)
+	{
+		using T = TypeParam;
+		const RMat4<T> rMat(
+			(T)6.314, (T)1.652, (T)4.236, (T)99.4,
+			(T)4.625, (T)7.751, (T)1.625, (T)78.25,
+			(T)6.53, (T)1.121, (T)1.536, (T)9.64,
+			(T)1.26, (T)2.232, (T)5.6214, (T)3.2215
+		);
+		const CMat4<T> cMat = rMat;
+
+		// Odd size to cover both SIMD packs and remaining elements.
+		constexpr size_t num = 19u;
+
+		Vec3<T> v3s[num];
+		Vec4<T> v4s[num];
+		RMat4<T> rMats[num];
+		CMat4<T> cMats[num];
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			v3s[i] = Vec3<T>(T(i) + (T)1.25, (T)2.5 - T(i), T(i) * (T)3.5);
+			v4s[i] = Vec4<T>(v3s[i], T(i % 3));
+			rMats[i] = rMat * T(i + 1);
+			cMats[i] = rMats[i];
+		}
+
+		Vec3<T> refPoints[num];
+		Vec3<T> refDirs[num];
+		Vec4<T> refVec4s[num];
+		RMat4<T> refRMults[num];
+		CMat4<T> refCMults[num];
+
+		for (Maths::SIMDLevel level : GetLevels())
+		{
+			Maths::SetSIMDLevel(level);
+
+			Vec3<T> points[num];
+			Vec3<T> cPoints[num];
+			Vec3<T> dirs[num];
+			Vec4<T> vec4s[num];
+			RMat4<T> rMults[num];
+			CMat4<T> cMults[num];
+
+			rMat.TransformPoints(v3s, points, num);
+			cMat.TransformPoints(v3s, cPoints, num);
+			rMat.TransformDirections(v3s, dirs, num);
+			rMat.TransformVec4(v4s, vec4s, num);
+			RMat4<T>::MultiplyBatch(rMats, rMat, rMults, num);
+			CMat4<T>::MultiplyBatch(cMats, cMat, cMults, num);
+
+			if (level == Maths::SIMDLevel::Scalar)
+			{
+				std::copy(points, points + num, refPoints);
+				std::copy(dirs, dirs + num, refDirs);
+				std::copy(vec4s, vec4s + num, refVec4s);
+				std::copy(rMults, rMults + num, refRMults);
+				std::copy(cMults, cMults + num, refCMults);
+			}
+
+			for (size_t i = 0; i < num; ++i)
+			{
+				EXPECT_VEC3_NEAR(points[i], refPoints[i], 0.001);
+				EXPECT_VEC3_NEAR(cPoints[i], refPoints[i], 0.001);
+				EXPECT_VEC3_NEAR(dirs[i], refDirs[i], 0.001);
+				EXPECT_VEC4_NEAR(vec4s[i], refVec4s[i], 0.001);
+				EXPECT_MAT4_NEAR(rMults[i], refRMults[i], 0.01);
+				EXPECT_MAT4_NEAR(cMults[i], refCMults[i], 0.01);
+			}
+		}
+
+		Maths::SetSIMDLevel(Maths::GetHostSIMDLevel());
+	}
+
+	TYPED_TEST(CPUFeaturesTest, Vec3Stream)
+	{
+		using T = TypeParam;
+
+		constexpr size_t num = 37u;
+
+		std::vector<Vec3<T>> lVecs(num);
+		std::vector<Vec3<T>> rVecs(num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			lVecs[i] = Vec3<T>(T(i) + (T)0.5, (T)2 * T(i) - (T)0.5, (T)3 - T(i) * (T)0.5);
+			rVecs[i] = Vec3<T>((T)4.25 - T(i), T(i) * (T)1.5, T(i) + (T)2);
+		}
+
+		std::vector<T> refDots(num);
+		Vec3Stream<T> refCross;
+		Vec3Stream<T> refNorm;
+
+		for (Maths::SIMDLevel level : GetLevels())
+		{
+			Maths::SetSIMDLevel(level);
+
+			const Vec3Stream<T> lhs(lVecs.data(), num);
+			const Vec3Stream<T> rhs(rVecs.data(), num);
+
+			std::vector<T> dots(num);
+			Vec3Stream<T>::Dot(lhs, rhs, dots.data());
+
+			Vec3Stream<T> cross;
+			Vec3Stream<T>::Cross(lhs, rhs, cross);
+
+			Vec3Stream<T> norm = lhs;
+			norm.Normalize();
+
+			if (level == Maths::SIMDLevel::Scalar)
+			{
+				refDots = dots;
+				refCross = cross;
+				refNorm = norm;
+			}
+
+			for (size_t i = 0; i < num; ++i)
+			{
+				EXPECT_NEAR(dots[i], refDots[i], 0.001);
+				EXPECT_VEC3_NEAR(cross.Get(i), refCross.Get(i), 0.0001);
+				EXPECT_VEC3_NEAR(norm.Get(i), refNorm.Get(i), 0.00001);
+			}
+		}
+
+		Maths::SetSIMDLevel(Maths::GetHostSIMDLevel());
+	}
+
+	TYPED_TEST(CPUFeaturesTest, TRSMatrixBatch)
+	{
+		using T = TypeParam;
+
+		constexpr size_t num = 37u;
+
+		std::vector<Vec3<T>> positions(num);
+		std::vector<Vec3<T>> scales(num);
+		std::vector<T> rw(num), rx(num), ry(num), rz(num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			const Quat<T> rot = Quat<T>(Deg<T>(T(i) * T(23)), Vec3<T>(T(i % 3), T(1), T(i % 2)).GetNormalized());
+
+			positions[i] = Vec3<T>(T(i), T(2) * T(i), T(5) - T(i));
+			scales[i] = Vec3<T>(T(1) + T(i % 3), T(2), T(0.5));
+			rw[i] = rot.w;
+			rx[i] = rot.x;
+			ry[i] = rot.y;
+			rz[i] = rot.z;
+		}
+
+		const Vec3Stream<T> posStream(positions.data(), num);
+		const Vec3Stream<T> scaleStream(scales.data(), num);
+
+		std::vector<RMat4<T>> refMats(num);
+
+		for (Maths::SIMDLevel level : GetLevels())
+		{
+			Maths::SetSIMDLevel(level);
+
+			std::vector<RMat4<T>> rMats(num);
+			std::vector<CMat4<T>> cMats(num);
+
+			TrTRSMatrixBatchFunctor()(posStream, rw.data(), rx.data(), ry.data(), rz.data(), scaleStream, rMats.data());
+			TrTRSMatrixBatchFunctor()(posStream, rw.data(), rx.data(), ry.data(), rz.data(), scaleStream, cMats.data());
+
+			if (level == Maths::SIMDLevel::Scalar)
+				refMats = rMats;
+
+			for (size_t i = 0; i < num; ++i)
+			{
+				EXPECT_MAT4_NEAR(rMats[i], refMats[i], 0.00001);
+				EXPECT_MAT4_NEAR(cMats[i], CMat4<T>(refMats[i]), 0.00001);
+			}
+		}
+
+		Maths::SetSIMDLevel(Maths::GetHostSIMDLevel());
+	}
+
+	TYPED_TEST(CPUFeaturesTest, AABB3DTransformBatch)
+	{
+		using T = TypeParam;
+
+		// Odd number: SIMD tail.
+		constexpr size_t num = 37u;
+
+		std::vector<AABB3D<T>> boxes(num);
+		std::vector<RMat4<T>> rMats(num);
+		std::vector<CMat4<T>> cMats(num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			const Quat<T> rot = Quat<T>(Deg<T>(T(i) * T(23)), Vec3<T>(T(i % 3), T(1), T(i % 2)).GetNormalized());
+
+			rMats[i] = RMat4<T>::MakeTranslation(Vec3<T>(T(i), T(2) * T(i), T(5) - T(i))) *
+				RMat4<T>::MakeRotation(rot) * RMat4<T>::MakeScale(Vec3<T>(T(1) + T(i % 3), T(2), T(0.5)));
+			cMats[i] = CMat4<T>(rMats[i]);
+
+			boxes[i] = AABB3D<T>(Vec3<T>(T(i), T(-1), -T(i)), Vec3<T>(T(i) + T(2), T(i % 4), T(1)));
+		}
+
+		std::vector<AABB3D<T>> refBoxes(num);
+		std::vector<AABB3D<T>> refConstBoxes(num);
+
+		for (Maths::SIMDLevel level : GetLevels())
+		{
+			Maths::SetSIMDLevel(level);
+
+			std::vector<AABB3D<T>> rBoxes(num);
+			std::vector<AABB3D<T>> cBoxes(num);
+			std::vector<AABB3D<T>> rConstBoxes(num);
+			std::vector<AABB3D<T>> cConstBoxes(num);
+
+			AABB3D<T>::TransformBatch(rMats.data(), boxes.data(), rBoxes.data(), num);
+			AABB3D<T>::TransformBatch(cMats.data(), boxes.data(), cBoxes.data(), num);
+			AABB3D<T>::TransformBatch(rMats[5], boxes.data(), rConstBoxes.data(), num);
+			AABB3D<T>::TransformBatch(cMats[5], boxes.data(), cConstBoxes.data(), num);
+
+			if (level == Maths::SIMDLevel::Scalar)
+			{
+				refBoxes = rBoxes;
+				refConstBoxes = rConstBoxes;
+			}
+
+			for (size_t i = 0; i < num; ++i)
+			{
+				EXPECT_VEC3_NEAR(rBoxes[i].min, refBoxes[i].min, 0.0001);
+				EXPECT_VEC3_NEAR(rBoxes[i].max, refBoxes[i].max, 0.0001);
+				EXPECT_VEC3_NEAR(cBoxes[i].min, refBoxes[i].min, 0.0001);
+				EXPECT_VEC3_NEAR(cBoxes[i].max, refBoxes[i].max, 0.0001);
+
+				EXPECT_VEC3_NEAR(rConstBoxes[i].min, refConstBoxes[i].min, 0.0001);
+				EXPECT_VEC3_NEAR(rConstBoxes[i].max, refConstBoxes[i].max, 0.0001);
+				EXPECT_VEC3_NEAR(cConstBoxes[i].min, refConstBoxes[i].min, 0.0001);
+				EXPECT_VEC3_NEAR(cConstBoxes[i].max, refConstBoxes[i].max, 0.0001);
+			}
+		}
+
+		Maths::SetSIMDLevel(Maths::GetHostSIMDLevel());
+	}
+}
@@ -0,0 +1,53 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <SA/Maths/Dispatch/ThreadPool.hpp>
+
+namespace SA::UT::ThreadPool
+{
+	TEST(ThreadPool, Constructors)
+	{
+		const Maths::ThreadPool p0(0u);
+		EXPECT_EQ(p0.GetThreadNum(), 1u);
+
+		const Maths::ThreadPool p1(1u);
+		EXPECT_EQ(p1.GetThreadNum(), 1u);
+
+		const Maths::ThreadPool p4(4u);
+		EXPECT_EQ(p4.GetThreadNum(), 4u);
+	}
+
+	TEST(ThreadPool, ParallelFor)
+	{
+		for (uint32_t threadNum : { 1u, 2u, 3u, 8u })
+		{
+			Maths::ThreadPool pool(threadNum);
+
+			std::vector<std::atomic<uint32_t>> calls(1000u);
+
+			// Pool is reused: each index processed exactly once per call.
+			for (uint32_t n = 0; n < 50u; ++n)
+			{
+				pool(10u, 1000u, [&calls](uint32_t _index)
+				{
+					calls[_index].fetch_add(1u, std::memory_order_relaxed);
+				});
+			}
+
+			for (uint32_t i = 0; i < 10u; ++i)
+				EXPECT_EQ(calls[i].load(), 0u);
+
+			for (uint32_t i = 10u; i < 1000u; ++i)
+				EXPECT_EQ(calls[i].load(), 50u);
+
+			// Empty range.
+			bool called = false;
+			pool(5u, 5u, [&called](uint32_t) { called = true; });
+			EXPECT_FALSE(called);
+		}
+	}
+}
@@ -160,7 +160,7 @@ namespace SA::UT::AABB2
 			Vec2T(TypeParam{ 30.25 }, TypeParam{ 10.0 })
 		);
 
-		EXPECT_TRUE(b0.IsColliding(b2));
+		EXPECT_FALSE(b0.IsColliding(b2));
 
 
 		// Collision Y only.
@@ -169,7 +169,7 @@ namespace SA::UT::AABB2
 			Vec2T(TypeParam{ 4.25 }, TypeParam{ 40.0 })
 		);
 
-		EXPECT_TRUE(b0.IsColliding(b3));
+		EXPECT_FALSE(b0.IsColliding(b3));
 
 
 		// Collision X Y.
@@ -179,6 +179,7 @@ namespace SA::UT::AABB2
 		);
 
 		EXPECT_TRUE(b0.IsColliding(b4));
+		EXPECT_TRUE(b4.IsColliding(b0));
 	}
 
 	TYPED_TEST(AABB2DTest, Geometry)
@@ -0,0 +1,101 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <SA/Maths/Geometry/AABB3DPack.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::AABB3Pack
+{
+	template <typename T>
+	class AABB3DPackTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(AABB3DPackTest, TestTypes);
+
+	template <typename T, uint32_t N>
+	static void ExpectOverlapMask(const std::vector<AABB3D<T>>& _boxes, const std::vector<AABB3D<T>>& _queries)
+	{
+		for (uint32_t i = 0; i < _boxes.size(); i += N)
+		{
+			const uint32_t num = std::min<uint32_t>(N, static_cast<uint32_t>(_boxes.size()) - i);
+			const AABB3DPack<T, N> pack(_boxes.data() + i, num);
+
+			for (const auto& query : _queries)
+			{
+				uint32_t expected = 0u;
+
+				for (uint32_t j = 0; j < num; ++j)
+					expected |= uint32_t(_boxes[i + j].IsColliding(query)) << j;
+
+				EXPECT_EQ(pack.OverlapMask(query), expected);
+			}
+		}
+	}
+
+
+	TYPED_TEST(AABB3DPackTest, Lanes)
+	{
+		using T = TypeParam;
+
+		const AABB3DT b0(Vec3T(T(1), T(2), T(3)), Vec3T(T(4), T(5), T(6)));
+		const AABB3DT b1(Vec3T(T(-1), T(-2), T(-3)), Vec3T(T(0), T(0), T(0)));
+
+		AABB3DPack4<T> pack;
+
+		// Empty lanes never overlap.
+		const AABB3DT everything(Vec3T(std::numeric_limits<T>::lowest()), Vec3T(std::numeric_limits<T>::max()));
+		EXPECT_EQ(pack.OverlapMask(everything), 0u);
+
+		pack.Set(0u, b0);
+		pack.Set(2u, b1);
+
+		EXPECT_EQ(pack.Get(0u), b0);
+		EXPECT_EQ(pack.Get(2u), b1);
+		EXPECT_EQ(pack.OverlapMask(everything), 0b0101u);
+
+		pack.SetEmpty(0u);
+		EXPECT_EQ(pack.OverlapMask(everything), 0b0100u);
+
+		const AABB3DT boxes[] = { b0, b1, b0 };
+		const AABB3DPack8<T> pack8(boxes, 3u);
+
+		EXPECT_EQ(pack8.Get(1u), b1);
+		EXPECT_EQ(pack8.OverlapMask(everything), 0b0111u);
+	}
+
+	TYPED_TEST(AABB3DPackTest, OverlapMask)
+	{
+		using T = TypeParam;
+
+		const AABB3DT b0(Vec3T(T(0)), Vec3T(T(2)));
+
+		const AABB3DT boxes[] = {
+			AABB3DT(Vec3T(T(1)), Vec3T(T(3))),								// Overlap.
+			AABB3DT(Vec3T(T(2), T(0), T(0)), Vec3T(T(3), T(2), T(2))),		// Touching face.
+			AABB3DT(Vec3T(T(1), T(1), T(5)), Vec3T(T(3), T(3), T(6))),		// X Y only.
+			AABB3DT(Vec3T(T(5), T(5), T(1)), Vec3T(T(6), T(6), T(3))),		// Z only.
+			AABB3DT(Vec3T(T(-1)), Vec3T(T(3))),								// Contains.
+			AABB3DT(Vec3T(T(0.5)), Vec3T(T(1.5))),							// Contained.
+			AABB3DT(Vec3T(T(-3)), Vec3T(T(-1))),							// Separated.
+		};
+
+		const AABB3DPack8<T> pack8(boxes, 7u);
+		EXPECT_EQ(pack8.OverlapMask(b0), 0b0110011u);
+
+		const AABB3DPack4<T> pack4(boxes, 4u);
+		EXPECT_EQ(pack4.OverlapMask(b0), 0b0011u);
+	}
+
+	TYPED_TEST(AABB3DPackTest, OverlapMaskRandom)
+	{
+		using T = TypeParam;
+
+		const std::vector<AABB3D<T>> boxes = MakeRandomBoxes<T>(203u, 1u, T(20), T(10));
+		const std::vector<AABB3D<T>> queries = MakeRandomBoxes<T>(50u, 2u, T(20), T(10));
+
+		ExpectOverlapMask<T, 4u>(boxes, queries);
+		ExpectOverlapMask<T, 8u>(boxes, queries);
+	}
+}
@@ -1,8 +1,12 @@
 // Copyright (c) 2023 Sapphire development team. All Rights Reserved.
 
+#include <random>
+
 #include "AABB3DTests.hpp"
 
+#include <SA/Maths/Space/Vector4.hpp>
 #include <SA/Maths/Geometry/AABB2D.hpp>
+#include <SA/Maths/Transform/Transform.hpp>
 
 namespace SA::UT::AABB3
 {
@@ -196,7 +200,7 @@ namespace SA::UT::AABB3
 			Vec3T(TypeParam{ 30.25 }, TypeParam{ 10.0 }, TypeParam{ -1.2 })
 		);
 
-		EXPECT_TRUE(b0.IsColliding(b2));
+		EXPECT_FALSE(b0.IsColliding(b2));
 
 
 		// Collision Y only.
@@ -205,7 +209,7 @@ namespace SA::UT::AABB3
 			Vec3T(TypeParam{ 4.25 }, TypeParam{ 40.0 }, TypeParam{ -1.2 })
 		);
 
-		EXPECT_TRUE(b0.IsColliding(b3));
+		EXPECT_FALSE(b0.IsColliding(b3));
 		
 
 		// Collision Z only.
@@ -214,7 +218,16 @@ namespace SA::UT::AABB3
 			Vec3T(TypeParam{ 4.25 }, TypeParam{ 10.0 }, TypeParam{ 46.2 })
 		);
 
-		EXPECT_TRUE(b0.IsColliding(b4));
+		EXPECT_FALSE(b0.IsColliding(b4));
+
+
+		// Collision X Y only.
+		const AABB3DT b6(
+			Vec3T(TypeParam{ 7.23 }, TypeParam{ 37.24 }, TypeParam{ -2.41 }),
+			Vec3T(TypeParam{ 30.25 }, TypeParam{ 40.0 }, TypeParam{ -1.2 })
+		);
+
+		EXPECT_FALSE(b0.IsColliding(b6));
 
 
 		// Collision X Y Z.
@@ -224,6 +237,15 @@ namespace SA::UT::AABB3
 		);
 
 		EXPECT_TRUE(b0.IsColliding(b5));
+		EXPECT_TRUE(b5.IsColliding(b0));
+
+		// Touching faces.
+		const AABB3DT b7(
+			Vec3T(TypeParam{ 54.25 }, TypeParam{ 37.24 }, TypeParam{ 7.25 }),
+			Vec3T(TypeParam{ 60.0 }, TypeParam{ 40.0 }, TypeParam{ 46.2 })
+		);
+
+		EXPECT_TRUE(b0.IsColliding(b7));
 	}
 
 	TYPED_TEST(AABB3DTest, Geometry)
@@ -259,4 +281,129 @@ namespace SA::UT::AABB3
 		EXPECT_EQ(merged.max, Vec3T(TypeParam{ 12 }, TypeParam{ 15 }, TypeParam{ 70 }));
 		EXPECT_EQ(cmerged, merged);
 	}
-}
\ No newline at end of file
+
+	template <typename T>
+	static Mat4<T> MakeTransformMatrix(std::mt19937& _gen)
+	{
+		std::uniform_real_distribution<T> pos(T(-10), T(10));
+		std::uniform_real_distribution<T> scale(T(0.2), T(3));
+		std::uniform_real_distribution<T> dir(T(-1), T(1));
+		std::uniform_real_distribution<T> angle(T(0), T(360));
+
+		const Vec3<T> axis = Vec3<T>(dir(_gen), dir(_gen), dir(_gen) + T(2)).GetNormalized();
+
+		// Non-uniform scale, then rotation: rotated and sheared box.
+		const TrPRS<T> tr{ Vec3<T>(pos(_gen), pos(_gen), pos(_gen)), Quat<T>(Deg<T>(angle(_gen)), axis),
+			Vec3<T>(scale(_gen), scale(_gen), scale(_gen)) };
+
+		return tr.Matrix();
+	}
+
+	template <typename T>
+	static AABB3D<T> MakeBox(std::mt19937& _gen)
+	{
+		std::uniform_real_distribution<T> pos(T(-5), T(5));
+		std::uniform_real_distribution<T> ext(T(0), T(4));
+
+		const Vec3<T> center(pos(_gen), pos(_gen), pos(_gen));
+		const Vec3<T> extents(ext(_gen), ext(_gen), ext(_gen));
+
+		return AABB3D<T>(center - extents, center + extents);
+	}
+
+	/// Reference: bounds of the 8 transformed corners.
+	template <typename T>
+	static AABB3D<T> TransformCorners(const AABB3D<T>& _box, const Mat4<T>& _mat)
+	{
+		AABB3D<T> out;
+		out.min = Vec3<T>(std::numeric_limits<T>::max());
+		out.max = Vec3<T>(std::numeric_limits<T>::lowest());
+
+		for (uint32_t c = 0u; c < 8u; ++c)
+		{
+			const Vec3<T> corner(c & 1u ? _box.max.x : _box.min.x, c & 2u ? _box.max.y : _box.min.y, c & 4u ? _box.max.z : _box.min.z);
+			const Vec3<T> p = Vec3<T>(_mat * Vec4<T>(corner, T(1)));
+
+			for (uint32_t k = 0u; k < 3u; ++k)
+			{
+				out.min[k] = std::min(out.min[k], p[k]);
+				out.max[k] = std::max(out.max[k], p[k]);
+			}
+		}
+
+		return out;
+	}
+
+	TYPED_TEST(AABB3DTest, Transform)
+	{
+		using T = TypeParam;
+
+		// Translation and scale only: exact.
+		const AABB3DT b0(Vec3T(T(1), T(-2), T(3)), Vec3T(T(2), T(4), T(5)));
+		const Mat4<T> trs = Mat4<T>::MakeTranslation(Vec3T(T(1), T(2), T(3))) * Mat4<T>::MakeScale(Vec3T(T(2), T(-1), T(0.5)));
+
+		const AABB3DT b0Out = b0.Transform(trs);
+		EXPECT_VEC3_NEAR(b0Out.min, Vec3T(T(3), T(-2), T(4.5)), T(1e-5));
+		EXPECT_VEC3_NEAR(b0Out.max, Vec3T(T(5), T(4), T(5.5)), T(1e-5));
+
+		// Rotation: same bounds as the 8 transformed corners, for both majors.
+		std::mt19937 gen(31u);
+
+		for (uint32_t i = 0u; i < 20u; ++i)
+		{
+			const AABB3DT box = MakeBox<T>(gen);
+			const Mat4<T> mat = MakeTransformMatrix<T>(gen);
+			const Mat4<T, MatrixMajor::Column> cmat(mat);
+
+			const AABB3DT ref = TransformCorners(box, mat);
+
+			EXPECT_AABB3D_NEAR(box.Transform(mat), ref, T(1e-4));
+			EXPECT_AABB3D_NEAR(box.Transform(cmat), ref, T(1e-4));
+		}
+	}
+
+	template <typename T, MatrixMajor major>
+	static void TestTransformBatch()
+	{
+		// Odd number: SIMD tail.
+		constexpr uint32_t num = 13u;
+
+		std::mt19937 gen(47u);
+
+		std::vector<AABB3D<T>> boxes(num);
+		std::vector<Mat4<T, major>> mats(num);
+
+		for (uint32_t i = 0u; i < num; ++i)
+		{
+			boxes[i] = MakeBox<T>(gen);
+			mats[i] = Mat4<T, major>(MakeTransformMatrix<T>(gen));
+		}
+
+		std::vector<AABB3D<T>> out(num);
+
+		// Single matrix.
+		AABB3D<T>::TransformBatch(mats[0], boxes.data(), out.data(), num);
+
+		for (uint32_t i = 0u; i < num; ++i)
+			EXPECT_AABB3D_NEAR(out[i], boxes[i].Transform(mats[0]), T(1e-4));
+
+		// One matrix per box.
+		AABB3D<T>::TransformBatch(mats.data(), boxes.data(), out.data(), num);
+
+		for (uint32_t i = 0u; i < num; ++i)
+			EXPECT_AABB3D_NEAR(out[i], boxes[i].Transform(mats[i]), T(1e-4));
+
+		// In place.
+		std::vector<AABB3D<T>> inPlace = boxes;
+		AABB3D<T>::TransformBatch(mats.data(), inPlace.data(), inPlace.data(), num);
+
+		for (uint32_t i = 0u; i < num; ++i)
+			EXPECT_AABB3D_NEAR(inPlace[i], out[i], T(1e-6));
+	}
+
+	TYPED_TEST(AABB3DTest, TransformBatch)
+	{
+		TestTransformBatch<TypeParam, MatrixMajor::Row>();
+		TestTransformBatch<TypeParam, MatrixMajor::Column>();
+	}
+}
@@ -5,6 +5,9 @@
 #ifndef SAPPHIRE_MATHS_AABB3D_TESTS_GUARD
 #define SAPPHIRE_MATHS_AABB3D_TESTS_GUARD
 
+#include <random>
+#include <vector>
+
 #include "../Space/Vector3Tests.hpp"
 
 #include <SA/Maths/Geometry/AABB3D.hpp>
@@ -34,10 +37,45 @@ namespace SA
 #define EXPECT_AABB3D_NEAR(_aabb1, _aabb2, eps)\
 {\
 	auto aabb1V = (_aabb1);\
-	auto aabb2V = (_aabb1);\
+	auto aabb2V = (_aabb2);\
 \
 	EXPECT_VEC3_NEAR(aabb1V.min, aabb2V.min, eps);\
 	EXPECT_VEC3_NEAR(aabb1V.max, aabb2V.max, eps);\
 }
 
+
+namespace SA::UT
+{
+	/**
+	*	Random box from generator _gen.
+	*	min in [-_posRange, _posRange]^3, extent in [0.1, _extRange] on each axis.
+	*/
+	template <typename T>
+	AABB3D<T> MakeRandomBox(std::mt19937& _gen, T _posRange, T _extRange)
+	{
+		std::uniform_real_distribution<T> pos(-_posRange, _posRange);
+		std::uniform_real_distribution<T> ext(T(0.1), _extRange);
+
+		AABB3D<T> box;
+		box.min = Vec3<T>(pos(_gen), pos(_gen), pos(_gen));
+		box.max = box.min + Vec3<T>(ext(_gen), ext(_gen), ext(_gen));
+
+		return box;
+	}
+
+	/// Deterministic random boxes, see MakeRandomBox().
+	template <typename T>
+	std::vector<AABB3D<T>> MakeRandomBoxes(uint32_t _num, uint32_t _seed, T _posRange, T _extRange)
+	{
+		std::mt19937 gen(_seed);
+
+		std::vector<AABB3D<T>> boxes(_num);
+
+		for (auto& box : boxes)
+			box = MakeRandomBox(gen, _posRange, _extRange);
+
+		return boxes;
+	}
+}
+
 #endif // GUARD
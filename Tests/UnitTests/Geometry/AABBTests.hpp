@@ -0,0 +1,44 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_AABB_TESTS_GUARD
+#define SAPPHIRE_MATHS_AABB_TESTS_GUARD
+
+#include <random>
+#include <vector>
+
+#include "AABB2DTests.hpp"
+#include "AABB3DTests.hpp"
+
+#include <SA/Maths/Geometry/AABBTraits.hpp>
+
+namespace SA::UT
+{
+	/**
+	*	Deterministic random AABB2D / AABB3D boxes.
+	*	min in [-_posRange, _posRange] and extent in [_extMin, _extMax] on each axis.
+	*/
+	template <typename AABBT, typename T = typename Intl::AABBTraits<AABBT>::Type>
+	std::vector<AABBT> MakeRandomAABBs(uint32_t _num, uint32_t _seed, T _posRange, T _extMin, T _extMax)
+	{
+		std::mt19937 gen(_seed);
+		std::uniform_real_distribution<T> pos(-_posRange, _posRange);
+		std::uniform_real_distribution<T> ext(_extMin, _extMax);
+
+		std::vector<AABBT> boxes(_num);
+
+		for (auto& box : boxes)
+		{
+			for (uint32_t a = 0u; a < Intl::AABBTraits<AABBT>::Dim; ++a)
+			{
+				box.min[a] = pos(gen);
+				box.max[a] = box.min[a] + ext(gen);
+			}
+		}
+
+		return boxes;
+	}
+}
+
+#endif // GUARD
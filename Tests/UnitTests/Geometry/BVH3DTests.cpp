@@ -0,0 +1,274 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/BVH3D.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::BVH3
+{
+	template <typename T>
+	class BVH3DTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(BVH3DTest, TestTypes);
+
+	template <typename T>
+	static bool BruteOverlap(const AABB3D<T>& _lhs, const AABB3D<T>& _rhs)
+	{
+		return _lhs.IsCollidingX(_rhs) && _lhs.IsCollidingY(_rhs) && _lhs.IsCollidingZ(_rhs);
+	}
+
+	/// Reference slab test.
+	template <typename T>
+	static bool BruteRay(const AABB3D<T>& _box, const Vec3<T>& _origin, const Vec3<T>& _dir, T _maxDist, T& _tEntry)
+	{
+		T tMin = T(0);
+		T tMax = _maxDist;
+
+		for (uint32_t a = 0u; a < 3u; ++a)
+		{
+			const T t1 = (_box.min[a] - _origin[a]) / _dir[a];
+			const T t2 = (_box.max[a] - _origin[a]) / _dir[a];
+
+			tMin = std::max(tMin, std::min(t1, t2));
+			tMax = std::min(tMax, std::max(t1, t2));
+		}
+
+		_tEntry = tMin;
+
+		return tMin <= tMax;
+	}
+
+	/// Every leaf bounds its boxes and every inner node bounds its children.
+	template <typename T>
+	static void ExpectValidTree(const BVH3D<T>& _bvh)
+	{
+		const auto& nodes = _bvh.GetNodes();
+		uint32_t primNum = 0u;
+
+		auto contains = [](const AABB3D<T>& _outer, const AABB3D<T>& _inner)
+		{
+			return _outer.min.x <= _inner.min.x && _outer.min.y <= _inner.min.y && _outer.min.z <= _inner.min.z &&
+				_outer.max.x >= _inner.max.x && _outer.max.y >= _inner.max.y && _outer.max.z >= _inner.max.z;
+		};
+
+		for (uint32_t i = 0; i < nodes.size(); ++i)
+		{
+			const auto& node = nodes[i];
+
+			if (node.IsLeaf())
+			{
+				for (uint32_t j = node.offset; j < node.offset + node.count; ++j)
+					EXPECT_TRUE(contains(node.bounds, _bvh.GetBoxes()[j]));
+
+				primNum += node.count;
+				continue;
+			}
+
+			ASSERT_LT(i + 1u, nodes.size());
+			ASSERT_LT(node.offset, nodes.size());
+			EXPECT_GT(node.offset, i + 1u);
+
+			EXPECT_TRUE(contains(node.bounds, nodes[i + 1u].bounds));
+			EXPECT_TRUE(contains(node.bounds, nodes[node.offset].bounds));
+		}
+
+		EXPECT_EQ(primNum, _bvh.Size());
+	}
+
+
+	TYPED_TEST(BVH3DTest, Build)
+	{
+		using T = TypeParam;
+
+		BVH3D<T> bvh;
+		EXPECT_TRUE(bvh.IsEmpty());
+
+		bvh.Build(nullptr, 0u);
+		EXPECT_TRUE(bvh.IsEmpty());
+		EXPECT_TRUE(bvh.GetNodes().empty());
+
+		const std::vector<AABB3D<T>> boxes = MakeRandomBoxes<T>(1000u, 42u, T(100), T(10));
+		bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		EXPECT_EQ(bvh.Size(), 1000u);
+
+		// Leaf order boxes match build input through indices.
+		for (uint32_t i = 0; i < bvh.Size(); ++i)
+			EXPECT_EQ(bvh.GetBoxes()[i], boxes[bvh.GetIndices()[i]]);
+
+		EXPECT_LT(bvh.GetNodes().size(), 2u * boxes.size());
+
+		ExpectValidTree(bvh);
+
+		// Single box: root is leaf.
+		bvh.Build(boxes.data(), 1u);
+		ASSERT_EQ(bvh.GetNodes().size(), 1u);
+		EXPECT_TRUE(bvh.GetNodes()[0].IsLeaf());
+		EXPECT_EQ(bvh.GetNodes()[0].bounds, boxes[0]);
+
+		bvh.Clear();
+		EXPECT_TRUE(bvh.IsEmpty());
+	}
+
+	TYPED_TEST(BVH3DTest, BuildDegenerate)
+	{
+		using T = TypeParam;
+
+		// All centroids at the same place: SAH has no valid split.
+		const std::vector<AABB3D<T>> boxes(100u, AABB3D<T>(Vec3<T>(T(-1)), Vec3<T>(T(1))));
+
+		BVH3D<T> bvh;
+		bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()), 1u);
+
+		ExpectValidTree(bvh);
+
+		std::vector<uint32_t> result;
+		bvh.QueryPoint(Vec3<T>::Zero, result);
+
+		EXPECT_EQ(result.size(), boxes.size());
+	}
+
+	TYPED_TEST(BVH3DTest, QueryOverlap)
+	{
+		using T = TypeParam;
+
+		const std::vector<AABB3D<T>> boxes = MakeRandomBoxes<T>(1000u, 42u, T(100), T(10));
+		const std::vector<AABB3D<T>> queries = MakeRandomBoxes<T>(100u, 7u, T(100), T(10));
+
+		BVH3D<T> bvh;
+		bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		std::vector<uint32_t> result;
+		std::vector<uint32_t> expected;
+
+		for (const auto& query : queries)
+		{
+			result.clear();
+			expected.clear();
+
+			bvh.QueryOverlap(query, result);
+
+			for (uint32_t i = 0; i < boxes.size(); ++i)
+			{
+				if (BruteOverlap(boxes[i], query))
+					expected.push_back(i);
+			}
+
+			std::sort(result.begin(), result.end());
+			EXPECT_EQ(result, expected);
+		}
+
+		// Everything.
+		result.clear();
+		bvh.QueryOverlap(AABB3D<T>(Vec3<T>(T(-200)), Vec3<T>(T(200))), result);
+		EXPECT_EQ(result.size(), boxes.size());
+
+		// Nothing.
+		result.clear();
+		bvh.QueryOverlap(AABB3D<T>(Vec3<T>(T(500)), Vec3<T>(T(600))), result);
+		EXPECT_TRUE(result.empty());
+	}
+
+	TYPED_TEST(BVH3DTest, QueryPoint)
+	{
+		using T = TypeParam;
+
+		const std::vector<AABB3D<T>> boxes = MakeRandomBoxes<T>(1000u, 42u, T(100), T(10));
+
+		BVH3D<T> bvh;
+		bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		// Random points: min corner of random boxes.
+		const std::vector<AABB3D<T>> pointBoxes = MakeRandomBoxes<T>(200u, 3u, T(100), T(10));
+
+		std::vector<uint32_t> result;
+		std::vector<uint32_t> expected;
+
+		for (uint32_t q = 0; q < 200u; ++q)
+		{
+			// Half of the points inside a known box.
+			const Vec3<T> point = q % 2 ? (boxes[q].min + boxes[q].max) * T(0.5) : pointBoxes[q].min;
+
+			result.clear();
+			expected.clear();
+
+			bvh.QueryPoint(point, result);
+
+			for (uint32_t i = 0; i < boxes.size(); ++i)
+			{
+				if (BruteOverlap(boxes[i], AABB3D<T>(point, point)))
+					expected.push_back(i);
+			}
+
+			std::sort(result.begin(), result.end());
+			EXPECT_EQ(result, expected);
+		}
+	}
+
+	TYPED_TEST(BVH3DTest, QueryRay)
+	{
+		using T = TypeParam;
+
+		const std::vector<AABB3D<T>> boxes = MakeRandomBoxes<T>(1000u, 42u, T(100), T(10));
+
+		BVH3D<T> bvh;
+		bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		std::mt19937 gen(5u);
+		std::uniform_real_distribution<T> pos(T(-120), T(120));
+
+		std::vector<uint32_t> result;
+		std::vector<uint32_t> expected;
+
+		for (uint32_t q = 0; q < 100u; ++q)
+		{
+			const Vec3<T> origin(pos(gen), pos(gen), pos(gen));
+			const Vec3<T> dir = (Vec3<T>(pos(gen), pos(gen), pos(gen)) - origin).GetNormalized();
+			const T maxDist = q % 2 ? T(50) : T(400);
+
+			result.clear();
+			expected.clear();
+
+			bvh.QueryRay(origin, dir, maxDist, [&result](uint32_t _index, T) { result.push_back(_index); });
+
+			T closestDist = std::numeric_limits<T>::max();
+			uint32_t closest = ~uint32_t(0);
+
+			for (uint32_t i = 0; i < boxes.size(); ++i)
+			{
+				T tEntry;
+
+				if (BruteRay(boxes[i], origin, dir, maxDist, tEntry))
+				{
+					expected.push_back(i);
+
+					if (tEntry < closestDist)
+					{
+						closestDist = tEntry;
+						closest = i;
+					}
+				}
+			}
+
+			std::sort(result.begin(), result.end());
+			EXPECT_EQ(result, expected);
+
+
+			T tEntry = T(0);
+			const uint32_t hit = bvh.RaycastClosest(origin, dir, maxDist, tEntry);
+
+			EXPECT_EQ(hit == ~uint32_t(0), closest == ~uint32_t(0));
+
+			// Boxes may share the same entry distance: compare distances.
+			if (closest != ~uint32_t(0))
+			{
+				EXPECT_NEAR(tEntry, closestDist, T(0.0001));
+			}
+		}
+	}
+}
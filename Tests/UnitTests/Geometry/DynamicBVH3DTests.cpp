@@ -0,0 +1,295 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/DynamicBVH3D.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::DynamicBVH3
+{
+	template <typename T>
+	class DynamicBVH3DTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(DynamicBVH3DTest, TestTypes);
+
+	template <typename T>
+	static bool Contains(const AABB3D<T>& _outer, const AABB3D<T>& _inner)
+	{
+		return _outer.min.x <= _inner.min.x && _outer.min.y <= _inner.min.y && _outer.min.z <= _inner.min.z &&
+			_outer.max.x >= _inner.max.x && _outer.max.y >= _inner.max.y && _outer.max.z >= _inner.max.z;
+	}
+
+	template <typename T>
+	static bool Overlap(const AABB3D<T>& _lhs, const AABB3D<T>& _rhs)
+	{
+		return _lhs.IsCollidingX(_rhs) && _lhs.IsCollidingY(_rhs) && _lhs.IsCollidingZ(_rhs);
+	}
+
+	/// Parent links, children bounds and leaf count.
+	template <typename T>
+	static void ExpectValidTree(const DynamicBVH3D<T>& _tree)
+	{
+		using Tree = DynamicBVH3D<T>;
+
+		const auto& nodes = _tree.GetNodes();
+
+		if (_tree.IsEmpty())
+		{
+			EXPECT_EQ(_tree.GetRoot(), Tree::NullNode);
+			return;
+		}
+
+		ASSERT_NE(_tree.GetRoot(), Tree::NullNode);
+		EXPECT_EQ(nodes[_tree.GetRoot()].parent, Tree::NullNode);
+
+		uint32_t leafNum = 0u;
+		std::vector<uint32_t> stack{ _tree.GetRoot() };
+
+		while (!stack.empty())
+		{
+			const uint32_t index = stack.back();
+			stack.pop_back();
+
+			const auto& node = nodes[index];
+
+			if (node.IsLeaf())
+			{
+				EXPECT_EQ(node.child2, Tree::NullNode);
+				++leafNum;
+				continue;
+			}
+
+			ASSERT_NE(node.child2, Tree::NullNode);
+
+			EXPECT_EQ(nodes[node.child1].parent, index);
+			EXPECT_EQ(nodes[node.child2].parent, index);
+
+			EXPECT_TRUE(Contains(node.box, nodes[node.child1].box));
+			EXPECT_TRUE(Contains(node.box, nodes[node.child2].box));
+
+			stack.push_back(node.child1);
+			stack.push_back(node.child2);
+		}
+
+		EXPECT_EQ(leafNum, _tree.Size());
+	}
+
+	/// Query results match brute force on fat boxes and include every true overlap.
+	template <typename T>
+	static void ExpectQueries(const DynamicBVH3D<T>& _tree, const std::vector<uint32_t>& _proxies,
+		const std::vector<AABB3D<T>>& _boxes, std::mt19937& _gen)
+	{
+		std::vector<uint32_t> result;
+		std::vector<uint32_t> expected;
+
+		for (uint32_t q = 0; q < 50u; ++q)
+		{
+			const AABB3D<T> query = MakeRandomBox<T>(_gen, T(100), T(5));
+
+			result.clear();
+			expected.clear();
+
+			_tree.QueryOverlap(query, result);
+
+			for (uint32_t i = 0; i < _proxies.size(); ++i)
+			{
+				if (Overlap(_tree.GetFatBox(_proxies[i]), query))
+					expected.push_back(_proxies[i]);
+
+				// Fat box contains real box: no false negative.
+				if (Overlap(_boxes[i], query))
+				{
+					EXPECT_TRUE(Overlap(_tree.GetFatBox(_proxies[i]), query));
+				}
+			}
+
+			std::sort(result.begin(), result.end());
+			std::sort(expected.begin(), expected.end());
+
+			EXPECT_EQ(result, expected);
+		}
+	}
+
+
+	TYPED_TEST(DynamicBVH3DTest, InsertRemove)
+	{
+		using T = TypeParam;
+
+		std::mt19937 gen(42u);
+
+		DynamicBVH3D<T> tree(T(0.5));
+		EXPECT_TRUE(tree.IsEmpty());
+		EXPECT_EQ(tree.GetMargin(), T(0.5));
+		EXPECT_EQ(tree.ComputeHeight(), 0u);
+
+		std::vector<uint32_t> proxies;
+		std::vector<AABB3D<T>> boxes;
+
+		for (uint32_t i = 0; i < 500u; ++i)
+		{
+			boxes.push_back(MakeRandomBox<T>(gen, T(100), T(5)));
+			proxies.push_back(tree.Insert(boxes.back()));
+
+			const AABB3D<T>& fat = tree.GetFatBox(proxies.back());
+			EXPECT_VEC3_NEAR(fat.min, boxes.back().min - Vec3<T>(T(0.5)), T(0.0001));
+			EXPECT_VEC3_NEAR(fat.max, boxes.back().max + Vec3<T>(T(0.5)), T(0.0001));
+		}
+
+		EXPECT_EQ(tree.Size(), 500u);
+		EXPECT_GT(tree.ComputeHeight(), 1u);
+
+		ExpectValidTree(tree);
+		ExpectQueries(tree, proxies, boxes, gen);
+
+
+		// Remove half.
+		for (uint32_t i = 0; i < 250u; ++i)
+		{
+			tree.Remove(proxies.back());
+
+			proxies.pop_back();
+			boxes.pop_back();
+		}
+
+		EXPECT_EQ(tree.Size(), 250u);
+
+		ExpectValidTree(tree);
+		ExpectQueries(tree, proxies, boxes, gen);
+
+
+		// Reinsert: reuse free nodes.
+		const size_t nodeNum = tree.GetNodes().size();
+
+		for (uint32_t i = 0; i < 250u; ++i)
+		{
+			boxes.push_back(MakeRandomBox<T>(gen, T(100), T(5)));
+			proxies.push_back(tree.Insert(boxes.back()));
+		}
+
+		EXPECT_EQ(tree.GetNodes().size(), nodeNum);
+
+		ExpectValidTree(tree);
+		ExpectQueries(tree, proxies, boxes, gen);
+
+
+		// Remove all.
+		for (auto proxy : proxies)
+			tree.Remove(proxy);
+
+		EXPECT_TRUE(tree.IsEmpty());
+		ExpectValidTree(tree);
+
+		tree.Clear();
+		EXPECT_TRUE(tree.GetNodes().empty());
+	}
+
+	TYPED_TEST(DynamicBVH3DTest, Move)
+	{
+		using T = TypeParam;
+
+		std::mt19937 gen(7u);
+		std::uniform_real_distribution<T> step(T(-0.2), T(0.2));
+
+		DynamicBVH3D<T> tree(T(0.5));
+
+		std::vector<uint32_t> proxies;
+		std::vector<AABB3D<T>> boxes;
+
+		for (uint32_t i = 0; i < 500u; ++i)
+		{
+			boxes.push_back(MakeRandomBox<T>(gen, T(100), T(5)));
+			proxies.push_back(tree.Insert(boxes.back()));
+		}
+
+		// Small move: inside fat box.
+		{
+			const Vec3<T> d(T(0.25), T(-0.25), T(0));
+			boxes[0].min += d;
+			boxes[0].max += d;
+
+			EXPECT_FALSE(tree.Move(proxies[0], boxes[0]));
+		}
+
+		// Large move: reinsertion.
+		{
+			boxes[1] = MakeRandomBox<T>(gen, T(100), T(5));
+			boxes[1].min += Vec3<T>(T(300));
+			boxes[1].max += Vec3<T>(T(300));
+
+			EXPECT_TRUE(tree.Move(proxies[1], boxes[1]));
+			EXPECT_TRUE(Contains(tree.GetFatBox(proxies[1]), boxes[1]));
+		}
+
+		// Frames.
+		for (uint32_t frame = 0; frame < 20u; ++frame)
+		{
+			for (uint32_t i = 0; i < boxes.size(); ++i)
+			{
+				const Vec3<T> d(step(gen), step(gen), step(gen));
+
+				boxes[i].min += d;
+				boxes[i].max += d;
+
+				tree.Move(proxies[i], boxes[i], d);
+
+				ASSERT_TRUE(Contains(tree.GetFatBox(proxies[i]), boxes[i]));
+			}
+
+			ExpectValidTree(tree);
+		}
+
+		ExpectQueries(tree, proxies, boxes, gen);
+	}
+
+	TYPED_TEST(DynamicBVH3DTest, RefitOptimize)
+	{
+		using T = TypeParam;
+
+		std::mt19937 gen(3u);
+		std::uniform_real_distribution<T> step(T(-1), T(1));
+
+		DynamicBVH3D<T> tree(T(0.1));
+
+		std::vector<uint32_t> proxies;
+		std::vector<AABB3D<T>> boxes;
+
+		for (uint32_t i = 0; i < 500u; ++i)
+		{
+			boxes.push_back(MakeRandomBox<T>(gen, T(100), T(5)));
+			proxies.push_back(tree.Insert(boxes.back()));
+		}
+
+		// Large moves with refit only: tree stays valid but degrades.
+		for (uint32_t frame = 0; frame < 20u; ++frame)
+		{
+			for (uint32_t i = 0; i < boxes.size(); ++i)
+			{
+				const Vec3<T> d(step(gen), step(gen), step(gen));
+
+				boxes[i].min += d;
+				boxes[i].max += d;
+
+				tree.Refit(proxies[i], boxes[i]);
+
+				ASSERT_TRUE(Contains(tree.GetFatBox(proxies[i]), boxes[i]));
+			}
+		}
+
+		ExpectValidTree(tree);
+		ExpectQueries(tree, proxies, boxes, gen);
+
+		// Rotations only decrease SAH cost.
+		const T ratio = tree.ComputeAreaRatio();
+
+		tree.Optimize(static_cast<uint32_t>(tree.GetNodes().size()) * 4u);
+
+		EXPECT_LE(tree.ComputeAreaRatio(), ratio);
+
+		ExpectValidTree(tree);
+		ExpectQueries(tree, proxies, boxes, gen);
+	}
+}
@@ -0,0 +1,225 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/Frustum.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::FrustumCulling
+{
+	template <typename T>
+	class FrustumTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(FrustumTest, TestTypes);
+
+	/// Camera at (0, 0, -10) looking at +Z, fov 90, far 30.
+	template <typename T, MatrixMajor major = MatrixMajor::Default>
+	static Mat4<T, major> MakeViewProj()
+	{
+		const Mat4<T, major> view = Mat4<T, major>::MakeLookAt(Vec3<T>(0, 0, -10), Vec3<T>(0, 0, 0), Vec3<T>(0, 1, 0));
+		const Mat4<T, major> proj = Mat4<T, major>::MakePerspective(T(90), T(1), T(1), T(30));
+
+		return proj * view;
+	}
+
+	template <typename T>
+	static bool IsInside(const Frustum<T>& _frustum, const Vec3<T>& _point)
+	{
+		for (uint32_t i = 0u; i < Frustum<T>::PlaneNum; ++i)
+		{
+			const Vec4<T>& plane = _frustum.GetPlane(i);
+
+			if (plane.x * _point.x + plane.y * _point.y + plane.z * _point.z + plane.w < T(0))
+				return false;
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	static std::vector<Vec4<T>> MakeSpheres(uint32_t _num, uint32_t _seed)
+	{
+		std::mt19937 gen(_seed);
+		std::uniform_real_distribution<T> pos(T(-40), T(40));
+		std::uniform_real_distribution<T> radius(T(0.1), T(6));
+
+		std::vector<Vec4<T>> spheres(_num);
+
+		for (auto& sphere : spheres)
+			sphere = Vec4<T>(pos(gen), pos(gen), pos(gen), radius(gen));
+
+		return spheres;
+	}
+
+
+	TYPED_TEST(FrustumTest, Planes)
+	{
+		using T = TypeParam;
+
+		const Frustum<T> rFrustum(MakeViewProj<T, MatrixMajor::Row>());
+		const Frustum<T> cFrustum(MakeViewProj<T, MatrixMajor::Column>());
+
+		// Same planes for both majors.
+		for (uint32_t i = 0u; i < Frustum<T>::PlaneNum; ++i)
+			EXPECT_EQ(rFrustum.GetPlane(i), cFrustum.GetPlane(i));
+
+		// Near plane: z = -9 facing +Z. Far plane: z = 20 facing -Z.
+		EXPECT_NEAR(rFrustum.GetPlane(Frustum<T>::Near).z, T(1), T(1e-5));
+		EXPECT_NEAR(rFrustum.GetPlane(Frustum<T>::Near).w, T(9), T(1e-4));
+		EXPECT_NEAR(rFrustum.GetPlane(Frustum<T>::Far).z, T(-1), T(1e-5));
+		EXPECT_NEAR(rFrustum.GetPlane(Frustum<T>::Far).w, T(20), T(1e-4));
+
+		// Corners: fov 90 -> half size = distance to camera.
+		EXPECT_NEAR(rFrustum.GetCorner(0).x, T(-1), T(1e-4));
+		EXPECT_NEAR(rFrustum.GetCorner(0).y, T(-1), T(1e-4));
+		EXPECT_NEAR(rFrustum.GetCorner(0).z, T(-9), T(1e-4));
+
+		EXPECT_NEAR(rFrustum.GetCorner(7).x, T(30), T(1e-3));
+		EXPECT_NEAR(rFrustum.GetCorner(7).y, T(30), T(1e-3));
+		EXPECT_NEAR(rFrustum.GetCorner(7).z, T(20), T(1e-3));
+
+		// Default: identity clip volume.
+		const Frustum<T> identity;
+		EXPECT_NEAR(identity.GetCorner(0).x, T(-1), T(1e-6));
+		EXPECT_NEAR(identity.GetCorner(7).z, T(1), T(1e-6));
+	}
+
+	TYPED_TEST(FrustumTest, IsVisible)
+	{
+		using T = TypeParam;
+
+		const Frustum<T> frustum(MakeViewProj<T>());
+
+		// Inside, outside, crossing near plane.
+		EXPECT_TRUE(frustum.IsVisible(AABB3D<T>(Vec3<T>(-1), Vec3<T>(1))));
+		EXPECT_FALSE(frustum.IsVisible(AABB3D<T>(Vec3<T>(50, 0, 0), Vec3<T>(51, 1, 1))));
+		EXPECT_TRUE(frustum.IsVisible(AABB3D<T>(Vec3<T>(-0.5, -0.5, -12), Vec3<T>(0.5, 0.5, -8))));
+
+		EXPECT_TRUE(frustum.IsVisible(Vec3<T>(0, 0, 0), T(1)));
+		EXPECT_FALSE(frustum.IsVisible(Vec3<T>(0, 0, 25), T(1)));
+		EXPECT_TRUE(frustum.IsVisible(Vec3<T>(0, 0, 25), T(6)));
+
+		// Outside left-far edge (x = -30, z = 20), crossing both planes: only exact test culls it.
+		const AABB3D<T> cornerBox(Vec3<T>(-32.5, -1, 19), Vec3<T>(-30.5, 1, 23));
+
+		EXPECT_TRUE(frustum.IsVisible(cornerBox, FrustumCull::Conservative));
+		EXPECT_FALSE(frustum.IsVisible(cornerBox, FrustumCull::Exact));
+
+		const Vec3<T> cornerCenter(-31.848, 0, 20.766);
+		const T cornerRadius = T(1.5);
+
+		EXPECT_TRUE(frustum.IsVisible(cornerCenter, cornerRadius, FrustumCull::Conservative));
+		EXPECT_FALSE(frustum.IsVisible(cornerCenter, cornerRadius, FrustumCull::Exact));
+
+		// Touching corner.
+		EXPECT_TRUE(frustum.IsVisible(frustum.GetCorner(0) - Vec3<T>(1), T(1.75), FrustumCull::Exact));
+	}
+
+	TYPED_TEST(FrustumTest, CullAABBs)
+	{
+		using T = TypeParam;
+
+		const Frustum<T> frustum(MakeViewProj<T>());
+		const auto boxes = MakeRandomBoxes<T>(2500u, 1u, T(40), T(8));
+
+		const uint32_t num = static_cast<uint32_t>(boxes.size());
+
+		std::vector<uint32_t> conservative((num + 31u) / 32u, ~0u);
+		std::vector<uint32_t> exact((num + 31u) / 32u, ~0u);
+
+		frustum.CullAABBs(boxes.data(), num, conservative.data(), FrustumCull::Conservative);
+		frustum.CullAABBs(boxes.data(), num, exact.data(), FrustumCull::Exact);
+
+		// Unused bits cleared.
+		EXPECT_EQ(conservative.back() >> (num % 32u), 0u);
+
+		uint32_t conservativeNum = 0u;
+		uint32_t exactNum = 0u;
+
+		for (uint32_t i = 0u; i < num; ++i)
+		{
+			const bool bConservative = (conservative[i / 32u] >> (i % 32u)) & 1u;
+			const bool bExact = (exact[i / 32u] >> (i % 32u)) & 1u;
+
+			EXPECT_EQ(bConservative, frustum.IsVisible(boxes[i], FrustumCull::Conservative));
+			EXPECT_EQ(bExact, frustum.IsVisible(boxes[i], FrustumCull::Exact));
+
+			// Exact is a subset of conservative.
+			EXPECT_TRUE(bConservative || !bExact);
+
+			conservativeNum += bConservative;
+			exactNum += bExact;
+
+			// Never cull a box containing a point inside the frustum.
+			bool bSampleInside = false;
+
+			for (uint32_t s = 0u; s < 125u && !bSampleInside; ++s)
+			{
+				const Vec3<T> f(T(s % 5u) / T(4), T((s / 5u) % 5u) / T(4), T(s / 25u) / T(4));
+				bSampleInside = IsInside(frustum, boxes[i].min + (boxes[i].max - boxes[i].min) * f);
+			}
+
+			if (bSampleInside)
+			{
+				EXPECT_TRUE(bExact);
+			}
+		}
+
+		EXPECT_LT(exactNum, conservativeNum);
+	}
+
+	TYPED_TEST(FrustumTest, CullSpheres)
+	{
+		using T = TypeParam;
+
+		const Frustum<T> frustum(MakeViewProj<T>());
+		const auto spheres = MakeSpheres<T>(2500u, 2u);
+
+		const uint32_t num = static_cast<uint32_t>(spheres.size());
+
+		std::vector<uint32_t> conservative((num + 31u) / 32u);
+		std::vector<uint32_t> exact((num + 31u) / 32u);
+
+		frustum.CullSpheres(spheres.data(), num, conservative.data(), FrustumCull::Conservative);
+		frustum.CullSpheres(spheres.data(), num, exact.data(), FrustumCull::Exact);
+
+		uint32_t conservativeNum = 0u;
+		uint32_t exactNum = 0u;
+
+		for (uint32_t i = 0u; i < num; ++i)
+		{
+			const Vec3<T> center(spheres[i].x, spheres[i].y, spheres[i].z);
+
+			const bool bConservative = (conservative[i / 32u] >> (i % 32u)) & 1u;
+			const bool bExact = (exact[i / 32u] >> (i % 32u)) & 1u;
+
+			EXPECT_EQ(bConservative, frustum.IsVisible(center, spheres[i].w, FrustumCull::Conservative));
+			EXPECT_EQ(bExact, frustum.IsVisible(center, spheres[i].w, FrustumCull::Exact));
+
+			EXPECT_TRUE(bConservative || !bExact);
+
+			conservativeNum += bConservative;
+			exactNum += bExact;
+
+			// Never cull a sphere containing a point inside the frustum.
+			if (IsInside(frustum, center))
+			{
+				EXPECT_TRUE(bExact);
+			}
+
+			for (uint32_t c = 0u; c < Frustum<T>::CornerNum; ++c)
+			{
+				if ((frustum.GetCorner(c) - center).SqrLength() <= spheres[i].w * spheres[i].w)
+				{
+					EXPECT_TRUE(bExact);
+				}
+			}
+		}
+
+		EXPECT_LT(exactNum, conservativeNum);
+	}
+}
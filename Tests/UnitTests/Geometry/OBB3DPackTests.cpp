@@ -0,0 +1,91 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <SA/Maths/Geometry/OBB3DPack.hpp>
+
+#include "OBB3DTests.hpp"
+
+namespace SA::UT::OBBPacket
+{
+	template <typename T>
+	class OBB3DPackTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(OBB3DPackTest, TestTypes);
+
+	template <typename T, uint32_t N, typename QueryT>
+	static void ExpectOverlapMask(const std::vector<OBB3D<T>>& _boxes, const std::vector<QueryT>& _queries)
+	{
+		for (uint32_t i = 0; i < _boxes.size(); i += N)
+		{
+			const uint32_t num = std::min<uint32_t>(N, static_cast<uint32_t>(_boxes.size()) - i);
+			const OBB3DPack<T, N> pack(_boxes.data() + i, num);
+
+			for (const auto& query : _queries)
+			{
+				uint32_t expected = 0u;
+
+				for (uint32_t j = 0; j < num; ++j)
+					expected |= uint32_t(_boxes[i + j].IsColliding(query)) << j;
+
+				EXPECT_EQ(pack.OverlapMask(query), expected);
+			}
+		}
+	}
+
+
+	TYPED_TEST(OBB3DPackTest, Lanes)
+	{
+		using T = TypeParam;
+
+		const OBB3D<T> b0(Vec3T(T(1), T(2), T(3)), Quat<T>(Deg<T>(T(30)), Vec3T(T(0), T(1), T(0))), Vec3T(T(1), T(2), T(3)));
+		const OBB3D<T> b1(AABB3DT(Vec3T(T(-1), T(-2), T(-3)), Vec3T(T(0))));
+
+		OBB3DPack4<T> pack;
+
+		// Empty lanes never overlap.
+		const AABB3DT big(Vec3T(T(-1e6)), Vec3T(T(1e6)));
+		const OBB3D<T> bigOBB(Vec3T(T(0)), Quat<T>(Deg<T>(T(45)), Vec3T(T(1), T(0), T(0))), Vec3T(T(1e6)));
+
+		EXPECT_EQ(pack.OverlapMask(big), 0u);
+		EXPECT_EQ(pack.OverlapMask(bigOBB), 0u);
+
+		pack.Set(0u, b0);
+		pack.Set(2u, b1);
+
+		EXPECT_EQ(pack.Get(0u).center, b0.center);
+		EXPECT_EQ(pack.Get(0u).axes[1], b0.axes[1]);
+		EXPECT_EQ(pack.Get(2u).extents, b1.extents);
+		EXPECT_EQ(pack.OverlapMask(big), 0b0101u);
+		EXPECT_EQ(pack.OverlapMask(bigOBB), 0b0101u);
+
+		pack.SetEmpty(0u);
+		EXPECT_EQ(pack.OverlapMask(bigOBB), 0b0100u);
+
+		const OBB3D<T> boxes[] = { b0, b1, b0 };
+		const OBB3DPack8<T> pack8(boxes, 3u);
+
+		EXPECT_EQ(pack8.Get(1u).center, b1.center);
+		EXPECT_EQ(pack8.OverlapMask(big), 0b0111u);
+	}
+
+	TYPED_TEST(OBB3DPackTest, OverlapMaskRandom)
+	{
+		using T = TypeParam;
+
+		const auto boxes = MakeRandomOBBs<T>(203u, 1u, T(10), T(4));
+		const auto obbQueries = MakeRandomOBBs<T>(50u, 2u, T(10), T(4));
+
+		std::vector<AABB3D<T>> aabbQueries;
+
+		for (const auto& query : obbQueries)
+			aabbQueries.push_back(query.ComputeAABB());
+
+		ExpectOverlapMask<T, 4u>(boxes, obbQueries);
+		ExpectOverlapMask<T, 8u>(boxes, obbQueries);
+
+		ExpectOverlapMask<T, 4u>(boxes, aabbQueries);
+		ExpectOverlapMask<T, 8u>(boxes, aabbQueries);
+	}
+}
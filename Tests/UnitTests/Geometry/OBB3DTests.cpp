@@ -0,0 +1,229 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <SA/Maths/Geometry/OBB3D.hpp>
+
+#include "OBB3DTests.hpp"
+
+namespace SA::UT::OBB
+{
+	template <typename T>
+	class OBB3DTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(OBB3DTest, TestTypes);
+
+	/// Reference SAT: corners projection intervals on the 15 axes.
+	template <typename T>
+	static bool ReferenceIsColliding(const OBB3D<T>& _a, const OBB3D<T>& _b)
+	{
+		std::vector<Vec3<T>> axes;
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+		{
+			axes.push_back(_a.axes[i]);
+			axes.push_back(_b.axes[i]);
+
+			for (uint32_t j = 0u; j < 3u; ++j)
+			{
+				const Vec3<T> cross = Vec3<T>::Cross(_a.axes[i], _b.axes[j]);
+
+				if (cross.SqrLength() > T(1e-6))
+					axes.push_back(cross.GetNormalized());
+			}
+		}
+
+		for (const auto& axis : axes)
+		{
+			T minA = std::numeric_limits<T>::max(), maxA = std::numeric_limits<T>::lowest();
+			T minB = minA, maxB = maxA;
+
+			for (uint32_t c = 0u; c < OBB3D<T>::CornerNum; ++c)
+			{
+				const T projA = Vec3<T>::Dot(_a.GetCorner(c), axis);
+				const T projB = Vec3<T>::Dot(_b.GetCorner(c), axis);
+
+				minA = std::min(minA, projA);
+				maxA = std::max(maxA, projA);
+				minB = std::min(minB, projB);
+				maxB = std::max(maxB, projB);
+			}
+
+			if (maxA < minB || maxB < minA)
+				return false;
+		}
+
+		return true;
+	}
+
+
+	TYPED_TEST(OBB3DTest, Constructors)
+	{
+		using T = TypeParam;
+
+		const Quat<T> rotation(Deg<T>(T(30)), Vec3T(T(0), T(0), T(1)));
+		const Vec3T center(T(1), T(2), T(3));
+		const Vec3T extents(T(3), T(2), T(1));
+
+		const OBB3D<T> fromQuat(center, rotation, extents);
+		const OBB3D<T> fromRMat(center, Mat3<T, MatrixMajor::Row>::MakeRotation(rotation), extents);
+		const OBB3D<T> fromCMat(center, Mat3<T, MatrixMajor::Column>::MakeRotation(rotation), extents);
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+		{
+			EXPECT_VEC3_NEAR(fromQuat.axes[i], fromRMat.axes[i], T(1e-6));
+			EXPECT_VEC3_NEAR(fromQuat.axes[i], fromCMat.axes[i], T(1e-6));
+		}
+
+		EXPECT_VEC3_NEAR(fromQuat.axes[0], Vec3T(std::cos(T(0.5235987755982988)), std::sin(T(0.5235987755982988)), T(0)), T(1e-6));
+
+		const AABB3DT box(Vec3T(T(-1), T(0), T(2)), Vec3T(T(3), T(4), T(4)));
+		const OBB3D<T> fromAABB(box);
+
+		EXPECT_EQ(fromAABB.center, Vec3T(T(1), T(2), T(3)));
+		EXPECT_EQ(fromAABB.extents, Vec3T(T(2), T(2), T(1)));
+		EXPECT_EQ(fromAABB.ComputeAABB(), box);
+		EXPECT_EQ(fromAABB.GetCorner(0u), box.min);
+		EXPECT_EQ(fromAABB.GetCorner(7u), box.max);
+	}
+
+	TYPED_TEST(OBB3DTest, Geometry)
+	{
+		using T = TypeParam;
+
+		// Unit cube rotated 45 degrees around Z.
+		const OBB3D<T> box(Vec3T(T(0)), Quat<T>(Deg<T>(T(45)), Vec3T(T(0), T(0), T(1))), Vec3T(T(1)));
+
+		const T sqrt2 = std::sqrt(T(2));
+
+		const AABB3DT bounds = box.ComputeAABB();
+		EXPECT_VEC3_NEAR(bounds.min, Vec3T(-sqrt2, -sqrt2, T(-1)), T(1e-5));
+		EXPECT_VEC3_NEAR(bounds.max, Vec3T(sqrt2, sqrt2, T(1)), T(1e-5));
+
+		EXPECT_TRUE(box.Contains(Vec3T(T(1.4), T(0), T(0))));
+		EXPECT_FALSE(box.Contains(Vec3T(T(1), T(1), T(0))));
+
+		EXPECT_VEC3_NEAR(box.ClosestPoint(Vec3T(T(3), T(0), T(0))), Vec3T(sqrt2, T(0), T(0)), T(1e-5));
+		EXPECT_VEC3_NEAR(box.ClosestPoint(Vec3T(T(0.5), T(0), T(0))), Vec3T(T(0.5), T(0), T(0)), T(1e-6));
+
+		for (uint32_t c = 0u; c < OBB3D<T>::CornerNum; ++c)
+			EXPECT_NEAR(box.GetCorner(c).Length(), std::sqrt(T(3)), T(1e-5));
+	}
+
+	TYPED_TEST(OBB3DTest, IsColliding)
+	{
+		using T = TypeParam;
+
+		const T sqrt2 = std::sqrt(T(2));
+
+		const OBB3D<T> a(AABB3DT(Vec3T(T(-1)), Vec3T(T(1))));
+		const Quat<T> rotZ(Deg<T>(T(45)), Vec3T(T(0), T(0), T(1)));
+
+		// Face / vertex along X.
+		EXPECT_TRUE(a.IsColliding(OBB3D<T>(Vec3T(T(1) + sqrt2 - T(0.01), T(0), T(0)), rotZ, Vec3T(T(1)))));
+		EXPECT_FALSE(a.IsColliding(OBB3D<T>(Vec3T(T(1) + sqrt2 + T(0.01), T(0), T(0)), rotZ, Vec3T(T(1)))));
+
+		// Edge / edge: only separated by a cross product axis.
+		const Quat<T> rotX(Deg<T>(T(45)), Vec3T(T(1), T(0), T(0)));
+		const OBB3D<T> rotatedA(Vec3T(T(0)), rotZ, Vec3T(T(1)));
+		const T edgeDist = sqrt2 + sqrt2;
+
+		const Vec3T diag = Vec3T(T(1), T(1), T(0)).GetNormalized();
+
+		const OBB3D<T> closeB(diag * (edgeDist - T(0.01)) + Vec3T(T(0), T(0), T(0)), rotX, Vec3T(T(1)));
+		const OBB3D<T> farB(diag * (edgeDist + T(0.2)), rotX, Vec3T(T(1)));
+
+		EXPECT_EQ(rotatedA.IsColliding(closeB), ReferenceIsColliding(rotatedA, closeB));
+		EXPECT_EQ(rotatedA.IsColliding(farB), ReferenceIsColliding(rotatedA, farB));
+		EXPECT_FALSE(rotatedA.IsColliding(farB));
+
+		// Parallel boxes (null cross product axes).
+		EXPECT_TRUE(a.IsColliding(OBB3D<T>(AABB3DT(Vec3T(T(1)), Vec3T(T(2))))));
+		EXPECT_FALSE(a.IsColliding(OBB3D<T>(AABB3DT(Vec3T(T(1.01)), Vec3T(T(2))))));
+
+		// OBB / sphere.
+		EXPECT_TRUE(rotatedA.IsColliding(Sphere<T>(Vec3T(T(2), T(0), T(0)), T(0.6))));
+		EXPECT_FALSE(rotatedA.IsColliding(Sphere<T>(Vec3T(T(2), T(0), T(0)), T(0.5))));
+		EXPECT_TRUE(rotatedA.IsColliding(Sphere<T>(Vec3T(T(1.2), T(1.2), T(0)), T(0.7))));
+		EXPECT_FALSE(rotatedA.IsColliding(Sphere<T>(Vec3T(T(1.2), T(1.2), T(0)), T(0.69))));
+	}
+
+	TYPED_TEST(OBB3DTest, IsCollidingRandom)
+	{
+		using T = TypeParam;
+
+		const auto boxes = MakeRandomOBBs<T>(120u, 1u, T(6), T(4));
+
+		uint32_t collidingNum = 0u;
+
+		for (const auto& a : boxes)
+		{
+			for (const auto& b : boxes)
+			{
+				const bool bColliding = a.IsColliding(b);
+
+				EXPECT_EQ(bColliding, ReferenceIsColliding(a, b));
+				EXPECT_EQ(bColliding, b.IsColliding(a));
+
+				collidingNum += bColliding;
+
+				// OBB / AABB: same as OBB / OBB with world axes.
+				const AABB3DT bounds = b.ComputeAABB();
+
+				EXPECT_EQ(a.IsColliding(bounds), a.IsColliding(OBB3D<T>(bounds)));
+			}
+		}
+
+		// Mix of colliding and separated pairs.
+		EXPECT_GT(collidingNum, 120u * 120u / 10u);
+		EXPECT_LT(collidingNum, 120u * 120u * 9u / 10u);
+	}
+
+	TYPED_TEST(OBB3DTest, Transform)
+	{
+		using T = TypeParam;
+
+		const OBB3D<T> box(Vec3T(T(1), T(-2), T(0.5)), Quat<T>(Deg<T>(T(20)), Vec3T(T(1), T(0), T(0))), Vec3T(T(1), T(2), T(0.5)));
+		const Quat<T> rotation(Deg<T>(T(71)), Vec3T(T(1), T(2), T(3)).GetNormalized());
+
+		// Rotation + uniform scale: exact (corners are mapped to corners).
+		const TrPRUS<T> trUniform{ Vec3T(T(4), T(5), T(-6)), rotation, T(3) };
+		const OBB3D<T> outUniform = box.Transform(trUniform);
+		const OBB3D<T> outUniformMat = box.Transform(trUniform.Matrix());
+
+		EXPECT_VEC3_NEAR(outUniform.extents, box.extents * T(3), T(1e-4));
+		EXPECT_VEC3_NEAR(outUniformMat.extents, box.extents * T(3), T(1e-4));
+
+		const Mat4<T> uniformMat = trUniform.Matrix();
+
+		for (uint32_t c = 0u; c < OBB3D<T>::CornerNum; ++c)
+		{
+			const Vec3T corner = Vec3T(uniformMat * Vec4<T>(box.GetCorner(c), T(1)));
+
+			EXPECT_VEC3_NEAR(outUniform.GetCorner(c), corner, T(1e-4));
+			EXPECT_VEC3_NEAR(outUniformMat.GetCorner(c), corner, T(1e-4));
+		}
+
+		// Non-uniform scale (shear in box frame): transformed corners are contained.
+		const TrPRS<T> tr{ Vec3T(T(4), T(5), T(-6)), rotation, Vec3T(T(2), T(0.5), T(3)) };
+		const OBB3D<T> out = box.Transform(tr);
+		const OBB3D<T> outCMat = box.Transform(Mat4<T, MatrixMajor::Column>(tr.Matrix()));
+
+		const Mat4<T> mat = tr.Matrix();
+
+		for (uint32_t c = 0u; c < OBB3D<T>::CornerNum; ++c)
+		{
+			const Vec3T corner = Vec3T(mat * Vec4<T>(box.GetCorner(c), T(1)));
+
+			EXPECT_LE((out.ClosestPoint(corner) - corner).Length(), T(1e-4));
+			EXPECT_VEC3_NEAR(outCMat.GetCorner(c), out.GetCorner(c), T(1e-4));
+		}
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+		{
+			EXPECT_NEAR(out.axes[i].Length(), T(1), T(1e-5));
+			EXPECT_NEAR(Vec3T::Dot(out.axes[i], out.axes[(i + 1u) % 3u]), T(0), T(1e-5));
+		}
+	}
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_OBB3D_TESTS_GUARD
+#define SAPPHIRE_MATHS_OBB3D_TESTS_GUARD
+
+#include <random>
+#include <vector>
+
+#include "AABB3DTests.hpp"
+
+#include <SA/Maths/Geometry/OBB3D.hpp>
+
+namespace SA::UT
+{
+	/**
+	*	Deterministic random oriented boxes.
+	*	center in [-_posRange, _posRange]^3, half extent in [0.1, _extRange] on each axis, random rotation.
+	*/
+	template <typename T>
+	std::vector<OBB3D<T>> MakeRandomOBBs(uint32_t _num, uint32_t _seed, T _posRange, T _extRange)
+	{
+		std::mt19937 gen(_seed);
+		std::uniform_real_distribution<T> pos(-_posRange, _posRange);
+		std::uniform_real_distribution<T> ext(T(0.1), _extRange);
+		std::uniform_real_distribution<T> dir(T(-1), T(1));
+		std::uniform_real_distribution<T> angle(T(0), T(360));
+
+		std::vector<OBB3D<T>> boxes(_num);
+
+		for (auto& box : boxes)
+		{
+			const Vec3<T> axis = Vec3<T>(dir(gen), dir(gen), dir(gen) + T(2)).GetNormalized();
+
+			box = OBB3D<T>(Vec3<T>(pos(gen), pos(gen), pos(gen)), Quat<T>(Deg<T>(angle(gen)), axis),
+				Vec3<T>(ext(gen), ext(gen), ext(gen)));
+		}
+
+		return boxes;
+	}
+}
+
+#endif // GUARD
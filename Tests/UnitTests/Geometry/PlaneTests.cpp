@@ -0,0 +1,95 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <SA/Maths/Geometry/Plane.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::Plane3
+{
+	template <typename T>
+	class PlaneTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(PlaneTest, TestTypes);
+
+	TYPED_TEST(PlaneTest, Constructors)
+	{
+		using T = TypeParam;
+
+		const Plane<T> p0;
+		EXPECT_EQ(p0.normal, Vec3T(T(0), T(1), T(0)));
+		EXPECT_EQ(p0.d, T(0));
+
+		const Plane<T> p1 = Plane<T>::FromPoint(Vec3T(T(0), T(0), T(1)), Vec3T(T(4), T(-2), T(3)));
+		EXPECT_EQ(p1.d, T(-3));
+
+		const Plane<T> p2(Vec4<T>(T(1), T(0), T(0), T(2)));
+		EXPECT_EQ(p2.normal, Vec3T(T(1), T(0), T(0)));
+		EXPECT_EQ(p2.d, T(2));
+
+		// Counter-clockwise triangle in z = 5 plane: normal is +Z.
+		const Plane<T> p3 = Plane<T>::FromPoints(Vec3T(T(0), T(0), T(5)), Vec3T(T(1), T(0), T(5)), Vec3T(T(0), T(1), T(5)));
+		EXPECT_VEC3_NEAR(p3.normal, Vec3T(T(0), T(0), T(1)), T(1e-6));
+		EXPECT_NEAR(p3.d, T(-5), T(1e-5));
+	}
+
+	TYPED_TEST(PlaneTest, Distance)
+	{
+		using T = TypeParam;
+
+		const Plane<T> plane = Plane<T>::FromPoint(Vec3T(T(0), T(1), T(0)), Vec3T(T(0), T(2), T(0)));
+
+		EXPECT_EQ(plane.SignedDistance(Vec3T(T(3), T(5), T(-1))), T(3));
+		EXPECT_EQ(plane.SignedDistance(Vec3T(T(3), T(-1), T(-1))), T(-3));
+		EXPECT_EQ(plane.ClosestPoint(Vec3T(T(3), T(5), T(-1))), Vec3T(T(3), T(2), T(-1)));
+	}
+
+	TYPED_TEST(PlaneTest, IsColliding)
+	{
+		using T = TypeParam;
+
+		const Plane<T> plane = Plane<T>::FromPoint(Vec3T(T(1), T(1), T(0)).GetNormalized(), Vec3T(T(0)));
+
+		EXPECT_TRUE(plane.IsColliding(AABB3DT(Vec3T(T(-1)), Vec3T(T(1)))));
+		EXPECT_TRUE(plane.IsColliding(AABB3DT(Vec3T(T(0)), Vec3T(T(1)))));		// Touching corner.
+		EXPECT_FALSE(plane.IsColliding(AABB3DT(Vec3T(T(0.1)), Vec3T(T(1)))));
+		EXPECT_FALSE(plane.IsColliding(AABB3DT(Vec3T(T(-2)), Vec3T(T(-0.1)))));
+		EXPECT_TRUE(plane.IsColliding(AABB3DT(Vec3T(T(1), T(-3), T(0)), Vec3T(T(2), T(-1), T(1)))));
+	}
+
+	TYPED_TEST(PlaneTest, Transform)
+	{
+		using T = TypeParam;
+
+		const Plane<T> plane = Plane<T>::FromPoint(Vec3T(T(1), T(2), T(-1)).GetNormalized(), Vec3T(T(1), T(0), T(3)));
+
+		const TrPRS<T> tr{ Vec3T(T(4), T(-2), T(7)), Quat<T>(Deg<T>(T(37)), Vec3T(T(1), T(1), T(0)).GetNormalized()),
+			Vec3T(T(2), T(0.5), T(3)) };
+
+		const Mat4<T> mat = tr.Matrix();
+
+		const Plane<T> outTr = plane.Transform(tr);
+		const Plane<T> outMat = plane.Transform(mat);
+		const Plane<T> outCMat = plane.Transform(Mat4<T, MatrixMajor::Column>(mat));
+
+		EXPECT_VEC3_NEAR(outTr.normal, outMat.normal, T(1e-5));
+		EXPECT_NEAR(outTr.d, outMat.d, T(1e-4));
+		EXPECT_VEC3_NEAR(outCMat.normal, outMat.normal, T(1e-5));
+
+		// Points on plane stay on plane, sides are kept.
+		const Vec3T u = Vec3T::Cross(plane.normal, Vec3T(T(0), T(0), T(1))).GetNormalized();
+		const Vec3T v = Vec3T::Cross(plane.normal, u);
+
+		for (int32_t i = -2; i <= 2; ++i)
+		{
+			const Vec3T onPlane = plane.ClosestPoint(Vec3T(T(1), T(0), T(3))) + u * T(i) + v * T(i * i);
+
+			EXPECT_NEAR(outMat.SignedDistance(Vec3T(mat * Vec4<T>(onPlane, T(1)))), T(0), T(1e-4));
+		}
+
+		const Vec3T front = Vec3T(T(1), T(0), T(3)) + plane.normal;
+		EXPECT_GT(outMat.SignedDistance(Vec3T(mat * Vec4<T>(front, T(1)))), T(0));
+	}
+}
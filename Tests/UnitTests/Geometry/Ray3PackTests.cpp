@@ -0,0 +1,131 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/Ray3Pack.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::Ray3Packet
+{
+	template <typename T>
+	class Ray3PackTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(Ray3PackTest, TestTypes);
+
+	template <typename T>
+	static std::vector<SA::Ray3<T>> MakeRays(uint32_t _num, uint32_t _seed)
+	{
+		std::mt19937 gen(_seed);
+		std::uniform_real_distribution<T> pos(T(-20), T(20));
+		std::uniform_real_distribution<T> target(T(-5), T(5));
+
+		std::vector<SA::Ray3<T>> rays(_num);
+
+		for (uint32_t i = 0u; i < _num; ++i)
+		{
+			// Aim at the center of the primitives: many hits.
+			const Vec3<T> origin(pos(gen), pos(gen), pos(gen));
+			Vec3<T> d = Vec3<T>(target(gen), target(gen), target(gen)) - origin;
+
+			// Some axis aligned rays: infinite inverse direction.
+			if (i % 7u == 0u)
+				d[i % 3u] = T(0);
+
+			rays[i] = SA::Ray3<T>(origin, d * T(0.1));
+		}
+
+		return rays;
+	}
+
+	template <typename T, uint32_t N>
+	static void ExpectPacket(const std::vector<SA::Ray3<T>>& _rays, uint32_t _seed)
+	{
+		std::mt19937 gen(_seed);
+		std::uniform_real_distribution<T> pos(T(-10), T(10));
+
+		for (uint32_t i = 0; i < _rays.size(); i += N)
+		{
+			const uint32_t num = std::min<uint32_t>(N, static_cast<uint32_t>(_rays.size()) - i);
+			const Ray3Pack<T, N> pack(_rays.data() + i, num);
+
+			for (uint32_t k = 0u; k < 20u; ++k)
+			{
+				const AABB3D<T> box = MakeRandomBox<T>(gen, T(10), T(15));
+
+				const Vec3<T> v0(pos(gen), pos(gen), pos(gen));
+				const Vec3<T> v1 = v0 + Vec3<T>(pos(gen), pos(gen), pos(gen)) * T(2);
+				const Vec3<T> v2 = v0 + Vec3<T>(pos(gen), pos(gen), pos(gen)) * T(2);
+
+				T tEntries[N];
+				T tHits[N];
+
+				const uint32_t boxMask = pack.IntersectAABBMask(box, T(30), tEntries);
+				const uint32_t triMask = pack.IntersectTriangleMask(v0, v1, v2, T(30), tHits);
+
+				EXPECT_EQ(boxMask, pack.IntersectAABBMask(box, T(30)));
+				EXPECT_EQ(triMask, pack.IntersectTriangleMask(v0, v1, v2, T(30)));
+
+				uint32_t expectedBox = 0u;
+				uint32_t expectedTri = 0u;
+
+				for (uint32_t j = 0; j < num; ++j)
+				{
+					T tEntry, t, u, v;
+
+					if (_rays[i + j].IntersectAABB(box, T(30), tEntry))
+					{
+						expectedBox |= 1u << j;
+						EXPECT_EQ(tEntries[j], tEntry);
+					}
+
+					if (_rays[i + j].IntersectTriangle(v0, v1, v2, T(30), t, u, v))
+					{
+						expectedTri |= 1u << j;
+						EXPECT_NEAR(tHits[j], t, T(1e-4) * std::abs(t));
+					}
+				}
+
+				// Empty lanes never hit.
+				EXPECT_EQ(boxMask, expectedBox);
+				EXPECT_EQ(triMask, expectedTri);
+			}
+		}
+	}
+
+
+	TYPED_TEST(Ray3PackTest, Lanes)
+	{
+		using T = TypeParam;
+
+		const std::vector<SA::Ray3<T>> rays = MakeRays<T>(3u, 1u);
+
+		const Ray3Pack4<T> pack(rays.data(), 3u);
+
+		for (uint32_t i = 0u; i < 3u; ++i)
+		{
+			const SA::Ray3<T> ray = pack.Get(i);
+
+			EXPECT_EQ(ray.origin, rays[i].origin);
+			EXPECT_EQ(ray.direction, rays[i].direction);
+		}
+
+		// Empty lane: never hits, even a huge box or triangle.
+		const AABB3D<T> all(Vec3<T>(-1e6), Vec3<T>(1e6));
+
+		EXPECT_EQ(pack.IntersectAABBMask(all, T(1e9)), 0b0111u);
+		EXPECT_EQ(Ray3Pack8<T>().IntersectAABBMask(all, T(1e9)), 0u);
+		EXPECT_EQ(Ray3Pack8<T>().IntersectTriangleMask(Vec3<T>(-1e6, -1e6, 0), Vec3<T>(1e6, -1e6, 0), Vec3<T>(0, 1e6, 0), T(1e9)), 0u);
+	}
+
+	TYPED_TEST(Ray3PackTest, Intersect)
+	{
+		const auto rays = MakeRays<TypeParam>(203u, 2u);
+
+		ExpectPacket<TypeParam, 4u>(rays, 3u);
+		ExpectPacket<TypeParam, 8u>(rays, 4u);
+	}
+}
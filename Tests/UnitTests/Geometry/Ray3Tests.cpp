@@ -0,0 +1,155 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/Ray3.hpp>
+#include <SA/Maths/Geometry/BVH3D.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::Ray3
+{
+	template <typename T>
+	class Ray3Test : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(Ray3Test, TestTypes);
+
+
+	TYPED_TEST(Ray3Test, Constructors)
+	{
+		using T = TypeParam;
+
+		const SA::Ray3<T> r0;
+		EXPECT_EQ(r0.origin, Vec3<T>::Zero);
+		EXPECT_EQ(r0.direction, Vec3<T>::Forward);
+		EXPECT_EQ(r0.invDirection.z, T(1));
+
+		const SA::Ray3<T> r1(Vec3<T>(1, 2, 3), Vec3<T>(2, -4, 0));
+		EXPECT_EQ(r1.origin, Vec3<T>(1, 2, 3));
+		EXPECT_EQ(r1.direction, Vec3<T>(2, -4, 0));
+		EXPECT_EQ(r1.invDirection.x, T(0.5));
+		EXPECT_EQ(r1.invDirection.y, T(-0.25));
+		EXPECT_EQ(r1.invDirection.z, std::numeric_limits<T>::infinity());
+
+		EXPECT_EQ(r1.ComputePoint(T(2)), Vec3<T>(5, -6, 3));
+	}
+
+	TYPED_TEST(Ray3Test, IntersectAABB)
+	{
+		using T = TypeParam;
+
+		const AABB3D<T> box(Vec3<T>(-1, -1, -1), Vec3<T>(1, 1, 1));
+
+		T tEntry = T(-1);
+
+		// Front hit.
+		const SA::Ray3<T> r0(Vec3<T>(-5, 0, 0), Vec3<T>(1, 0, 0));
+		EXPECT_TRUE(r0.IntersectAABB(box, T(100), tEntry));
+		EXPECT_EQ(tEntry, T(4));
+
+		// Too short.
+		EXPECT_FALSE(r0.IntersectAABB(box, T(3), tEntry));
+
+		// Box behind.
+		const SA::Ray3<T> r1(Vec3<T>(-5, 0, 0), Vec3<T>(-1, 0, 0));
+		EXPECT_FALSE(r1.IntersectAABB(box, T(100), tEntry));
+
+		// Origin inside.
+		const SA::Ray3<T> r2(Vec3<T>(0.5, 0, 0), Vec3<T>(0, 1, 0));
+		EXPECT_TRUE(r2.IntersectAABB(box, T(100), tEntry));
+		EXPECT_EQ(tEntry, T(0));
+
+		// Axis parallel miss (null direction components).
+		const SA::Ray3<T> r3(Vec3<T>(-5, 2, 0), Vec3<T>(1, 0, 0));
+		EXPECT_FALSE(r3.IntersectAABB(box, T(100), tEntry));
+
+		// Non normalized diagonal.
+		const SA::Ray3<T> r4(Vec3<T>(-3, -3, -3), Vec3<T>(2, 2, 2));
+		EXPECT_TRUE(r4.IntersectAABB(box, T(100), tEntry));
+		EXPECT_EQ(tEntry, T(1));
+	}
+
+	TYPED_TEST(Ray3Test, IntersectTriangle)
+	{
+		using T = TypeParam;
+
+		const Vec3<T> v0(0, 0, 0);
+		const Vec3<T> v1(2, 0, 0);
+		const Vec3<T> v2(0, 2, 0);
+
+		T t = T(-1), u = T(-1), v = T(-1);
+
+		const SA::Ray3<T> r0(Vec3<T>(0.5, 0.25, 3), Vec3<T>(0, 0, -1));
+		EXPECT_TRUE(r0.IntersectTriangle(v0, v1, v2, T(100), t, u, v));
+		EXPECT_NEAR(t, T(3), T(1e-6));
+		EXPECT_NEAR(u, T(0.25), T(1e-6));
+		EXPECT_NEAR(v, T(0.125), T(1e-6));
+		EXPECT_EQ(r0.ComputePoint(t), v0 * (T(1) - u - v) + v1 * u + v2 * v);
+
+		// Double sided.
+		const SA::Ray3<T> r1(Vec3<T>(0.5, 0.25, -3), Vec3<T>(0, 0, 1));
+		EXPECT_TRUE(r1.IntersectTriangle(v0, v1, v2, T(100), t, u, v));
+
+		// Max distance.
+		EXPECT_FALSE(r0.IntersectTriangle(v0, v1, v2, T(2), t, u, v));
+
+		// Behind.
+		const SA::Ray3<T> r2(Vec3<T>(0.5, 0.25, 3), Vec3<T>(0, 0, 1));
+		EXPECT_FALSE(r2.IntersectTriangle(v0, v1, v2, T(100), t, u, v));
+
+		// Outside edge v1-v2.
+		const SA::Ray3<T> r3(Vec3<T>(1.5, 1.5, 3), Vec3<T>(0, 0, -1));
+		EXPECT_FALSE(r3.IntersectTriangle(v0, v1, v2, T(100), t, u, v));
+
+		// Parallel to plane.
+		const SA::Ray3<T> r4(Vec3<T>(0.5, 0.25, 0), Vec3<T>(1, 0, 0));
+		EXPECT_FALSE(r4.IntersectTriangle(v0, v1, v2, T(100), t, u, v));
+	}
+
+	TYPED_TEST(Ray3Test, BVH3D)
+	{
+		using T = TypeParam;
+
+		std::mt19937 gen(1u);
+		std::uniform_real_distribution<T> pos(T(-20), T(20));
+		std::uniform_real_distribution<T> ext(T(0.1), T(4));
+
+		std::vector<AABB3D<T>> boxes(300u);
+
+		for (auto& box : boxes)
+		{
+			box.min = Vec3<T>(pos(gen), pos(gen), pos(gen));
+			box.max = box.min + Vec3<T>(ext(gen), ext(gen), ext(gen));
+		}
+
+		BVH3D<T> bvh;
+		bvh.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		for (uint32_t i = 0u; i < 50u; ++i)
+		{
+			const SA::Ray3<T> ray(Vec3<T>(pos(gen), pos(gen), pos(gen)), Vec3<T>(pos(gen), pos(gen), pos(gen)));
+
+			// Ray overloads: same result as origin / direction overloads.
+			T tRay = T(0), tDir = T(0);
+
+			EXPECT_EQ(bvh.RaycastClosest(ray, T(10), tRay), bvh.RaycastClosest(ray.origin, ray.direction, T(10), tDir));
+			EXPECT_EQ(tRay, tDir);
+
+			uint32_t rayNum = 0u;
+			bvh.QueryRay(ray, T(10), [&rayNum](uint32_t, T) { ++rayNum; });
+
+			uint32_t bruteNum = 0u;
+
+			for (const auto& box : boxes)
+			{
+				T tEntry;
+				bruteNum += ray.IntersectAABB(box, T(10), tEntry);
+			}
+
+			EXPECT_EQ(rayNum, bruteNum);
+		}
+	}
+}
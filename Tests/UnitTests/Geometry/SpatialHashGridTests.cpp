@@ -0,0 +1,212 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/SpatialHashGrid.hpp>
+
+#include "AABBTests.hpp"
+
+namespace SA::UT::HashGrid
+{
+	template <typename AABBT>
+	class SpatialHashGridTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<AABB2D<float>, AABB2D<double>, AABB3D<float>, AABB3D<double>>;
+	TYPED_TEST_SUITE(SpatialHashGridTest, TestTypes);
+
+	template <typename AABBT>
+	static std::vector<typename SpatialHashGrid<AABBT>::VecT> MakePoints(uint32_t _num, uint32_t _seed)
+	{
+		using Grid = SpatialHashGrid<AABBT>;
+		using T = typename Grid::T;
+
+		std::mt19937 gen(_seed);
+		std::uniform_real_distribution<T> pos(T(-20), T(20));
+
+		std::vector<typename Grid::VecT> points(_num);
+
+		for (auto& point : points)
+		{
+			for (uint32_t a = 0u; a < Grid::Dim; ++a)
+				point[a] = pos(gen);
+		}
+
+		return points;
+	}
+
+	template <typename VecT, typename T>
+	static T SqrDistance(const VecT& _lhs, const VecT& _rhs, uint32_t _dim)
+	{
+		T sqrDist = T(0);
+
+		for (uint32_t a = 0u; a < _dim; ++a)
+			sqrDist += (_lhs[a] - _rhs[a]) * (_lhs[a] - _rhs[a]);
+
+		return sqrDist;
+	}
+
+	/// Query output must be the brute-force result, each index reported once.
+	static void ExpectSameSet(std::vector<uint32_t> _result, const std::vector<uint32_t>& _expected)
+	{
+		std::sort(_result.begin(), _result.end());
+
+		EXPECT_EQ(_result.size(), _expected.size());
+		EXPECT_TRUE(_result == _expected);
+	}
+
+
+	TYPED_TEST(SpatialHashGridTest, Build)
+	{
+		using Grid = SpatialHashGrid<TypeParam>;
+		using T = typename Grid::T;
+
+		Grid grid(T(4));
+		EXPECT_EQ(grid.GetCellSize(), T(4));
+
+		grid.Build(static_cast<const TypeParam*>(nullptr), 0u);
+		EXPECT_EQ(grid.Size(), 0u);
+		EXPECT_EQ(grid.GetCellNum(), 0u);
+
+		std::vector<uint32_t> out;
+		grid.QueryBox(TypeParam(), out);
+		EXPECT_TRUE(out.empty());
+
+		// One box spanning 2 cells per axis.
+		TypeParam box;
+		box.min = typename Grid::VecT(T(3));
+		box.max = typename Grid::VecT(T(5));
+
+		grid.Build(&box, 1u);
+		EXPECT_EQ(grid.Size(), 1u);
+		EXPECT_EQ(grid.GetCellNum(), 1u << Grid::Dim);
+
+		// Cells: floor, negative coordinates included.
+		const auto cell = grid.ComputeCell(typename Grid::VecT(T(-0.5)));
+
+		for (uint32_t a = 0u; a < Grid::Dim; ++a)
+			EXPECT_EQ(cell.coords[a], -1);
+
+		grid.SetCellSize(T(2));
+		EXPECT_EQ(grid.Size(), 0u);
+	}
+
+	TYPED_TEST(SpatialHashGridTest, QueryBox)
+	{
+		using Grid = SpatialHashGrid<TypeParam>;
+		using T = typename Grid::T;
+
+		const std::vector<TypeParam> boxes = MakeRandomAABBs<TypeParam>(800u, 1u, T(50), T(0), T(8));
+		const std::vector<TypeParam> queries = MakeRandomAABBs<TypeParam>(50u, 2u, T(50), T(0), T(8));
+
+		// Small cells (boxes span many cells) and large cells.
+		for (T cellSize : { T(1.5), T(10) })
+		{
+			Grid grid(cellSize);
+			grid.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+			EXPECT_EQ(grid.Size(), 800u);
+
+			for (const auto& query : queries)
+			{
+				std::vector<uint32_t> expected;
+
+				for (uint32_t i = 0u; i < boxes.size(); ++i)
+				{
+					if (boxes[i].IsColliding(query))
+						expected.push_back(i);
+				}
+
+				std::vector<uint32_t> result;
+				grid.QueryBox(query, result);
+
+				ExpectSameSet(result, expected);
+			}
+
+			// Query larger than the whole grid: occupied cells scan.
+			TypeParam all;
+			all.min = typename Grid::VecT(T(-1000));
+			all.max = typename Grid::VecT(T(1000));
+
+			std::vector<uint32_t> result;
+			grid.QueryBox(all, result);
+
+			EXPECT_EQ(result.size(), boxes.size());
+		}
+	}
+
+	TYPED_TEST(SpatialHashGridTest, QueryRadiusPoints)
+	{
+		using Grid = SpatialHashGrid<TypeParam>;
+		using T = typename Grid::T;
+
+		const auto points = MakePoints<TypeParam>(2000u, 3u);
+		const T radius = T(1.5);
+
+		Grid grid(radius * T(2));
+		grid.Build(points.data(), static_cast<uint32_t>(points.size()));
+
+		std::vector<uint32_t> result;
+
+		for (uint32_t q = 0u; q < 100u; ++q)
+		{
+			std::vector<uint32_t> expected;
+
+			for (uint32_t i = 0u; i < points.size(); ++i)
+			{
+				if (SqrDistance<typename Grid::VecT, T>(points[q], points[i], Grid::Dim) <= radius * radius)
+					expected.push_back(i);
+			}
+
+			result.clear();
+			grid.QueryRadius(points[q], radius, result);
+
+			ExpectSameSet(result, expected);
+		}
+
+		// Callback version: same result, no output container.
+		uint32_t count = 0u;
+		grid.QueryRadius(points[0], radius, [&count](uint32_t) { ++count; });
+
+		result.clear();
+		grid.QueryRadius(points[0], radius, result);
+
+		EXPECT_EQ(count, result.size());
+	}
+
+	TYPED_TEST(SpatialHashGridTest, QueryRadiusBoxes)
+	{
+		using Grid = SpatialHashGrid<TypeParam>;
+		using T = typename Grid::T;
+
+		const std::vector<TypeParam> boxes = MakeRandomAABBs<TypeParam>(500u, 4u, T(50), T(0), T(8));
+		const auto centers = MakePoints<TypeParam>(50u, 5u);
+		const T radius = T(6);
+
+		Grid grid(T(3));
+		grid.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		for (const auto& center : centers)
+		{
+			std::vector<uint32_t> expected;
+
+			for (uint32_t i = 0u; i < boxes.size(); ++i)
+			{
+				// Distance to closest point of the box.
+				typename Grid::VecT closest;
+
+				for (uint32_t a = 0u; a < Grid::Dim; ++a)
+					closest[a] = std::clamp(center[a], boxes[i].min[a], boxes[i].max[a]);
+
+				if (SqrDistance<typename Grid::VecT, T>(center, closest, Grid::Dim) <= radius * radius)
+					expected.push_back(i);
+			}
+
+			std::vector<uint32_t> result;
+			grid.QueryRadius(center, radius, result);
+
+			ExpectSameSet(result, expected);
+		}
+	}
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/SpherePack.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::SpherePacket
+{
+	template <typename T>
+	class SpherePackTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(SpherePackTest, TestTypes);
+
+	template <typename T>
+	static std::vector<Sphere<T>> MakeSpheres(uint32_t _num, uint32_t _seed)
+	{
+		std::mt19937 gen(_seed);
+		std::uniform_real_distribution<T> pos(T(-20), T(20));
+		std::uniform_real_distribution<T> radius(T(0.1), T(6));
+
+		std::vector<Sphere<T>> spheres(_num);
+
+		for (auto& sphere : spheres)
+			sphere = Sphere<T>(Vec3<T>(pos(gen), pos(gen), pos(gen)), radius(gen));
+
+		return spheres;
+	}
+
+	template <typename T, uint32_t N, typename QueryT>
+	static void ExpectOverlapMask(const std::vector<Sphere<T>>& _spheres, const std::vector<QueryT>& _queries)
+	{
+		for (uint32_t i = 0; i < _spheres.size(); i += N)
+		{
+			const uint32_t num = std::min<uint32_t>(N, static_cast<uint32_t>(_spheres.size()) - i);
+			const SpherePack<T, N> pack(_spheres.data() + i, num);
+
+			for (const auto& query : _queries)
+			{
+				uint32_t expected = 0u;
+
+				for (uint32_t j = 0; j < num; ++j)
+					expected |= uint32_t(_spheres[i + j].IsColliding(query)) << j;
+
+				EXPECT_EQ(pack.OverlapMask(query), expected);
+			}
+		}
+	}
+
+
+	TYPED_TEST(SpherePackTest, Lanes)
+	{
+		using T = TypeParam;
+
+		const Sphere<T> s0(Vec3T(T(1), T(2), T(3)), T(4));
+		const Sphere<T> s1(Vec3T(T(-1), T(-2), T(-3)), T(0.5));
+
+		SpherePack4<T> pack;
+
+		// Empty lanes never overlap.
+		const AABB3DT everything(Vec3T(std::numeric_limits<T>::lowest()), Vec3T(std::numeric_limits<T>::max()));
+		const Sphere<T> big(Vec3T(T(0)), T(1e6));
+
+		EXPECT_EQ(pack.OverlapMask(everything), 0u);
+		EXPECT_EQ(pack.OverlapMask(big), 0u);
+
+		pack.Set(0u, s0);
+		pack.Set(2u, s1);
+
+		EXPECT_EQ(pack.Get(0u).center, s0.center);
+		EXPECT_EQ(pack.Get(2u).radius, s1.radius);
+		EXPECT_EQ(pack.OverlapMask(everything), 0b0101u);
+		EXPECT_EQ(pack.OverlapMask(big), 0b0101u);
+
+		pack.SetEmpty(0u);
+		EXPECT_EQ(pack.OverlapMask(big), 0b0100u);
+
+		const Sphere<T> spheres[] = { s0, s1, s0 };
+		const SpherePack8<T> pack8(spheres, 3u);
+
+		EXPECT_EQ(pack8.Get(1u).center, s1.center);
+		EXPECT_EQ(pack8.OverlapMask(big), 0b0111u);
+	}
+
+	TYPED_TEST(SpherePackTest, OverlapMaskRandom)
+	{
+		using T = TypeParam;
+
+		const auto spheres = MakeSpheres<T>(203u, 1u);
+		const auto sphereQueries = MakeSpheres<T>(50u, 2u);
+		const auto boxQueries = MakeRandomBoxes<T>(50u, 3u, T(20), T(10));
+
+		ExpectOverlapMask<T, 4u>(spheres, sphereQueries);
+		ExpectOverlapMask<T, 8u>(spheres, sphereQueries);
+
+		ExpectOverlapMask<T, 4u>(spheres, boxQueries);
+		ExpectOverlapMask<T, 8u>(spheres, boxQueries);
+	}
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <SA/Maths/Geometry/Sphere.hpp>
+
+#include "AABB3DTests.hpp"
+
+namespace SA::UT::SphereVolume
+{
+	template <typename T>
+	class SphereTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(SphereTest, TestTypes);
+
+	TYPED_TEST(SphereTest, Constructors)
+	{
+		using T = TypeParam;
+
+		const Sphere<T> s0;
+		EXPECT_EQ(s0.center, Vec3T(T(0)));
+		EXPECT_EQ(s0.radius, T(0));
+
+		const Sphere<T> s1(Vec4<T>(T(1), T(2), T(3), T(4)));
+		EXPECT_EQ(s1.center, Vec3T(T(1), T(2), T(3)));
+		EXPECT_EQ(s1.radius, T(4));
+
+		EXPECT_EQ(s1.ComputeAABB(), AABB3DT(Vec3T(T(-3), T(-2), T(-1)), Vec3T(T(5), T(6), T(7))));
+	}
+
+	TYPED_TEST(SphereTest, IsColliding)
+	{
+		using T = TypeParam;
+
+		const Sphere<T> sphere(Vec3T(T(0)), T(2));
+
+		EXPECT_TRUE(sphere.Contains(Vec3T(T(0), T(2), T(0))));
+		EXPECT_FALSE(sphere.Contains(Vec3T(T(1.5), T(1.5), T(0))));
+
+		// Sphere / sphere.
+		EXPECT_TRUE(sphere.IsColliding(Sphere<T>(Vec3T(T(3), T(0), T(0)), T(1))));		// Touching.
+		EXPECT_FALSE(sphere.IsColliding(Sphere<T>(Vec3T(T(3), T(0), T(0)), T(0.9))));
+		EXPECT_TRUE(sphere.IsColliding(Sphere<T>(Vec3T(T(0.5), T(0), T(0)), T(0.1))));	// Contained.
+
+		// Sphere / box: face, edge and corner regions.
+		EXPECT_TRUE(sphere.IsColliding(AABB3DT(Vec3T(T(-1)), Vec3T(T(1)))));
+		EXPECT_TRUE(sphere.IsColliding(AABB3DT(Vec3T(T(2), T(-1), T(-1)), Vec3T(T(3), T(1), T(1)))));
+		EXPECT_FALSE(sphere.IsColliding(AABB3DT(Vec3T(T(2.1), T(-1), T(-1)), Vec3T(T(3), T(1), T(1)))));
+		EXPECT_TRUE(sphere.IsColliding(AABB3DT(Vec3T(T(1.4), T(1.4), T(-1)), Vec3T(T(3), T(3), T(1)))));
+		EXPECT_FALSE(sphere.IsColliding(AABB3DT(Vec3T(T(1.5), T(1.5), T(-1)), Vec3T(T(3), T(3), T(1)))));
+		EXPECT_TRUE(sphere.IsColliding(AABB3DT(Vec3T(T(1.1)), Vec3T(T(3)))));
+		EXPECT_FALSE(sphere.IsColliding(AABB3DT(Vec3T(T(1.2)), Vec3T(T(3)))));
+
+		// Sphere / plane.
+		EXPECT_TRUE(sphere.IsColliding(Plane<T>(Vec3T(T(0), T(1), T(0)), T(-2))));
+		EXPECT_FALSE(sphere.IsColliding(Plane<T>(Vec3T(T(0), T(1), T(0)), T(-2.5))));
+		EXPECT_FALSE(sphere.IsColliding(Plane<T>(Vec3T(T(0), T(1), T(0)), T(2.5))));
+	}
+
+	TYPED_TEST(SphereTest, Transform)
+	{
+		using T = TypeParam;
+
+		const Sphere<T> sphere(Vec3T(T(1), T(-2), T(3)), T(1.5));
+		const Quat<T> rotation(Deg<T>(T(63)), Vec3T(T(0), T(1), T(1)).GetNormalized());
+
+		// Uniform scale: exact.
+		const TrPRUS<T> trUniform{ Vec3T(T(4), T(5), T(-6)), rotation, T(-2) };
+		const Sphere<T> outUniform = sphere.Transform(trUniform);
+		const Sphere<T> outUniformMat = sphere.Transform(trUniform.Matrix());
+
+		EXPECT_VEC3_NEAR(outUniform.center, outUniformMat.center, T(1e-4));
+		EXPECT_NEAR(outUniform.radius, T(3), T(1e-5));
+		EXPECT_NEAR(outUniformMat.radius, T(3), T(1e-5));
+
+		// Non-uniform scale: largest axis scale.
+		const TrPRS<T> tr{ Vec3T(T(4), T(5), T(-6)), rotation, Vec3T(T(2), T(-4), T(0.5)) };
+		const Sphere<T> out = sphere.Transform(tr);
+		const Sphere<T> outMat = sphere.Transform(tr.Matrix());
+		const Sphere<T> outCMat = sphere.Transform(Mat4<T, MatrixMajor::Column>(tr.Matrix()));
+
+		EXPECT_VEC3_NEAR(out.center, outMat.center, T(1e-4));
+		EXPECT_VEC3_NEAR(outCMat.center, outMat.center, T(1e-4));
+		EXPECT_NEAR(out.radius, T(6), T(1e-5));
+		EXPECT_NEAR(outMat.radius, T(6), T(1e-5));
+		EXPECT_NEAR(outCMat.radius, T(6), T(1e-5));
+
+		EXPECT_VEC3_NEAR(out.center, trUniform.position + rotation.Rotate(sphere.center * Vec3T(T(2), T(-4), T(0.5))), T(1e-4));
+	}
+
+	TYPED_TEST(SphereTest, TransformScaleRotation)
+	{
+		using T = TypeParam;
+
+		// Parent with non-uniform scale, rotated child: M = S * R (columns are not scaled axes).
+		const Sphere<T> sphere(Vec3T(T(1), T(-2), T(3)), T(1.5));
+		const Mat4<T> scale = Mat4<T>::MakeScale(Vec3T(T(2), T(1), T(1)));
+		const Mat4<T> rotation = Mat4<T>::MakeRotation(Quat<T>(Deg<T>(T(45)), Vec3T(T(0), T(0), T(1))));
+		const Mat4<T> mat = scale * rotation;
+
+		const Sphere<T> out = sphere.Transform(mat);
+
+		// Largest stretch is 2 (longest column is only sqrt(2.5)).
+		EXPECT_NEAR(out.radius, T(3), T(1e-4));
+
+		// Contains transformed surface points.
+		for (int32_t i = -4; i <= 4; ++i)
+		{
+			for (int32_t j = -4; j <= 4; ++j)
+			{
+				for (int32_t k = -4; k <= 4; ++k)
+				{
+					const Vec3T dir(static_cast<T>(i), static_cast<T>(j), static_cast<T>(k));
+
+					if (dir.SqrLength() == T(0))
+						continue;
+
+					const Vec3T point = mat * (sphere.center + dir.GetNormalized() * sphere.radius) + Vec3T(mat.e03, mat.e13, mat.e23);
+
+					EXPECT_LE((point - out.center).Length(), out.radius * T(1.0001));
+				}
+			}
+		}
+
+		const Sphere<T> outCMat = sphere.Transform(Mat4<T, MatrixMajor::Column>(mat));
+		EXPECT_NEAR(outCMat.radius, out.radius, T(1e-5));
+	}
+}
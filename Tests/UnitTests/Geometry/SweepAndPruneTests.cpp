@@ -0,0 +1,163 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <random>
+
+#include <SA/Maths/Geometry/SweepAndPrune.hpp>
+#include <SA/Maths/Dispatch/ThreadPool.hpp>
+
+#include "AABBTests.hpp"
+
+namespace SA::UT::SweepPrune
+{
+	template <typename AABBT>
+	class SweepAndPruneTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<AABB2D<float>, AABB2D<double>, AABB3D<float>, AABB3D<double>>;
+	TYPED_TEST_SUITE(SweepAndPruneTest, TestTypes);
+
+	template <typename AABBT>
+	static std::vector<typename SweepAndPrune<AABBT>::Pair> BrutePairs(const std::vector<AABBT>& _boxes)
+	{
+		std::vector<typename SweepAndPrune<AABBT>::Pair> pairs;
+
+		for (uint32_t i = 0u; i < _boxes.size(); ++i)
+		{
+			for (uint32_t j = i + 1u; j < _boxes.size(); ++j)
+			{
+				if (_boxes[i].IsColliding(_boxes[j]))
+					pairs.push_back({ i, j });
+			}
+		}
+
+		return pairs;
+	}
+
+	template <typename AABBT>
+	static void ExpectPairs(const SweepAndPrune<AABBT>& _sap, const std::vector<AABBT>& _boxes)
+	{
+		auto pairs = _sap.GetPairs();
+		std::sort(pairs.begin(), pairs.end());
+
+		const auto expected = BrutePairs(_boxes);
+
+		EXPECT_EQ(pairs.size(), expected.size());
+		EXPECT_TRUE(pairs == expected);
+	}
+
+
+	TYPED_TEST(SweepAndPruneTest, Build)
+	{
+		using T = typename SweepAndPrune<TypeParam>::T;
+
+		SweepAndPrune<TypeParam> sap;
+
+		sap.Build(nullptr, 0u);
+		EXPECT_EQ(sap.Size(), 0u);
+		EXPECT_TRUE(sap.GetPairs().empty());
+
+		const std::vector<TypeParam> boxes = MakeRandomAABBs<TypeParam>(600u, 1u, T(50), T(0.1), T(8));
+
+		sap.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+		EXPECT_EQ(sap.Size(), 600u);
+
+		ExpectPairs(sap, boxes);
+	}
+
+	TYPED_TEST(SweepAndPruneTest, MajorAxis)
+	{
+		using T = typename SweepAndPrune<TypeParam>::T;
+
+		// Boxes spread along Y only.
+		std::vector<TypeParam> boxes(100u);
+
+		for (uint32_t i = 0u; i < boxes.size(); ++i)
+		{
+			boxes[i].min[1] = T(i) * T(2) - T(100);
+			boxes[i].max[1] = boxes[i].min[1] + T(3);
+			boxes[i].max[0] = T(1);
+		}
+
+		SweepAndPrune<TypeParam> sap;
+		sap.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		EXPECT_EQ(sap.GetAxis(), 1u);
+		EXPECT_EQ(sap.GetPairs().size(), 99u);
+
+		ExpectPairs(sap, boxes);
+	}
+
+	TYPED_TEST(SweepAndPruneTest, Update)
+	{
+		using SAP = SweepAndPrune<TypeParam>;
+		using T = typename SAP::T;
+
+		std::vector<TypeParam> boxes = MakeRandomAABBs<TypeParam>(600u, 2u, T(50), T(0.1), T(8));
+
+		SAP sap;
+		sap.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		std::mt19937 gen(3u);
+		std::uniform_real_distribution<T> step(T(-1), T(1));
+
+		for (uint32_t frame = 0u; frame < 10u; ++frame)
+		{
+			for (auto& box : boxes)
+			{
+				for (uint32_t a = 0u; a < SAP::Dim; ++a)
+				{
+					const T d = step(gen);
+
+					box.min[a] += d;
+					box.max[a] += d;
+				}
+			}
+
+			sap.Update(boxes.data());
+
+			ExpectPairs(sap, boxes);
+		}
+
+		// No motion: already sorted.
+		sap.Update(boxes.data());
+		EXPECT_EQ(sap.GetSwapNum(), 0u);
+
+		// Full shuffle.
+		boxes = MakeRandomAABBs<TypeParam>(600u, 4u, T(50), T(0.1), T(8));
+
+		sap.Update(boxes.data());
+		EXPECT_GT(sap.GetSwapNum(), 0u);
+
+		ExpectPairs(sap, boxes);
+	}
+
+	TYPED_TEST(SweepAndPruneTest, UpdateParallel)
+	{
+		using SAP = SweepAndPrune<TypeParam>;
+		using T = typename SAP::T;
+
+		std::vector<TypeParam> boxes = MakeRandomAABBs<TypeParam>(1000u, 5u, T(50), T(0.1), T(8));
+
+		SAP serial;
+		serial.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		SAP parallel;
+		parallel.Build(boxes.data(), static_cast<uint32_t>(boxes.size()));
+
+		boxes = MakeRandomAABBs<TypeParam>(1000u, 6u, T(50), T(0.1), T(8));
+		serial.Update(boxes.data());
+
+		for (uint32_t threadNum : { 2u, 3u, 8u })
+		{
+			Maths::ThreadPool pool(threadNum);
+
+			parallel.UpdateParallel(boxes.data(), pool, pool.GetThreadNum());
+
+			// Same pairs in the same order.
+			EXPECT_TRUE(parallel.GetPairs() == serial.GetPairs());
+		}
+
+		ExpectPairs(parallel, boxes);
+	}
+}
@@ -4,6 +4,7 @@
 #include "Matrix4Tests.hpp"
 #include "../Space/QuaternionTests.hpp"
 #include "../Space/Vector3Tests.hpp"
+#include "../Tools/ULP.hpp"
 
 namespace SA::UT::Matrix3
 {
@@ -782,4 +783,124 @@ namespace SA::UT::Matrix3
 
 		EXPECT_EQ(cm1.Data(), &cm1.e00);
 	}
+
+	template <MatrixMajor major>
+	static void Mat3PrecisionULP(const std::string& _name)
+	{
+		ULPStats mult, multScalar;
+		ULPStats vec3, vec3Scalar;
+		ULPStats det, detScalar;
+		ULPStats inv, invScalar;
+
+		for (size_t k = 0; k < 64u; ++k)
+		{
+			// Dominant diagonal: well-conditioned.
+			float a[3][3];
+			float b[3][3];
+
+			for (int r = 0; r < 3; ++r)
+			{
+				for (int c = 0; c < 3; ++c)
+				{
+					a[r][c] = PrecisionValue(k * 18u + r * 3u + c) + (r == c ? 3.0f : 0.0f);
+					b[r][c] = PrecisionValue(k * 18u + 9u + r * 3u + c);
+				}
+			}
+
+			const Mat3<float, major> fA(
+				a[0][0], a[0][1], a[0][2],
+				a[1][0], a[1][1], a[1][2],
+				a[2][0], a[2][1], a[2][2]
+			);
+			const Mat3<float, major> fB(
+				b[0][0], b[0][1], b[0][2],
+				b[1][0], b[1][1], b[1][2],
+				b[2][0], b[2][1], b[2][2]
+			);
+			const Vec3f fV(PrecisionValue(k * 5u), PrecisionValue(k * 5u + 1u), PrecisionValue(k * 5u + 2u));
+
+			const Mat3<double, major> dA = fA;
+			const Mat3<double, major> dB = fB;
+			const Vec3d dV = fV;
+
+			// Multiply.
+			{
+				// Compare logical elements (row major).
+				const RMat3f fRes = fA * fB;
+				const RMat3d dRes = dA * dB;
+
+				for (uint32_t r = 0; r < 3u; ++r)
+				{
+					for (uint32_t c = 0; c < 3u; ++c)
+					{
+						mult.Add(fRes.At(r, c), dRes.At(r, c));
+						multScalar.Add(a[r][0] * b[0][c] + a[r][1] * b[1][c] + a[r][2] * b[2][c], dRes.At(r, c));
+					}
+				}
+			}
+
+			// Transform.
+			{
+				const Vec3f fRes = fA * fV;
+				const Vec3d dRes = dA * dV;
+
+				for (uint32_t r = 0; r < 3u; ++r)
+				{
+					vec3.Add(fRes[r], dRes[r]);
+					vec3Scalar.Add(a[r][0] * fV.x + a[r][1] * fV.y + a[r][2] * fV.z, dRes[r]);
+				}
+			}
+
+			// Determinant and inverse.
+			{
+				const double dDet = dA.Determinant();
+				const RMat3d dInv = dA.GetInversed();
+				const RMat3f fInv = fA.GetInversed();
+
+				// Cofactor C(r, c) of logical elements.
+				auto cofactor = [&a](int _r, int _c)
+				{
+					const int r0 = _r == 0 ? 1 : 0;
+					const int r1 = _r == 2 ? 1 : 2;
+					const int c0 = _c == 0 ? 1 : 0;
+					const int c1 = _c == 2 ? 1 : 2;
+
+					const float minor = a[r0][c0] * a[r1][c1] - a[r0][c1] * a[r1][c0];
+
+					return (_r + _c) % 2 ? -minor : minor;
+				};
+
+				const float scalarDet = a[0][0] * cofactor(0, 0) + a[0][1] * cofactor(0, 1) + a[0][2] * cofactor(0, 2);
+
+				det.Add(fA.Determinant(), dDet);
+				detScalar.Add(scalarDet, dDet);
+
+				for (uint32_t r = 0; r < 3u; ++r)
+				{
+					for (uint32_t c = 0; c < 3u; ++c)
+					{
+						inv.Add(fInv.At(r, c), dInv.At(r, c));
+						invScalar.Add(cofactor(c, r) / scalarDet, dInv.At(r, c));
+					}
+				}
+			}
+		}
+
+		ReportULP(_name + "Multiply", mult, multScalar);
+		ReportULP(_name + "TransformVec3", vec3, vec3Scalar);
+		ReportULP(_name + "Determinant", det, detScalar);
+		ReportULP(_name + "Inverse", inv, invScalar);
+
+		// Sums of positive products: a few ULP. Inverse: cancellation in cofactors of small elements.
+		EXPECT_LE(mult.max, 4.0);
+		EXPECT_LE(vec3.max, 4.0);
+		EXPECT_LE(det.max, 8.0);
+		EXPECT_LE(inv.max, 64.0);
+	}
+
+	TEST(Matrix3, PrecisionULP)
+	{
+		Mat3PrecisionULP<MatrixMajor::Row>("RMat3f");
+		Mat3PrecisionULP<MatrixMajor::Column>("CMat3f");
+	}
 }
@@ -5,6 +5,7 @@
 #include "../Space/QuaternionTests.hpp"
 #include "../Space/Vector3Tests.hpp"
 #include "../Space/Vector4Tests.hpp"
+#include "../Tools/ULP.hpp"
 
 namespace SA::UT::Matrix4
 {
@@ -701,6 +702,99 @@ namespace SA::UT::Matrix4
 		}
 	}
 
+	TYPED_TEST(Matrix4Test, Batch)
+	{
+		using T = typename TypeParam::T;
+
+		const Mat4T m1(
+			(T)6.314, (T)1.652, (T)4.236, (T)99.4,
+			(T)4.625, (T)7.751, (T)1.625, (T)78.25,
+			(T)6.53, (T)1.121, (T)1.536, (T)9.64,
+			(T)1.26, (T)2.232, (T)5.6214, (T)3.2215
+		);
+
+		// Odd size to cover both SIMD packs and remaining elements.
+		constexpr size_t num = 19u;
+
+		Vec3<T> v3s[num];
+		Vec4<T> v4s[num];
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			v3s[i] = Vec3<T>(T(i) + (T)1.25, (T)2.5 - T(i), T(i) * (T)3.5);
+			v4s[i] = Vec4<T>(v3s[i], T(i % 3));
+		}
+
+
+		// Points.
+		Vec3<T> points[num];
+		m1.TransformPoints(v3s, points, num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			const Vec4<T> res = m1 * Vec4<T>(v3s[i], T(1));
+			EXPECT_VEC3_NEAR(points[i], Vec3<T>(res.x, res.y, res.z), 0.001);
+		}
+
+
+		// Directions.
+		Vec3<T> dirs[num];
+		m1.TransformDirections(v3s, dirs, num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(dirs[i], m1 * v3s[i], 0.001);
+
+
+		// Vec4.
+		Vec4<T> vec4s[num];
+		m1.TransformVec4(v4s, vec4s, num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC4_NEAR(vec4s[i], m1 * v4s[i], 0.001);
+
+
+		// In-place.
+		Vec3<T> inPlace[num];
+		std::copy(v3s, v3s + num, inPlace);
+		m1.TransformPoints(inPlace, inPlace, num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(inPlace[i], points[i], 0);
+
+
+		// Multiply.
+		Mat4T lhs[num];
+		Mat4T rhs[num];
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			lhs[i] = m1 * T(i % 4 + 1);
+			rhs[i] = m1.GetTransposed() - Mat4T::Identity * T(i);
+		}
+
+		Mat4T mults[num];
+		Mat4T::MultiplyBatch(lhs, rhs, mults, num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_MAT4_NEAR(mults[i], lhs[i] * rhs[i], 0.01);
+
+		Mat4T::MultiplyBatch(m1, rhs, mults, num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_MAT4_NEAR(mults[i], m1 * rhs[i], 0.01);
+
+		Mat4T::MultiplyBatch(lhs, m1, mults, num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_MAT4_NEAR(mults[i], lhs[i] * m1, 0.01);
+
+		// In-place.
+		Mat4T::MultiplyBatch(lhs, m1, lhs, num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_MAT4_NEAR(lhs[i], mults[i], 0);
+	}
+
 
 	TEST(Matrix4, Majors)
 	{
@@ -1026,4 +1120,153 @@ namespace SA::UT::Matrix4
 
 		EXPECT_EQ(cm1.Data(), &cm1.e00);
 	}
+
+	/// Scalar path (generic implementation formulas) on memory-agnostic logical elements m[row][col].
+	static float ScalarDet3(float _a, float _b, float _c, float _d, float _e, float _f, float _g, float _h, float _i)
+	{
+		return _a * (_e * _i - _f * _h) - _b * (_d * _i - _f * _g) + _c * (_d * _h - _e * _g);
+	}
+
+	static float ScalarCofactor(const float (&_m)[4][4], int _r, int _c)
+	{
+		float minor[9];
+		int n = 0;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4 && i != _r; ++j)
+			{
+				if (j != _c)
+					minor[n++] = _m[i][j];
+			}
+		}
+
+		const float det = ScalarDet3(minor[0], minor[1], minor[2], minor[3], minor[4], minor[5], minor[6], minor[7], minor[8]);
+
+		return (_r + _c) % 2 ? -det : det;
+	}
+
+	template <MatrixMajor major>
+	static void Mat4PrecisionULP(const std::string& _name)
+	{
+		ULPStats mult, multScalar;
+		ULPStats vec3, vec3Scalar;
+		ULPStats vec4, vec4Scalar;
+		ULPStats det, detScalar;
+		ULPStats inv, invScalar;
+
+		for (size_t k = 0; k < 64u; ++k)
+		{
+			float a[4][4];
+			float b[4][4];
+
+			for (int r = 0; r < 4; ++r)
+			{
+				for (int c = 0; c < 4; ++c)
+				{
+					a[r][c] = PrecisionValue(k * 32u + r * 4u + c) + (r == c ? 4.0f : 0.0f);
+					b[r][c] = PrecisionValue(k * 32u + 16u + r * 4u + c);
+				}
+			}
+
+			const Mat4<float, major> fA(
+				a[0][0], a[0][1], a[0][2], a[0][3],
+				a[1][0], a[1][1], a[1][2], a[1][3],
+				a[2][0], a[2][1], a[2][2], a[2][3],
+				a[3][0], a[3][1], a[3][2], a[3][3]
+			);
+			const Mat4<float, major> fB(
+				b[0][0], b[0][1], b[0][2], b[0][3],
+				b[1][0], b[1][1], b[1][2], b[1][3],
+				b[2][0], b[2][1], b[2][2], b[2][3],
+				b[3][0], b[3][1], b[3][2], b[3][3]
+			);
+			const Vec4f fV(PrecisionValue(k * 7u), PrecisionValue(k * 7u + 1u), PrecisionValue(k * 7u + 2u), PrecisionValue(k * 7u + 3u));
+
+			const Mat4<double, major> dA = fA;
+			const Mat4<double, major> dB = fB;
+			const Vec4d dV = fV;
+
+			// Multiply.
+			{
+				// Compare logical elements (row major).
+				const RMat4f fRes = fA * fB;
+				const RMat4d dRes = dA * dB;
+
+				for (uint32_t r = 0; r < 4u; ++r)
+				{
+					for (uint32_t c = 0; c < 4u; ++c)
+					{
+						mult.Add(fRes.At(r, c), dRes.At(r, c));
+						multScalar.Add(a[r][0] * b[0][c] + a[r][1] * b[1][c] + a[r][2] * b[2][c] + a[r][3] * b[3][c], dRes.At(r, c));
+					}
+				}
+			}
+
+			// Transform.
+			{
+				const Vec3f fRes3 = fA * Vec3f(fV.x, fV.y, fV.z);
+				const Vec3d dRes3 = dA * Vec3d(dV.x, dV.y, dV.z);
+				const Vec4f fRes4 = fA * fV;
+				const Vec4d dRes4 = dA * dV;
+
+				for (uint32_t r = 0; r < 4u; ++r)
+				{
+					const float scalar3 = a[r][0] * fV.x + a[r][1] * fV.y + a[r][2] * fV.z;
+
+					if (r < 3u)
+					{
+						vec3.Add(fRes3[r], dRes3[r]);
+						vec3Scalar.Add(scalar3, dRes3[r]);
+					}
+
+					vec4.Add(fRes4[r], dRes4[r]);
+					vec4Scalar.Add(scalar3 + a[r][3] * fV.w, dRes4[r]);
+				}
+			}
+
+			// Determinant and inverse.
+			{
+				const double dDet = dA.Determinant();
+				const RMat4d dInv = dA.GetInversed();
+				const RMat4f fInv = fA.GetInversed();
+
+				float scalarDet = 0.0f;
+
+				for (int c = 0; c < 4; ++c)
+					scalarDet += a[0][c] * ScalarCofactor(a, 0, c);
+
+				det.Add(fA.Determinant(), dDet);
+				detScalar.Add(scalarDet, dDet);
+
+				for (uint32_t r = 0; r < 4u; ++r)
+				{
+					for (uint32_t c = 0; c < 4u; ++c)
+					{
+						inv.Add(fInv.At(r, c), dInv.At(r, c));
+						invScalar.Add(ScalarCofactor(a, c, r) / scalarDet, dInv.At(r, c));
+					}
+				}
+			}
+		}
+
+		ReportULP(_name + "Multiply", mult, multScalar);
+		ReportULP(_name + "TransformVec3", vec3, vec3Scalar);
+		ReportULP(_name + "TransformVec4", vec4, vec4Scalar);
+		ReportULP(_name + "Determinant", det, detScalar);
+		ReportULP(_name + "Inverse", inv, invScalar);
+
+		// Sums of positive products: a few ULP. Inverse: cancellation in cofactors of small elements.
+		EXPECT_LE(mult.max, 4.0);
+		EXPECT_LE(vec3.max, 4.0);
+		EXPECT_LE(vec4.max, 4.0);
+		EXPECT_LE(det.max, 8.0);
+		EXPECT_LE(inv.max, 64.0);
+	}
+
+	TEST(Matrix4, PrecisionULP)
+	{
+		Mat4PrecisionULP<MatrixMajor::Row>("RMat4f");
+		Mat4PrecisionULP<MatrixMajor::Column>("CMat4f");
+	}
 }
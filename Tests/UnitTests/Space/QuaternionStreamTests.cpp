@@ -0,0 +1,204 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include "QuaternionTests.hpp"
+#include "Vector3Tests.hpp"
+
+#include <vector>
+
+#include <SA/Maths/Space/QuaternionStream.hpp>
+
+namespace SA::UT::QuaternionStream
+{
+	template <typename T>
+	class QuaternionStreamTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(QuaternionStreamTest, TestTypes);
+
+	/// Odd size to cover both SIMD packs and scalar tail.
+	static constexpr size_t num = 37u;
+
+	template <typename T>
+	std::vector<Quat<T>> MakeQuats(T _offset)
+	{
+		std::vector<Quat<T>> quats(num);
+
+		for (size_t i = 0; i < num; ++i)
+			quats[i] = Quat<T>(T(1) + _offset, T(i) * _offset, T(2) - T(i), T(0.5) * T(i) + _offset).GetNormalized();
+
+		return quats;
+	}
+
+	template <typename T>
+	std::vector<Vec3<T>> MakeVecs(T _offset)
+	{
+		std::vector<Vec3<T>> vecs(num);
+
+		for (size_t i = 0; i < num; ++i)
+			vecs[i] = Vec3<T>(T(i) + _offset, T(2) * T(i) - _offset, T(3) - T(i) * _offset);
+
+		return vecs;
+	}
+
+	TYPED_TEST(QuaternionStreamTest, Constructors)
+	{
+		const QuatStream<TypeParam> s0;
+		EXPECT_EQ(s0.Size(), 0u);
+		EXPECT_TRUE(s0.IsEmpty());
+
+		const QuatStream<TypeParam> s1(num);
+		EXPECT_EQ(s1.Size(), num);
+		EXPECT_GE(s1.Capacity(), num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(s1.Get(i), QuatT::Identity, 0);
+
+		// Component arrays alignment.
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(s1.W()) % QuatStream<TypeParam>::Alignment, 0u);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(s1.X()) % QuatStream<TypeParam>::Alignment, 0u);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(s1.Y()) % QuatStream<TypeParam>::Alignment, 0u);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(s1.Z()) % QuatStream<TypeParam>::Alignment, 0u);
+
+		const std::vector<QuatT> quats = MakeQuats<TypeParam>(TypeParam(0.5));
+		const QuatStream<TypeParam> s2(quats.data(), num);
+
+		QuatStream<TypeParam> s3(s2);
+		ASSERT_EQ(s3.Size(), num);
+
+		const QuatStream<TypeParam> s4(std::move(s3));
+		ASSERT_EQ(s4.Size(), num);
+		EXPECT_EQ(s3.Size(), 0u);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(s4.Get(i), quats[i], 0);
+	}
+
+	TYPED_TEST(QuaternionStreamTest, Size)
+	{
+		const std::vector<QuatT> quats = MakeQuats<TypeParam>(TypeParam(0.5));
+
+		QuatStream<TypeParam> s;
+
+		for (size_t i = 0; i < num; ++i)
+			s.Push(quats[i]);
+
+		ASSERT_EQ(s.Size(), num);
+
+		// Content is kept on reallocation.
+		s.Reserve(num * 4u);
+		EXPECT_GE(s.Capacity(), num * 4u);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(s.Get(i), quats[i], 0);
+
+		s.Set(3u, QuatT(1, 2, 3, 4));
+		EXPECT_QUAT_NEAR(s.Get(3u), QuatT(1, 2, 3, 4), 0);
+
+		s.Clear();
+		EXPECT_TRUE(s.IsEmpty());
+	}
+
+	TYPED_TEST(QuaternionStreamTest, GatherScatter)
+	{
+		const std::vector<QuatT> quats = MakeQuats<TypeParam>(TypeParam(1.5));
+
+		QuatStream<TypeParam> s;
+		s.Gather(quats.data(), num);
+
+		ASSERT_EQ(s.Size(), num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			EXPECT_EQ(s.W()[i], quats[i].w);
+			EXPECT_EQ(s.X()[i], quats[i].x);
+			EXPECT_EQ(s.Y()[i], quats[i].y);
+			EXPECT_EQ(s.Z()[i], quats[i].z);
+		}
+
+		std::vector<QuatT> out(num);
+		s.Scatter(out.data());
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(out[i], quats[i], 0);
+	}
+
+	TYPED_TEST(QuaternionStreamTest, NormalizeInverse)
+	{
+		std::vector<QuatT> quats = MakeQuats<TypeParam>(TypeParam(1.5));
+
+		for (QuatT& quat : quats)
+			quat *= TypeParam(3.5);
+
+		QuatStream<TypeParam> s(quats.data(), num);
+		s.Normalize();
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(s.Get(i), quats[i].GetNormalized(), 0.00001);
+
+		s.Inverse();
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(s.Get(i), quats[i].GetNormalized().GetInversed(), 0.00001);
+	}
+
+	TYPED_TEST(QuaternionStreamTest, DotMultiply)
+	{
+		const std::vector<QuatT> lQuats = MakeQuats<TypeParam>(TypeParam(1.5));
+		const std::vector<QuatT> rQuats = MakeQuats<TypeParam>(TypeParam(-4.25));
+
+		const QuatStream<TypeParam> lhs(lQuats.data(), num);
+		const QuatStream<TypeParam> rhs(rQuats.data(), num);
+
+		std::vector<TypeParam> dots(num);
+		QuatStream<TypeParam>::Dot(lhs, rhs, dots.data());
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_NEAR(dots[i], QuatT::Dot(lQuats[i], rQuats[i]), 0.00001);
+
+		QuatStream<TypeParam> prod;
+		QuatStream<TypeParam>::Multiply(lhs, rhs, prod);
+
+		ASSERT_EQ(prod.Size(), num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(prod.Get(i), lQuats[i] * rQuats[i], 0.00001);
+
+		// In place.
+		QuatStream<TypeParam> inPlace = lhs;
+		QuatStream<TypeParam>::Multiply(inPlace, rhs, inPlace);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_QUAT_NEAR(inPlace.Get(i), prod.Get(i), 0);
+	}
+
+	TYPED_TEST(QuaternionStreamTest, Rotate)
+	{
+		const std::vector<QuatT> quats = MakeQuats<TypeParam>(TypeParam(1.5));
+		const std::vector<Vec3T> vecs = MakeVecs<TypeParam>(TypeParam(-4.25));
+
+		const QuatStream<TypeParam> s(quats.data(), num);
+		const Vec3Stream<TypeParam> vStream(vecs.data(), num);
+
+		Vec3Stream<TypeParam> rotated;
+		s.Rotate(vStream, rotated);
+
+		ASSERT_EQ(rotated.Size(), num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(rotated.Get(i), quats[i].Rotate(vecs[i]), 0.0001);
+
+		Vec3Stream<TypeParam> unRotated;
+		s.UnRotate(vStream, unRotated);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(unRotated.Get(i), quats[i].UnRotate(vecs[i]), 0.0001);
+
+		// In place round trip.
+		s.UnRotate(rotated, rotated);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(rotated.Get(i), vecs[i], 0.0001);
+	}
+}
@@ -1,5 +1,10 @@
 // Copyright (c) 2023 Sapphire development team. All Rights Reserved.
 
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
 #include "QuaternionTests.hpp"
 
 #include "Vector3Tests.hpp"
@@ -128,6 +133,21 @@ namespace SA::UT::Quaternion
 		EXPECT_EQ(q1, nQ1);
 	}
 
+	TYPED_TEST(QuaternionTest, NormalizeFast)
+	{
+		const QuatT q1(TypeParam{ 63.21 }, TypeParam{ 12.365 }, TypeParam{ 9.155 }, TypeParam{ 22.362 });
+		const QuatT nQ1 = q1.GetNormalized();
+
+		const QuatT newton = q1.template GetNormalized<Maths::InvSqrtPrecision::Newton>();
+		EXPECT_TRUE(newton.Equals(nQ1, TypeParam(5e-6)));
+
+		QuatT raw = q1;
+		raw.template Normalize<Maths::InvSqrtPrecision::Raw>();
+		EXPECT_TRUE(raw.Equals(nQ1, TypeParam(2e-3)));
+
+		EXPECT_EQ(q1.template GetNormalized<Maths::InvSqrtPrecision::Exact>(), nQ1);
+	}
+
 	TYPED_TEST(QuaternionTest, Inverse)
 	{
 		QuatT q1 = QuatT(TypeParam{ 63.21 }, TypeParam{ 12.365 }, TypeParam{ 9.155 }, TypeParam{ 22.362 }).Normalize();
@@ -348,6 +368,206 @@ namespace SA::UT::Quaternion
 		EXPECT_QUAT_NEAR(QuatT::SLerp(q1, q2, 0.5f), slerp_res05, 0.000001);
 	}
 
+	/// Structure-Of-Arrays quaternions for batch tests.
+	template <typename T>
+	struct QuatSoA
+	{
+		std::vector<T> w;
+		std::vector<T> x;
+		std::vector<T> y;
+		std::vector<T> z;
+
+		explicit QuatSoA(size_t _num) : w(_num), x(_num), y(_num), z(_num)
+		{
+		}
+
+		Quat<T> Get(size_t _i) const
+		{
+			return Quat<T>(w[_i], x[_i], y[_i], z[_i]);
+		}
+
+		void Set(size_t _i, const Quat<T>& _q)
+		{
+			w[_i] = _q.w;
+			x[_i] = _q.x;
+			y[_i] = _q.y;
+			z[_i] = _q.z;
+		}
+	};
+
+	/**
+	*	Shortest path (s)lerp reference in long double.
+	*	angle = 2 * atan2(|s - e|, |s + e|): accurate for close quaternions.
+	*/
+	template <typename T>
+	void LerpBatchReference(const Quat<T>& _start, const Quat<T>& _end, float _alpha, bool _bSpherical, long double (&_out)[4])
+	{
+		const long double s[4] = { _start.w, _start.x, _start.y, _start.z };
+		long double e[4] = { _end.w, _end.x, _end.y, _end.z };
+
+		if (s[0] * e[0] + s[1] * e[1] + s[2] * e[2] + s[3] * e[3] < 0.0l)
+		{
+			for (long double& comp : e)
+				comp = -comp;
+		}
+
+		const long double alpha = _alpha;
+
+		long double wStart = 1.0l - alpha;
+		long double wEnd = alpha;
+
+		if (_bSpherical)
+		{
+			long double sqrDiff = 0.0l;
+			long double sqrSum = 0.0l;
+
+			for (int c = 0; c < 4; ++c)
+			{
+				sqrDiff += (s[c] - e[c]) * (s[c] - e[c]);
+				sqrSum += (s[c] + e[c]) * (s[c] + e[c]);
+			}
+
+			const long double angle = 2.0l * std::atan2(std::sqrt(sqrDiff), std::sqrt(sqrSum));
+
+			if (angle > 0.0l)
+			{
+				wStart = std::sin((1.0l - alpha) * angle) / std::sin(angle);
+				wEnd = std::sin(alpha * angle) / std::sin(angle);
+			}
+		}
+
+		long double sqrLen = 0.0l;
+
+		for (int c = 0; c < 4; ++c)
+		{
+			_out[c] = wStart * s[c] + wEnd * e[c];
+			sqrLen += _out[c] * _out[c];
+		}
+
+		for (long double& comp : _out)
+			comp /= std::sqrt(sqrLen);
+	}
+
+	TYPED_TEST(QuaternionTest, LerpBatch)
+	{
+		using T = TypeParam;
+
+		std::mt19937 gen(42u);
+		std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+		const auto randQuat = [&]()
+		{
+			return Quat<T>(T(dist(gen)), T(dist(gen)), T(dist(gen)), T(dist(gen))).GetNormalized();
+		};
+
+		// Odd count: exercise batch tail.
+		constexpr size_t num = 1001u;
+
+		QuatSoA<T> start(num);
+		QuatSoA<T> end(num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			const Quat<T> qStart = randQuat();
+			Quat<T> qEnd;
+
+			switch (i % 5u)
+			{
+				case 0u:	// Random angle.
+				case 1u:
+					qEnd = randQuat();
+					break;
+				case 2u:	// Close to start, up to small angles.
+					qEnd = (qStart + randQuat() * static_cast<T>(std::pow(10.0, -static_cast<double>(i % 8u)))).GetNormalized();
+					break;
+				case 3u:	// Opposite hemisphere.
+					qEnd = -(qStart + randQuat() * T(0.5)).GetNormalized();
+					break;
+				default:	// Same rotation.
+					qEnd = i % 2u ? qStart : -qStart;
+					break;
+			}
+
+			start.Set(i, qStart);
+			end.Set(i, qEnd);
+		}
+
+		const auto check = [&](auto _batch, bool _bSpherical, double _eps)
+		{
+			for (float alpha : { 0.0f, 0.25f, 0.5f, 0.8f, 1.0f })
+			{
+				QuatSoA<T> out(num);
+				_batch(start, end, out, alpha);
+
+				double maxErr = 0.0;
+
+				for (size_t i = 0; i < num; ++i)
+				{
+					long double ref[4];
+					LerpBatchReference(start.Get(i), end.Get(i), alpha, _bSpherical, ref);
+
+					const Quat<T> res = out.Get(i);
+
+					const T comps[4] = { res.w, res.x, res.y, res.z };
+
+					for (int c = 0; c < 4; ++c)
+					{
+						const double err = static_cast<double>(std::abs(comps[c] - ref[c]));
+
+						// NaN must fail the check.
+						maxErr = std::isnan(err) ? std::numeric_limits<double>::infinity() : std::max(maxErr, err);
+					}
+				}
+
+				EXPECT_LE(maxErr, _eps) << "alpha: " << alpha;
+			}
+		};
+
+		const auto nlerp = [](const QuatSoA<T>& _s, const QuatSoA<T>& _e, QuatSoA<T>& _o, float _alpha)
+		{
+			QuatT::NLerpBatch(_s.w.data(), _s.x.data(), _s.y.data(), _s.z.data(), _e.w.data(), _e.x.data(), _e.y.data(), _e.z.data(),
+				_o.w.data(), _o.x.data(), _o.y.data(), _o.z.data(), _alpha, _o.w.size());
+		};
+
+		const auto slerp = [](const QuatSoA<T>& _s, const QuatSoA<T>& _e, QuatSoA<T>& _o, float _alpha)
+		{
+			QuatT::SLerpBatch(_s.w.data(), _s.x.data(), _s.y.data(), _s.z.data(), _e.w.data(), _e.x.data(), _e.y.data(), _e.z.data(),
+				_o.w.data(), _o.x.data(), _o.y.data(), _o.z.data(), _alpha, _o.w.size());
+		};
+
+		const auto slerpApprox = [](const QuatSoA<T>& _s, const QuatSoA<T>& _e, QuatSoA<T>& _o, float _alpha)
+		{
+			QuatT::template SLerpBatch<Maths::SLerpPrecision::Approx>(_s.w.data(), _s.x.data(), _s.y.data(), _s.z.data(),
+				_e.w.data(), _e.x.data(), _e.y.data(), _e.z.data(), _o.w.data(), _o.x.data(), _o.y.data(), _o.z.data(), _alpha, _o.w.size());
+		};
+
+		const bool bFloat = std::is_same_v<T, float>;
+
+		check(nlerp, false, bFloat ? 1e-6 : 1e-14);
+		check(slerp, true, bFloat ? 1e-6 : 1e-14);
+		check(slerpApprox, true, 1e-4);
+
+		// Single SLerp.
+		const QuatT q1 = start.Get(0);
+		const QuatT q2 = end.Get(0);
+
+		QuatSoA<T> single(1u);
+		slerp(start, end, single, 0.3f);
+		EXPECT_QUAT_NEAR(single.Get(0), QuatT::SLerp(q1, q2, 0.3f), bFloat ? 1e-6 : 1e-12);
+
+		// In place.
+		QuatSoA<T> inPlace = start;
+		QuatSoA<T> out(num);
+
+		slerp(start, end, out, 0.6f);
+		slerp(inPlace, end, inPlace, 0.6f);
+
+		EXPECT_EQ(inPlace.w, out.w);
+		EXPECT_EQ(inPlace.x, out.x);
+		EXPECT_EQ(inPlace.y, out.y);
+		EXPECT_EQ(inPlace.z, out.z);
+	}
+
 	TYPED_TEST(QuaternionTest, Operators)
 	{
 		const QuatT q1(TypeParam{ 66.25 }, TypeParam{ 5.23 }, TypeParam{ 12.36 }, TypeParam{ -96.31 });
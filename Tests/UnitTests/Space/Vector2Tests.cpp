@@ -126,6 +126,23 @@ namespace SA::UT::Vector2
 		EXPECT_EQ(v1, nV1);
 	}
 
+	TYPED_TEST(Vector2Test, NormalizeFast)
+	{
+		const Vec2T v1(TypeParam{ 12.365 }, TypeParam{ 9.155 });
+		const Vec2T nV1 = v1.GetNormalized();
+
+		const Vec2T newton = v1.template GetNormalized<Maths::InvSqrtPrecision::Newton>();
+		EXPECT_NEAR(newton.x, nV1.x, TypeParam(5e-6));
+		EXPECT_NEAR(newton.y, nV1.y, TypeParam(5e-6));
+
+		Vec2T raw = v1;
+		raw.template Normalize<Maths::InvSqrtPrecision::Raw>();
+		EXPECT_NEAR(raw.x, nV1.x, TypeParam(2e-3));
+		EXPECT_NEAR(raw.y, nV1.y, TypeParam(2e-3));
+
+		EXPECT_EQ(v1.template GetNormalized<Maths::InvSqrtPrecision::Exact>(), nV1);
+	}
+
 	TYPED_TEST(Vector2Test, Projection)
 	{
 		// Reflect
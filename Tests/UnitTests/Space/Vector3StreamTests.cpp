@@ -0,0 +1,215 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include "Vector3Tests.hpp"
+
+#include <vector>
+
+#include <SA/Maths/Space/Vector3Stream.hpp>
+
+namespace SA::UT::Vector3Stream
+{
+	template <typename T>
+	class Vector3StreamTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(Vector3StreamTest, TestTypes);
+
+	/// Odd size to cover both SIMD packs and scalar tail.
+	static constexpr size_t num = 37u;
+
+	template <typename T>
+	std::vector<Vec3<T>> MakeVecs(T _offset)
+	{
+		std::vector<Vec3<T>> vecs(num);
+
+		for (size_t i = 0; i < num; ++i)
+			vecs[i] = Vec3<T>(T(i) + _offset, T(2) * T(i) - _offset, T(3) - T(i) * _offset);
+
+		return vecs;
+	}
+
+	TYPED_TEST(Vector3StreamTest, Constructors)
+	{
+		const Vec3Stream<TypeParam> s0;
+		EXPECT_EQ(s0.Size(), 0u);
+		EXPECT_TRUE(s0.IsEmpty());
+
+		const Vec3Stream<TypeParam> s1(num);
+		EXPECT_EQ(s1.Size(), num);
+		EXPECT_GE(s1.Capacity(), num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s1.Get(i), Vec3T::Zero, 0);
+
+		// Component arrays alignment.
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(s1.X()) % Vec3Stream<TypeParam>::Alignment, 0u);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(s1.Y()) % Vec3Stream<TypeParam>::Alignment, 0u);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(s1.Z()) % Vec3Stream<TypeParam>::Alignment, 0u);
+
+		const std::vector<Vec3T> vecs = MakeVecs<TypeParam>(TypeParam(0.5));
+		const Vec3Stream<TypeParam> s2(vecs.data(), num);
+
+		Vec3Stream<TypeParam> s3(s2);
+		ASSERT_EQ(s3.Size(), num);
+
+		const Vec3Stream<TypeParam> s4(std::move(s3));
+		ASSERT_EQ(s4.Size(), num);
+		EXPECT_EQ(s3.Size(), 0u);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s4.Get(i), vecs[i], 0);
+	}
+
+	TYPED_TEST(Vector3StreamTest, Size)
+	{
+		Vec3Stream<TypeParam> s;
+
+		for (size_t i = 0; i < num; ++i)
+			s.Push(Vec3T(TypeParam(i)));
+
+		ASSERT_EQ(s.Size(), num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), Vec3T(TypeParam(i)), 0);
+
+		// Content is kept on reallocation.
+		s.Reserve(num * 4u);
+		EXPECT_GE(s.Capacity(), num * 4u);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), Vec3T(TypeParam(i)), 0);
+
+		s.Set(3u, Vec3T(1, 2, 3));
+		EXPECT_VEC3_NEAR(s.Get(3u), Vec3T(1, 2, 3), 0);
+
+		s.Clear();
+		EXPECT_TRUE(s.IsEmpty());
+	}
+
+	TYPED_TEST(Vector3StreamTest, GatherScatter)
+	{
+		const std::vector<Vec3T> vecs = MakeVecs<TypeParam>(TypeParam(1.5));
+
+		Vec3Stream<TypeParam> s;
+		s.Gather(vecs.data(), num);
+
+		ASSERT_EQ(s.Size(), num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			EXPECT_EQ(s.X()[i], vecs[i].x);
+			EXPECT_EQ(s.Y()[i], vecs[i].y);
+			EXPECT_EQ(s.Z()[i], vecs[i].z);
+		}
+
+		std::vector<Vec3T> out(num);
+		s.Scatter(out.data());
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(out[i], vecs[i], 0);
+	}
+
+	TYPED_TEST(Vector3StreamTest, Normalize)
+	{
+		const std::vector<Vec3T> vecs = MakeVecs<TypeParam>(TypeParam(1.5));
+
+		Vec3Stream<TypeParam> s(vecs.data(), num);
+		s.Normalize();
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), vecs[i].GetNormalized(), 0.00001);
+	}
+
+	TYPED_TEST(Vector3StreamTest, DotCross)
+	{
+		const std::vector<Vec3T> lVecs = MakeVecs<TypeParam>(TypeParam(1.5));
+		const std::vector<Vec3T> rVecs = MakeVecs<TypeParam>(TypeParam(-4.25));
+
+		const Vec3Stream<TypeParam> lhs(lVecs.data(), num);
+		const Vec3Stream<TypeParam> rhs(rVecs.data(), num);
+
+		std::vector<TypeParam> dots(num);
+		Vec3Stream<TypeParam>::Dot(lhs, rhs, dots.data());
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_NEAR(dots[i], Vec3T::Dot(lVecs[i], rVecs[i]), 0.0001);
+
+		Vec3Stream<TypeParam> cross;
+		Vec3Stream<TypeParam>::Cross(lhs, rhs, cross);
+
+		ASSERT_EQ(cross.Size(), num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(cross.Get(i), Vec3T::Cross(lVecs[i], rVecs[i]), 0.0001);
+	}
+
+	TYPED_TEST(Vector3StreamTest, Dist)
+	{
+		const std::vector<Vec3T> sVecs = MakeVecs<TypeParam>(TypeParam(1.5));
+		const std::vector<Vec3T> eVecs = MakeVecs<TypeParam>(TypeParam(-4.25));
+
+		const Vec3Stream<TypeParam> start(sVecs.data(), num);
+		const Vec3Stream<TypeParam> end(eVecs.data(), num);
+
+		std::vector<TypeParam> dists(num);
+		Vec3Stream<TypeParam>::Dist(start, end, dists.data());
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_NEAR(dists[i], Vec3T::Dist(sVecs[i], eVecs[i]), 0.0001);
+	}
+
+	TYPED_TEST(Vector3StreamTest, Lerp)
+	{
+		const std::vector<Vec3T> sVecs = MakeVecs<TypeParam>(TypeParam(1.5));
+		const std::vector<Vec3T> eVecs = MakeVecs<TypeParam>(TypeParam(-4.25));
+
+		const Vec3Stream<TypeParam> start(sVecs.data(), num);
+		const Vec3Stream<TypeParam> end(eVecs.data(), num);
+
+		Vec3Stream<TypeParam> out;
+
+		Vec3Stream<TypeParam>::Lerp(start, end, 0.35f, out);
+		ASSERT_EQ(out.Size(), num);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(out.Get(i), Vec3T::Lerp(sVecs[i], eVecs[i], 0.35f), 0.0001);
+
+		Vec3Stream<TypeParam>::LerpUnclamped(start, end, -1.5f, out);
+
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(out.Get(i), Vec3T::LerpUnclamped(sVecs[i], eVecs[i], -1.5f), 0.0001);
+	}
+
+	TYPED_TEST(Vector3StreamTest, Operators)
+	{
+		const std::vector<Vec3T> lVecs = MakeVecs<TypeParam>(TypeParam(1.5));
+		const std::vector<Vec3T> rVecs = MakeVecs<TypeParam>(TypeParam(-4.25));
+
+		const Vec3Stream<TypeParam> rhs(rVecs.data(), num);
+
+		Vec3Stream<TypeParam> s(lVecs.data(), num);
+
+		s += rhs;
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), lVecs[i] + rVecs[i], 0.0001);
+
+		s -= rhs;
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), lVecs[i], 0.0001);
+
+		const Vec3T offset(2.5, -1.0, 4.0);
+		s += offset;
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), lVecs[i] + offset, 0.0001);
+
+		s *= TypeParam(3.0);
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), (lVecs[i] + offset) * TypeParam(3.0), 0.0001);
+
+		s /= TypeParam(3.0);
+		for (size_t i = 0; i < num; ++i)
+			EXPECT_VEC3_NEAR(s.Get(i), lVecs[i] + offset, 0.0001);
+	}
+}
@@ -161,6 +161,25 @@ namespace SA::UT::Vector3
 		EXPECT_EQ(v1, nV1);
 	}
 
+	TYPED_TEST(Vector3Test, NormalizeFast)
+	{
+		const Vec3T v1(TypeParam{ 12.365 }, TypeParam{ 9.155 }, TypeParam{ 22.362 });
+		const Vec3T nV1 = v1.GetNormalized();
+
+		const Vec3T newton = v1.template GetNormalized<Maths::InvSqrtPrecision::Newton>();
+		EXPECT_NEAR(newton.x, nV1.x, TypeParam(5e-6));
+		EXPECT_NEAR(newton.y, nV1.y, TypeParam(5e-6));
+		EXPECT_NEAR(newton.z, nV1.z, TypeParam(5e-6));
+
+		Vec3T raw = v1;
+		raw.template Normalize<Maths::InvSqrtPrecision::Raw>();
+		EXPECT_NEAR(raw.x, nV1.x, TypeParam(2e-3));
+		EXPECT_NEAR(raw.y, nV1.y, TypeParam(2e-3));
+		EXPECT_NEAR(raw.z, nV1.z, TypeParam(2e-3));
+
+		EXPECT_EQ(v1.template GetNormalized<Maths::InvSqrtPrecision::Exact>(), nV1);
+	}
+
 	TYPED_TEST(Vector3Test, Projection)
 	{
 		// Reflect
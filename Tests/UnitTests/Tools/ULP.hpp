@@ -0,0 +1,87 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_MATHS_UT_ULP_GUARD
+#define SAPPHIRE_MATHS_UT_ULP_GUARD
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <iostream>
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace SA::UT
+{
+	/**
+	*	\brief Error of a float result in ULP (unit in the last place) of the exact value.
+	*
+	*	\param[in] _value		Computed float value.
+	*	\param[in] _exact		Reference value (computed in double).
+	*
+	*	\return error in float ULP.
+	*/
+	inline double ULPError(float _value, double _exact)
+	{
+		const float fExact = std::abs(static_cast<float>(_exact));
+		const double ulp = static_cast<double>(std::nextafter(fExact, std::numeric_limits<float>::infinity())) - fExact;
+
+		return std::abs(static_cast<double>(_value) - _exact) / ulp;
+	}
+
+
+	/// Deterministic precision test input: positive value in [0.5, 1.5[.
+	inline float PrecisionValue(size_t _index)
+	{
+		const double v = std::sin(static_cast<double>(_index) * 12.9898) * 43758.5453;
+
+		return static_cast<float>(0.5 + (v - std::floor(v)));
+	}
+
+
+	/// Max and mean ULP error accumulator.
+	struct ULPStats
+	{
+		double max = 0.0;
+		double sum = 0.0;
+		size_t num = 0u;
+
+		void Add(float _value, double _exact)
+		{
+			const double err = ULPError(_value, _exact);
+
+			max = std::max(max, err);
+			sum += err;
+			++num;
+		}
+
+		double Mean() const
+		{
+			return num ? sum / static_cast<double>(num) : 0.0;
+		}
+	};
+
+
+	/**
+	*	\brief Report ULP error of the library implementation compared to the scalar path.
+	*
+	*	Recorded as test properties (XML output) and printed.
+	*
+	*	\param[in] _name		Operation name.
+	*	\param[in] _impl		Library implementation error (SIMD / FMA when enabled).
+	*	\param[in] _scalar		Scalar path error.
+	*/
+	inline void ReportULP(const std::string& _name, const ULPStats& _impl, const ULPStats& _scalar)
+	{
+		testing::Test::RecordProperty(_name + "MaxULP", std::to_string(_impl.max));
+		testing::Test::RecordProperty(_name + "ScalarMaxULP", std::to_string(_scalar.max));
+
+		std::cout << "[   ULP    ] " << _name <<
+			": max " << _impl.max << " (scalar " << _scalar.max << ")" <<
+			", mean " << _impl.Mean() << " (scalar " << _scalar.Mean() << ")" << std::endl;
+	}
+}
+
+#endif // GUARD
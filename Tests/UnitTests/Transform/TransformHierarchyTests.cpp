@@ -0,0 +1,211 @@
+// Copyright (c) 2023 Sapphire development team. All Rights Reserved.
+
+#include <SA/Maths/Transform/TransformHierarchy.hpp>
+#include <SA/Maths/Dispatch/ThreadPool.hpp>
+
+#include "TransformTests.hpp"
+
+#include "../Matrix/Matrix4Tests.hpp"
+
+namespace SA::UT::TransformHierarchy
+{
+	template <typename T>
+	class TransformHierarchyTest : public testing::Test
+	{
+	};
+
+	using TestTypes = ::testing::Types<float, double>;
+	TYPED_TEST_SUITE(TransformHierarchyTest, TestTypes);
+
+	/// Reference world transform: walk parent chain.
+	template <typename T>
+	static TrPRS<T> ComputeWorld(const TrHierarchy<T>& _hierarchy, typename TrHierarchy<T>::Index _index)
+	{
+		TrPRS<T> world = _hierarchy.GetLocal(_index);
+
+		for (auto parent = _hierarchy.GetParent(_index); parent != TrHierarchy<T>::NoParent; parent = _hierarchy.GetParent(parent))
+			world = _hierarchy.GetLocal(parent) * world;
+
+		return world;
+	}
+
+	template <typename T>
+	static TrPRS<T> MakeLocal(uint32_t _i)
+	{
+		return TrPRS<T>{
+			Vec3<T>(T(_i % 7) * T(0.5), T(1) - T(_i % 3), T(_i % 5) * T(0.25)),
+			Quat<T>(Deg<T>(T(_i % 11) * T(15)), Vec3<T>(T(1), T(_i % 2), T(2)).GetNormalized()),
+			Vec3<T>(T(1) + T(_i % 4) * T(0.1), T(1), T(1) - T(_i % 3) * T(0.1))
+		};
+	}
+
+	/// Random-like hierarchy of _num nodes: parent of node i is any previous node (or root).
+	template <typename T>
+	static TrHierarchy<T> MakeHierarchy(uint32_t _num)
+	{
+		TrHierarchy<T> hierarchy;
+		hierarchy.Reserve(_num);
+
+		for (uint32_t i = 0; i < _num; ++i)
+		{
+			const uint32_t parent = i % 13 == 0 ? TrHierarchy<T>::NoParent : (i * 7919u) % i;
+			hierarchy.Add(MakeLocal<T>(i), parent);
+		}
+
+		return hierarchy;
+	}
+
+	template <typename T>
+	static void ExpectWorlds(const TrHierarchy<T>& _hierarchy)
+	{
+		for (uint32_t i = 0; i < _hierarchy.Size(); ++i)
+		{
+			const TrPRS<T> world = ComputeWorld(_hierarchy, i);
+
+			EXPECT_TR_NEAR(_hierarchy.GetWorld(i), world, T(0.0001));
+			EXPECT_MAT4_NEAR(_hierarchy.GetMatrix(i), world.Matrix(), T(0.0001));
+		}
+	}
+
+
+	TYPED_TEST(TransformHierarchyTest, Add)
+	{
+		using T = TypeParam;
+
+		TrHierarchy<T> hierarchy;
+		EXPECT_TRUE(hierarchy.IsEmpty());
+
+		const auto root = hierarchy.Add(MakeLocal<T>(1));
+		const auto child = hierarchy.Add(MakeLocal<T>(2), root);
+		const auto grandChild = hierarchy.Add(MakeLocal<T>(3), child);
+
+		EXPECT_EQ(hierarchy.Size(), 3u);
+		EXPECT_EQ(hierarchy.GetParent(root), TrHierarchy<T>::NoParent);
+		EXPECT_EQ(hierarchy.GetParent(child), root);
+		EXPECT_EQ(hierarchy.GetParent(grandChild), child);
+		EXPECT_EQ(hierarchy.GetLocal(child), MakeLocal<T>(2));
+
+		// New nodes are dirty.
+		EXPECT_TRUE(hierarchy.IsDirty(root));
+		EXPECT_TRUE(hierarchy.IsDirty(grandChild));
+
+		EXPECT_EQ(hierarchy.Update(), 3u);
+		EXPECT_FALSE(hierarchy.IsDirty(root));
+		EXPECT_FALSE(hierarchy.IsDirty(grandChild));
+
+		EXPECT_TR_NEAR(hierarchy.GetWorld(grandChild), MakeLocal<T>(1) * MakeLocal<T>(2) * MakeLocal<T>(3), T(0.0001));
+
+		hierarchy.Clear();
+		EXPECT_TRUE(hierarchy.IsEmpty());
+		EXPECT_EQ(hierarchy.Update(), 0u);
+	}
+
+	TYPED_TEST(TransformHierarchyTest, Update)
+	{
+		using T = TypeParam;
+
+		// > 64 nodes: multiple dirty words.
+		TrHierarchy<T> hierarchy = MakeHierarchy<T>(300u);
+
+		EXPECT_EQ(hierarchy.Update(), 300u);
+		ExpectWorlds(hierarchy);
+
+		// Nothing dirty.
+		EXPECT_EQ(hierarchy.Update(), 0u);
+	}
+
+	TYPED_TEST(TransformHierarchyTest, DirtySubtree)
+	{
+		using T = TypeParam;
+
+		TrHierarchy<T> hierarchy = MakeHierarchy<T>(300u);
+		hierarchy.Update();
+
+		// Modify one node: only its subtree is updated.
+		const uint32_t modified = 70u;
+
+		uint32_t subtreeSize = 0u;
+
+		for (uint32_t i = 0; i < hierarchy.Size(); ++i)
+		{
+			for (uint32_t curr = i; curr != TrHierarchy<T>::NoParent; curr = hierarchy.GetParent(curr))
+			{
+				if (curr == modified)
+				{
+					++subtreeSize;
+					break;
+				}
+			}
+		}
+
+		hierarchy.SetLocal(modified, MakeLocal<T>(1234u));
+
+		EXPECT_TRUE(hierarchy.IsDirty(modified));
+		EXPECT_EQ(hierarchy.Update(), subtreeSize);
+		ExpectWorlds(hierarchy);
+
+
+		// Multiple roots modified.
+		hierarchy.SetLocal(0u, MakeLocal<T>(42u));
+		hierarchy.SetLocal(299u, MakeLocal<T>(43u));
+		hierarchy.SetDirty(130u);
+
+		EXPECT_GT(hierarchy.Update(), 3u);
+		ExpectWorlds(hierarchy);
+	}
+
+	TYPED_TEST(TransformHierarchyTest, UpdateParallel)
+	{
+		using T = TypeParam;
+
+		// Large enough for levels to be split in tasks (ParallelMinNodeNum).
+		const uint32_t num = 20000u;
+
+		for (uint32_t threadNum : { 2u, 3u, 8u })
+		{
+			Maths::ThreadPool pool(threadNum);
+
+			TrHierarchy<T> serial = MakeHierarchy<T>(num);
+			TrHierarchy<T> parallel = MakeHierarchy<T>(num);
+
+			EXPECT_EQ(parallel.UpdateParallel(pool, pool.GetThreadNum()), serial.Update());
+
+			// Deterministic: identical to serial update.
+			for (uint32_t i = 0; i < serial.Size(); ++i)
+			{
+				EXPECT_TRUE(parallel.GetWorld(i).Equals(serial.GetWorld(i), T(0)));
+				EXPECT_TRUE(parallel.GetMatrix(i).Equals(serial.GetMatrix(i), T(0)));
+			}
+
+			EXPECT_EQ(parallel.UpdateParallel(pool, pool.GetThreadNum()), 0u);
+
+
+			// Dirty subtrees.
+			for (uint32_t i : { 5u, 70u, 500u, 999u })
+			{
+				serial.SetLocal(i, MakeLocal<T>(i + 1u));
+				parallel.SetLocal(i, MakeLocal<T>(i + 1u));
+			}
+
+			EXPECT_EQ(parallel.UpdateParallel(pool, pool.GetThreadNum()), serial.Update());
+			EXPECT_FALSE(parallel.IsDirty(70u));
+
+			for (uint32_t i = 0; i < serial.Size(); ++i)
+			{
+				EXPECT_TRUE(parallel.GetWorld(i).Equals(serial.GetWorld(i), T(0)));
+				EXPECT_TRUE(parallel.GetMatrix(i).Equals(serial.GetMatrix(i), T(0)));
+			}
+
+			ExpectWorlds(parallel);
+
+
+			// Topology change after levels build.
+			parallel.Add(MakeLocal<T>(3u), 999u);
+			serial.Add(MakeLocal<T>(3u), 999u);
+
+			EXPECT_EQ(parallel.UpdateParallel(pool, pool.GetThreadNum()), 1u);
+			EXPECT_EQ(serial.Update(), 1u);
+			EXPECT_TRUE(parallel.GetMatrix(num).Equals(serial.GetMatrix(num), T(0)));
+		}
+	}
+}
@@ -1,5 +1,9 @@
 // Copyright (c) 2023 Sapphire development team. All Rights Reserved.
 
+#include <vector>
+
+#include <SA/Maths/Transform/Functors/TransformTRSMatrixBatchFunctor.hpp>
+
 #include "TransformTests.hpp"
 
 #include "../Matrix/Matrix4Tests.hpp"
@@ -170,6 +174,53 @@ namespace SA::UT::Transform
 		EXPECT_EQ(trPRUS.Matrix(), matPRUS);
 	}
 
+	TYPED_TEST(TransformTest, TransformationMatrixBatch)
+	{
+		using T = TypeParam;
+
+		// Odd size to cover both SIMD packs and remaining elements.
+		constexpr size_t num = 37u;
+
+		std::vector<TrPRS<T>> trs(num);
+		std::vector<Vec3<T>> positions(num);
+		std::vector<Vec3<T>> scales(num);
+		std::vector<T> rw(num), rx(num), ry(num), rz(num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			trs[i].position = Vec3<T>(T(i) * T(1.5), T(3) - T(i), T(i % 5) * T(0.25));
+			trs[i].rotation = Quat<T>(Deg<T>(T(i) * T(17)), Vec3<T>(T(1), T(i % 3), T(2) - T(i % 4)).GetNormalized());
+			trs[i].scale = Vec3<T>(T(1) + T(i % 4) * T(0.5), T(0.5), T(2) - T(i % 3) * T(0.25));
+
+			positions[i] = trs[i].position;
+			scales[i] = trs[i].scale;
+			rw[i] = trs[i].rotation.w;
+			rx[i] = trs[i].rotation.x;
+			ry[i] = trs[i].rotation.y;
+			rz[i] = trs[i].rotation.z;
+		}
+
+		const Vec3Stream<T> posStream(positions.data(), num);
+		const Vec3Stream<T> scaleStream(scales.data(), num);
+
+		std::vector<Mat4<T, MatrixMajor::Row>> rMats(num);
+		std::vector<Mat4<T, MatrixMajor::Column>> cMats(num);
+
+		TrTRSMatrixBatchFunctor functor;
+		functor(posStream, rw.data(), rx.data(), ry.data(), rz.data(), scaleStream, rMats.data());
+		functor(posStream.X(), posStream.Y(), posStream.Z(), rw.data(), rx.data(), ry.data(), rz.data(),
+			scaleStream.X(), scaleStream.Y(), scaleStream.Z(), cMats.data(), num);
+
+		for (size_t i = 0; i < num; ++i)
+		{
+			const Mat4<T, MatrixMajor::Row> rMat = trs[i].Matrix();
+			const Mat4<T, MatrixMajor::Column> cMat = rMat;
+
+			EXPECT_MAT4_NEAR(rMats[i], rMat, T(0.00001));
+			EXPECT_MAT4_NEAR(cMats[i], cMat, T(0.00001));
+		}
+	}
+
 	TYPED_TEST(TransformTest, Lerp)
 	{
 		/** Values from QuaternionTests.cpp */